@@ -77,6 +77,9 @@ namespace hpx
         typedef local_vector_iterator<T> local_iterator;
         typedef const_local_vector_iterator<T> local_const_iterator;
 
+        local_raw_vector_iterator()
+        {}
+
         local_raw_vector_iterator(base_iterator const& it,
                 boost::shared_ptr<server::partitioned_vector<T> > const& data)
           : base_type(it), data_(data)
@@ -117,6 +120,9 @@ namespace hpx
         typedef const_local_vector_iterator<T> local_iterator;
         typedef const_local_vector_iterator<T> local_const_iterator;
 
+        const_local_raw_vector_iterator()
+        {}
+
         const_local_raw_vector_iterator(base_iterator const& it,
                 boost::shared_ptr<server::partitioned_vector<T> > const& data)
           : base_type(it), data_(data)
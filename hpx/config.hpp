@@ -175,6 +175,44 @@
 #  define HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE 1000000
 #endif
 
+/// This defines the maximal number of bytes the parcel buffer pool keeps
+/// cached in its shared free lists. This value can be changed at runtime by
+/// setting the configuration parameter:
+///
+///   hpx.parcel.buffer_pool.max_cached_bytes = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES).
+#if !defined(HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES)
+#  define HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES 268435456
+#endif
+
+/// This defines the size of the segments very large messages are split into
+/// if those are streamed (currently supported by the TCP parcelport only).
+/// This value can be changed at runtime by setting the configuration
+/// parameter:
+///
+///   hpx.parcel.tcp.streaming_segment_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_TCP_STREAMING_SEGMENT_SIZE).
+#if !defined(HPX_PARCEL_STREAMING_SEGMENT_SIZE)
+#  define HPX_PARCEL_STREAMING_SEGMENT_SIZE 1048576
+#endif
+
+/// This defines the minimal size of messages which are compressed if
+/// compression is enabled globally (see hpx.parcel.compression.filter).
+/// This value can be changed at runtime by setting the configuration
+/// parameter:
+///
+///   hpx.parcel.compression.threshold = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_COMPRESSION_THRESHOLD).
+#if !defined(HPX_PARCEL_COMPRESSION_THRESHOLD)
+#  define HPX_PARCEL_COMPRESSION_THRESHOLD 4096
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // This defines the number of bytes of overhead it takes to serialize a
 // parcel.
@@ -206,6 +244,26 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+/// This defines the time (in microseconds) after which pending decrements of
+/// global reference counts are sent to AGAS.
+#if !defined(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)
+#  define HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL 10000
+#endif
+
+/// This defines the number of entries of the table used to resolve the
+/// addresses of objects living on (and being managed by) the local locality
+/// without consulting AGAS (must be a power of two).
+#if !defined(HPX_INITIAL_AGAS_LOCAL_ADDRESS_TABLE_SIZE)
+#  define HPX_INITIAL_AGAS_LOCAL_ADDRESS_TABLE_SIZE 16384
+#endif
+
+/// This defines the number of localities each locality forwards the startup
+/// notifications to while bootstrapping AGAS (0: all localities are notified
+/// by the bootstrap locality).
+#if !defined(HPX_INITIAL_AGAS_BOOTSTRAP_FANOUT)
+#  define HPX_INITIAL_AGAS_BOOTSTRAP_FANOUT 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
@@ -0,0 +1,12 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_MERGE_NOV_18_2015)
+#define HPX_PARALLEL_MERGE_NOV_18_2015
+
+#include <hpx/parallel/algorithms/merge.hpp>
+
+#endif
+
@@ -0,0 +1,11 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_PARTITION_DEC_08_2015_0322PM)
+#define HPX_PARALLEL_PARTITION_DEC_08_2015_0322PM
+
+#include <hpx/parallel/algorithms/partition.hpp>
+
+#endif
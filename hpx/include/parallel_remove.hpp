@@ -0,0 +1,11 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_REMOVE_DEC_09_2015_1130AM)
+#define HPX_PARALLEL_REMOVE_DEC_09_2015_1130AM
+
+#include <hpx/parallel/algorithms/remove.hpp>
+
+#endif
@@ -0,0 +1,11 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SAMPLE_SORT_DEC_18_2015_1052AM)
+#define HPX_PARALLEL_SAMPLE_SORT_DEC_18_2015_1052AM
+
+#include <hpx/parallel/segmented_algorithms/sample_sort.hpp>
+
+#endif
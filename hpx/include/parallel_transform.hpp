@@ -8,6 +8,7 @@
 #define HPX_PARALLEL_TRANSFORM_JUN_28_2014_0827AM
 
 #include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/segmented_algorithms/transform.hpp>
 
 #endif
 
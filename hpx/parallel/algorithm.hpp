@@ -24,9 +24,15 @@
 #include <hpx/parallel/algorithms/is_partitioned.hpp>
 #include <hpx/parallel/algorithms/is_sorted.hpp>
 #include <hpx/parallel/algorithms/lexicographical_compare.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/algorithms/move.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/pipeline.hpp>
+#include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/algorithms/remove_copy.hpp>
 #include <hpx/parallel/algorithms/replace.hpp>
 #include <hpx/parallel/algorithms/reverse.hpp>
@@ -37,6 +43,9 @@
 #include <hpx/parallel/algorithms/set_symmetric_difference.hpp>
 #include <hpx/parallel/algorithms/set_union.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
 #include <hpx/parallel/algorithms/swap_ranges.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
 
 #endif
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_ALL_ANY_NONE_JUL_05_2014_0940PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/void_guard.hpp>
 #include <hpx/util/move.hpp>
 
@@ -26,6 +27,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 {
@@ -86,6 +88,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return none_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -161,14 +188,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::none_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::none_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -228,6 +254,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return any_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -303,14 +354,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::any_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::any_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -370,6 +420,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return all_of().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -445,14 +520,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::all_of().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::all_of_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 }}}
 
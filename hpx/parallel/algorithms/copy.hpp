@@ -16,7 +16,7 @@
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -359,14 +359,21 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 boost::shared_array<bool> flags(new bool[count]);
                 std::size_t init = 0;
 
+                // The elements are copied in a single pass over the data.
+                // The predicate is evaluated (and its result stored) while
+                // reducing a chunk only if the number of elements copied by
+                // the preceding chunks is not known yet (decoupled
+                // look-back).
+
                 using hpx::util::get;
                 using hpx::util::make_zip_iterator;
-                typedef util::scan_partitioner<ExPolicy, Iter, std::size_t>
-                    scan_partitioner_type;
+                typedef util::lookback_scan_partitioner<
+                        ExPolicy, Iter, std::size_t
+                    > scan_partitioner_type;
                 return scan_partitioner_type::call(
                     policy, make_zip_iterator(first, flags.get()),
                     count, init,
-                    // step 1 performs first part of scan algorithm
+                    // count the elements to copy in the chunk
                     [pred](zip_iterator part_begin, std::size_t part_size)
                         -> std::size_t
                     {
@@ -381,28 +388,45 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                             });
                         return curr;
                     },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    hpx::util::unwrapped(std::plus<std::size_t>()),
-                    // step 3 runs final accumulation on each partition
-                    [dest, flags](
+                    // combine the counts
+                    std::plus<std::size_t>(),
+                    // copy the elements of the chunk
+                    [pred, dest, flags](
                         zip_iterator part_begin, std::size_t part_size,
-                        hpx::shared_future<std::size_t> f_accu) mutable
+                        std::size_t prefix, bool reduced) -> std::size_t
                     {
-                        std::advance(dest, f_accu.get());
-                        util::loop_n(part_begin, part_size,
-                            [&dest](zip_iterator it) mutable
-                            {
-                                if(get<1>(*it))
-                                    *dest++ = get<0>(*it);
-                            });
+                        Iter out = dest;
+                        std::advance(out, prefix);
+                        if (reduced)
+                        {
+                            util::loop_n(part_begin, part_size,
+                                [&out, &prefix](zip_iterator it) mutable
+                                {
+                                    if(get<1>(*it))
+                                    {
+                                        *out++ = get<0>(*it);
+                                        ++prefix;
+                                    }
+                                });
+                        }
+                        else
+                        {
+                            util::loop_n(part_begin, part_size,
+                                [&pred, &out, &prefix](zip_iterator it) mutable
+                                {
+                                    if(pred(get<0>(*it)))
+                                    {
+                                        *out++ = get<0>(*it);
+                                        ++prefix;
+                                    }
+                                });
+                        }
+                        return prefix;
                     },
-                    // step 4 use this return value
-                    [dest, flags](
-                        std::vector<hpx::shared_future<std::size_t> > && items,
-                        std::vector<hpx::future<void> > &&) mutable -> Iter
+                    // use this return value
+                    [dest, flags](std::size_t total) mutable -> Iter
                     {
-                        std::advance(dest, items.back().get());
+                        std::advance(dest, total);
                         return dest;
                     });
             }
@@ -18,6 +18,7 @@
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/vector_loop.hpp>
 
 #include <boost/range/functions.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -65,18 +66,20 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         >::get(0);
                 }
 
+                typedef typename std::iterator_traits<Iter>::reference
+                    reference;
+
                 return util::partitioner<ExPolicy, difference_type>::call(
                     policy, first, std::distance(first, last),
                     [value](Iter part_begin, std::size_t part_size) -> difference_type
                     {
-                        difference_type ret = 0;
-                        util::loop_n(part_begin, part_size,
-                            [&value, &ret](Iter const& curr)
+                        return util::vector_accumulate_n<ExPolicy>(
+                            part_begin, part_size, difference_type(0),
+                            std::plus<difference_type>(),
+                            [&value](reference v) -> difference_type
                             {
-                                if (value == *curr)
-                                    ++ret;
+                                return (value == v) ? 1 : 0;
                             });
-                        return ret;
                     },
                     hpx::util::unwrapped(
                         [](std::vector<difference_type>&& results)
@@ -223,18 +226,20 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         >::get(0);
                 }
 
+                typedef typename std::iterator_traits<Iter>::reference
+                    reference;
+
                 return util::partitioner<ExPolicy, difference_type>::call(
                     policy, first, std::distance(first, last),
                     [op](Iter part_begin, std::size_t part_size) -> difference_type
                     {
-                        difference_type ret = 0;
-                        util::loop_n(part_begin, part_size,
-                            [&op, &ret](Iter const& curr)
+                        return util::vector_accumulate_n<ExPolicy>(
+                            part_begin, part_size, difference_type(0),
+                            std::plus<difference_type>(),
+                            [&op](reference v) -> difference_type
                             {
-                                if (op(*curr))
-                                    ++ret;
+                                return op(v) ? 1 : 0;
                             });
-                        return ret;
                     },
                     hpx::util::unwrapped(
                         [](std::vector<difference_type> && results)
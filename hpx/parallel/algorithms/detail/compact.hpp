@@ -0,0 +1,179 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_COMPACT_DEC_09_2015_1012AM)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_COMPACT_DEC_09_2015_1012AM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/zip_iterator.hpp>
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/executors/executor_information_traits.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+
+#include <boost/shared_array.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // Sequences shorter than this are moved back from the scratch buffer by
+    // a single task.
+    static const std::size_t compact_move_limit_per_task = 65536ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move the elements [buffer, buffer + count) to the sequence starting at
+    // dest. Returns the iterator referring to the element past the last one
+    // moved. This function has to be invoked on an HPX thread, it waits for
+    // the tasks it creates.
+    template <typename ExPolicy, typename BufIter, typename FwdIter>
+    FwdIter parallel_move_from_buffer(ExPolicy policy, BufIter buffer,
+        std::size_t count, FwdIter dest)
+    {
+        typedef typename ExPolicy::executor_type executor_type;
+        typedef typename hpx::parallel::executor_traits<executor_type>
+            executor_traits;
+        typedef typename hpx::parallel::executor_information_traits<
+                executor_type
+            > information_traits;
+
+        std::size_t const cores = information_traits::processing_units_count(
+            policy.executor(), policy.parameters());
+
+        std::size_t num_tasks =
+            (std::min)(cores, count / compact_move_limit_per_task);
+        if (num_tasks <= 1)
+        {
+            return std::move(buffer, buffer + count, dest);
+        }
+
+        std::size_t const task_size = (count + num_tasks - 1) / num_tasks;
+
+        std::vector<hpx::future<void> > workitems;
+        workitems.reserve(num_tasks);
+
+        for (std::size_t base = 0; base < count; base += task_size)
+        {
+            std::size_t const size = (std::min)(task_size, count - base);
+            BufIter part_begin = buffer + base;
+
+            workitems.push_back(executor_traits::async_execute(
+                policy.executor(),
+                [part_begin, size, dest]()
+                {
+                    std::move(part_begin, part_begin + size, dest);
+                }));
+
+            std::advance(dest, size);
+        }
+
+        hpx::wait_all(workitems);
+
+        std::list<boost::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+
+        return dest;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Remove all elements from the sequence [first, first + count) for which
+    // keep(it) returns false while preserving the order of the remaining
+    // elements. The remaining elements are stored starting at dest, which
+    // has to refer to the element referred to by first.
+    //
+    // The elements to keep are gathered in a scratch buffer in a single
+    // pass using the lookback scan partitioner and are moved back to dest
+    // afterwards. The function object elem(it) returns the element to store
+    // for the given iterator, it may return an lvalue if the elements of the
+    // sequence have to remain valid while they are being inspected.
+    template <typename ExPolicy, typename Iter, typename FwdIter,
+        typename Keep, typename Elem>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    parallel_compact(ExPolicy policy, Iter first, std::size_t count,
+        FwdIter dest, Keep && keep, Elem && elem)
+    {
+        typedef typename std::iterator_traits<FwdIter>::value_type value_type;
+        typedef hpx::util::zip_iterator<Iter, bool*> zip_iterator;
+        typedef typename hpx::util::decay<Keep>::type keep_type;
+        typedef typename hpx::util::decay<Elem>::type elem_type;
+
+        HPX_ASSERT(count != 0);
+
+        // the scratch buffer has to be kept alive until all tasks have
+        // finished
+        boost::shared_array<value_type> buffer(new value_type[count]);
+        boost::shared_array<bool> flags(new bool[count]);
+
+        keep_type keep_(std::forward<Keep>(keep));
+        elem_type elem_(std::forward<Elem>(elem));
+
+        using hpx::util::get;
+        typedef util::lookback_scan_partitioner<
+                ExPolicy, FwdIter, std::size_t
+            > scan_partitioner_type;
+        return scan_partitioner_type::call(
+            policy, hpx::util::make_zip_iterator(first, flags.get()),
+            count, std::size_t(0),
+            // count the elements to keep in the chunk
+            [keep_](zip_iterator part_begin, std::size_t part_size)
+                -> std::size_t
+            {
+                std::size_t curr = 0;
+                util::loop_n(part_begin, part_size,
+                    [&keep_, &curr](zip_iterator it) mutable
+                    {
+                        if ((get<1>(*it) =
+                                keep_(get<0>(it.get_iterator_tuple()))))
+                        {
+                            ++curr;
+                        }
+                    });
+                return curr;
+            },
+            // combine the counts
+            std::plus<std::size_t>(),
+            // gather the elements to keep in the scratch buffer
+            [keep_, elem_, buffer, flags](
+                zip_iterator part_begin, std::size_t part_size,
+                std::size_t prefix, bool reduced) -> std::size_t
+            {
+                value_type* out = buffer.get() + prefix;
+                util::loop_n(part_begin, part_size,
+                    [&](zip_iterator it) mutable
+                    {
+                        Iter curr = get<0>(it.get_iterator_tuple());
+                        if (reduced ? get<1>(*it) : keep_(curr))
+                        {
+                            *out++ = elem_(curr);
+                            ++prefix;
+                        }
+                    });
+                return prefix;
+            },
+            // move the elements back into the sequence
+            [policy, buffer, flags, dest](std::size_t total) -> FwdIter
+            {
+                return parallel_move_from_buffer(policy, buffer.get(),
+                    total, dest);
+            });
+    }
+
+    /// \endcond
+}}}}
+
+#endif
@@ -22,6 +22,7 @@
 #include <boost/mpl/bool.hpp>
 
 #include <string>
+#include <utility>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
 {
@@ -40,6 +41,32 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
         typedef void type;
     };
 
+    template <typename Iter1, typename Iter2>
+    struct local_algorithm_result<std::pair<Iter1, Iter2> >
+    {
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iter1
+            >::local_raw_iterator type1;
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iter2
+            >::local_raw_iterator type2;
+
+        typedef std::pair<type1, type2> type;
+    };
+
+    template <typename Iter1, typename Iter2>
+    struct local_algorithm_result<hpx::util::tuple<Iter1, Iter2> >
+    {
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iter1
+            >::local_raw_iterator type1;
+        typedef typename hpx::traits::segmented_local_iterator_traits<
+                Iter2
+            >::local_raw_iterator type2;
+
+        typedef hpx::util::tuple<type1, type2> type;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Derived, typename Result = void>
     struct algorithm
@@ -0,0 +1,204 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_PARALLEL_PARTITION_NOV_18_2015)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_PARALLEL_PARTITION_NOV_18_2015
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/executors/executor_information_traits.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // Sub-ranges shorter than this are partitioned by a single task.
+    static const std::size_t partition_limit_per_task = 65536ul;
+
+    struct partition_block
+    {
+        std::size_t first;
+        std::size_t count;
+    };
+
+    // Swap the elements with the indices [index, index + count) of the
+    // sequence of elements described by lhs with the corresponding elements
+    // described by rhs.
+    template <typename RandomIt>
+    void swap_partition_blocks(RandomIt first,
+        std::vector<partition_block> const& lhs,
+        std::vector<partition_block> const& rhs,
+        std::size_t index, std::size_t count)
+    {
+        std::size_t l = 0, l_offset = index;
+        while (l_offset >= lhs[l].count)
+            l_offset -= lhs[l++].count;
+
+        std::size_t r = 0, r_offset = index;
+        while (r_offset >= rhs[r].count)
+            r_offset -= rhs[r++].count;
+
+        while (count != 0)
+        {
+            std::size_t chunk = (std::min)(count,
+                (std::min)(lhs[l].count - l_offset, rhs[r].count - r_offset));
+
+            std::swap_ranges(
+                first + (lhs[l].first + l_offset),
+                first + (lhs[l].first + l_offset + chunk),
+                first + (rhs[r].first + r_offset));
+
+            count -= chunk;
+            if ((l_offset += chunk) == lhs[l].count)
+            {
+                ++l;
+                l_offset = 0;
+            }
+            if ((r_offset += chunk) == rhs[r].count)
+            {
+                ++r;
+                r_offset = 0;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reorder the elements of [first, last) such that all elements for which
+    // pred returns true precede the elements for which it returns false. The
+    // relative order of the elements is not preserved. Returns the iterator
+    // to the first element of the second group.
+    //
+    // The range is split into one chunk per core which are partitioned
+    // concurrently. Afterwards, all elements which ended up on the wrong side
+    // of the overall partition point are exchanged pairwise, again
+    // concurrently. This function has to be invoked on an HPX thread, it
+    // waits for the tasks it creates.
+    template <typename ExPolicy, typename RandomIt, typename Pred>
+    RandomIt parallel_partition(ExPolicy policy, RandomIt first,
+        RandomIt last, Pred pred)
+    {
+        typedef typename ExPolicy::executor_type executor_type;
+        typedef typename hpx::parallel::executor_traits<executor_type>
+            executor_traits;
+        typedef typename hpx::parallel::executor_information_traits<
+                executor_type
+            > information_traits;
+
+        std::size_t const count = std::size_t(last - first);
+        std::size_t const cores = information_traits::processing_units_count(
+            policy.executor(), policy.parameters());
+
+        std::size_t num_chunks =
+            (std::min)(cores, count / partition_limit_per_task);
+        if (num_chunks <= 1)
+            return std::partition(first, last, pred);
+
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+        num_chunks = (count + chunk_size - 1) / chunk_size;
+
+        // partition all chunks concurrently
+        std::vector<hpx::future<std::size_t> > workitems;
+        workitems.reserve(num_chunks);
+
+        for (std::size_t base = 0; base < count; base += chunk_size)
+        {
+            RandomIt part_begin = first + base;
+            RandomIt part_end = first + (std::min)(base + chunk_size, count);
+
+            workitems.push_back(executor_traits::async_execute(
+                policy.executor(),
+                [part_begin, part_end, pred]() -> std::size_t
+                {
+                    return std::size_t(
+                        std::partition(part_begin, part_end, pred) -
+                            part_begin);
+                }));
+        }
+
+        hpx::wait_all(workitems);
+
+        std::list<boost::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+
+        std::vector<std::size_t> true_counts;
+        true_counts.reserve(num_chunks);
+
+        std::size_t split = 0;
+        for (hpx::future<std::size_t>& f : workitems)
+        {
+            true_counts.push_back(f.get());
+            split += true_counts.back();
+        }
+
+        // collect the elements which are on the wrong side of the split point
+        std::vector<partition_block> misplaced_false, misplaced_true;
+        std::size_t misplaced = 0;
+
+        for (std::size_t i = 0; i != num_chunks; ++i)
+        {
+            std::size_t const base = i * chunk_size;
+            std::size_t const end = (std::min)(base + chunk_size, count);
+            std::size_t const middle = base + true_counts[i];
+
+            std::size_t const false_end = (std::min)(end, split);
+            if (middle < false_end)
+            {
+                partition_block b = { middle, false_end - middle };
+                misplaced_false.push_back(b);
+                misplaced += b.count;
+            }
+
+            std::size_t const true_begin = (std::max)(base, split);
+            if (true_begin < middle)
+            {
+                partition_block b = { true_begin, middle - true_begin };
+                misplaced_true.push_back(b);
+            }
+        }
+
+        if (misplaced == 0)
+            return first + split;
+
+        // exchange the misplaced elements concurrently
+        std::size_t num_tasks = (std::min)(num_chunks,
+            (misplaced + partition_limit_per_task - 1) /
+                partition_limit_per_task);
+        std::size_t const task_size = (misplaced + num_tasks - 1) / num_tasks;
+
+        std::vector<hpx::future<void> > swaps;
+        swaps.reserve(num_tasks);
+
+        for (std::size_t index = 0; index < misplaced; index += task_size)
+        {
+            std::size_t const size = (std::min)(task_size, misplaced - index);
+            swaps.push_back(executor_traits::async_execute(
+                policy.executor(),
+                [&, index, size]()
+                {
+                    swap_partition_blocks(first, misplaced_false,
+                        misplaced_true, index, size);
+                }));
+        }
+
+        hpx::wait_all(swaps);
+        util::detail::handle_local_exceptions<ExPolicy>::call(swaps, errors);
+
+        return first + split;
+    }
+
+    /// \endcond
+}}}}
+
+#endif
@@ -0,0 +1,455 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_NOV_25_2015)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_NOV_25_2015
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/unused.hpp>
+#include <hpx/util/unwrapped.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/scoped_array.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // Ranges shorter than this are sorted using a comparison based sort.
+    static const std::size_t radix_sort_limit = 262144ul;
+
+    // Every pass of the radix sort handles one digit of this many bits.
+    static const std::size_t radix_sort_bits = 8;
+    static const std::size_t radix_sort_buckets = 1ul << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map arithmetic values onto unsigned integers of the same size such that
+    // the order of the resulting keys matches the order of the values.
+    template <typename T, typename Enable = void>
+    struct radix_key
+    {
+        typedef void type;      // not supported
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value
+        >::type>
+    {
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type call(T value)
+        {
+            // flip the sign bit of signed values
+            return std::is_signed<T>::value ?
+                type(type(value) ^ (type(1) << (sizeof(T) * CHAR_BIT - 1))) :
+                type(value);
+        }
+    };
+
+    template <typename T, typename Key>
+    struct radix_floating_point_key
+    {
+        static_assert(sizeof(T) == sizeof(Key),
+            "the size of the key has to match the size of the value");
+
+        typedef Key type;
+
+        static type call(T value)
+        {
+            type key;
+            std::memcpy(&key, &value, sizeof(key));
+
+            // negative values are ordered in reverse
+            type const sign_bit = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (key & sign_bit) ? type(~key) : type(key | sign_bit);
+        }
+    };
+
+    template <>
+    struct radix_key<float>
+      : radix_floating_point_key<float, boost::uint32_t>
+    {};
+
+    template <>
+    struct radix_key<double>
+      : radix_floating_point_key<double, boost::uint64_t>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort is used instead of a comparison based sort if the
+    // values are arithmetic, no projection is applied, and the values are
+    // ordered using std::less.
+    template <typename T, typename Compare>
+    struct is_radix_sort_compare
+      : std::is_same<Compare, std::less<T> >
+    {};
+
+#if defined(__cpp_lib_transparent_operators)
+    template <typename T>
+    struct is_radix_sort_compare<T, std::less<> >
+      : std::true_type
+    {};
+#endif
+
+    template <typename T, typename Compare,
+        typename Proj = util::projection_identity>
+    struct is_radix_sortable
+      : std::integral_constant<bool,
+            !std::is_void<typename radix_key<T>::type>::value &&
+            is_radix_sort_compare<T,
+                typename hpx::util::decay<Compare>::type
+            >::value &&
+            std::is_same<
+                typename hpx::util::decay<Proj>::type,
+                util::projection_identity
+            >::value>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Placeholder for the values if only keys are sorted.
+    struct radix_no_values
+    {
+        radix_no_values operator+(std::size_t) const
+        {
+            return radix_no_values();
+        }
+    };
+
+    inline void radix_move_value(radix_no_values, std::size_t,
+        radix_no_values, std::size_t)
+    {}
+
+    template <typename SrcIt, typename DestIt>
+    void radix_move_value(SrcIt src, std::size_t src_index,
+        DestIt dest, std::size_t dest_index)
+    {
+        dest[dest_index] = std::move(src[src_index]);
+    }
+
+    inline void radix_move_values(radix_no_values, radix_no_values,
+        std::size_t)
+    {}
+
+    template <typename SrcIt, typename DestIt>
+    void radix_move_values(SrcIt src, DestIt dest, std::size_t count)
+    {
+        std::move(src, src + count, dest);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Temporary storage for the elements while they are scattered. The
+    // memory of trivial element types is not touched on allocation, it is
+    // initialized by the tasks working on the corresponding part of the input
+    // sequence instead. This places the memory pages close to the cores
+    // accessing them (first touch policy).
+    template <typename T>
+    class radix_buffer
+    {
+    public:
+        explicit radix_buffer(std::size_t size)
+          : data_(new T[size])
+        {}
+
+        T* get() const { return data_.get(); }
+
+        void touch(std::size_t offset, std::size_t count)
+        {
+            touch(offset, count, std::is_trivial<T>());
+        }
+
+    private:
+        void touch(std::size_t offset, std::size_t count, std::true_type)
+        {
+            std::fill(data_.get() + offset, data_.get() + offset + count, T());
+        }
+
+        void touch(std::size_t, std::size_t, std::false_type)
+        {
+            // the elements were default constructed on allocation
+        }
+
+        boost::scoped_array<T> data_;
+    };
+
+    template <typename ValueIt>
+    struct radix_values_buffer
+      : radix_buffer<typename std::iterator_traits<ValueIt>::value_type>
+    {
+        explicit radix_values_buffer(std::size_t size)
+          : radix_values_buffer::radix_buffer(size)
+        {}
+    };
+
+    template <>
+    struct radix_values_buffer<radix_no_values>
+    {
+        explicit radix_values_buffer(std::size_t) {}
+
+        radix_no_values get() const { return radix_no_values(); }
+        void touch(std::size_t, std::size_t) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The partitioner returns a future for asynchronous execution policies,
+    // the radix sort waits for each of its steps to finish.
+    template <typename T>
+    T radix_get(T && t)
+    {
+        return std::move(t);
+    }
+
+    template <typename T>
+    T radix_get(hpx::future<T> && f)
+    {
+        return f.get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of elements per digit value in one chunk of the sequence.
+    // After the offsets are calculated, the counts are replaced with the
+    // index of the next element to be written for the digit value.
+    struct radix_histogram
+    {
+        std::size_t offset;
+        std::size_t count;
+        std::size_t buckets[radix_sort_buckets];
+    };
+
+    template <typename KeyIt>
+    std::size_t radix_digit(KeyIt keys, std::size_t index, std::size_t shift)
+    {
+        typedef typename std::iterator_traits<KeyIt>::value_type value_type;
+        return std::size_t(radix_key<value_type>::call(keys[index]) >> shift) &
+            (radix_sort_buckets - 1);
+    }
+
+    template <typename KeyIt>
+    radix_histogram radix_count(KeyIt keys, std::size_t offset,
+        std::size_t count, std::size_t shift)
+    {
+        radix_histogram h;
+        h.offset = offset;
+        h.count = count;
+        std::fill(h.buckets, h.buckets + radix_sort_buckets, std::size_t(0));
+
+        for (std::size_t i = offset; i != offset + count; ++i)
+            ++h.buckets[radix_digit(keys, i, shift)];
+
+        return h;
+    }
+
+    // Turn the per chunk histograms into the positions the elements of each
+    // chunk are scattered to. Returns false if all elements share the same
+    // digit value, in which case the pass can be skipped.
+    inline bool radix_compute_offsets(std::vector<radix_histogram>& chunks,
+        std::size_t count)
+    {
+        std::size_t base = 0;
+        for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+        {
+            std::size_t bucket_base = base;
+            for (radix_histogram& h : chunks)
+            {
+                std::size_t const n = h.buckets[b];
+                h.buckets[b] = base;
+                base += n;
+            }
+
+            if (base - bucket_base == count)
+                return false;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename KeyIt, typename SrcKeyIt>
+    std::vector<radix_histogram>
+    radix_histograms(ExPolicy policy, KeyIt first, std::size_t count,
+        SrcKeyIt src_keys, std::vector<std::size_t> const& chunk_sizes,
+        std::vector<std::size_t> const& chunk_indices, std::size_t shift)
+    {
+        typedef std::vector<radix_histogram> result_type;
+
+        return radix_get(
+            util::partitioner<ExPolicy, result_type, radix_histogram>::
+                call_with_data(
+                    policy, first, count,
+                    [=](std::size_t, KeyIt part_begin, std::size_t part_size)
+                    {
+                        return radix_count(src_keys,
+                            std::size_t(part_begin - first), part_size, shift);
+                    },
+                    hpx::util::unwrapped(
+                        [](result_type && chunks)
+                        {
+                            return std::move(chunks);
+                        }),
+                    chunk_sizes, chunk_indices));
+    }
+
+    template <typename ExPolicy, typename KeyIt, typename SrcKeyIt,
+        typename SrcValueIt, typename DestKeyIt, typename DestValueIt>
+    void radix_scatter(ExPolicy policy, KeyIt first, std::size_t count,
+        SrcKeyIt src_keys, SrcValueIt src_values,
+        DestKeyIt dest_keys, DestValueIt dest_values,
+        std::vector<radix_histogram>& chunks,
+        std::vector<std::size_t> const& chunk_sizes,
+        std::vector<std::size_t> const& chunk_indices, std::size_t shift)
+    {
+        radix_get(
+            util::partitioner<ExPolicy, hpx::util::unused_type, void>::
+                call_with_data(
+                    policy, first, count,
+                    [=, &chunks](std::size_t chunk, KeyIt, std::size_t)
+                    {
+                        radix_histogram& h = chunks[chunk];
+                        for (std::size_t i = h.offset;
+                             i != h.offset + h.count; ++i)
+                        {
+                            std::size_t const pos =
+                                h.buckets[radix_digit(src_keys, i, shift)]++;
+
+                            dest_keys[pos] = src_keys[i];
+                            radix_move_value(src_values, i, dest_values, pos);
+                        }
+                    },
+                    [](std::vector<hpx::future<void> > &&)
+                    {
+                        return hpx::util::unused;
+                    },
+                    chunk_sizes, chunk_indices));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the keys [first, first + count) using a least significant digit
+    // radix sort and apply the same permutation to the values if given. Each
+    // pass counts the digit values for every chunk of the sequence
+    // concurrently and scatters the elements of all chunks concurrently
+    // afterwards. This function has to be invoked on an HPX thread, it waits
+    // for the tasks it creates.
+    template <typename ExPolicy, typename KeyIt, typename ValueIt>
+    void radix_sort_thread(ExPolicy policy, KeyIt first, ValueIt values,
+        std::size_t count)
+    {
+        typedef typename std::iterator_traits<KeyIt>::value_type key_type;
+        typedef std::vector<radix_histogram> result_type;
+
+        radix_buffer<key_type> key_buffer(count);
+        radix_values_buffer<ValueIt> value_buffer(count);
+
+        // The first step establishes the chunks used by all passes.
+        result_type chunks = radix_get(
+            util::partitioner<ExPolicy, result_type, radix_histogram>::call(
+                policy, first, count,
+                [&](KeyIt part_begin, std::size_t part_size)
+                {
+                    std::size_t const offset =
+                        std::size_t(part_begin - first);
+
+                    key_buffer.touch(offset, part_size);
+                    value_buffer.touch(offset, part_size);
+
+                    return radix_count(first, offset, part_size, 0);
+                },
+                hpx::util::unwrapped(
+                    [](result_type && chunks)
+                    {
+                        return std::move(chunks);
+                    })));
+
+        std::vector<std::size_t> chunk_sizes, chunk_indices;
+        chunk_sizes.reserve(chunks.size());
+        chunk_indices.reserve(chunks.size());
+        for (radix_histogram const& h : chunks)
+        {
+            chunk_indices.push_back(chunk_sizes.size());
+            chunk_sizes.push_back(h.count);
+        }
+
+        typedef typename radix_key<key_type>::type radix_key_type;
+        std::size_t const passes =
+            sizeof(radix_key_type) * CHAR_BIT / radix_sort_bits;
+
+        bool in_buffer = false;
+        for (std::size_t pass = 0; pass != passes; ++pass)
+        {
+            std::size_t const shift = pass * radix_sort_bits;
+            if (pass != 0)
+            {
+                chunks = in_buffer ?
+                    radix_histograms(policy, first, count, key_buffer.get(),
+                        chunk_sizes, chunk_indices, shift) :
+                    radix_histograms(policy, first, count, first,
+                        chunk_sizes, chunk_indices, shift);
+            }
+
+            if (!radix_compute_offsets(chunks, count))
+                continue;
+
+            if (in_buffer)
+            {
+                radix_scatter(policy, first, count,
+                    key_buffer.get(), value_buffer.get(), first, values,
+                    chunks, chunk_sizes, chunk_indices, shift);
+            }
+            else
+            {
+                radix_scatter(policy, first, count,
+                    first, values, key_buffer.get(), value_buffer.get(),
+                    chunks, chunk_sizes, chunk_indices, shift);
+            }
+            in_buffer = !in_buffer;
+        }
+
+        if (!in_buffer)
+            return;
+
+        // move the sorted elements back into the input sequence
+        radix_get(
+            util::partitioner<ExPolicy, hpx::util::unused_type, void>::
+                call_with_data(
+                    policy, first, count,
+                    [&](std::size_t, KeyIt part_begin, std::size_t part_size)
+                    {
+                        std::size_t const offset =
+                            std::size_t(part_begin - first);
+
+                        std::copy(key_buffer.get() + offset,
+                            key_buffer.get() + offset + part_size,
+                            part_begin);
+                        radix_move_values(value_buffer.get() + offset,
+                            values + offset, part_size);
+                    },
+                    [](std::vector<hpx::future<void> > &&)
+                    {
+                        return hpx::util::unused;
+                    },
+                    chunk_sizes, chunk_indices));
+    }
+
+    /// \endcond
+}}}}
+
+#endif
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_EQUAL_JUL_06_2014_0848PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
@@ -26,6 +27,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 {
@@ -392,6 +394,36 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     });
             }
         };
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, F && f, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter1>::iterator_category
+                iterator_category1;
+            typedef typename std::iterator_traits<InIter2>::iterator_category
+                iterator_category2;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category1>,
+                boost::is_same<std::input_iterator_tag, iterator_category2>
+            >::type is_seq;
+
+            return equal().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first1, last1, first2, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, F && f, std::true_type);
+
         /// \endcond
     }
 
@@ -466,15 +498,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category2>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category1>,
-            boost::is_same<std::input_iterator_tag, iterator_category2>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter1>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::equal().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first1, last1, first2, detail::equal_to());
+        return detail::equal_(
+            std::forward<ExPolicy>(policy), first1, last1, first2,
+            detail::equal_to(), is_segmented());
     }
 
     /// Returns true if the range [first1, last1) is equal to the range
@@ -565,15 +595,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category2>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category1>,
-            boost::is_same<std::input_iterator_tag, iterator_category2>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter1>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::equal().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first1, last1, first2, std::forward<F>(f));
+        return detail::equal_(
+            std::forward<ExPolicy>(policy), first1, last1, first2,
+            std::forward<F>(f), is_segmented());
     }
 }}}
 
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_ALGORITHM_EXCLUSIVE_SCAN_DEC_30_2014_1236PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/unwrapped.hpp>
 #include <hpx/util/zip_iterator.hpp>
@@ -19,12 +20,13 @@
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -76,25 +78,28 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : exclusive_scan::algorithm("exclusive_scan")
             {}
 
-            template <typename ExPolicy, typename InIter, typename T, typename Op>
-            static OutIter
+            template <typename ExPolicy, typename InIter, typename OutIter_,
+                typename T, typename Op>
+            static OutIter_
             sequential(ExPolicy, InIter first, InIter last,
-                OutIter dest, T && init, Op && op)
+                OutIter_ dest, T && init, Op && op)
             {
                 return sequential_exclusive_scan(first, last, dest,
                     std::forward<T>(init), std::forward<Op>(op));
             }
 
-            template <typename ExPolicy, typename FwdIter, typename T, typename Op>
+            template <typename ExPolicy, typename FwdIter, typename OutIter_,
+                typename T, typename Op>
             static typename util::detail::algorithm_result<
-                ExPolicy, OutIter
+                ExPolicy, OutIter_
             >::type
             parallel(ExPolicy policy, FwdIter first, FwdIter last,
-                 OutIter dest, T && init, Op && op)
+                 OutIter_ dest, T const& init, Op && op)
             {
-                typedef util::detail::algorithm_result<ExPolicy, OutIter>
+                typedef util::detail::algorithm_result<ExPolicy, OutIter_>
                     result;
-                typedef hpx::util::zip_iterator<FwdIter, OutIter> zip_iterator;
+                typedef hpx::util::zip_iterator<FwdIter, OutIter_>
+                    zip_iterator;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -103,55 +108,82 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                 difference_type count = std::distance(first, last);
 
-                OutIter final_dest = dest;
+                OutIter_ final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 3
-                // steps. The first calculates the scan results for each
-                // partition. The second accumulates the result from left to
-                // right to be used by the third step--which operates on the
-                // same partitions the first step operated on.
+                // The scan is performed in a single pass over the data. Each
+                // chunk is reduced only if the prefix of its predecessor is
+                // not known yet (decoupled look-back), the final scan of the
+                // chunk is run while its elements are still in the cache.
 
                 using hpx::util::get;
                 using hpx::util::make_zip_iterator;
-                return util::scan_partitioner<ExPolicy, OutIter, T>::call(
-                    policy, make_zip_iterator(first, dest), count, init,
-                    // step 1 performs first part of scan algorithm
-                    [op](zip_iterator part_begin, std::size_t part_size) -> T
-                    {
-                        T part_init = get<0>(*part_begin++);
-                        return sequential_exclusive_scan_n(
-                            get<0>(part_begin.get_iterator_tuple()),
-                            part_size - 1,
-                            get<1>(part_begin.get_iterator_tuple()),
-                            part_init, op);
-                    },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    hpx::util::unwrapped(op),
-                    // step 3 runs final accumulation on each partition
-                    [op](zip_iterator part_begin, std::size_t part_size,
-                        hpx::shared_future<T> f_accu)
-                    {
-                        T val = f_accu.get();
-                        OutIter dst = get<1>(part_begin.get_iterator_tuple());
-                        *dst++ = val;
-                        // MSVC 2015 fails if op is captured by reference
-                        util::loop_n(dst, part_size - 1,
-                            [=, &val](OutIter it)
-                            {
-                                *it = op(*it, val);
-                            });
-                    },
-                    // step 4 use this return value
-                    [final_dest](std::vector<hpx::shared_future<T> > &&,
-                        std::vector<hpx::future<void> > &&)
-                    {
-                        return final_dest;
-                    });
+                typedef util::lookback_scan_partitioner<
+                        ExPolicy, OutIter_, T
+                    > scan_partitioner_type;
+                return scan_partitioner_type::
+                    call(policy, make_zip_iterator(first, dest), count, init,
+                        // reduce the chunk
+                        [op](zip_iterator part_begin, std::size_t part_size)
+                            -> T
+                        {
+                            FwdIter it = get<0>(part_begin.get_iterator_tuple());
+                            T part_init = *it++;
+                            return util::accumulate_n(it, part_size - 1,
+                                std::move(part_init), op);
+                        },
+                        // combine the chunk reductions
+                        op,
+                        // run the final scan on the chunk
+                        [op](zip_iterator part_begin, std::size_t part_size,
+                            T const& prefix, bool) -> T
+                        {
+                            return sequential_exclusive_scan_n(
+                                get<0>(part_begin.get_iterator_tuple()),
+                                part_size,
+                                get<1>(part_begin.get_iterator_tuple()),
+                                prefix, op);
+                        },
+                        // use this return value
+                        [final_dest](T const&)
+                        {
+                            return final_dest;
+                        });
 
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        exclusive_scan_(ExPolicy&& policy, InIter first, InIter last,
+            OutIter dest, T && init, Op && op, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+            typedef typename std::iterator_traits<OutIter>::iterator_category
+                output_iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category>
+            >::type is_seq;
+
+            return exclusive_scan<OutIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::forward<T>(init),
+                std::forward<Op>(op));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        exclusive_scan_(ExPolicy&& policy, InIter first, InIter last,
+            OutIter dest, T && init, Op && op, std::true_type);
+
         /// \endcond
     }
 
@@ -261,15 +293,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::exclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::forward<Op>(op));
+        return detail::exclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::forward<Op>(op), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -357,15 +387,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least output iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>,
-            boost::is_same<std::output_iterator_tag, output_iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::exclusive_scan<OutIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::move(init), std::plus<T>());
+        return detail::exclusive_scan_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::move(init), std::plus<T>(), is_segmented());
     }
 }}}
 
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_FILL_JUNE_12_2014_0405PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/void_guard.hpp>
 #include <hpx/util/move.hpp>
 
@@ -21,6 +22,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -68,6 +70,27 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, InIter first, InIter last, T const& value,
+            std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::fill().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, value);
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, InIter first, InIter last, T const& value,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -124,11 +147,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::fill().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, value);
+        return detail::fill_(
+            std::forward<ExPolicy>(policy), first, last, value,
+            is_segmented());
     }
     ///////////////////////////////////////////////////////////////////////////
     // fill_n
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_FIND_JULY_16_2014_0213PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -18,6 +19,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -36,23 +38,23 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 : find::algorithm("find")
             {}
 
-            template <typename ExPolicy, typename T>
-            static InIter
-            sequential(ExPolicy, InIter first, InIter last, const T& val)
+            template <typename ExPolicy, typename InIter_, typename T>
+            static InIter_
+            sequential(ExPolicy, InIter_ first, InIter_ last, const T& val)
             {
                 return std::find(first, last, val);
             }
 
-            template <typename ExPolicy, typename T>
+            template <typename ExPolicy, typename FwdIter, typename T>
             static typename util::detail::algorithm_result<
-                ExPolicy, InIter
+                ExPolicy, FwdIter
             >::type
-            parallel(ExPolicy policy, InIter first, InIter last,
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
                 T const& val)
             {
-                typedef util::detail::algorithm_result<ExPolicy, InIter> result;
-                typedef typename std::iterator_traits<InIter>::value_type type;
-                typedef typename std::iterator_traits<InIter>::difference_type
+                typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
+                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
                 difference_type count = std::distance(first, last);
@@ -61,10 +63,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 
                 util::cancellation_token<std::size_t> tok(count);
 
-                return util::partitioner<ExPolicy, InIter, void>::
+                return util::partitioner<ExPolicy, FwdIter, void>::
                     call_with_index(
                         policy, first, count,
-                        [val, tok](std::size_t base_idx, InIter it,
+                        [val, tok](std::size_t base_idx, FwdIter it,
                             std::size_t part_size) mutable
                         {
                             util::loop_idx_n(
@@ -75,7 +77,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                                         tok.cancel(i);
                                 });
                         },
-                        [=](std::vector<hpx::future<void> > &&) mutable -> InIter
+                        [=](std::vector<hpx::future<void> > &&) mutable -> FwdIter
                         {
                             difference_type find_res =
                                 static_cast<difference_type>(tok.get_data());
@@ -88,6 +90,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_(ExPolicy && policy, InIter first, InIter last, T const& val,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return find<InIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, val);
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_(ExPolicy && policy, InIter first, InIter last, T const& val,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -151,14 +178,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::find<InIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, val);
+        return detail::find_(
+            std::forward<ExPolicy>(policy), first, last, val,
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -173,9 +199,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 : find_if::algorithm("find_if")
             {}
 
-            template <typename ExPolicy, typename F>
-            static InIter
-            sequential(ExPolicy, InIter first, InIter last, F && f)
+            template <typename ExPolicy, typename InIter_, typename F>
+            static InIter_
+            sequential(ExPolicy, InIter_ first, InIter_ last, F && f)
             {
                 return std::find_if(first, last, f);
             }
@@ -187,8 +213,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             parallel(ExPolicy policy, FwdIter first, FwdIter last, F && f)
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
-                typedef typename std::iterator_traits<InIter>::value_type type;
-                typedef typename std::iterator_traits<InIter>::difference_type
+                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
                 difference_type count = std::distance(first, last);
@@ -224,6 +250,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return find_if<InIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -301,14 +352,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::find_if<InIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::find_if_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -323,9 +373,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 : find_if_not::algorithm("find_if_not")
             {}
 
-            template <typename ExPolicy, typename F>
-            static InIter
-            sequential(ExPolicy, InIter first, InIter last, F && f)
+            template <typename ExPolicy, typename InIter_, typename F>
+            static InIter_
+            sequential(ExPolicy, InIter_ first, InIter_ last, F && f)
             {
                 for (; first != last; ++first) {
                     if (!f(*first)) {
@@ -342,8 +392,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             parallel(ExPolicy policy, FwdIter first, FwdIter last, F && f)
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
-                typedef typename std::iterator_traits<InIter>::value_type type;
-                typedef typename std::iterator_traits<InIter>::difference_type
+                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
                 difference_type count = std::distance(first, last);
@@ -380,6 +430,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         });
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_not_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return find_if_not<InIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_not_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -457,14 +532,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::find_if_not<InIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::find_if_not_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
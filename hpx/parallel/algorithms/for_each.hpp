@@ -23,6 +23,7 @@
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/vector_loop.hpp>
 #include <hpx/parallel/traits/projected.hpp>
 
 #include <algorithm>
@@ -66,6 +67,9 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             parallel(ExPolicy policy, Iter first, std::size_t count,
                 F && f, Proj && proj = Proj())
             {
+                typedef typename std::iterator_traits<Iter>::reference
+                    reference;
+
                 if (count != 0)
                 {
                     return util::foreach_n_partitioner<ExPolicy>::call(
@@ -73,10 +77,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         [f, proj](Iter part_begin, std::size_t part_size)
                         {
                             // VS2015 bails out when proj ot f are captured by ref
-                            util::loop_n(part_begin, part_size,
-                                [=](Iter const& curr)
+                            util::vector_loop_n<ExPolicy>(part_begin, part_size,
+                                [=](reference curr)
                                 {
-                                    f(hpx::util::invoke(proj, *curr));
+                                    f(hpx::util::invoke(proj, curr));
                                 });
                         });
                 }
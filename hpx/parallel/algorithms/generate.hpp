@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_GENERATE_JULY_15_2014_0224PM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
@@ -17,6 +18,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -59,6 +61,27 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         });
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        generate_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::generate().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        generate_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::true_type);
+
         /// \endcond
     }
 
@@ -125,11 +148,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::generate().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::generate_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
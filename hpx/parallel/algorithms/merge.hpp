@@ -0,0 +1,543 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/merge.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_MERGE_NOV_18_2015)
+#define HPX_PARALLEL_ALGORITHM_MERGE_NOV_18_2015
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <boost/shared_array.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // merge
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        static const std::size_t merge_limit_per_task = 65536ul;
+
+        // Merge the sorted ranges [first1, last1) and [first2, last2) into
+        // the range starting at dest. The larger of the two input ranges is
+        // split at its middle element, the other one at the corresponding
+        // position found by a binary search. Both halves are merged by
+        // separate tasks. Elements from the first range precede equivalent
+        // elements from the second range.
+        template <typename ExPolicy, typename RandomIt1, typename RandomIt2,
+            typename OutIter, typename Compare>
+        hpx::future<void> parallel_merge(ExPolicy policy,
+            RandomIt1 first1, RandomIt1 last1,
+            RandomIt2 first2, RandomIt2 last2,
+            OutIter dest, Compare comp)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+
+            std::size_t const count1 = std::size_t(last1 - first1);
+            std::size_t const count2 = std::size_t(last2 - first2);
+
+            if (count1 + count2 <= merge_limit_per_task)
+            {
+                return executor_traits::async_execute(
+                    policy.executor(),
+                    [first1, last1, first2, last2, dest, comp]()
+                    {
+                        std::merge(first1, last1, first2, last2, dest, comp);
+                    });
+            }
+
+            RandomIt1 middle1;
+            RandomIt2 middle2;
+            if (count1 >= count2)
+            {
+                middle1 = first1 + (count1 >> 1);
+                middle2 = std::lower_bound(first2, last2, *middle1, comp);
+            }
+            else
+            {
+                middle2 = first2 + (count2 >> 1);
+                middle1 = std::upper_bound(first1, last1, *middle2, comp);
+            }
+
+            OutIter dest_middle =
+                dest + ((middle1 - first1) + (middle2 - first2));
+
+            typedef hpx::future<void> (*merge_function)(ExPolicy,
+                RandomIt1, RandomIt1, RandomIt2, RandomIt2, OutIter, Compare);
+            merge_function merge_part =
+                &parallel_merge<ExPolicy, RandomIt1, RandomIt2, OutIter,
+                    Compare>;
+
+            hpx::future<void> left =
+                executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(merge_part, policy,
+                        first1, middle1, first2, middle2, dest, comp));
+
+            hpx::future<void> right =
+                executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(merge_part, policy,
+                        middle1, last1, middle2, last2, dest_middle, comp));
+
+            return hpx::lcos::local::dataflow(&join_sort_tasks,
+                std::move(left), std::move(right));
+        }
+
+        // Move the elements of [first, last) to the range starting at dest,
+        // using one task per chunk of merge_limit_per_task elements.
+        template <typename ExPolicy, typename RandomIt, typename OutIter>
+        hpx::future<void> parallel_move_chunks(ExPolicy policy,
+            RandomIt first, RandomIt last, OutIter dest)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+
+            std::size_t const count = std::size_t(last - first);
+
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(count / merge_limit_per_task + 1);
+
+            for (std::size_t base = 0; base < count;
+                 base += merge_limit_per_task)
+            {
+                std::size_t const size =
+                    (std::min)(merge_limit_per_task, count - base);
+
+                RandomIt part_begin = first + base;
+                OutIter part_dest = dest + base;
+
+                workitems.push_back(executor_traits::async_execute(
+                    policy.executor(),
+                    [part_begin, size, part_dest]()
+                    {
+                        std::move(part_begin, part_begin + size, part_dest);
+                    }));
+            }
+
+            return hpx::lcos::local::dataflow(
+                [](std::vector<hpx::future<void> > && r)
+                {
+                    std::list<boost::exception_ptr> errors;
+                    util::detail::handle_local_exceptions<ExPolicy>::call(
+                        r, errors);
+                },
+                std::move(workitems));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename OutIter>
+        struct merge : public detail::algorithm<merge<OutIter>, OutIter>
+        {
+            merge()
+              : merge::algorithm("merge")
+            {}
+
+            template <typename ExPolicy, typename InIter1, typename InIter2,
+                typename Compare, typename Proj>
+            static OutIter
+            sequential(ExPolicy, InIter1 first1, InIter1 last1,
+                InIter2 first2, InIter2 last2, OutIter dest,
+                Compare && comp, Proj && proj)
+            {
+                return std::merge(first1, last1, first2, last2, dest,
+                    compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename RandomIt1,
+                typename RandomIt2, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, OutIter
+            >::type
+            parallel(ExPolicy policy, RandomIt1 first1, RandomIt1 last1,
+                RandomIt2 first2, RandomIt2 last2, OutIter dest,
+                Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, OutIter>
+                    result;
+
+                OutIter dest_last = dest + ((last1 - first1) + (last2 - first2));
+
+                hpx::future<void> f;
+                try {
+                    f = parallel_merge(policy, first1, last1, first2, last2,
+                        dest, compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    f = handle_sort_exception<ExPolicy>::call(
+                        boost::current_exception());
+                }
+
+                return result::get(f.then(
+                    [dest_last](hpx::future<void> && f) -> OutIter
+                    {
+                        if (f.has_exception())
+                        {
+                            handle_sort_exception<ExPolicy>::call(
+                                f.get_exception_ptr()).get();
+                        }
+                        return dest_last;
+                    }));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // inplace_merge
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<void>
+        parallel_inplace_merge_async(ExPolicy policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            try {
+                std::size_t const count = std::size_t(last - first);
+                if (first == middle || middle == last)
+                    return hpx::make_ready_future();
+
+                if (count <= merge_limit_per_task)
+                {
+                    std::inplace_merge(first, middle, last, comp);
+                    return hpx::make_ready_future();
+                }
+
+                // merge into a temporary buffer and move the result back
+                boost::shared_array<value_type> buffer(new value_type[count]);
+
+                return parallel_merge(policy,
+                        std::make_move_iterator(first),
+                        std::make_move_iterator(middle),
+                        std::make_move_iterator(middle),
+                        std::make_move_iterator(last),
+                        buffer.get(), comp)
+                    .then(
+                        [policy, buffer, count, first](hpx::future<void> && f)
+                            -> hpx::future<void>
+                        {
+                            f.get();        // rethrow exceptions
+                            return parallel_move_chunks(policy,
+                                buffer.get(), buffer.get() + count, first);
+                        })
+                    .then(
+                        [buffer](hpx::future<void> && f)
+                        {
+                            if (f.has_exception())
+                            {
+                                handle_sort_exception<ExPolicy>::call(
+                                    f.get_exception_ptr()).get();
+                            }
+                        });
+            }
+            catch (...) {
+                return handle_sort_exception<ExPolicy>::call(
+                    boost::current_exception());
+            }
+        }
+
+        template <typename RandomIt>
+        struct inplace_merge
+          : public detail::algorithm<inplace_merge<RandomIt>, void>
+        {
+            inplace_merge()
+              : inplace_merge::algorithm("inplace_merge")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::util::unused_type
+            sequential(ExPolicy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                std::inplace_merge(first, middle, last,
+                    compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    parallel_inplace_merge_async(policy, first, middle, last,
+                        compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Merges two sorted ranges [first1, last1) and [first2, last2) into one
+    /// sorted range beginning at \a dest. The order of equivalent elements is
+    /// preserved, elements from the first range precede equivalent elements
+    /// from the second range. The function uses the given comparison function
+    /// object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(N1 + N2) applications of the comparison function,
+    ///         where N1 = std::distance(first1, last1) and
+    ///         N2 = std::distance(first2, last2).
+    ///
+    /// The destination range must not overlap with either of the input
+    /// ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam InIter1     The type of the iterators of the first range
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of an input iterator.
+    /// \tparam InIter2     The type of the iterators of the second range
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of an input iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first1       Refers to the beginning of the first sorted range.
+    /// \param last1        Refers to the end of the first sorted range.
+    /// \param first2       Refers to the beginning of the second sorted range.
+    /// \param last2        Refers to the end of the second sorted range.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a merge algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of
+    ///           type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a OutIter
+    ///           otherwise.
+    ///           The \a merge algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last element
+    ///           copied.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, InIter1>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<InIter1>::value &&
+        traits::detail::is_iterator<InIter2>::value &&
+        traits::is_projected<Proj, InIter1>::value &&
+        traits::is_projected<Proj, InIter2>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, InIter1>,
+                traits::projected<Proj, InIter2>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+    merge(ExPolicy && policy, InIter1 first1, InIter1 last1,
+        InIter2 first2, InIter2 last2, OutIter dest,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<InIter1>::iterator_category
+            input_iterator_category1;
+        typedef typename std::iterator_traits<InIter2>::iterator_category
+            input_iterator_category2;
+        typedef typename std::iterator_traits<OutIter>::iterator_category
+            output_iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, input_iterator_category1>::value),
+            "Requires at least input iterator.");
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, input_iterator_category2>::value),
+            "Requires at least input iterator.");
+
+        static_assert(
+            (boost::mpl::or_<
+                boost::is_base_of<
+                    std::forward_iterator_tag, output_iterator_category>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category>
+            >::value),
+            "Requires at least output iterator.");
+
+        typedef typename boost::mpl::or_<
+            parallel::is_sequential_execution_policy<ExPolicy>,
+            boost::mpl::not_<boost::is_same<
+                std::random_access_iterator_tag, input_iterator_category1
+            > >,
+            boost::mpl::not_<boost::is_same<
+                std::random_access_iterator_tag, input_iterator_category2
+            > >,
+            boost::mpl::not_<boost::is_same<
+                std::random_access_iterator_tag, output_iterator_category
+            > >
+        >::type is_seq;
+
+        return detail::merge<OutIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first1, last1, first2, last2, dest,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Merges two consecutive sorted ranges [first, middle) and
+    /// [middle, last) into one sorted range [first, last). The order of
+    /// equivalent elements is preserved. The function uses the given
+    /// comparison function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(N) applications of the comparison function,
+    ///         where N = std::distance(first, last).
+    ///
+    /// The parallel overloads of this algorithm merge into a temporary
+    /// buffer, they require the value type of the sequence to be default
+    /// constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the first sorted range.
+    /// \param middle       Refers to the end of the first sorted range and
+    ///                     the beginning of the second sorted range.
+    /// \param last         Refers to the end of the second sorted range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a inplace_merge algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a void
+    ///           otherwise.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename RandomIt,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, void>::type
+    inplace_merge(ExPolicy && policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<RandomIt>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+
+        return detail::inplace_merge<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
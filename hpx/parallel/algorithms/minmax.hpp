@@ -9,6 +9,9 @@
 #define HPX_PARALLEL_DETAIL_MINMAX_AUG_20_2014_1005AM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/invoke.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/assert.hpp>
 
@@ -18,9 +21,12 @@
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -32,25 +38,28 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     namespace detail
     {
         /// \cond NOINTERNAL
-        template <typename FwdIter, typename F>
+        template <typename FwdIter, typename F, typename Proj>
         FwdIter sequential_min_element(FwdIter it, std::size_t count,
-            F const& f)
+            F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
                 return it;
 
             FwdIter smallest = it;
-            util::loop_n(++it, count-1, [&f, &smallest](FwdIter const& curr)
-            {
-                if (f(*curr, *smallest))
-                    smallest = curr;
-            });
+            util::loop_n(++it, count-1,
+                [&f, &smallest, &proj](FwdIter const& curr)
+                {
+                    if (f(hpx::util::invoke(proj, *curr),
+                            hpx::util::invoke(proj, *smallest)))
+                        smallest = curr;
+                });
             return smallest;
         }
 
-        template <typename FwdIter, typename F>
+        template <typename FwdIter, typename F, typename Proj>
         typename std::iterator_traits<FwdIter>::value_type
-        sequential_min_element_ind(FwdIter it, std::size_t count, F const& f)
+        sequential_min_element_ind(FwdIter it, std::size_t count, F const& f,
+            Proj const& proj)
         {
             HPX_ASSERT(count != 0);
 
@@ -58,35 +67,48 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return *it;
 
             typename std::iterator_traits<FwdIter>::value_type smallest = *it;
-            util::loop_n(++it, count-1, [&f, &smallest](FwdIter const& curr)
-            {
-                if (f(**curr, *smallest))
-                    smallest = *curr;
-            });
+            util::loop_n(++it, count-1,
+                [&f, &smallest, &proj](FwdIter const& curr)
+                {
+                    if (f(hpx::util::invoke(proj, **curr),
+                            hpx::util::invoke(proj, *smallest)))
+                        smallest = *curr;
+                });
             return smallest;
         }
 
-        template <typename FwdIter>
+        template <typename Iter>
         struct min_element
-          : public detail::algorithm<min_element<FwdIter>, FwdIter>
+          : public detail::algorithm<min_element<Iter>, Iter>
         {
             min_element()
               : min_element::algorithm("min_element")
             {}
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
             static FwdIter
-            sequential(ExPolicy, FwdIter first, FwdIter last, F && f)
+            sequential(ExPolicy, FwdIter first, FwdIter last, F && f,
+                Proj && proj)
             {
-                return std::min_element(first, last, std::forward<F>(f));
+                typedef typename std::iterator_traits<FwdIter>::reference
+                    reference;
+
+                return std::min_element(first, last,
+                    [&f, &proj](reference lhs, reference rhs) -> bool
+                    {
+                        return f(hpx::util::invoke(proj, lhs),
+                            hpx::util::invoke(proj, rhs));
+                    });
             }
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
             static typename util::detail::algorithm_result<
                 ExPolicy, FwdIter
             >::type
             parallel(ExPolicy policy, FwdIter first, FwdIter last,
-                F && f)
+                F && f, Proj && proj)
             {
                 if (first == last)
                 {
@@ -97,17 +119,43 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return util::partitioner<ExPolicy, FwdIter, FwdIter>::
                     call(
                         policy, first, std::distance(first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f, proj](FwdIter it, std::size_t part_count)
                         {
-                            return sequential_min_element(it, part_count, f);
+                            return sequential_min_element(
+                                it, part_count, f, proj);
                         },
-                        hpx::util::unwrapped([f](std::vector<FwdIter> && positions)
-                        {
-                            return sequential_min_element_ind(
-                                positions.begin(), positions.size(), f);
-                        }));
+                        hpx::util::unwrapped(
+                            [f, proj](std::vector<FwdIter> && positions)
+                            {
+                                return sequential_min_element_ind(
+                                    positions.begin(), positions.size(),
+                                    f, proj);
+                            }));
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        min_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::min_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f), std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        min_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::true_type);
+
         /// \endcond
     }
 
@@ -127,7 +175,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     /// \tparam F           The type of the function/function object to use
     ///                     (deduced). Unlike its sequential form, the parallel
     ///                     overload of \a min_element requires \a F to meet the
-    ///                     requirements of \a CopyConstructible.
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
     ///
     /// \param policy       The execution policy to use for the scheduling of
     ///                     the iterations.
@@ -146,73 +197,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     ///                     The signature does not need to have const &, but
     ///                     the function must not modify the objects passed to
     ///                     it. The types \a Type1 and \a Type2 must be such
-    ///                     that objects of types \a InIter1 and \a InIter2 can
-    ///                     be dereferenced and then implicitly converted to
-    ///                     \a Type1 and \a Type2 respectively
-    ///
-    /// The comparisons in the parallel \a min_element algorithm invoked with
-    /// an execution policy object of type \a sequential_execution_policy
-    /// execute in sequential order in the calling thread.
-    ///
-    /// The comparisons in the parallel \a min_element algorithm invoked with
-    /// an execution policy object of type \a parallel_execution_policy or
-    /// \a parallel_task_execution_policy are permitted to execute in an unordered
-    /// fashion in unspecified threads, and indeterminately sequenced
-    /// within each thread.
-    ///
-    /// \returns  The \a min_element algorithm returns a \a hpx::future<FwdIter>
-    ///           if the execution policy is of type
-    ///           \a sequential_task_execution_policy or
-    ///           \a parallel_task_execution_policy
-    ///           and returns \a FwdIter otherwise.
-    ///           The \a min_element algorithm returns the iterator to the
-    ///           smallest element in the range [first, last). If several
-    ///           elements in the range are equivalent to the smallest element,
-    ///           returns the iterator to the first such element. Returns last
-    ///           if the range is empty.
-    ///
-    template <typename ExPolicy, typename FwdIter, typename F>
-    inline typename boost::enable_if<
-        is_execution_policy<ExPolicy>,
-        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
-    >::type
-    min_element(ExPolicy && policy, FwdIter first, FwdIter last, F && f)
-    {
-        typedef typename std::iterator_traits<FwdIter>::iterator_category
-            iterator_category;
-
-        static_assert(
-            (boost::is_base_of<
-                std::forward_iterator_tag, iterator_category>::value),
-            "Required at least forward iterator.");
-
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
-
-        return detail::min_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
-    }
-
-    /// Finds the smallest element in the range [first, last) using the given
-    /// \a std::less predicate.
-    ///
-    /// \note   Complexity: Exactly \a max(N-1, 0) comparisons, where
-    ///                     N = std::distance(first, last).
-    ///
-    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
-    ///                     It describes the manner in which the execution
-    ///                     of the algorithm may be parallelized and the manner
-    ///                     in which it executes the assignments.
-    /// \tparam FwdIter     The type of the source iterators used (deduced).
-    ///                     This iterator type must meet the requirements of a
-    ///                     forward iterator.
-    ///
-    /// \param policy       The execution policy to use for the scheduling of
-    ///                     the iterations.
-    /// \param first        Refers to the beginning of the sequence of elements
-    ///                     the algorithm will be applied to.
-    /// \param last         Refers to the end of the sequence of elements the
-    ///                     algorithm will be applied to.
+    ///                     that objects of the type returned by applying the
+    ///                     projection \a proj to the dereferenced \a FwdIter
+    ///                     can be implicitly converted to \a Type1 and
+    ///                     \a Type2 respectively
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a f is invoked.
     ///
     /// The comparisons in the parallel \a min_element algorithm invoked with
     /// an execution policy object of type \a sequential_execution_policy
@@ -235,28 +227,41 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     ///           returns the iterator to the first such element. Returns last
     ///           if the range is empty.
     ///
-    template <typename ExPolicy, typename FwdIter>
-    inline typename boost::enable_if<
-        is_execution_policy<ExPolicy>,
-        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
-    >::type
-    min_element(ExPolicy && policy, FwdIter first, FwdIter last)
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename FwdIter,
+        typename F = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, FwdIter>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<FwdIter>::value &&
+        traits::is_projected<Proj, FwdIter>::value &&
+        traits::is_indirect_callable<
+            F,
+                traits::projected<Proj, FwdIter>,
+                traits::projected<Proj, FwdIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    min_element(ExPolicy && policy, FwdIter first, FwdIter last,
+        F && f = F(), Proj && proj = Proj())
     {
         typedef typename std::iterator_traits<FwdIter>::iterator_category
             iterator_category;
-        typedef typename std::iterator_traits<FwdIter>::value_type
-            value_type;
 
         static_assert(
             (boost::is_base_of<
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::min_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::min_element_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<F>(f), std::forward<Proj>(proj), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -264,25 +269,28 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     namespace detail
     {
         /// \cond NOINTERNAL
-        template <typename FwdIter, typename F>
+        template <typename FwdIter, typename F, typename Proj>
         FwdIter sequential_max_element(FwdIter it, std::size_t count,
-            F const& f)
+            F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
                 return it;
 
             FwdIter greatest = it;
-            util::loop_n(++it, count-1, [&f, &greatest](FwdIter const& curr)
-            {
-                if (f(*greatest, *curr))
-                    greatest = curr;
-            });
+            util::loop_n(++it, count-1,
+                [&f, &greatest, &proj](FwdIter const& curr)
+                {
+                    if (f(hpx::util::invoke(proj, *greatest),
+                            hpx::util::invoke(proj, *curr)))
+                        greatest = curr;
+                });
             return greatest;
         }
 
-        template <typename FwdIter, typename F>
+        template <typename FwdIter, typename F, typename Proj>
         typename std::iterator_traits<FwdIter>::value_type
-        sequential_max_element_ind(FwdIter it, std::size_t count, F const& f)
+        sequential_max_element_ind(FwdIter it, std::size_t count, F const& f,
+            Proj const& proj)
         {
             HPX_ASSERT(count != 0);
 
@@ -290,35 +298,48 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return *it;
 
             typename std::iterator_traits<FwdIter>::value_type greatest = *it;
-            util::loop_n(++it, count-1, [&f, &greatest](FwdIter const& curr)
-            {
-                if (f(*greatest, **curr))
-                    greatest = *curr;
-            });
+            util::loop_n(++it, count-1,
+                [&f, &greatest, &proj](FwdIter const& curr)
+                {
+                    if (f(hpx::util::invoke(proj, *greatest),
+                            hpx::util::invoke(proj, **curr)))
+                        greatest = *curr;
+                });
             return greatest;
         }
 
-        template <typename FwdIter>
+        template <typename Iter>
         struct max_element
-          : public detail::algorithm<max_element<FwdIter>, FwdIter>
+          : public detail::algorithm<max_element<Iter>, Iter>
         {
             max_element()
               : max_element::algorithm("max_element")
             {}
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
             static FwdIter
-            sequential(ExPolicy, FwdIter first, FwdIter last, F && f)
+            sequential(ExPolicy, FwdIter first, FwdIter last, F && f,
+                Proj && proj)
             {
-                return std::max_element(first, last, std::forward<F>(f));
+                typedef typename std::iterator_traits<FwdIter>::reference
+                    reference;
+
+                return std::max_element(first, last,
+                    [&f, &proj](reference lhs, reference rhs) -> bool
+                    {
+                        return f(hpx::util::invoke(proj, lhs),
+                            hpx::util::invoke(proj, rhs));
+                    });
             }
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
             static typename util::detail::algorithm_result<
                 ExPolicy, FwdIter
             >::type
             parallel(ExPolicy policy, FwdIter first, FwdIter last,
-                F && f)
+                F && f, Proj && proj)
             {
                 if (first == last)
                 {
@@ -329,17 +350,43 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return util::partitioner<ExPolicy, FwdIter, FwdIter>::
                     call(
                         policy, first, std::distance(first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f, proj](FwdIter it, std::size_t part_count)
                         {
-                            return sequential_max_element(it, part_count, f);
+                            return sequential_max_element(
+                                it, part_count, f, proj);
                         },
-                        hpx::util::unwrapped([f](std::vector<FwdIter> && positions)
-                        {
-                            return sequential_max_element_ind(
-                                positions.begin(), positions.size(), f);
-                        }));
+                        hpx::util::unwrapped(
+                            [f, proj](std::vector<FwdIter> && positions)
+                            {
+                                return sequential_max_element_ind(
+                                    positions.begin(), positions.size(),
+                                    f, proj);
+                            }));
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        max_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::max_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f), std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        max_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::true_type);
+
         /// \endcond
     }
 
@@ -359,7 +406,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     /// \tparam F           The type of the function/function object to use
     ///                     (deduced). Unlike its sequential form, the parallel
     ///                     overload of \a max_element requires \a F to meet the
-    ///                     requirements of \a CopyConstructible.
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
     ///
     /// \param policy       The execution policy to use for the scheduling of
     ///                     the iterations.
@@ -378,73 +428,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     ///                     The signature does not need to have const &, but
     ///                     the function must not modify the objects passed to
     ///                     it. The types \a Type1 and \a Type2 must be such
-    ///                     that objects of types \a InIter1 and \a InIter2 can
-    ///                     be dereferenced and then implicitly converted to
-    ///                     \a Type1 and \a Type2 respectively
-    ///
-    /// The comparisons in the parallel \a max_element algorithm invoked with
-    /// an execution policy object of type \a sequential_execution_policy
-    /// execute in sequential order in the calling thread.
-    ///
-    /// The comparisons in the parallel \a max_element algorithm invoked with
-    /// an execution policy object of type \a parallel_execution_policy or
-    /// \a parallel_task_execution_policy are permitted to execute in an unordered
-    /// fashion in unspecified threads, and indeterminately sequenced
-    /// within each thread.
-    ///
-    /// \returns  The \a max_element algorithm returns a \a hpx::future<FwdIter>
-    ///           if the execution policy is of type
-    ///           \a sequential_task_execution_policy or
-    ///           \a parallel_task_execution_policy
-    ///           and returns \a FwdIter otherwise.
-    ///           The \a max_element algorithm returns the iterator to the
-    ///           smallest element in the range [first, last). If several
-    ///           elements in the range are equivalent to the smallest element,
-    ///           returns the iterator to the first such element. Returns last
-    ///           if the range is empty.
-    ///
-    template <typename ExPolicy, typename FwdIter, typename F>
-    inline typename boost::enable_if<
-        is_execution_policy<ExPolicy>,
-        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
-    >::type
-    max_element(ExPolicy && policy, FwdIter first, FwdIter last, F && f)
-    {
-        typedef typename std::iterator_traits<FwdIter>::iterator_category
-            iterator_category;
-
-        static_assert(
-            (boost::is_base_of<
-                std::forward_iterator_tag, iterator_category>::value),
-            "Required at least forward iterator.");
-
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
-
-        return detail::max_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
-    }
-
-    /// Finds the greatest element in the range [first, last) using the given
-    /// \a std::less predicate.
-    ///
-    /// \note   Complexity: Exactly \a max(N-1, 0) comparisons, where
-    ///                     N = std::distance(first, last).
-    ///
-    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
-    ///                     It describes the manner in which the execution
-    ///                     of the algorithm may be parallelized and the manner
-    ///                     in which it executes the assignments.
-    /// \tparam FwdIter     The type of the source iterators used (deduced).
-    ///                     This iterator type must meet the requirements of a
-    ///                     forward iterator.
-    ///
-    /// \param policy       The execution policy to use for the scheduling of
-    ///                     the iterations.
-    /// \param first        Refers to the beginning of the sequence of elements
-    ///                     the algorithm will be applied to.
-    /// \param last         Refers to the end of the sequence of elements the
-    ///                     algorithm will be applied to.
+    ///                     that objects of the type returned by applying the
+    ///                     projection \a proj to the dereferenced \a FwdIter
+    ///                     can be implicitly converted to \a Type1 and
+    ///                     \a Type2 respectively
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a f is invoked.
     ///
     /// The comparisons in the parallel \a max_element algorithm invoked with
     /// an execution policy object of type \a sequential_execution_policy
@@ -462,33 +453,46 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     ///           \a parallel_task_execution_policy
     ///           and returns \a FwdIter otherwise.
     ///           The \a max_element algorithm returns the iterator to the
-    ///           smallest element in the range [first, last). If several
-    ///           elements in the range are equivalent to the smallest element,
+    ///           greatest element in the range [first, last). If several
+    ///           elements in the range are equivalent to the greatest element,
     ///           returns the iterator to the first such element. Returns last
     ///           if the range is empty.
     ///
-    template <typename ExPolicy, typename FwdIter>
-    inline typename boost::enable_if<
-        is_execution_policy<ExPolicy>,
-        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
-    >::type
-    max_element(ExPolicy && policy, FwdIter first, FwdIter last)
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename FwdIter,
+        typename F = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, FwdIter>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<FwdIter>::value &&
+        traits::is_projected<Proj, FwdIter>::value &&
+        traits::is_indirect_callable<
+            F,
+                traits::projected<Proj, FwdIter>,
+                traits::projected<Proj, FwdIter>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    max_element(ExPolicy && policy, FwdIter first, FwdIter last,
+        F && f = F(), Proj && proj = Proj())
     {
         typedef typename std::iterator_traits<FwdIter>::iterator_category
             iterator_category;
-        typedef typename std::iterator_traits<FwdIter>::value_type
-            value_type;
 
         static_assert(
             (boost::is_base_of<
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::max_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::max_element_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<F>(f), std::forward<Proj>(proj), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -546,21 +550,21 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
               : minmax_element::algorithm("minmax_element")
             {}
 
-            template <typename ExPolicy, typename F>
-            static std::pair<FwdIter, FwdIter>
-            sequential(ExPolicy, FwdIter first, FwdIter last, F && f)
+            template <typename ExPolicy, typename FwdIter_, typename F>
+            static std::pair<FwdIter_, FwdIter_>
+            sequential(ExPolicy, FwdIter_ first, FwdIter_ last, F && f)
             {
                 return std::minmax_element(first, last, std::forward<F>(f));
             }
 
-            template <typename ExPolicy, typename F>
+            template <typename ExPolicy, typename FwdIter_, typename F>
             static typename util::detail::algorithm_result<
-                ExPolicy, std::pair<FwdIter, FwdIter>
+                ExPolicy, std::pair<FwdIter_, FwdIter_>
             >::type
-            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+            parallel(ExPolicy policy, FwdIter_ first, FwdIter_ last,
                 F && f)
             {
-                typedef std::pair<FwdIter, FwdIter> result_type;
+                typedef std::pair<FwdIter_, FwdIter_> result_type;
 
                 result_type result(first, first);
                 if (first == last || ++first == last)
@@ -573,7 +577,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 return util::partitioner<ExPolicy, result_type, result_type>::
                     call(
                         policy, result.first, std::distance(result.first, last),
-                        [f](FwdIter it, std::size_t part_count)
+                        [f](FwdIter_ it, std::size_t part_count)
                         {
                             return sequential_minmax_element(it, part_count, f);
                         },
@@ -584,6 +588,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         }));
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        inline typename util::detail::algorithm_result<
+            ExPolicy, std::pair<FwdIter, FwdIter>
+        >::type
+        minmax_element_(ExPolicy && policy, FwdIter first, FwdIter last,
+            F && f, std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::minmax_element<FwdIter>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename F>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<FwdIter, FwdIter>
+        >::type
+        minmax_element_(ExPolicy && policy, FwdIter first, FwdIter last,
+            F && f, std::true_type);
+
         /// \endcond
     }
 
@@ -667,11 +696,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::minmax_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::forward<F>(f));
+        return detail::minmax_element_(
+            std::forward<ExPolicy>(policy), first, last, std::forward<F>(f),
+            is_segmented());
     }
 
     /// Finds the greatest element in the range [first, last) using the given
@@ -738,11 +769,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 std::forward_iterator_tag, iterator_category>::value),
             "Required at least forward iterator.");
 
-        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<FwdIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::minmax_element<FwdIter>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::less<value_type>());
+        return detail::minmax_element_(
+            std::forward<ExPolicy>(policy), first, last, std::less<value_type>(),
+            is_segmented());
     }
 }}}
 
@@ -0,0 +1,245 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_NOV_18_2015)
+#define HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_NOV_18_2015
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/bind.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Narrow down the range containing the nth element using parallel
+        // partitioning steps until it is short enough to be handled
+        // sequentially. This has to be executed on an HPX thread.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void nth_element_thread(ExPolicy policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare comp)
+        {
+            while (std::size_t(last - first) >= sort_parallel_partition_limit)
+            {
+                std::pair<RandomIt, RandomIt> middle =
+                    parallel_three_way_partition(policy, first, last, comp);
+
+                if (nth < middle.first)
+                    last = middle.first;
+                else if (nth < middle.second)
+                    return;     // nth refers to an element equal to the pivot
+                else
+                    first = middle.second;
+            }
+
+            std::nth_element(first, nth, last, comp);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<void>
+        parallel_nth_element_async(ExPolicy policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare comp)
+        {
+            hpx::future<void> result;
+            try {
+                if (nth == last)
+                    return hpx::make_ready_future();
+
+                if (std::size_t(last - first) < sort_parallel_partition_limit)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return hpx::make_ready_future();
+                }
+
+                typedef typename ExPolicy::executor_type executor_type;
+                typedef typename hpx::parallel::executor_traits<executor_type>
+                    executor_traits;
+
+                result = executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(
+                        &nth_element_thread<ExPolicy, RandomIt, Compare>,
+                        policy, first, nth, last, comp
+                    ));
+            }
+            catch (...) {
+                return detail::handle_sort_exception<ExPolicy>::call(
+                    boost::current_exception());
+            }
+
+            return result.then(
+                [](hpx::future<void> && f)
+                {
+                    if (f.has_exception())
+                    {
+                        handle_sort_exception<ExPolicy>::call(
+                            f.get_exception_ptr()).get();
+                    }
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // nth_element
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, void>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::util::unused_type
+            sequential(ExPolicy, RandomIt first, RandomIt nth, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::nth_element(first, nth, last,
+                    compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    parallel_nth_element_async(policy, first, nth, last,
+                        compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would occur
+    /// in that position if [first, last) was sorted. All of the elements
+    /// before this new nth element are less than or equal to the elements
+    /// after the new nth element. The function uses the given comparison
+    /// function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(N) applications of the comparison function on
+    ///         average, where N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which is to be put into its
+    ///                     sorted position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a void
+    ///           otherwise.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename RandomIt,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, void>::type
+    nth_element(ExPolicy && policy, RandomIt first, RandomIt nth,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<RandomIt>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
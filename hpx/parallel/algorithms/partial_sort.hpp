@@ -0,0 +1,202 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_NOV_18_2015)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_NOV_18_2015
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/move.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Select the smallest elements using a parallel nth_element and sort
+        // them afterwards.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<void>
+        parallel_partial_sort_async(ExPolicy policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare comp)
+        {
+            if (first == middle)
+                return hpx::make_ready_future();
+
+            if (middle == last)
+                return parallel_sort_async(policy, first, last, comp);
+
+            return parallel_nth_element_async(policy, first, middle, last,
+                    comp)
+                .then(
+                    [policy, first, middle, comp](hpx::future<void> && f)
+                        -> hpx::future<void>
+                    {
+                        f.get();        // rethrow exceptions
+                        return parallel_sort_async(policy, first, middle,
+                            comp);
+                    });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // partial_sort
+        template <typename RandomIt>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandomIt>, void>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::util::unused_type
+            sequential(ExPolicy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                std::partial_sort(first, middle, last,
+                    compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    parallel_partial_sort_async(policy, first, middle, last,
+                        compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the range
+    /// [first, middle) contains the sorted middle - first smallest elements
+    /// of the range [first, last). The order of equal elements is not
+    /// guaranteed to be preserved. The order of the remaining elements in
+    /// the range [middle, last) is unspecified. The function uses the given
+    /// comparison function object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: Approximately (last-first)*log(middle-first)
+    ///         applications of the comparison function.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the range which will hold the
+    ///                     sorted elements.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a void
+    ///           otherwise.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename RandomIt,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, void>::type
+    partial_sort(ExPolicy && policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<RandomIt>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
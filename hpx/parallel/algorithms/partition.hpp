@@ -0,0 +1,717 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partition.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_PARTITION_DEC_08_2015_0315PM)
+#define HPX_PARALLEL_ALGORITHMS_PARTITION_DEC_08_2015_0315PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/zip_iterator.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/compact.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <boost/shared_array.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/or.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // partition_copy
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The number of elements copied to the first and second destination
+        // range, respectively.
+        typedef std::pair<std::size_t, std::size_t> partition_copy_counts;
+
+        struct partition_copy_add
+        {
+            partition_copy_counts operator()(partition_copy_counts const& lhs,
+                partition_copy_counts const& rhs) const
+            {
+                return partition_copy_counts(
+                    lhs.first + rhs.first, lhs.second + rhs.second);
+            }
+        };
+
+        template <typename OutIter1, typename OutIter2>
+        struct partition_copy
+          : public detail::algorithm<
+                partition_copy<OutIter1, OutIter2>,
+                std::pair<OutIter1, OutIter2> >
+        {
+            partition_copy()
+              : partition_copy::algorithm("partition_copy")
+            {}
+
+            template <typename ExPolicy, typename InIter, typename Pred>
+            static std::pair<OutIter1, OutIter2>
+            sequential(ExPolicy, InIter first, InIter last,
+                OutIter1 dest_true, OutIter2 dest_false, Pred && pred)
+            {
+                return std::partition_copy(first, last, dest_true, dest_false,
+                    std::forward<Pred>(pred));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, std::pair<OutIter1, OutIter2>
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                OutIter1 dest_true, OutIter2 dest_false, Pred && pred)
+            {
+                typedef hpx::util::zip_iterator<FwdIter, bool*> zip_iterator;
+                typedef util::detail::algorithm_result<
+                        ExPolicy, std::pair<OutIter1, OutIter2>
+                    > result;
+                typedef typename std::iterator_traits<FwdIter>::difference_type
+                    difference_type;
+
+                if (first == last)
+                {
+                    return result::get(
+                        std::make_pair(dest_true, dest_false));
+                }
+
+                difference_type count = std::distance(first, last);
+
+                boost::shared_array<bool> flags(new bool[count]);
+                partition_copy_counts init(0, 0);
+
+                // The elements are distributed in a single pass over the
+                // data, see copy_if.
+
+                using hpx::util::get;
+                using hpx::util::make_zip_iterator;
+                typedef util::lookback_scan_partitioner<
+                        ExPolicy, std::pair<OutIter1, OutIter2>,
+                        partition_copy_counts
+                    > scan_partitioner_type;
+                return scan_partitioner_type::call(
+                    policy, make_zip_iterator(first, flags.get()),
+                    count, init,
+                    // count the elements satisfying the predicate
+                    [pred](zip_iterator part_begin, std::size_t part_size)
+                        -> partition_copy_counts
+                    {
+                        std::size_t curr = 0;
+                        util::loop_n(part_begin, part_size,
+                            [&pred, &curr](zip_iterator it) mutable
+                            {
+                                if((get<1>(*it) = pred(get<0>(*it))))
+                                {
+                                    ++curr;
+                                }
+                            });
+                        return partition_copy_counts(curr, part_size - curr);
+                    },
+                    // combine the counts
+                    partition_copy_add(),
+                    // copy the elements of the chunk
+                    [pred, dest_true, dest_false, flags](
+                        zip_iterator part_begin, std::size_t part_size,
+                        partition_copy_counts prefix, bool reduced)
+                        -> partition_copy_counts
+                    {
+                        OutIter1 out_true = dest_true;
+                        std::advance(out_true, prefix.first);
+                        OutIter2 out_false = dest_false;
+                        std::advance(out_false, prefix.second);
+
+                        util::loop_n(part_begin, part_size,
+                            [&](zip_iterator it) mutable
+                            {
+                                if(reduced ? get<1>(*it) : pred(get<0>(*it)))
+                                {
+                                    *out_true++ = get<0>(*it);
+                                    ++prefix.first;
+                                }
+                                else
+                                {
+                                    *out_false++ = get<0>(*it);
+                                    ++prefix.second;
+                                }
+                            });
+                        return prefix;
+                    },
+                    // use this return value
+                    [dest_true, dest_false, flags](
+                        partition_copy_counts const& total) mutable
+                        -> std::pair<OutIter1, OutIter2>
+                    {
+                        std::advance(dest_true, total.first);
+                        std::advance(dest_false, total.second);
+                        return std::make_pair(dest_true, dest_false);
+                    });
+            }
+        };
+        /// \endcond
+    }
+
+    /// Copies the elements in the range, defined by [first, last), to two
+    /// different ranges depending on the value returned by the predicate
+    /// \a pred. The elements, that satisfy the predicate \a pred, are copied
+    /// to the range beginning at \a dest_true. The rest of the elements are
+    /// copied to the range beginning at \a dest_false. The order of the
+    /// elements is preserved.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first applications of the
+    ///         predicate \a pred.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     input iterator.
+    /// \tparam OutIter1    The type of the iterator representing the
+    ///                     destination range for the elements that satisfy
+    ///                     the predicate \a pred (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam OutIter2    The type of the iterator representing the
+    ///                     destination range for the elements that don't
+    ///                     satisfy the predicate \a pred (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a partition_copy requires \a Pred to
+    ///                     meet the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest_true    Refers to the beginning of the destination range for
+    ///                     the elements that satisfy the predicate \a pred.
+    /// \param dest_false   Refers to the beginning of the destination range for
+    ///                     the elements that don't satisfy the predicate
+    ///                     \a pred.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). This is an
+    ///                     unary predicate for partitioning the source
+    ///                     iterators. The signature of this predicate
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that an object of
+    ///                     type \a InIter can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The assignments in the parallel \a partition_copy algorithm invoked
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a partition_copy algorithm invoked
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a partition_copy algorithm returns a
+    ///           \a hpx::future<std::pair<OutIter1, OutIter2> > if the
+    ///           execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a std::pair<OutIter1, OutIter2> otherwise.
+    ///           The \a partition_copy algorithm returns the pair of the
+    ///           output iterators to the elements in the destination ranges,
+    ///           one past the last element copied to each of them.
+    ///
+    template <typename ExPolicy, typename InIter, typename OutIter1,
+        typename OutIter2, typename Pred>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<OutIter1, OutIter2>
+        >::type
+    >::type
+    partition_copy(ExPolicy&& policy, InIter first, InIter last,
+        OutIter1 dest_true, OutIter2 dest_false, Pred && pred)
+    {
+        typedef typename std::iterator_traits<InIter>::iterator_category
+            input_iterator_category;
+        typedef typename std::iterator_traits<OutIter1>::iterator_category
+            output_iterator_category1;
+        typedef typename std::iterator_traits<OutIter2>::iterator_category
+            output_iterator_category2;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, input_iterator_category>::value),
+            "Required at least input iterator.");
+
+        static_assert(
+            (boost::mpl::or_<
+                boost::is_base_of<
+                    std::forward_iterator_tag, output_iterator_category1>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category1>
+            >::value),
+            "Requires at least output iterator.");
+
+        static_assert(
+            (boost::mpl::or_<
+                boost::is_base_of<
+                    std::forward_iterator_tag, output_iterator_category2>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category2>
+            >::value),
+            "Requires at least output iterator.");
+
+        typedef typename boost::mpl::or_<
+            is_sequential_execution_policy<ExPolicy>,
+            boost::is_same<std::input_iterator_tag, input_iterator_category>,
+            boost::is_same<std::output_iterator_tag, output_iterator_category1>,
+            boost::is_same<std::output_iterator_tag, output_iterator_category2>
+        >::type is_seq;
+
+        return detail::partition_copy<OutIter1, OutIter2>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, dest_true, dest_false, std::forward<Pred>(pred));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_partition
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Partition the sequence [first, first + count) while preserving the
+        // relative order of the elements in both groups. The elements are
+        // distributed to a scratch buffer in a single pass over the data:
+        // the elements satisfying the predicate are stored from the front,
+        // all others are stored in reverse order from the back of the buffer.
+        // Both groups are moved back into the sequence afterwards.
+        template <typename ExPolicy, typename FwdIter, typename Pred>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        parallel_stable_partition(ExPolicy policy, FwdIter first,
+            std::size_t count, Pred && pred)
+        {
+            typedef hpx::util::zip_iterator<FwdIter, bool*> zip_iterator;
+            typedef typename std::iterator_traits<FwdIter>::value_type
+                value_type;
+            typedef typename hpx::util::decay<Pred>::type pred_type;
+
+            HPX_ASSERT(count != 0);
+
+            boost::shared_array<value_type> buffer(new value_type[count]);
+            boost::shared_array<bool> flags(new bool[count]);
+            partition_copy_counts init(0, 0);
+
+            pred_type f(std::forward<Pred>(pred));
+
+            using hpx::util::get;
+            using hpx::util::make_zip_iterator;
+            typedef util::lookback_scan_partitioner<
+                    ExPolicy, FwdIter, partition_copy_counts
+                > scan_partitioner_type;
+            return scan_partitioner_type::call(
+                policy, make_zip_iterator(first, flags.get()), count, init,
+                // count the elements satisfying the predicate
+                [f](zip_iterator part_begin, std::size_t part_size)
+                    -> partition_copy_counts
+                {
+                    std::size_t curr = 0;
+                    util::loop_n(part_begin, part_size,
+                        [&f, &curr](zip_iterator it) mutable
+                        {
+                            if((get<1>(*it) = f(get<0>(*it))))
+                            {
+                                ++curr;
+                            }
+                        });
+                    return partition_copy_counts(curr, part_size - curr);
+                },
+                // combine the counts
+                partition_copy_add(),
+                // distribute the elements of the chunk to the scratch buffer
+                [f, buffer, flags, count](
+                    zip_iterator part_begin, std::size_t part_size,
+                    partition_copy_counts prefix, bool reduced)
+                    -> partition_copy_counts
+                {
+                    value_type* out_true = buffer.get() + prefix.first;
+                    value_type* out_false =
+                        buffer.get() + (count - 1 - prefix.second);
+
+                    util::loop_n(part_begin, part_size,
+                        [&](zip_iterator it) mutable
+                        {
+                            if(reduced ? get<1>(*it) : f(get<0>(*it)))
+                            {
+                                *out_true++ = std::move(get<0>(*it));
+                                ++prefix.first;
+                            }
+                            else
+                            {
+                                *out_false-- = std::move(get<0>(*it));
+                                ++prefix.second;
+                            }
+                        });
+                    return prefix;
+                },
+                // move both groups back into the sequence
+                [policy, buffer, flags, first, count](
+                    partition_copy_counts const& total) -> FwdIter
+                {
+                    typedef std::reverse_iterator<value_type*>
+                        reverse_iterator;
+
+                    FwdIter middle = parallel_move_from_buffer(policy,
+                        buffer.get(), total.first, first);
+                    parallel_move_from_buffer(policy,
+                        reverse_iterator(buffer.get() + count),
+                        total.second, middle);
+                    return middle;
+                });
+        }
+
+        template <typename BidirIter>
+        struct stable_partition
+          : public detail::algorithm<stable_partition<BidirIter>, BidirIter>
+        {
+            stable_partition()
+              : stable_partition::algorithm("stable_partition")
+            {}
+
+            template <typename ExPolicy, typename Pred>
+            static BidirIter
+            sequential(ExPolicy, BidirIter first, BidirIter last,
+                Pred && pred)
+            {
+                return std::stable_partition(first, last,
+                    std::forward<Pred>(pred));
+            }
+
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, BidirIter
+            >::type
+            parallel(ExPolicy policy, BidirIter first, BidirIter last,
+                Pred && pred)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, BidirIter>
+                    result;
+
+                if (first == last)
+                    return result::get(std::move(last));
+
+                return parallel_stable_partition(policy, first,
+                    std::distance(first, last), std::forward<Pred>(pred));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Reorders the elements in the range [first, last) in such a way that
+    /// all elements for which the predicate \a pred returns true precede
+    /// the elements for which the predicate \a pred returns false. The
+    /// relative order of the elements in both groups is preserved.
+    ///
+    /// \note   Complexity: Performs not more than 2 * (\a last - \a first)
+    ///         assignments, exactly \a last - \a first applications of the
+    ///         predicate \a pred.
+    ///
+    /// The parallel overloads of this algorithm distribute the elements to
+    /// a scratch buffer of the size of the input range, they require the
+    /// value type of the sequence to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam BidirIter   The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     bidirectional iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a stable_partition requires \a Pred to
+    ///                     meet the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). This is an
+    ///                     unary predicate for partitioning the source
+    ///                     iterators. The signature of this predicate
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that an object of
+    ///                     type \a BidirIter can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The assignments in the parallel \a stable_partition algorithm invoked
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a stable_partition algorithm invoked
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a stable_partition algorithm returns a
+    ///           \a hpx::future<BidirIter> if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a BidirIter otherwise.
+    ///           The \a stable_partition algorithm returns the iterator to
+    ///           the first element of the second group.
+    ///
+    template <typename ExPolicy, typename BidirIter, typename Pred>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, BidirIter>::type
+    >::type
+    stable_partition(ExPolicy && policy, BidirIter first, BidirIter last,
+        Pred && pred)
+    {
+        typedef typename std::iterator_traits<BidirIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::bidirectional_iterator_tag, iterator_category>::value),
+            "Required at least bidirectional iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::stable_partition<BidirIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, std::forward<Pred>(pred));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partition
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename ExPolicy, typename RandomIt, typename Pred>
+        hpx::future<RandomIt>
+        parallel_partition_async(ExPolicy policy, RandomIt first,
+            RandomIt last, Pred pred)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+
+            hpx::future<RandomIt> result;
+            try {
+                result = executor_traits::async_execute(
+                    policy.executor(),
+                    [policy, first, last, pred]() -> RandomIt
+                    {
+                        return parallel_partition(policy, first, last, pred);
+                    });
+            }
+            catch (...) {
+                result = hpx::make_exceptional_future<RandomIt>(
+                    boost::current_exception());
+            }
+
+            return result.then(
+                [](hpx::future<RandomIt> && f) -> RandomIt
+                {
+                    if (f.has_exception())
+                    {
+                        handle_sort_exception<ExPolicy>::call(
+                            f.get_exception_ptr()).get();
+                    }
+                    return f.get();
+                });
+        }
+
+        template <typename FwdIter>
+        struct partition
+          : public detail::algorithm<partition<FwdIter>, FwdIter>
+        {
+            partition()
+              : partition::algorithm("partition")
+            {}
+
+            template <typename ExPolicy, typename Pred>
+            static FwdIter
+            sequential(ExPolicy, FwdIter first, FwdIter last, Pred && pred)
+            {
+                return std::partition(first, last, std::forward<Pred>(pred));
+            }
+
+            // Random access sequences are partitioned in place. All other
+            // sequences are partitioned stably using a scratch buffer.
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, FwdIter>
+                    result;
+                typedef typename std::iterator_traits<
+                        FwdIter
+                    >::iterator_category iterator_category;
+
+                if (first == last)
+                    return result::get(std::move(last));
+
+                return partition_dispatch(policy, first, last,
+                    std::forward<Pred>(pred), iterator_category());
+            }
+
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            partition_dispatch(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred, std::random_access_iterator_tag)
+            {
+                typedef typename hpx::util::decay<Pred>::type pred_type;
+
+                return util::detail::algorithm_result<ExPolicy, FwdIter>::get(
+                    parallel_partition_async(policy, first, last,
+                        pred_type(std::forward<Pred>(pred))));
+            }
+
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            partition_dispatch(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred, std::forward_iterator_tag)
+            {
+                return parallel_stable_partition(policy, first,
+                    std::distance(first, last), std::forward<Pred>(pred));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Reorders the elements in the range [first, last) in such a way that
+    /// all elements for which the predicate \a pred returns true precede
+    /// the elements for which the predicate \a pred returns false. The
+    /// relative order of the elements is not preserved.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         swaps, exactly \a last - \a first applications of the
+    ///         predicate \a pred.
+    ///
+    /// The parallel overloads of this algorithm partition random access
+    /// sequences in place. All other sequences are partitioned using a
+    /// scratch buffer of the size of the input range, which requires the
+    /// value type of the sequence to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a partition requires \a Pred to meet
+    ///                     the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). This is an
+    ///                     unary predicate for partitioning the source
+    ///                     iterators. The signature of this predicate
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that an object of
+    ///                     type \a FwdIter can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The assignments in the parallel \a partition algorithm invoked with an
+    /// execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a partition algorithm invoked with an
+    /// execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partition algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a partition algorithm returns the iterator to the first
+    ///           element of the second group.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Pred>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    partition(ExPolicy && policy, FwdIter first, FwdIter last, Pred && pred)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::forward_iterator_tag, iterator_category>::value),
+            "Required at least forward iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::partition<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, std::forward<Pred>(pred));
+    }
+}}}
+
+#endif
@@ -0,0 +1,1088 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/pipeline.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_PIPELINE_DEC_16_2015_0915AM)
+#define HPX_PARALLEL_ALGORITHMS_PIPELINE_DEC_16_2015_0915AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/result_of.hpp>
+#include <hpx/util/unwrapped.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/compact.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include <boost/mpl/or.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/functions.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // pipeline stages
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // A sink is invoked for each of the elements flowing through a
+        // pipeline. Each stage of a pipeline wraps the sink of the succeeding
+        // stage, the terminal sink is provided by the algorithm consuming
+        // the pipeline.
+        template <typename F, typename Sink>
+        struct transform_sink
+        {
+            template <typename T>
+            void operator()(T && t)
+            {
+                sink_(hpx::util::invoke(f_, std::forward<T>(t)));
+            }
+
+            F f_;
+            Sink sink_;
+        };
+
+        template <typename Pred, typename Sink>
+        struct filter_sink
+        {
+            template <typename T>
+            void operator()(T && t)
+            {
+                if (hpx::util::invoke(pred_, t))
+                    sink_(std::forward<T>(t));
+            }
+
+            Pred pred_;
+            Sink sink_;
+        };
+
+        // Each stage exposes the type of the elements it produces from
+        // elements of the given type (output<T>::type) and creates the sink
+        // for its elements from the sink of the succeeding stage (bind).
+        struct identity_stage
+        {
+            template <typename T>
+            struct output
+            {
+                typedef T type;
+            };
+
+            template <typename Sink>
+            Sink bind(Sink const& sink) const
+            {
+                return sink;
+            }
+        };
+
+        template <typename F>
+        struct transform_stage
+        {
+            template <typename T>
+            struct output
+            {
+                typedef typename hpx::util::result_of<F const(T)>::type type;
+            };
+
+            template <typename Sink>
+            transform_sink<F, Sink> bind(Sink const& sink) const
+            {
+                transform_sink<F, Sink> s = { f_, sink };
+                return s;
+            }
+
+            F f_;
+        };
+
+        template <typename Pred>
+        struct filter_stage
+        {
+            template <typename T>
+            struct output
+            {
+                typedef T type;
+            };
+
+            template <typename Sink>
+            filter_sink<Pred, Sink> bind(Sink const& sink) const
+            {
+                filter_sink<Pred, Sink> s = { pred_, sink };
+                return s;
+            }
+
+            Pred pred_;
+        };
+
+        // The elements are passed through First and then through Second.
+        template <typename First, typename Second>
+        struct composed_stage
+        {
+            template <typename T>
+            struct output
+            {
+                typedef typename Second::template output<
+                        typename First::template output<T>::type
+                    >::type type;
+            };
+
+            template <typename Sink>
+            auto bind(Sink const& sink) const
+            ->  decltype(std::declval<First const&>().bind(
+                    std::declval<Second const&>().bind(sink)))
+            {
+                return first_.bind(second_.bind(sink));
+            }
+
+            First first_;
+            Second second_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Run the elements [first, first + count) through the given sink
+        template <typename Iter, typename Sink>
+        void run_pipeline_n(Iter first, std::size_t count, Sink& sink)
+        {
+            util::loop_n(first, count,
+                [&sink](Iter it)
+                {
+                    sink(*it);
+                });
+        }
+
+        template <typename Iter, typename Sink>
+        void run_pipeline(Iter first, Iter last, Sink& sink)
+        {
+            for (/**/; first != last; ++first)
+                sink(*first);
+        }
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A lazily evaluated view of the elements in the range [first, last)
+    /// which are passed through a sequence of stages. The stages are not
+    /// applied before the view is consumed by one of the algorithms accepting
+    /// a \a pipeline_view (\a for_each, \a count, \a reduce and \a copy).
+    /// Those run all stages of the pipeline in a single partitioned pass
+    /// over the input range without materializing any intermediate
+    /// sequences.
+    ///
+    /// A \a pipeline_view is created using \a make_pipeline, stages are
+    /// appended using operator| and the stage adaptors \a transformed and
+    /// \a filtered:
+    ///
+    /// \code
+    /// auto view = make_pipeline(v.begin(), v.end())
+    ///     | transformed([](int i) { return i * i; })
+    ///     | filtered([](int i) { return i % 2 == 0; });
+    ///
+    /// int sum = reduce(par, view, 0, std::plus<int>());
+    /// \endcode
+    ///
+    /// \tparam FwdIter     The type of the iterators referring to the input
+    ///                     range.
+    /// \tparam Stage       The type representing the stages of the pipeline.
+    ///
+    template <typename FwdIter, typename Stage = detail::identity_stage>
+    class pipeline_view
+    {
+    public:
+        /// The type of the iterators referring to the input range
+        typedef FwdIter iterator;
+
+        /// The type representing the stages of the pipeline
+        typedef Stage stage_type;
+
+        /// The type of the elements produced by the pipeline
+        typedef typename hpx::util::decay<
+                typename Stage::template output<
+                    typename std::iterator_traits<FwdIter>::reference
+                >::type
+            >::type value_type;
+
+        pipeline_view(FwdIter first, FwdIter last,
+                Stage const& stage = Stage())
+          : first_(first), last_(last), stage_(stage)
+        {}
+
+        /// Returns the beginning of the input range
+        FwdIter begin() const { return first_; }
+
+        /// Returns the end of the input range
+        FwdIter end() const { return last_; }
+
+        /// Returns the stages of the pipeline
+        Stage const& stage() const { return stage_; }
+
+    private:
+        FwdIter first_;
+        FwdIter last_;
+        Stage stage_;
+    };
+
+    /// Creates a \a pipeline_view of the elements in the range
+    /// [first, last) without any stages.
+    ///
+    template <typename FwdIter>
+    inline pipeline_view<FwdIter>
+    make_pipeline(FwdIter first, FwdIter last)
+    {
+        return pipeline_view<FwdIter>(first, last);
+    }
+
+    /// Creates a pipeline stage which replaces each element \a a by the
+    /// result of invoking \a f(a).
+    ///
+    template <typename F>
+    inline detail::transform_stage<typename hpx::util::decay<F>::type>
+    transformed(F && f)
+    {
+        detail::transform_stage<typename hpx::util::decay<F>::type> s =
+            { std::forward<F>(f) };
+        return s;
+    }
+
+    /// Creates a pipeline stage which passes on only the elements \a a for
+    /// which \a pred(a) returns true.
+    ///
+    template <typename Pred>
+    inline detail::filter_stage<typename hpx::util::decay<Pred>::type>
+    filtered(Pred && pred)
+    {
+        detail::filter_stage<typename hpx::util::decay<Pred>::type> s =
+            { std::forward<Pred>(pred) };
+        return s;
+    }
+
+    /// Appends the given stage to the \a pipeline_view \a view.
+    ///
+    template <typename FwdIter, typename Stage, typename F>
+    inline pipeline_view<
+        FwdIter, detail::composed_stage<Stage, detail::transform_stage<F> >
+    >
+    operator|(pipeline_view<FwdIter, Stage> const& view,
+        detail::transform_stage<F> const& stage)
+    {
+        detail::composed_stage<Stage, detail::transform_stage<F> > s =
+            { view.stage(), stage };
+        return pipeline_view<FwdIter, decltype(s)>(
+            view.begin(), view.end(), s);
+    }
+
+    /// Appends the given stage to the \a pipeline_view \a view.
+    ///
+    template <typename FwdIter, typename Stage, typename Pred>
+    inline pipeline_view<
+        FwdIter, detail::composed_stage<Stage, detail::filter_stage<Pred> >
+    >
+    operator|(pipeline_view<FwdIter, Stage> const& view,
+        detail::filter_stage<Pred> const& stage)
+    {
+        detail::composed_stage<Stage, detail::filter_stage<Pred> > s =
+            { view.stage(), stage };
+        return pipeline_view<FwdIter, decltype(s)>(
+            view.begin(), view.end(), s);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // for_each
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename F>
+        struct for_each_sink
+        {
+            template <typename T>
+            void operator()(T && t)
+            {
+                hpx::util::invoke(f_, std::forward<T>(t));
+            }
+
+            F f_;
+        };
+
+        template <typename FwdIter>
+        struct pipeline_for_each
+          : public detail::algorithm<pipeline_for_each<FwdIter>, FwdIter>
+        {
+            pipeline_for_each()
+              : pipeline_for_each::algorithm("pipeline_for_each")
+            {}
+
+            template <typename ExPolicy, typename Stage, typename F>
+            static FwdIter
+            sequential(ExPolicy, FwdIter first, FwdIter last,
+                Stage const& stage, F && f)
+            {
+                typedef typename hpx::util::decay<F>::type f_type;
+
+                for_each_sink<f_type> s = { std::forward<F>(f) };
+                auto sink = stage.bind(s);
+                run_pipeline(first, last, sink);
+                return last;
+            }
+
+            template <typename ExPolicy, typename Stage, typename F>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                Stage const& stage, F && f)
+            {
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<
+                            ExPolicy, FwdIter
+                        >::get(std::move(last));
+                }
+
+                typedef typename hpx::util::decay<F>::type f_type;
+                for_each_sink<f_type> s = { std::forward<F>(f) };
+
+                return util::foreach_n_partitioner<ExPolicy>::call(
+                    policy, first, std::distance(first, last),
+                    [stage, s](FwdIter part_begin, std::size_t part_size)
+                    {
+                        auto sink = stage.bind(s);
+                        run_pipeline_n(part_begin, part_size, sink);
+                    });
+            }
+        };
+        /// \endcond
+    }
+
+    /// Applies \a f to each of the elements produced by the given
+    /// \a pipeline_view. All stages of the pipeline and \a f are applied to
+    /// an element before the next element of the same chunk of the input
+    /// range is processed.
+    ///
+    /// \note   Complexity: Applies the stages of the pipeline to each of the
+    ///         elements of the input range of \a view exactly once.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the iterators of the input range of
+    ///                     the pipeline (deduced). This iterator type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Stage       The type representing the stages of the pipeline
+    ///                     (deduced).
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a for_each requires \a F to meet the
+    ///                     requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline producing the elements to apply
+    ///                     \a f to.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements produced
+    ///                     by the pipeline.
+    ///
+    /// The invocations of \a f in the parallel \a for_each algorithm invoked
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a f in the parallel \a for_each algorithm invoked
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a for_each algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a FwdIter
+    ///           otherwise.
+    ///           It returns the end of the input range of \a view.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stage, typename F>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    for_each(ExPolicy && policy, pipeline_view<FwdIter, Stage> const& view,
+        F && f)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, iterator_category>::value),
+            "Required at least input iterator.");
+
+        typedef typename boost::mpl::or_<
+            parallel::is_sequential_execution_policy<ExPolicy>,
+            boost::is_same<std::input_iterator_tag, iterator_category>
+        >::type is_seq;
+
+        return detail::pipeline_for_each<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            view.begin(), view.end(), view.stage(), std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // count
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename Value>
+        struct count_sink
+        {
+            template <typename T>
+            void operator()(T &&)
+            {
+                ++*count_;
+            }
+
+            Value* count_;
+        };
+
+        template <typename Value>
+        struct pipeline_count
+          : public detail::algorithm<pipeline_count<Value>, Value>
+        {
+            typedef Value difference_type;
+
+            pipeline_count()
+              : pipeline_count::algorithm("pipeline_count")
+            {}
+
+            template <typename ExPolicy, typename Iter, typename Stage>
+            static difference_type
+            sequential(ExPolicy, Iter first, Iter last, Stage const& stage)
+            {
+                difference_type result = 0;
+
+                count_sink<difference_type> s = { &result };
+                auto sink = stage.bind(s);
+                run_pipeline(first, last, sink);
+                return result;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Stage>
+            static typename util::detail::algorithm_result<
+                ExPolicy, difference_type
+            >::type
+            parallel(ExPolicy policy, Iter first, Iter last,
+                Stage const& stage)
+            {
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<
+                            ExPolicy, difference_type
+                        >::get(0);
+                }
+
+                return util::partitioner<ExPolicy, difference_type>::call(
+                    policy, first, std::distance(first, last),
+                    [stage](Iter part_begin, std::size_t part_size)
+                        -> difference_type
+                    {
+                        difference_type result = 0;
+
+                        count_sink<difference_type> s = { &result };
+                        auto sink = stage.bind(s);
+                        run_pipeline_n(part_begin, part_size, sink);
+                        return result;
+                    },
+                    hpx::util::unwrapped(
+                        [](std::vector<difference_type>&& results)
+                        {
+                            return util::accumulate_n(
+                                boost::begin(results), boost::size(results),
+                                difference_type(0),
+                                std::plus<difference_type>());
+                        }));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Returns the number of elements produced by the given
+    /// \a pipeline_view.
+    ///
+    /// \note   Complexity: Applies the stages of the pipeline to each of the
+    ///         elements of the input range of \a view exactly once.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the iterators of the input range of
+    ///                     the pipeline (deduced). This iterator type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Stage       The type representing the stages of the pipeline
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline producing the elements to count.
+    ///
+    /// The stages of the pipeline invoked by the parallel \a count algorithm
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The stages of the pipeline invoked by the parallel \a count algorithm
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a count algorithm returns a
+    ///           \a hpx::future<difference_type> if the execution policy is
+    ///           of type \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a difference_type otherwise (where
+    ///           \a difference_type is defined by
+    ///           \a std::iterator_traits<FwdIter>::difference_type).
+    ///           It returns the number of elements produced by the pipeline.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stage>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy,
+            typename std::iterator_traits<FwdIter>::difference_type
+        >::type
+    >::type
+    count(ExPolicy && policy, pipeline_view<FwdIter, Stage> const& view)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, iterator_category>::value),
+            "Required at least input iterator.");
+
+        typedef typename boost::mpl::or_<
+            parallel::is_sequential_execution_policy<ExPolicy>,
+            boost::is_same<std::input_iterator_tag, iterator_category>
+        >::type is_seq;
+
+        typedef typename std::iterator_traits<FwdIter>::difference_type
+            difference_type;
+
+        return detail::pipeline_count<difference_type>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            view.begin(), view.end(), view.stage());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // reduce
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The chunks of a filtering pipeline may not produce any elements,
+        // the partial results are left empty in this case.
+        template <typename T, typename Op>
+        struct reduce_sink
+        {
+            template <typename U>
+            void operator()(U && u)
+            {
+                if (*result_)
+                    *result_ = op_(std::move(**result_), std::forward<U>(u));
+                else
+                    *result_ = T(std::forward<U>(u));
+            }
+
+            boost::optional<T>* result_;
+            Op op_;
+        };
+
+        template <typename T>
+        struct pipeline_reduce
+          : public detail::algorithm<pipeline_reduce<T>, T>
+        {
+            pipeline_reduce()
+              : pipeline_reduce::algorithm("pipeline_reduce")
+            {}
+
+            template <typename ExPolicy, typename Iter, typename Stage,
+                typename T_, typename Reduce>
+            static T
+            sequential(ExPolicy, Iter first, Iter last, Stage const& stage,
+                T_ && init, Reduce && r)
+            {
+                typedef typename hpx::util::decay<Reduce>::type reduce_type;
+
+                boost::optional<T> result(T(std::forward<T_>(init)));
+
+                reduce_sink<T, reduce_type> s =
+                    { &result, std::forward<Reduce>(r) };
+                auto sink = stage.bind(s);
+                run_pipeline(first, last, sink);
+                return std::move(*result);
+            }
+
+            template <typename ExPolicy, typename Iter, typename Stage,
+                typename T_, typename Reduce>
+            static typename util::detail::algorithm_result<ExPolicy, T>::type
+            parallel(ExPolicy policy, Iter first, Iter last,
+                Stage const& stage, T_ && init, Reduce && r)
+            {
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<ExPolicy, T>::get(
+                        T(std::forward<T_>(init)));
+                }
+
+                typedef typename hpx::util::decay<Reduce>::type reduce_type;
+                typedef boost::optional<T> partial_result_type;
+
+                reduce_type op(std::forward<Reduce>(r));
+                T init_value(std::forward<T_>(init));
+
+                return util::partitioner<
+                        ExPolicy, T, partial_result_type
+                    >::call(
+                    policy, first, std::distance(first, last),
+                    [stage, op](Iter part_begin, std::size_t part_size)
+                        -> partial_result_type
+                    {
+                        partial_result_type result;
+
+                        reduce_sink<T, reduce_type> s = { &result, op };
+                        auto sink = stage.bind(s);
+                        run_pipeline_n(part_begin, part_size, sink);
+                        return result;
+                    },
+                    hpx::util::unwrapped(
+                        [init_value, op](
+                            std::vector<partial_result_type>&& results) -> T
+                        {
+                            T result = init_value;
+                            for (partial_result_type& p : results)
+                            {
+                                if (p)
+                                    result = op(std::move(result), *p);
+                            }
+                            return result;
+                        }));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Returns GENERALIZED_SUM(op, init, e1, ..., eN), where e1 to eN are
+    /// the elements produced by the given \a pipeline_view.
+    ///
+    /// \note   Complexity: Applies the stages of the pipeline to each of the
+    ///         elements of the input range of \a view exactly once, performs
+    ///         O(N) applications of \a op, where N is the number of elements
+    ///         produced by the pipeline.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the iterators of the input range of
+    ///                     the pipeline (deduced). This iterator type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Stage       The type representing the stages of the pipeline
+    ///                     (deduced).
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    /// \tparam Op          The type of the binary function object used for
+    ///                     the reduction operation (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline producing the elements to reduce.
+    /// \param init         The initial value for the generalized sum.
+    /// \param op           Specifies the function (or function object) which
+    ///                     will be invoked to combine the elements. This is a
+    ///                     binary predicate. The signature of this predicate
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     T op(const T &a, const Type &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The type \a Type must be convertible to \a T
+    ///                     and \a op must accept \a T as its second argument.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a T otherwise.
+    ///           The \a reduce algorithm returns the result of the
+    ///           generalized sum over the elements produced by the pipeline.
+    ///
+    /// \note   GENERALIZED_SUM(op, a1, ..., aN) is defined as follows:
+    ///         * a1 when N is 1
+    ///         * op(GENERALIZED_SUM(op, b1, ..., bK), GENERALIZED_SUM(op, bM, ..., bN)),
+    ///           where:
+    ///           * b1, ..., bN may be any permutation of a1, ..., aN and
+    ///           * 1 < K+1 = M <= N.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stage, typename T,
+        typename Op>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy,
+            typename hpx::util::decay<T>::type
+        >::type
+    >::type
+    reduce(ExPolicy && policy, pipeline_view<FwdIter, Stage> const& view,
+        T && init, Op && op)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, iterator_category>::value),
+            "Required at least input iterator.");
+
+        typedef typename boost::mpl::or_<
+            parallel::is_sequential_execution_policy<ExPolicy>,
+            boost::is_same<std::input_iterator_tag, iterator_category>
+        >::type is_seq;
+
+        typedef typename hpx::util::decay<T>::type init_type;
+
+        return detail::pipeline_reduce<init_type>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            view.begin(), view.end(), view.stage(), std::forward<T>(init),
+            std::forward<Op>(op));
+    }
+
+    /// Returns GENERALIZED_SUM(+, init, e1, ..., eN), where e1 to eN are
+    /// the elements produced by the given \a pipeline_view.
+    ///
+    /// \note   Complexity: Applies the stages of the pipeline to each of the
+    ///         elements of the input range of \a view exactly once, performs
+    ///         O(N) applications of operator+(), where N is the number of
+    ///         elements produced by the pipeline.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the iterators of the input range of
+    ///                     the pipeline (deduced). This iterator type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Stage       The type representing the stages of the pipeline
+    ///                     (deduced).
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline producing the elements to reduce.
+    /// \param init         The initial value for the generalized sum.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a parallel_execution_policy
+    /// or \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a T otherwise.
+    ///           The \a reduce algorithm returns the result of the
+    ///           generalized sum over the elements produced by the pipeline.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stage, typename T>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy,
+            typename hpx::util::decay<T>::type
+        >::type
+    >::type
+    reduce(ExPolicy && policy, pipeline_view<FwdIter, Stage> const& view,
+        T && init)
+    {
+        typedef typename hpx::util::decay<T>::type init_type;
+
+        return reduce(std::forward<ExPolicy>(policy), view,
+            std::forward<T>(init), std::plus<init_type>());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // copy
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename OutIter>
+        struct output_sink
+        {
+            template <typename T>
+            void operator()(T && t)
+            {
+                **dest_ = std::forward<T>(t);
+                ++*dest_;
+            }
+
+            OutIter* dest_;
+        };
+
+        template <typename Buffer>
+        struct buffer_sink
+        {
+            template <typename T>
+            void operator()(T && t)
+            {
+                buffer_->push_back(std::forward<T>(t));
+            }
+
+            Buffer* buffer_;
+        };
+
+        // Move the per-chunk results to their final position in the output
+        // sequence. This function has to be invoked on an HPX thread, it
+        // waits for the tasks it creates.
+        template <typename ExPolicy, typename Buffer, typename OutIter>
+        OutIter parallel_move_from_buffers(ExPolicy policy,
+            std::vector<Buffer>& buffers, OutIter dest)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+
+            std::size_t total = 0;
+            for (Buffer const& b : buffers)
+                total += b.size();
+
+            if (total < compact_move_limit_per_task)
+            {
+                for (Buffer& b : buffers)
+                    dest = std::move(b.begin(), b.end(), dest);
+                return dest;
+            }
+
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(buffers.size());
+
+            for (Buffer& b : buffers)
+            {
+                if (b.empty())
+                    continue;
+
+                Buffer* buffer = &b;
+                workitems.push_back(executor_traits::async_execute(
+                    policy.executor(),
+                    [buffer, dest]()
+                    {
+                        std::move(buffer->begin(), buffer->end(), dest);
+                    }));
+
+                std::advance(dest, b.size());
+            }
+
+            hpx::wait_all(workitems);
+
+            std::list<boost::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+
+            return dest;
+        }
+
+        template <typename OutIter>
+        struct pipeline_copy
+          : public detail::algorithm<pipeline_copy<OutIter>, OutIter>
+        {
+            pipeline_copy()
+              : pipeline_copy::algorithm("pipeline_copy")
+            {}
+
+            template <typename ExPolicy, typename Iter, typename Stage>
+            static OutIter
+            sequential(ExPolicy, Iter first, Iter last, Stage const& stage,
+                OutIter dest)
+            {
+                output_sink<OutIter> s = { &dest };
+                auto sink = stage.bind(s);
+                run_pipeline(first, last, sink);
+                return dest;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Stage>
+            static typename util::detail::algorithm_result<
+                ExPolicy, OutIter
+            >::type
+            parallel(ExPolicy policy, Iter first, Iter last,
+                Stage const& stage, OutIter dest)
+            {
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<
+                            ExPolicy, OutIter
+                        >::get(std::move(dest));
+                }
+
+                typedef typename hpx::util::decay<
+                        typename Stage::template output<
+                            typename std::iterator_traits<Iter>::reference
+                        >::type
+                    >::type value_type;
+                typedef std::vector<value_type> buffer_type;
+
+                // Each chunk gathers the elements it produces in a local
+                // buffer, those are moved to the output sequence after all
+                // chunks have finished.
+                return util::partitioner<
+                        ExPolicy, OutIter, buffer_type
+                    >::call(
+                    policy, first, std::distance(first, last),
+                    [stage](Iter part_begin, std::size_t part_size)
+                        -> buffer_type
+                    {
+                        buffer_type buffer;
+
+                        buffer_sink<buffer_type> s = { &buffer };
+                        auto sink = stage.bind(s);
+                        run_pipeline_n(part_begin, part_size, sink);
+                        return buffer;
+                    },
+                    hpx::util::unwrapped(
+                        [policy, dest](std::vector<buffer_type>&& buffers)
+                            -> OutIter
+                        {
+                            return parallel_move_from_buffers(policy,
+                                buffers, dest);
+                        }));
+            }
+        };
+        /// \endcond
+    }
+
+    /// Copies the elements produced by the given \a pipeline_view to the
+    /// range beginning at \a dest. The order of the elements is preserved.
+    ///
+    /// \note   Complexity: Applies the stages of the pipeline to each of the
+    ///         elements of the input range of \a view exactly once, performs
+    ///         exactly N assignments, where N is the number of elements
+    ///         produced by the pipeline.
+    ///
+    /// The parallel overloads of this algorithm gather the elements produced
+    /// by each chunk of the input range in a buffer local to the chunk before
+    /// moving them to the destination range, they require the value type of
+    /// the pipeline to be \a MoveConstructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the iterators of the input range of
+    ///                     the pipeline (deduced). This iterator type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Stage       The type representing the stages of the pipeline
+    ///                     (deduced).
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline producing the elements to copy.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The assignments in the parallel \a copy algorithm invoked with an
+    /// execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a copy algorithm invoked with an
+    /// execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a copy algorithm returns a \a hpx::future<OutIter> if
+    ///           the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a OutIter otherwise.
+    ///           The \a copy algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last element
+    ///           copied.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stage,
+        typename OutIter>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+    >::type
+    copy(ExPolicy && policy, pipeline_view<FwdIter, Stage> const& view,
+        OutIter dest)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            input_iterator_category;
+        typedef typename std::iterator_traits<OutIter>::iterator_category
+            output_iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::input_iterator_tag, input_iterator_category>::value),
+            "Required at least input iterator.");
+
+        static_assert(
+            (boost::mpl::or_<
+                boost::is_base_of<
+                    std::forward_iterator_tag, output_iterator_category>,
+                boost::is_same<
+                    std::output_iterator_tag, output_iterator_category>
+            >::value),
+            "Requires at least output iterator.");
+
+        typedef typename boost::mpl::or_<
+            parallel::is_sequential_execution_policy<ExPolicy>,
+            boost::is_same<std::input_iterator_tag, input_iterator_category>,
+            boost::is_same<std::output_iterator_tag, output_iterator_category>
+        >::type is_seq;
+
+        return detail::pipeline_copy<OutIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            view.begin(), view.end(), view.stage(), dest);
+    }
+}}}
+
+#endif
@@ -9,6 +9,7 @@
 #define HPX_PARALLEL_DETAIL_REDUCE_JUN_01_2014_0903AM
 
 #include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/unwrapped.hpp>
 
@@ -18,6 +19,7 @@
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/vector_loop.hpp>
 
 #include <boost/range/functions.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -26,6 +28,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
 {
@@ -68,8 +71,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     [r](FwdIter part_begin, std::size_t part_size) -> T
                     {
                         T val = *part_begin;
-                        return util::accumulate_n(++part_begin, --part_size,
-                            std::move(val), r);
+                        return util::vector_accumulate_n<ExPolicy>(
+                            ++part_begin, --part_size, std::move(val), r);
                     },
                     hpx::util::unwrapped([init, r](std::vector<T> && results)
                     {
@@ -78,6 +81,31 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     }));
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename T, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, InIter first, InIter last, T init,
+            F && f, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return reduce<T>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, std::move(init), std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T, typename F>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, InIter first, InIter last, T init,
+            F && f, std::true_type);
+
         /// \endcond
     }
 
@@ -165,14 +193,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::move(init), std::forward<F>(f));
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, std::move(init),
+            std::forward<F>(f), is_segmented());
     }
 
     /// Returns GENERALIZED_SUM(+, init, *first, ..., *(first + (last - first) - 1)).
@@ -242,14 +269,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<T>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, std::move(init), std::plus<T>());
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, std::move(init),
+            std::plus<T>(), is_segmented());
     }
 
     /// Returns GENERALIZED_SUM(+, T(), *first, ..., *(first + (last - first) - 1)).
@@ -322,14 +348,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Requires at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::reduce<value_type>().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, value_type(), std::plus<value_type>());
+        return detail::reduce_(
+            std::forward<ExPolicy>(policy), first, last, value_type(),
+            std::plus<value_type>(), is_segmented());
     }
 }}}
 
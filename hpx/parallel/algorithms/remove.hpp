@@ -0,0 +1,278 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/remove.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_REMOVE_DEC_09_2015_1107AM)
+#define HPX_PARALLEL_ALGORITHMS_REMOVE_DEC_09_2015_1107AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/compact.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // remove_if
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename FwdIter>
+        struct remove_if : public detail::algorithm<remove_if<FwdIter>, FwdIter>
+        {
+            remove_if()
+              : remove_if::algorithm("remove_if")
+            {}
+
+            template <typename ExPolicy, typename Pred>
+            static FwdIter
+            sequential(ExPolicy, FwdIter first, FwdIter last, Pred && pred)
+            {
+                return std::remove_if(first, last, std::forward<Pred>(pred));
+            }
+
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, FwdIter>
+                    result;
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                if (first == last)
+                    return result::get(std::move(last));
+
+                typedef typename hpx::util::decay<Pred>::type pred_type;
+                pred_type f(std::forward<Pred>(pred));
+
+                return parallel_compact(policy, first,
+                    std::distance(first, last), first,
+                    [f](FwdIter it)
+                    {
+                        return !f(*it);
+                    },
+                    [](FwdIter it) -> value_type&&
+                    {
+                        return std::move(*it);
+                    });
+            }
+        };
+        /// \endcond
+    }
+
+    /// Removes all elements satisfying specific criteria from the range
+    /// [first, last) and returns a past-the-end iterator for the new
+    /// end of the range. This version removes all elements for which
+    /// predicate \a pred returns true. The order of the elements that are
+    /// not removed is preserved.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first applications of the
+    ///         predicate \a pred.
+    ///
+    /// The parallel overloads of this algorithm gather the remaining
+    /// elements in a scratch buffer of the size of the input range, they
+    /// require the value type of the sequence to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a remove_if requires \a Pred to meet
+    ///                     the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last).This is an
+    ///                     unary predicate which returns \a true for the
+    ///                     elements to be removed. The signature of this
+    ///                     predicate should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that an object of
+    ///                     type \a FwdIter can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The assignments in the parallel \a remove_if algorithm invoked with
+    /// an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a remove_if algorithm invoked with
+    /// an execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a remove_if algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a remove_if algorithm returns the iterator to the new
+    ///           end of the range.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Pred>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    remove_if(ExPolicy && policy, FwdIter first, FwdIter last, Pred && pred)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::forward_iterator_tag, iterator_category>::value),
+            "Required at least forward iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::remove_if<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, std::forward<Pred>(pred));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // remove
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename FwdIter>
+        struct remove : public detail::algorithm<remove<FwdIter>, FwdIter>
+        {
+            remove()
+              : remove::algorithm("remove")
+            {}
+
+            template <typename ExPolicy, typename T>
+            static FwdIter
+            sequential(ExPolicy, FwdIter first, FwdIter last, T const& value)
+            {
+                return std::remove(first, last, value);
+            }
+
+            template <typename ExPolicy, typename T>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                T const& value)
+            {
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                return remove_if<FwdIter>().call(
+                    policy, boost::mpl::false_(), first, last,
+                    [value](value_type const& a) { return a == value; });
+            }
+        };
+        /// \endcond
+    }
+
+    /// Removes all elements satisfying specific criteria from the range
+    /// [first, last) and returns a past-the-end iterator for the new
+    /// end of the range. This version removes all elements that are equal
+    /// to \a value. The order of the elements that are not removed is
+    /// preserved.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first applications of
+    ///         the operator==().
+    ///
+    /// The parallel overloads of this algorithm gather the remaining
+    /// elements in a scratch buffer of the size of the input range, they
+    /// require the value type of the sequence to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam T           The type of the value to remove (deduced).
+    ///                     This value type must meet the requirements of
+    ///                     \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param value        Specifies the value of elements to remove.
+    ///
+    /// The assignments in the parallel \a remove algorithm invoked with
+    /// an execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a remove algorithm invoked with
+    /// an execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a remove algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a remove algorithm returns the iterator to the new end
+    ///           of the range.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename T>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    remove(ExPolicy && policy, FwdIter first, FwdIter last, T const& value)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::forward_iterator_tag, iterator_category>::value),
+            "Required at least forward iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::remove<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, value);
+    }
+}}}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/move.hpp>
 #include <hpx/util/bind.hpp>
@@ -20,6 +21,8 @@
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_partition.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
@@ -27,6 +30,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <list>
 #include <type_traits>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
@@ -38,6 +42,11 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         /// \cond NOINTERNAL
         static const std::size_t sort_limit_per_task = 65536ul;
 
+        // ranges at least this long are split using a parallel partitioning
+        // step instead of a sequential one
+        static const std::size_t sort_parallel_partition_limit =
+            4 * partition_limit_per_task;
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Compare, typename Proj>
         struct compare_projected
@@ -48,8 +57,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 proj_(std::forward<Proj>(proj))
             {}
 
-            template <typename T>
-            inline bool operator()(T const& t1, T const& t2)
+            template <typename T1, typename T2>
+            inline bool operator()(T1 const& t1, T2 const& t2)
             {
                 return hpx::util::invoke(comp_,
                     hpx::util::invoke(proj_, t1),
@@ -80,6 +89,10 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                     return hpx::make_exceptional_future<void>(
                         boost::current_exception());
                 }
+                catch (exception_list const&) {
+                    // errors reported by sub-tasks are already packaged up
+                    return hpx::make_exceptional_future<void>(e);
+                }
                 catch (...) {
                     // package up everything else as an exception_list
                     return hpx::make_exceptional_future<void>(
@@ -122,6 +135,76 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             return sorted;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // combine the results of the two tasks working on the sub-ranges of a
+        // split range
+        inline void join_sort_tasks(hpx::future<void> && left,
+            hpx::future<void> && right)
+        {
+            if (left.has_exception() || right.has_exception())
+            {
+                std::list<boost::exception_ptr> errors;
+                if (left.has_exception())
+                    errors.push_back(left.get_exception_ptr());
+                if (right.has_exception())
+                    errors.push_back(right.get_exception_ptr());
+
+                boost::throw_exception(exception_list(std::move(errors)));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // select the median of the first, middle, and last element
+        template <typename RandomIt, typename Compare>
+        typename std::iterator_traits<RandomIt>::value_type
+        select_pivot(RandomIt first, RandomIt last, Compare& comp)
+        {
+            RandomIt it_a = first;
+            RandomIt it_b = first + ((last - first) >> 1);
+            RandomIt it_c = last - 1;
+
+            if (comp(*it_b, *it_a))
+                std::swap(it_a, it_b);
+            if (comp(*it_c, *it_b))
+            {
+                it_b = it_c;
+                if (comp(*it_b, *it_a))
+                    it_b = it_a;
+            }
+            return *it_b;
+        }
+
+        // Split the given range into three parts using a parallel
+        // partitioning step: the elements less than the pivot, the elements
+        // equal to the pivot, and the elements greater than the pivot. The
+        // second part is never empty.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        std::pair<RandomIt, RandomIt>
+        parallel_three_way_partition(ExPolicy policy, RandomIt first,
+            RandomIt last, Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+            typedef typename std::iterator_traits<RandomIt>::reference
+                reference;
+
+            value_type const pivot = select_pivot(first, last, comp);
+
+            RandomIt middle1 = parallel_partition(policy, first, last,
+                [comp, &pivot](reference v) mutable
+                {
+                    return comp(v, pivot);
+                });
+
+            RandomIt middle2 = parallel_partition(policy, middle1, last,
+                [comp, &pivot](reference v) mutable
+                {
+                    return !comp(pivot, v);
+                });
+
+            return std::make_pair(middle1, middle2);
+        }
+
         //------------------------------------------------------------------------
         //  function : sort_thread
         /// \brief this function is the work assigned to each thread in the
@@ -158,6 +241,32 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             if (detail::is_sorted_sequential(first, last, comp))
                 return hpx::make_ready_future();
 
+            //---------------- parallel partitioning -------------------------
+            if (std::size_t(N) >= sort_parallel_partition_limit)
+            {
+                std::pair<RandomIt, RandomIt> middle =
+                    parallel_three_way_partition(policy, first, last, comp);
+
+                hpx::future<void> left =
+                    executor_traits::async_execute(
+                        policy.executor(),
+                        hpx::util::bind(
+                            &sort_thread<ExPolicy, RandomIt, Compare>,
+                            policy, first, middle.first, comp
+                        ));
+
+                hpx::future<void> right =
+                    executor_traits::async_execute(
+                        policy.executor(),
+                        hpx::util::bind(
+                            &sort_thread<ExPolicy, RandomIt, Compare>,
+                            policy, middle.second, last, comp
+                        ));
+
+                return hpx::lcos::local::dataflow(&join_sort_tasks,
+                    std::move(left), std::move(right));
+            }
+
             //---------------------- pivot select ----------------------------
             std::size_t nx = std::size_t(N) >> 1;
 
@@ -213,21 +322,7 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         policy, c_first, last, comp
                     ));
 
-            return hpx::lcos::local::dataflow(
-                [](hpx::future<void> && left, hpx::future<void> && right)
-                {
-                    if (left.has_exception() || right.has_exception())
-                    {
-                        std::list<boost::exception_ptr> errors;
-                        if (left.has_exception())
-                            errors.push_back(left.get_exception_ptr());
-                        if (right.has_exception())
-                            errors.push_back(right.get_exception_ptr());
-
-                        boost::throw_exception(
-                            exception_list(std::move(errors)));
-                    }
-                },
+            return hpx::lcos::local::dataflow(&join_sort_tasks,
                 std::move(left), std::move(right));
         }
 
@@ -285,6 +380,80 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             return result;
         }
 
+        //------------------------------------------------------------------------
+        //  function : parallel_radix_sort_async
+        //------------------------------------------------------------------------
+        /// @param [in] first : iterator to the first key to sort
+        /// @param [in] last : iterator to the next key after the last
+        /// @param [in] values : iterator to the first value to reorder along
+        ///                      with the keys, radix_no_values if none
+        /// @remarks the keys have to be of an arithmetic type, they are
+        ///          sorted in ascending order
+        template <typename ExPolicy, typename KeyIt, typename ValueIt>
+        hpx::future<void>
+        parallel_radix_sort_async(ExPolicy policy, KeyIt first, KeyIt last,
+            ValueIt values)
+        {
+            hpx::future<void> result;
+            try {
+                std::ptrdiff_t N = last - first;
+                HPX_ASSERT(N >= 0);
+
+                typedef typename ExPolicy::executor_type executor_type;
+                typedef typename hpx::parallel::executor_traits<executor_type>
+                    executor_traits;
+
+                result = executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(
+                        &radix_sort_thread<ExPolicy, KeyIt, ValueIt>,
+                        policy, first, values, std::size_t(N)
+                    ));
+            }
+            catch (...) {
+                return detail::handle_sort_exception<ExPolicy>::call(
+                    boost::current_exception());
+            }
+
+            return result.then(
+                [](hpx::future<void> && f)
+                {
+                    if (f.has_exception())
+                    {
+                        handle_sort_exception<ExPolicy>::call(
+                            f.get_exception_ptr()).get();
+                    }
+                });
+        }
+
+        // Arithmetic values compared using std::less are sorted using a radix
+        // sort if the range is long enough.
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<void>
+        parallel_sort_dispatch(ExPolicy policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj &&, std::true_type)
+        {
+            if (std::size_t(last - first) < radix_sort_limit)
+                return parallel_sort_async(policy, first, last, comp);
+
+            return parallel_radix_sort_async(policy, first, last,
+                radix_no_values());
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<void>
+        parallel_sort_dispatch(ExPolicy policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            return parallel_sort_async(policy, first, last,
+                compare_projected<Compare, Proj>(
+                    std::forward<Compare>(comp),
+                    std::forward<Proj>(proj)
+                ));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -312,16 +481,42 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             parallel(ExPolicy policy, RandomIt first, RandomIt last,
                 Compare && comp, Proj && proj)
             {
+                typedef typename std::iterator_traits<RandomIt>::value_type
+                    value_type;
+                typedef is_radix_sortable<value_type, Compare, Proj>
+                    use_radix_sort;
+
                 // call the sort routine and return the right type,
                 // depending on execution policy
                 return util::detail::algorithm_result<ExPolicy>::get(
-                    parallel_sort_async(policy, first, last,
-                        compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj)
-                        )));
+                    parallel_sort_dispatch(policy, first, last,
+                        std::forward<Compare>(comp), std::forward<Proj>(proj),
+                        use_radix_sort()));
             }
         };
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            return detail::sort<RandomIt>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::true_type);
+
         /// \endcond
     }
 
@@ -334,6 +529,11 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// The parallel overloads of this algorithm use a radix sort performing
+    /// O(N) operations instead if the values are of an integral type (other
+    /// than bool), float, or double, if they are compared using std::less,
+    /// and if no projection is given.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -420,11 +620,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             >::value),
             "Requires a random access iterator.");
 
-        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::segmented_iterator_traits<RandomIt>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::sort<RandomIt>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first, last,
-            std::forward<Compare>(comp), std::forward<Proj>(proj));
+        return detail::sort_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}
 
@@ -0,0 +1,366 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/sort_by_key.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_SORT_BY_KEY_NOV_25_2015)
+#define HPX_PARALLEL_ALGORITHM_SORT_BY_KEY_NOV_25_2015
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/unused.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // sort_by_key
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The keys and values are sorted together as pairs if no radix sort
+        // can be used, the pairs are compared using their first element only.
+        struct sort_by_key_projection
+        {
+            template <typename Pair>
+            typename Pair::first_type const& operator()(Pair const& p) const
+            {
+                return p.first;
+            }
+        };
+
+        template <typename KeyIt, typename ValueIt, typename Compare>
+        void sort_by_key_sequential(KeyIt first, KeyIt last, ValueIt values,
+            Compare && comp)
+        {
+            typedef std::pair<
+                    typename std::iterator_traits<KeyIt>::value_type,
+                    typename std::iterator_traits<ValueIt>::value_type
+                > element_type;
+
+            std::size_t const count = std::size_t(last - first);
+
+            std::vector<element_type> elements;
+            elements.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                elements.push_back(element_type(
+                    std::move(first[i]), std::move(values[i])));
+            }
+
+            std::sort(elements.begin(), elements.end(),
+                compare_projected<Compare, sort_by_key_projection>(
+                    std::forward<Compare>(comp), sort_by_key_projection()));
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                first[i] = std::move(elements[i].first);
+                values[i] = std::move(elements[i].second);
+            }
+        }
+
+        // This has to be executed on an HPX thread, it waits for the tasks it
+        // creates.
+        template <typename ExPolicy, typename KeyIt, typename ValueIt,
+            typename Compare>
+        void sort_by_key_thread(ExPolicy policy, KeyIt first, KeyIt last,
+            ValueIt values, Compare comp)
+        {
+            typedef std::pair<
+                    typename std::iterator_traits<KeyIt>::value_type,
+                    typename std::iterator_traits<ValueIt>::value_type
+                > element_type;
+
+            std::size_t const count = std::size_t(last - first);
+            if (count < sort_limit_per_task)
+            {
+                sort_by_key_sequential(first, last, values, comp);
+                return;
+            }
+
+            std::vector<element_type> elements(count);
+
+            radix_get(
+                util::partitioner<ExPolicy, hpx::util::unused_type, void>::call(
+                    policy, first, count,
+                    [&](KeyIt part_begin, std::size_t part_size)
+                    {
+                        std::size_t const offset =
+                            std::size_t(part_begin - first);
+                        for (std::size_t i = offset;
+                             i != offset + part_size; ++i)
+                        {
+                            elements[i].first = std::move(first[i]);
+                            elements[i].second = std::move(values[i]);
+                        }
+                    },
+                    [](std::vector<hpx::future<void> > &&)
+                    {
+                        return hpx::util::unused;
+                    }));
+
+            parallel_sort_async(policy, elements.begin(), elements.end(),
+                compare_projected<Compare, sort_by_key_projection>(
+                    std::move(comp), sort_by_key_projection())).get();
+
+            radix_get(
+                util::partitioner<ExPolicy, hpx::util::unused_type, void>::call(
+                    policy, first, count,
+                    [&](KeyIt part_begin, std::size_t part_size)
+                    {
+                        std::size_t const offset =
+                            std::size_t(part_begin - first);
+                        for (std::size_t i = offset;
+                             i != offset + part_size; ++i)
+                        {
+                            first[i] = std::move(elements[i].first);
+                            values[i] = std::move(elements[i].second);
+                        }
+                    },
+                    [](std::vector<hpx::future<void> > &&)
+                    {
+                        return hpx::util::unused;
+                    }));
+        }
+
+        template <typename ExPolicy, typename KeyIt, typename ValueIt,
+            typename Compare>
+        hpx::future<void>
+        parallel_sort_by_key_async(ExPolicy policy, KeyIt first, KeyIt last,
+            ValueIt values, Compare && comp, std::false_type)
+        {
+            typedef typename hpx::util::decay<Compare>::type compare_type;
+
+            hpx::future<void> result;
+            try {
+                typedef typename ExPolicy::executor_type executor_type;
+                typedef typename hpx::parallel::executor_traits<executor_type>
+                    executor_traits;
+
+                result = executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(
+                        &sort_by_key_thread<
+                            ExPolicy, KeyIt, ValueIt, compare_type>,
+                        policy, first, last, values,
+                        std::forward<Compare>(comp)
+                    ));
+            }
+            catch (...) {
+                return detail::handle_sort_exception<ExPolicy>::call(
+                    boost::current_exception());
+            }
+
+            return result.then(
+                [](hpx::future<void> && f)
+                {
+                    if (f.has_exception())
+                    {
+                        handle_sort_exception<ExPolicy>::call(
+                            f.get_exception_ptr()).get();
+                    }
+                });
+        }
+
+        template <typename ExPolicy, typename KeyIt, typename ValueIt,
+            typename Compare>
+        hpx::future<void>
+        parallel_sort_by_key_async(ExPolicy policy, KeyIt first, KeyIt last,
+            ValueIt values, Compare && comp, std::true_type)
+        {
+            if (std::size_t(last - first) < radix_sort_limit)
+            {
+                return parallel_sort_by_key_async(policy, first, last, values,
+                    std::forward<Compare>(comp), std::false_type());
+            }
+
+            return parallel_radix_sort_async(policy, first, last, values);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // sort_by_key
+        template <typename KeyIt, typename ValueIt>
+        struct sort_by_key
+          : public detail::algorithm<
+                sort_by_key<KeyIt, ValueIt>, std::pair<KeyIt, ValueIt>
+            >
+        {
+            sort_by_key()
+              : sort_by_key::algorithm("sort_by_key")
+            {}
+
+            template <typename ExPolicy, typename Compare>
+            static std::pair<KeyIt, ValueIt>
+            sequential(ExPolicy, KeyIt first, KeyIt last, ValueIt values,
+                Compare && comp)
+            {
+                sort_by_key_sequential(first, last, values,
+                    std::forward<Compare>(comp));
+                return std::make_pair(last, values + (last - first));
+            }
+
+            template <typename ExPolicy, typename Compare>
+            static typename util::detail::algorithm_result<
+                ExPolicy, std::pair<KeyIt, ValueIt>
+            >::type
+            parallel(ExPolicy policy, KeyIt first, KeyIt last, ValueIt values,
+                Compare && comp)
+            {
+                typedef typename std::iterator_traits<KeyIt>::value_type
+                    key_type;
+                typedef is_radix_sortable<key_type, Compare> use_radix_sort;
+
+                ValueIt values_last = values + (last - first);
+
+                return util::detail::algorithm_result<
+                        ExPolicy, std::pair<KeyIt, ValueIt>
+                    >::get(
+                        parallel_sort_by_key_async(policy, first, last,
+                            values, std::forward<Compare>(comp),
+                            use_radix_sort())
+                        .then(
+                            [last, values_last](hpx::future<void> && f)
+                                -> std::pair<KeyIt, ValueIt>
+                            {
+                                f.get();        // rethrow exceptions
+                                return std::make_pair(last, values_last);
+                            }));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [key_first, key_last) in ascending
+    /// order and applies the same permutation to the range of values starting
+    /// at value_first. The order of equal keys is not guaranteed to be
+    /// preserved. The function uses the given comparison function object comp
+    /// (defaults to using operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// The parallel overloads of this algorithm use a radix sort performing
+    /// O(N) operations if the keys are of an integral type (other than bool),
+    /// float, or double, and if they are compared using std::less. Otherwise
+    /// the keys and values are sorted as pairs, which requires both of them
+    /// to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam KeyIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam ValueIter   The type of the value iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of keys
+    ///                     the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of keys the
+    ///                     algorithm will be applied to.
+    /// \param value_first  Refers to the beginning of the sequence of values
+    ///                     which are reordered along with the keys.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// \a comp has to induce a strict weak ordering on the keys.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a sort_by_key algorithm returns a
+    ///           \a hpx::future<std::pair<KeyIter, ValueIter> > if the
+    ///           execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns
+    ///           \a std::pair<KeyIter, ValueIter> otherwise.
+    ///           It returns the end of the sequence of keys and the end of
+    ///           the sequence of values.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        typename Compare = std::less<
+            typename std::iterator_traits<KeyIter>::value_type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<KeyIter>::value &&
+        traits::detail::is_iterator<ValueIter>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<util::projection_identity, KeyIter>,
+                traits::projected<util::projection_identity, KeyIter>
+        >::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, std::pair<KeyIter, ValueIter>
+    >::type
+    sort_by_key(ExPolicy && policy, KeyIter key_first, KeyIter key_last,
+        ValueIter value_first, Compare && comp = Compare())
+    {
+        typedef typename std::iterator_traits<KeyIter>::iterator_category
+            key_iterator_category;
+        typedef typename std::iterator_traits<ValueIter>::iterator_category
+            value_iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, key_iterator_category
+            >::value),
+            "Requires a random access iterator.");
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, value_iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+
+        return detail::sort_by_key<KeyIter, ValueIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(), key_first, key_last,
+            value_first, std::forward<Compare>(comp));
+    }
+}}}
+
+#endif
@@ -0,0 +1,305 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_NOV_18_2015)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_NOV_18_2015
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <boost/shared_array.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Sort the range [first, last). The result is left in [first, last)
+        // if in_place is true, otherwise it is moved to the range starting at
+        // buffer. Both halves of the range are sorted into the respective
+        // other storage and merged back, which avoids copying the elements
+        // back and forth on each level.
+        template <typename ExPolicy, typename RandomIt, typename BufferIt,
+            typename Compare>
+        hpx::future<void> stable_sort_thread(ExPolicy policy,
+            RandomIt first, RandomIt last, BufferIt buffer, Compare comp,
+            bool in_place)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+
+            std::ptrdiff_t N = last - first;
+            if (std::size_t(N) <= sort_limit_per_task)
+            {
+                return executor_traits::async_execute(
+                    policy.executor(),
+                    [first, last, buffer, comp, in_place]()
+                    {
+                        std::stable_sort(first, last, comp);
+                        if (!in_place)
+                            std::move(first, last, buffer);
+                    });
+            }
+
+            RandomIt middle = first + (N >> 1);
+            BufferIt buffer_middle = buffer + (N >> 1);
+            BufferIt buffer_last = buffer + N;
+
+            hpx::future<void> left =
+                executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(
+                        &stable_sort_thread<
+                            ExPolicy, RandomIt, BufferIt, Compare>,
+                        policy, first, middle, buffer, comp, !in_place
+                    ));
+
+            hpx::future<void> right =
+                executor_traits::async_execute(
+                    policy.executor(),
+                    hpx::util::bind(
+                        &stable_sort_thread<
+                            ExPolicy, RandomIt, BufferIt, Compare>,
+                        policy, middle, last, buffer_middle, comp, !in_place
+                    ));
+
+            return hpx::lcos::local::dataflow(
+                [=](hpx::future<void> && left, hpx::future<void> && right)
+                    -> hpx::future<void>
+                {
+                    join_sort_tasks(std::move(left), std::move(right));
+
+                    // both halves are sorted, merge them into the target
+                    if (in_place)
+                    {
+                        return parallel_merge(policy,
+                            std::make_move_iterator(buffer),
+                            std::make_move_iterator(buffer_middle),
+                            std::make_move_iterator(buffer_middle),
+                            std::make_move_iterator(buffer_last),
+                            first, comp);
+                    }
+
+                    return parallel_merge(policy,
+                        std::make_move_iterator(first),
+                        std::make_move_iterator(middle),
+                        std::make_move_iterator(middle),
+                        std::make_move_iterator(last),
+                        buffer, comp);
+                },
+                std::move(left), std::move(right));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<void>
+        parallel_stable_sort_async(ExPolicy policy, RandomIt first,
+            RandomIt last, Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            hpx::future<void> result;
+            try {
+                std::ptrdiff_t N = last - first;
+                HPX_ASSERT(N >= 0);
+
+                if (std::size_t(N) < sort_limit_per_task)
+                {
+                    std::stable_sort(first, last, comp);
+                    return hpx::make_ready_future();
+                }
+
+                // check if already sorted
+                if (detail::is_sorted_sequential(first, last, comp))
+                    return hpx::make_ready_future();
+
+                // the scratch buffer has to be kept alive until all tasks
+                // have finished
+                boost::shared_array<value_type> buffer(new value_type[N]);
+
+                result = stable_sort_thread(policy, first, last,
+                        buffer.get(), comp, true)
+                    .then(
+                        [buffer](hpx::future<void> && f)
+                        {
+                            if (f.has_exception())
+                            {
+                                handle_sort_exception<ExPolicy>::call(
+                                    f.get_exception_ptr()).get();
+                            }
+                        });
+            }
+            catch (...) {
+                return detail::handle_sort_exception<ExPolicy>::call(
+                    boost::current_exception());
+            }
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, void>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::util::unused_type
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::stable_sort(first, last,
+                    compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    parallel_stable_sort_async(policy, first, last,
+                        compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// order of equal elements is guaranteed to be preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// The parallel overloads of this algorithm perform a merge sort using a
+    /// scratch buffer of the size of the input range, they require the value
+    /// type of the sequence to be default constructible.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Iter        The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns \a void
+    ///           otherwise.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename RandomIt,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, void>::type
+    stable_sort(ExPolicy && policy, RandomIt first, RandomIt last,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<RandomIt>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef is_sequential_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
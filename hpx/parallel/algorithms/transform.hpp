@@ -14,6 +14,7 @@
 #include <hpx/util/invoke.hpp>
 #include <hpx/traits/is_callable.hpp>
 #include <hpx/traits/concepts.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/execution_policy.hpp>
@@ -26,6 +27,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -52,36 +54,33 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
         struct transform
           : public detail::algorithm<transform<IterTuple>, IterTuple>
         {
-            typedef typename hpx::util::tuple_element<1, IterTuple>::type
-                output_iterator;
-
             transform()
               : transform::algorithm("transform")
             {}
 
-            template <typename ExPolicy, typename InIter, typename F,
-                typename Proj>
-            static hpx::util::tuple<InIter, output_iterator>
-            sequential(ExPolicy, InIter first, InIter last,
-                output_iterator dest, F && f, Proj && proj)
+            template <typename ExPolicy, typename InIter, typename OutIter,
+                typename F, typename Proj>
+            static hpx::util::tuple<InIter, OutIter>
+            sequential(ExPolicy, InIter first, InIter last, OutIter dest,
+                F && f, Proj && proj)
             {
                 return sequential_transform(first, last, dest,
                     std::forward<F>(f), std::forward<Proj>(proj));
             }
 
-            template <typename ExPolicy, typename FwdIter, typename F,
-                typename Proj>
+            template <typename ExPolicy, typename FwdIter, typename OutIter,
+                typename F, typename Proj>
             static typename util::detail::algorithm_result<
-                ExPolicy, hpx::util::tuple<FwdIter, output_iterator>
+                ExPolicy, hpx::util::tuple<FwdIter, OutIter>
             >::type
             parallel(ExPolicy policy, FwdIter first, FwdIter last,
-                output_iterator dest, F && f, Proj && proj)
+                OutIter dest, F && f, Proj && proj)
             {
-                typedef hpx::util::zip_iterator<FwdIter, output_iterator>
+                typedef hpx::util::zip_iterator<FwdIter, OutIter>
                     zip_iterator;
                 typedef typename zip_iterator::reference reference;
                 typedef typename util::detail::algorithm_result<
-                        ExPolicy, hpx::util::tuple<FwdIter, output_iterator>
+                        ExPolicy, hpx::util::tuple<FwdIter, OutIter>
                     >::type result_type;
 
                 return get_iter_tuple<result_type>(
@@ -96,6 +95,38 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         }));
             }
         };
+
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename F, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<InIter, OutIter>
+        >::type
+        transform_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, F && f, Proj && proj, std::false_type)
+        {
+            typedef typename std::iterator_traits<InIter>::iterator_category
+                iterator_category;
+
+            typedef typename boost::mpl::or_<
+                parallel::is_sequential_execution_policy<ExPolicy>,
+                boost::is_same<std::input_iterator_tag, iterator_category>
+            >::type is_seq;
+
+            return transform<hpx::util::tuple<InIter, OutIter> >().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::forward<F>(f),
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename F, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<InIter, OutIter>
+        >::type
+        transform_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, F && f, Proj && proj, std::true_type);
+
         /// \endcond
     }
 
@@ -191,15 +222,13 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
             (boost::is_base_of<std::input_iterator_tag, iterator_category>::value),
             "Required at least input iterator.");
 
-        typedef typename boost::mpl::or_<
-            is_sequential_execution_policy<ExPolicy>,
-            boost::is_same<std::input_iterator_tag, iterator_category>
-        >::type is_seq;
+        typedef hpx::traits::segmented_iterator_traits<InIter>
+            iterator_traits;
+        typedef typename iterator_traits::is_segmented_iterator is_segmented;
 
-        return detail::transform<hpx::util::tuple<InIter, OutIter> >().call(
-            std::forward<ExPolicy>(policy), is_seq(),
-            first, last, dest, std::forward<F>(f),
-            std::forward<Proj>(proj));
+        return detail::transform_(
+            std::forward<ExPolicy>(policy), first, last, dest,
+            std::forward<F>(f), std::forward<Proj>(proj), is_segmented());
     }
 
     ///////////////////////////////////////////////////////////////////////////
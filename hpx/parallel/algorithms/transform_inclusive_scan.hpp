@@ -17,7 +17,7 @@
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/parallel/util/lookback_scan_partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
 #include <algorithm>
@@ -104,48 +104,49 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                 OutIter final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 2
-                // subsequent parallel steps. The first calculates the scan
-                // results for each partition and the second produces the
-                // overall result
+                // The scan is performed in a single pass over the data. Each
+                // chunk is reduced only if the prefix of its predecessor is
+                // not known yet (decoupled look-back), the final scan of the
+                // chunk is run while its elements are still in the cache.
 
                 using hpx::util::get;
                 using hpx::util::make_zip_iterator;
-                return util::scan_partitioner<ExPolicy, OutIter, T>::call(
-                    policy, make_zip_iterator(first, dest), count, init,
-                    // step 1 performs first part of scan algorithm
-                    [op, conv](zip_iterator part_begin, std::size_t part_size)
-                        -> T
-                    {
-                        T part_init = conv(get<0>(*part_begin));
-                        get<1>(*part_begin++) = part_init;
-                        return sequential_transform_inclusive_scan_n(
-                            get<0>(part_begin.get_iterator_tuple()),
-                            part_size-1,
-                            get<1>(part_begin.get_iterator_tuple()),
-                            conv, part_init, op);
-                    },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    hpx::util::unwrapped(op),
-                    // step 3 runs final accumulation on each partition
-                    [op](zip_iterator part_begin, std::size_t part_size,
-                        hpx::shared_future<T> f_accu)
-                    {
-                        T val = f_accu.get();
-                        OutIter dst = get<1>(part_begin.get_iterator_tuple());
-                        util::loop_n(dst, part_size,
-                            [&op, &val](OutIter it)
-                            {
-                                *it = op(*it, val);
-                            });
-                    },
-                    // step 4 use this return value
-                    [final_dest](std::vector<hpx::shared_future<T> > &&,
-                        std::vector<hpx::future<void> > &&)
-                    {
-                        return final_dest;
-                    });
+                return util::lookback_scan_partitioner<ExPolicy, OutIter, T>::
+                    call(policy, make_zip_iterator(first, dest), count, init,
+                        // reduce the chunk
+                        [op, conv](zip_iterator part_begin,
+                            std::size_t part_size) -> T
+                        {
+                            typedef typename std::iterator_traits<
+                                    FwdIter
+                                >::reference reference;
+
+                            FwdIter it = get<0>(part_begin.get_iterator_tuple());
+                            T part_init = conv(*it++);
+                            return util::accumulate_n(it, part_size - 1,
+                                std::move(part_init),
+                                [&op, &conv](T const& res, reference next)
+                                {
+                                    return op(res, conv(next));
+                                });
+                        },
+                        // combine the chunk reductions
+                        op,
+                        // run the final scan on the chunk
+                        [op, conv](zip_iterator part_begin,
+                            std::size_t part_size, T const& prefix, bool) -> T
+                        {
+                            return sequential_transform_inclusive_scan_n(
+                                get<0>(part_begin.get_iterator_tuple()),
+                                part_size,
+                                get<1>(part_begin.get_iterator_tuple()),
+                                conv, prefix, op);
+                        },
+                        // use this return value
+                        [final_dest](T const&)
+                        {
+                            return final_dest;
+                        });
             }
         };
         /// \endcond
@@ -19,6 +19,7 @@
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/vector_loop.hpp>
 
 #include <boost/range/functions.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -73,22 +74,14 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
                         std::move(init_));
                 }
 
-                typedef typename std::iterator_traits<FwdIter>::reference
-                    reference;
-
                 return util::partitioner<ExPolicy, T>::call(
                     policy, first, std::distance(first, last),
                     [r, conv](FwdIter part_begin, std::size_t part_size) -> T
                     {
                         T val = conv(*part_begin);
-                        return util::accumulate_n(++part_begin, --part_size,
-                            std::move(val),
-                            // MSVC14 bails out if r and conv are captured by
-                            // reference
-                            [=](T const& res, reference next)
-                            {
-                                return r(res, conv(next));
-                            });
+                        return util::vector_accumulate_n<ExPolicy>(
+                            ++part_begin, --part_size, std::move(val), r,
+                            conv);
                     },
                     hpx::util::unwrapped([init, r](std::vector<T> && results)
                     {
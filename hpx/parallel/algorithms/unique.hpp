@@ -0,0 +1,256 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/unique.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_UNIQUE_DEC_09_2015_1132AM)
+#define HPX_PARALLEL_ALGORITHMS_UNIQUE_DEC_09_2015_1132AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/zip_iterator.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/compact.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // unique
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename FwdIter>
+        struct unique : public detail::algorithm<unique<FwdIter>, FwdIter>
+        {
+            unique()
+              : unique::algorithm("unique")
+            {}
+
+            template <typename ExPolicy, typename Pred>
+            static FwdIter
+            sequential(ExPolicy, FwdIter first, FwdIter last, Pred && pred)
+            {
+                return std::unique(first, last, std::forward<Pred>(pred));
+            }
+
+            template <typename ExPolicy, typename Pred>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, FwdIter>
+                    result;
+                typedef hpx::util::zip_iterator<FwdIter, FwdIter>
+                    zip_iterator;
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+
+                std::size_t count = std::distance(first, last);
+                if (count < 2)
+                    return result::get(std::move(last));
+
+                typedef typename hpx::util::decay<Pred>::type pred_type;
+                pred_type f(std::forward<Pred>(pred));
+
+                // Every element is compared with its predecessor in the
+                // input sequence. The first element is always kept and is
+                // not touched. The kept elements are copied (not moved) to
+                // the scratch buffer as their original values may still be
+                // needed as the predecessor of an element which is looked
+                // at by a different task.
+                FwdIter second = first;
+                ++second;
+
+                using hpx::util::get;
+                return parallel_compact(policy,
+                    hpx::util::make_zip_iterator(second, first), count - 1,
+                    second,
+                    [f](zip_iterator it) -> bool
+                    {
+                        return !f(*get<1>(it.get_iterator_tuple()),
+                            *get<0>(it.get_iterator_tuple()));
+                    },
+                    [](zip_iterator it) -> value_type const&
+                    {
+                        return *get<0>(it.get_iterator_tuple());
+                    });
+            }
+        };
+        /// \endcond
+    }
+
+    /// Eliminates all but the first element from every consecutive group of
+    /// equivalent elements from the range [first, last) and returns a
+    /// past-the-end iterator for the new logical end of the range. This
+    /// version uses operator== to compare the elements.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first - 1 applications of
+    ///         operator==.
+    ///
+    /// The parallel overloads of this algorithm gather the remaining
+    /// elements in a scratch buffer of the size of the input range, they
+    /// require the value type of the sequence to be default constructible
+    /// and \a CopyAssignable.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// The comparisons in the parallel \a unique algorithm invoked with an
+    /// execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a unique algorithm invoked with an
+    /// execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a unique algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unique algorithm returns the iterator to the new
+    ///           logical end of the range.
+    ///
+    template <typename ExPolicy, typename FwdIter>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    unique(ExPolicy && policy, FwdIter first, FwdIter last)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::forward_iterator_tag, iterator_category>::value),
+            "Required at least forward iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::unique<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, detail::equal_to());
+    }
+
+    /// Eliminates all but the first element from every consecutive group of
+    /// equivalent elements from the range [first, last) and returns a
+    /// past-the-end iterator for the new logical end of the range. The
+    /// elements are compared using the given binary predicate \a pred.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first - 1 applications of
+    ///         the predicate \a pred.
+    ///
+    /// The parallel overloads of this algorithm gather the remaining
+    /// elements in a scratch buffer of the size of the input range, they
+    /// require the value type of the sequence to be default constructible
+    /// and \a CopyAssignable.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a unique requires \a Pred to meet the
+    ///                     requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of consecutive
+    ///                     elements in the sequence specified by
+    ///                     [first, last). This is a binary predicate which
+    ///                     returns \a true if the elements should be treated
+    ///                     as equal. The signature of this predicate should
+    ///                     be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a, const Type &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that an object of
+    ///                     type \a FwdIter can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The comparisons in the parallel \a unique algorithm invoked with an
+    /// execution policy object of type \a sequential_execution_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a unique algorithm invoked with an
+    /// execution policy object of type \a parallel_execution_policy or
+    /// \a parallel_task_execution_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a unique algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unique algorithm returns the iterator to the new
+    ///           logical end of the range.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Pred>
+    inline typename boost::enable_if<
+        is_execution_policy<ExPolicy>,
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    >::type
+    unique(ExPolicy && policy, FwdIter first, FwdIter last,
+        Pred && pred)
+    {
+        typedef typename std::iterator_traits<FwdIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::forward_iterator_tag, iterator_category>::value),
+            "Required at least forward iterator.");
+
+        typedef typename is_sequential_execution_policy<ExPolicy>::type is_seq;
+
+        return detail::unique<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(),
+            first, last, std::forward<Pred>(pred));
+    }
+}}}
+
+#endif
@@ -1540,6 +1540,42 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
       : detail::is_async_execution_policy<typename hpx::util::decay<T>::type>
     {};
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename T>
+        struct is_vector_execution_policy
+          : boost::mpl::false_
+        {};
+
+        template <>
+        struct is_vector_execution_policy<parallel_vector_execution_policy>
+          : boost::mpl::true_
+        {};
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Extension: Detect whether given execution policy allows to vectorize
+    ///            the invocations of the element access functions
+    ///
+    /// 1. The type is_vector_execution_policy can be used to detect
+    ///    execution policies which permit algorithms to be executed using
+    ///    explicitly vectorized kernels.
+    /// 2. If T is the type of a standard or implementation-defined execution
+    ///    policy, is_vector_execution_policy<T> shall be publicly derived
+    ///    from integral_constant<bool, true>, otherwise from
+    ///    integral_constant<bool, false>.
+    /// 3. The behavior of a program that adds specializations for
+    ///    is_vector_execution_policy is undefined.
+    ///
+    // extension:
+    template <typename T>
+    struct is_vector_execution_policy
+      : detail::is_vector_execution_policy<typename hpx::util::decay<T>::type>
+    {};
+
     ///////////////////////////////////////////////////////////////////////////
     ///
     /// An execution policy is an object that expresses the requirements on the
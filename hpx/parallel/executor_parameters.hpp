@@ -12,5 +12,7 @@
 #include <hpx/parallel/executors/dynamic_chunk_size.hpp>
 #include <hpx/parallel/executors/auto_chunk_size.hpp>
 #include <hpx/parallel/executors/guided_chunk_size.hpp>
+#include <hpx/parallel/executors/pinned_chunk_size.hpp>
+#include <hpx/parallel/executors/adaptive_chunk_size.hpp>
 
 #endif
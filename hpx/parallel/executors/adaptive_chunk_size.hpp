@@ -0,0 +1,181 @@
+//  Copyright (c) 2007-2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#if !defined(HPX_PARALLEL_ADAPTIVE_CHUNK_SIZE_DEC_15_2015_1027AM)
+#define HPX_PARALLEL_ADAPTIVE_CHUNK_SIZE_DEC_15_2015_1027AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/executors/executor_parameter_traits.hpp>
+#include <hpx/parallel/executors/executor_information_traits.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/date_time_chrono.hpp>
+
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/cstdint.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces of decreasing size and then
+    /// assigned to threads. Each piece is given half of the per-core share of
+    /// the loop iterations remaining to be scheduled, but never less than the
+    /// number of loop iterations estimated to run for the amount of time
+    /// specified. Large pieces are handed out first, the remaining work is
+    /// split into ever smaller pieces which can be picked up by otherwise idle
+    /// cores, which balances loops with irregular per-iteration costs.
+    ///
+    /// The cost of a single loop iteration is estimated by measuring how long
+    /// the execution of 1% of the loop iterations takes. All copies of an
+    /// \a adaptive_chunk_size object share this estimate, each invocation of
+    /// an algorithm refines it by an exponential moving average. Using the
+    /// same object for repeated invocations of an algorithm (for instance
+    /// by keeping one object per call site) will therefore remember the cost
+    /// estimate across those invocations.
+    ///
+    struct adaptive_chunk_size : executor_parameters_tag
+    {
+    private:
+        /// \cond NOINTERNAL
+        struct cost_estimate
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+            cost_estimate()
+              : cost_(0.0)
+            {}
+
+            // fold a new measurement into the exponential moving average
+            void update(double cost)
+            {
+                boost::lock_guard<mutex_type> l(mtx_);
+                cost_ = (cost_ == 0.0) ? cost : (3.0 * cost_ + cost) / 4.0;
+            }
+
+            double get() const
+            {
+                boost::lock_guard<mutex_type> l(mtx_);
+                return cost_;
+            }
+
+            mutable mutex_type mtx_;
+            double cost_;       // nanoseconds, may be well below 1
+        };
+        /// \endcond
+
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor parameter
+        ///       types will use 80 microseconds as the minimal time for which
+        ///       any of the scheduled chunks should run.
+        ///
+        adaptive_chunk_size()
+          : min_time_(80000),
+            estimate_(boost::make_shared<cost_estimate>()),
+            probed_(false)
+        {}
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param rel_time     [in] The time duration to use as the minimum
+        ///                     to decide how many loop iterations should be
+        ///                     combined.
+        ///
+        explicit adaptive_chunk_size(
+            hpx::util::steady_duration const& rel_time)
+          : min_time_(rel_time.value().count()),
+            estimate_(boost::make_shared<cost_estimate>()),
+            probed_(false)
+        {}
+
+        /// \cond NOINTERNAL
+        // This executor parameters type provides variable chunk sizes and
+        // needs to be invoked for each of the chunks to be combined.
+        template <typename Executor>
+        static bool variable_chunk_size(Executor&)
+        {
+            return true;
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(Executor& exec, F && f,
+            std::size_t num_tasks)
+        {
+            std::size_t const cores = executor_information_traits<Executor>::
+                processing_units_count(exec, *this);
+
+            // The algorithms operate on a copy of this object, measure the
+            // cost of the loop iterations only once for each invocation.
+            if (!probed_)
+            {
+                probed_ = true;
+                if (num_tasks > 100*cores)
+                {
+                    using hpx::util::high_resolution_clock;
+                    boost::uint64_t t = high_resolution_clock::now();
+
+                    std::size_t test_chunk_size = f();
+                    if (test_chunk_size != 0)
+                    {
+                        // cheap iterations take less than a nanosecond,
+                        // divide the time of the whole chunk in floating
+                        // point
+                        t = high_resolution_clock::now() - t;
+                        estimate_->update(double(t) / test_chunk_size);
+                        num_tasks -= test_chunk_size;
+                    }
+                }
+            }
+
+            // hand out half of the per-core share of the remaining work,
+            // but at least enough to run for the minimal time
+            std::size_t chunk = (num_tasks + 2*cores - 1) / (2*cores);
+
+            double const cost = estimate_->get();
+            if (cost > 0.0)
+            {
+                double const min_chunk = double(min_time_) / cost;
+                if (min_chunk >= double(num_tasks))
+                    chunk = num_tasks;
+                else
+                    chunk = (std::max)(chunk, std::size_t(min_chunk));
+            }
+
+            return (std::max)(std::size_t(1), (std::min)(chunk, num_tasks));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & min_time_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        boost::uint64_t min_time_;      // nanoseconds
+        boost::shared_ptr<cost_estimate> estimate_;
+        bool probed_;
+        /// \endcond
+    };
+}}}
+
+#endif
@@ -124,11 +124,28 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
         }
 
         ///////////////////////////////////////////////////////////////////////
+        struct reset_thread_distribution_executor_helper
+        {
+            template <typename Executor>
+            static void call(wrap_int, Executor&)
+            {
+            }
+
+            template <typename Executor>
+            static auto call(int, Executor& exec)
+            ->  decltype(exec.reset_thread_distribution())
+            {
+                exec.reset_thread_distribution();
+            }
+        };
+
         struct reset_thread_distribution_helper
         {
             template <typename Parameters, typename Executor>
             static void call(wrap_int, Parameters&, Executor& exec)
             {
+                // forward the request to the executor, if supported
+                reset_thread_distribution_executor_helper::call(0, exec);
             }
 
             template <typename Parameters, typename Executor>
@@ -207,7 +224,8 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
         /// \param exec     [in] The executor object to use.
         ///
         /// \note This calls params.reset_thread_distribution(exec) if it exists;
-        ///       otherwise it does nothing.
+        ///       otherwise it calls exec.reset_thread_distribution() if that
+        ///       exists; otherwise it does nothing.
         ///
         template <typename Executor>
         static void reset_thread_distribution(executor_parameters_type& params,
@@ -0,0 +1,110 @@
+//  Copyright (c) 2007-2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/pinned_chunk_size.hpp
+
+#if !defined(HPX_PARALLEL_PINNED_CHUNK_SIZE_DEC_14_2015_0912AM)
+#define HPX_PARALLEL_PINNED_CHUNK_SIZE_DEC_14_2015_0912AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/executors/executor_parameter_traits.hpp>
+#include <hpx/parallel/executors/executor_information_traits.hpp>
+#include <hpx/parallel/executors/thread_executor_parameter_traits.hpp>
+#include <hpx/parallel/executors/thread_executor_information_traits.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces of size \a chunk_size and then
+    /// assigned to threads such that the i-th piece always runs on the
+    /// (i modulo N)-th processing unit managed by the executor, where N is
+    /// the number of processing units of the executor. If \a chunk_size is
+    /// not specified, the iterations are evenly (if possible) divided
+    /// contiguously among the processing units.
+    ///
+    /// Repeated invocations of algorithms over the same range of elements
+    /// will run each piece of the range on the same processing unit. If the
+    /// memory of the range was touched first using the same executor and
+    /// the same executor parameters (see \a util::numa_first_touch), each
+    /// processing unit will access memory local to its NUMA domain only.
+    ///
+    /// \note The placement of the pieces relies on the executor exposing
+    ///       a deterministic (round robin) distribution of the scheduled
+    ///       tasks over its processing units which can be reset, as
+    ///       implemented by the thread pool executors attached to a set of
+    ///       cores (for instance
+    ///       \a threads::executors::local_priority_queue_attached_executor).
+    ///       For all other executors this executor parameters type is
+    ///       equivalent to \a static_chunk_size.
+    ///
+    struct pinned_chunk_size : executor_parameters_tag
+    {
+        /// Construct a \a pinned_chunk_size executor parameters object
+        ///
+        /// \note By default the number of loop iterations is determined from
+        ///       the number of available cores and the overall number of loop
+        ///       iterations to schedule.
+        ///
+        pinned_chunk_size()
+          : chunk_size_(0)
+        {}
+
+        /// Construct a \a pinned_chunk_size executor parameters object
+        ///
+        /// \param chunk_size   [in] The optional chunk size to use as the
+        ///                     number of loop iterations to run on a single
+        ///                     thread.
+        ///
+        explicit pinned_chunk_size(std::size_t chunk_size)
+          : chunk_size_(chunk_size)
+        {}
+
+        /// \cond NOINTERNAL
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(Executor& exec, F &&, std::size_t num_tasks)
+        {
+            // Make sure the first piece is always scheduled on the first
+            // processing unit of the executor, regardless of how many tasks
+            // were scheduled before.
+            typedef executor_parameter_traits<pinned_chunk_size> traits;
+            traits::reset_thread_distribution(*this, exec);
+
+            // use the given chunk size if given
+            if (chunk_size_ != 0)
+                return chunk_size_;
+
+            // by default use static work distribution over number of
+            // available compute resources
+            std::size_t const cores = executor_information_traits<Executor>::
+                processing_units_count(exec, *this);
+
+            return (num_tasks + cores - 1) / cores;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive & ar, const unsigned int version)
+        {
+            ar & chunk_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunk_size_;
+        /// \endcond
+    };
+}}}
+
+#endif
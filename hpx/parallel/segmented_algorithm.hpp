@@ -9,8 +9,21 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/parallel/algorithm.hpp>
 
+#include <hpx/parallel/segmented_algorithms/all_any_none.hpp>
+#include <hpx/parallel/segmented_algorithms/copy.hpp>
 #include <hpx/parallel/segmented_algorithms/count.hpp>
+#include <hpx/parallel/segmented_algorithms/equal.hpp>
+#include <hpx/parallel/segmented_algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/segmented_algorithms/fill.hpp>
+#include <hpx/parallel/segmented_algorithms/find.hpp>
 #include <hpx/parallel/segmented_algorithms/for_each.hpp>
+#include <hpx/parallel/segmented_algorithms/generate.hpp>
+#include <hpx/parallel/segmented_algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/segmented_algorithms/minmax.hpp>
+#include <hpx/parallel/segmented_algorithms/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/sample_sort.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/transform.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_reduce.hpp>
 
 #endif
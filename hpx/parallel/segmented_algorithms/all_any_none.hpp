@@ -0,0 +1,194 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_ALL_ANY_NONE_DEC_16_2015_1140AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_ALL_ANY_NONE_DEC_16_2015_1140AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/all_any_none.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_none_of, segmented_any_of, segmented_all_of
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // All three algorithms combine the results for the segments the same
+        // way: the overall result is \a decisive as soon as the result for
+        // one of the segments is \a decisive, and !decisive otherwise.
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F>
+        static typename util::detail::algorithm_result<ExPolicy, bool>::type
+        segmented_all_any_none(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, bool decisive,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            for (segment_type const& s : segments)
+            {
+                bool r = dispatch(traits::get_id(s.sit), algo, policy,
+                    true_(), s.beg, s.end, f);
+                if (r == decisive)
+                    return result::get(std::move(r));
+            }
+
+            return result::get(!decisive);
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F>
+        static typename util::detail::algorithm_result<ExPolicy, bool>::type
+        segmented_all_any_none(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, bool decisive,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<future<bool> > segments_result;
+            segments_result.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                segments_result.push_back(dispatch_async(
+                    traits::get_id(s.sit), algo, policy, forced_seq(),
+                    s.beg, s.end, f));
+            }
+
+            return result::get(
+                lcos::local::dataflow(
+                    [decisive](std::vector<future<bool> > && r) -> bool
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        for (future<bool>& v : r)
+                        {
+                            if (v.get() == decisive)
+                                return decisive;
+                        }
+                        return !decisive;
+                    },
+                    std::move(segments_result)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return util::detail::algorithm_result<ExPolicy, bool>::get(true);
+
+            return segmented_all_any_none(none_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), false, is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return util::detail::algorithm_result<ExPolicy, bool>::get(false);
+
+            return segmented_all_any_none(any_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), true, is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return util::detail::algorithm_result<ExPolicy, bool>::get(true);
+
+            return segmented_all_any_none(all_of(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), false, is_seq());
+        }
+
+        // forward declare the non-segmented versions of these algorithms
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        none_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        any_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        all_of_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -12,12 +12,15 @@
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/components/colocating_distribution_policy.hpp>
 #include <hpx/util/decay.hpp>
+#include <hpx/util/tuple.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 
+#include <utility>
+
 #include <boost/utility/enable_if.hpp>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
@@ -71,6 +74,102 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
         }
     };
 
+    // results combining two iterators (for instance the final positions of
+    // the input and the output sequences)
+    template <typename Iter1, typename Iter2>
+    struct algorithm_result_helper<
+        std::pair<Iter1, Iter2>,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iter1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef hpx::traits::segmented_local_iterator_traits<Iter1> traits1;
+        typedef hpx::traits::segmented_local_iterator_traits<Iter2> traits2;
+
+        static BOOST_FORCEINLINE std::pair<Iter1, Iter2>
+        call(std::pair<
+            typename traits1::local_raw_iterator,
+            typename traits2::local_raw_iterator
+        >&& p)
+        {
+            return std::make_pair(traits1::remote(std::move(p.first)),
+                traits2::remote(std::move(p.second)));
+        }
+    };
+
+    template <typename Iter1, typename Iter2>
+    struct algorithm_result_helper<
+        future<std::pair<Iter1, Iter2> >,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iter1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef algorithm_result_helper<std::pair<Iter1, Iter2> > helper;
+        typedef std::pair<
+                typename helper::traits1::local_raw_iterator,
+                typename helper::traits2::local_raw_iterator
+            > local_result_type;
+
+        static BOOST_FORCEINLINE future<std::pair<Iter1, Iter2> >
+        call(future<local_result_type>&& f)
+        {
+            typedef future<local_result_type> argtype;
+            return f.then([](argtype&& f) { return helper::call(f.get()); });
+        }
+    };
+
+    template <typename Iter1, typename Iter2>
+    struct algorithm_result_helper<
+        hpx::util::tuple<Iter1, Iter2>,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iter1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef hpx::traits::segmented_local_iterator_traits<Iter1> traits1;
+        typedef hpx::traits::segmented_local_iterator_traits<Iter2> traits2;
+
+        static BOOST_FORCEINLINE hpx::util::tuple<Iter1, Iter2>
+        call(hpx::util::tuple<
+            typename traits1::local_raw_iterator,
+            typename traits2::local_raw_iterator
+        >&& t)
+        {
+            return hpx::util::make_tuple(
+                traits1::remote(std::move(hpx::util::get<0>(t))),
+                traits2::remote(std::move(hpx::util::get<1>(t))));
+        }
+    };
+
+    template <typename Iter1, typename Iter2>
+    struct algorithm_result_helper<
+        future<hpx::util::tuple<Iter1, Iter2> >,
+        typename boost::enable_if<
+                typename hpx::traits::segmented_local_iterator_traits<
+                        Iter1
+                    >::is_segmented_local_iterator
+            >::type>
+    {
+        typedef algorithm_result_helper<hpx::util::tuple<Iter1, Iter2> >
+            helper;
+        typedef hpx::util::tuple<
+                typename helper::traits1::local_raw_iterator,
+                typename helper::traits2::local_raw_iterator
+            > local_result_type;
+
+        static BOOST_FORCEINLINE future<hpx::util::tuple<Iter1, Iter2> >
+        call(future<local_result_type>&& f)
+        {
+            typedef future<local_result_type> argtype;
+            return f.then([](argtype&& f) { return helper::call(f.get()); });
+        }
+    };
+
     template <>
     struct algorithm_result_helper<future<void> >
     {
@@ -0,0 +1,76 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_REDUCE_DEC_16_2015_0931AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_REDUCE_DEC_16_2015_0931AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/unwrapped.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // Reduce the (non-empty) part of a segment without an initial value,
+    // this is run on the locality where the segment lives.
+    template <typename T>
+    struct segment_reduce
+      : public detail::algorithm<segment_reduce<T>, T>
+    {
+        segment_reduce()
+          : segment_reduce::algorithm("segment_reduce")
+        {}
+
+        template <typename ExPolicy, typename InIter, typename Op>
+        static T
+        sequential(ExPolicy, InIter first, InIter last, Op && op)
+        {
+            T init = *first;
+            return std::accumulate(++first, last, std::move(init),
+                std::forward<Op>(op));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Op>
+        static typename util::detail::algorithm_result<ExPolicy, T>::type
+        parallel(ExPolicy policy, FwdIter first, FwdIter last, Op && op)
+        {
+            typedef typename hpx::util::decay<Op>::type op_type;
+            op_type f(std::forward<Op>(op));
+
+            return util::partitioner<ExPolicy, T>::call(
+                policy, first, std::distance(first, last),
+                [f](FwdIter part_begin, std::size_t part_size) -> T
+                {
+                    T part_init = *part_begin++;
+                    return util::accumulate_n(part_begin, part_size - 1,
+                        std::move(part_init), f);
+                },
+                hpx::util::unwrapped([f](std::vector<T> && results) -> T
+                {
+                    T init = results.front();
+                    return util::accumulate_n(results.begin() + 1,
+                        results.size() - 1, std::move(init), f);
+                }));
+        }
+    };
+
+    /// \endcond
+}}}}
+
+#endif
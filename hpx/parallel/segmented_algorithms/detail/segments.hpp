@@ -0,0 +1,147 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_SEGMENTS_DEC_16_2015_0914AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_DETAIL_SEGMENTS_DEC_16_2015_0914AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+
+#include <iterator>
+#include <vector>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1) { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // The part of a sequence handled on one of the segments.
+    template <typename SegIter>
+    struct local_segment
+    {
+        typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+
+        typename traits::segment_iterator sit;
+        typename traits::local_iterator beg;
+        typename traits::local_iterator end;
+    };
+
+    // Collect the non-empty parts of all segments touched by [first, last),
+    // in order.
+    template <typename SegIter>
+    std::vector<local_segment<SegIter> >
+    get_local_segments(SegIter first, SegIter last)
+    {
+        typedef local_segment<SegIter> segment_type;
+        typedef typename segment_type::traits traits;
+
+        typename traits::segment_iterator sit = traits::segment(first);
+        typename traits::segment_iterator send = traits::segment(last);
+
+        std::vector<segment_type> segments;
+        segments.reserve(std::distance(sit, send) + 1);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            segment_type s = { sit, traits::local(first), traits::local(last) };
+            if (s.beg != s.end)
+                segments.push_back(s);
+        }
+        else {
+            // handle the remaining part of the first partition
+            segment_type s = { sit, traits::local(first), traits::end(sit) };
+            if (s.beg != s.end)
+                segments.push_back(s);
+
+            // handle all of the full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                segment_type p = { sit, traits::begin(sit), traits::end(sit) };
+                if (p.beg != p.end)
+                    segments.push_back(p);
+            }
+
+            // handle the beginning of the last partition
+            segment_type l = { sit, traits::begin(sit), traits::local(last) };
+            if (l.beg != l.end)
+                segments.push_back(l);
+        }
+
+        return segments;
+    }
+
+    // The part of two sequences handled on one of the segments. The second
+    // sequence is assumed to be segmented in the same way as the first one.
+    template <typename SegIter, typename SegOutIter>
+    struct paired_segment
+    {
+        typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+        typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+            output_traits;
+
+        typename traits::segment_iterator sit;
+        typename traits::local_iterator beg;
+        typename traits::local_iterator end;
+        typename output_traits::segment_iterator sdest;
+        typename output_traits::local_iterator out;
+    };
+
+    template <typename SegIter, typename SegOutIter>
+    std::vector<paired_segment<SegIter, SegOutIter> >
+    get_paired_segments(SegIter first, SegIter last, SegOutIter dest)
+    {
+        typedef paired_segment<SegIter, SegOutIter> segment_type;
+        typedef typename segment_type::traits traits;
+        typedef typename segment_type::output_traits output_traits;
+
+        typename traits::segment_iterator sit = traits::segment(first);
+        typename traits::segment_iterator send = traits::segment(last);
+        typename output_traits::segment_iterator sdest =
+            output_traits::segment(dest);
+
+        std::vector<segment_type> segments;
+        segments.reserve(std::distance(sit, send) + 1);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            segment_type s = { sit, traits::local(first),
+                traits::local(last), sdest, output_traits::local(dest) };
+            if (s.beg != s.end)
+                segments.push_back(s);
+        }
+        else {
+            // handle the remaining part of the first partition
+            segment_type s = { sit, traits::local(first), traits::end(sit),
+                sdest, output_traits::local(dest) };
+            if (s.beg != s.end)
+                segments.push_back(s);
+
+            // handle all of the full partitions
+            for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
+            {
+                segment_type p = { sit, traits::begin(sit),
+                    traits::end(sit), sdest, output_traits::begin(sdest) };
+                if (p.beg != p.end)
+                    segments.push_back(p);
+            }
+
+            // handle the beginning of the last partition
+            segment_type l = { sit, traits::begin(sit),
+                traits::local(last), sdest, output_traits::begin(sdest) };
+            if (l.beg != l.end)
+                segments.push_back(l);
+        }
+
+        return segments;
+    }
+
+    /// \endcond
+}}}}
+
+#endif
@@ -0,0 +1,150 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_EQUAL_DEC_16_2015_1158AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_EQUAL_DEC_16_2015_1158AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_equal
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The second sequence is assumed to be segmented in the same way as
+        // the first sequence.
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename F>
+        static typename util::detail::algorithm_result<ExPolicy, bool>::type
+        segmented_equal(ExPolicy const& policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, F && f, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits;
+            typedef paired_segment<SegIter1, SegIter2> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first1, last1, first2);
+
+            for (segment_type const& s : segments)
+            {
+                if (!dispatch(traits::get_id(s.sit), equal(), policy,
+                        true_(), s.beg, s.end, s.out, f))
+                {
+                    return result::get(false);
+                }
+            }
+
+            return result::get(true);
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename F>
+        static typename util::detail::algorithm_result<ExPolicy, bool>::type
+        segmented_equal(ExPolicy const& policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, F && f, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits;
+            typedef paired_segment<SegIter1, SegIter2> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            typedef typename std::iterator_traits<SegIter1>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first1, last1, first2);
+
+            std::vector<future<bool> > segments_equal;
+            segments_equal.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                segments_equal.push_back(dispatch_async(
+                    traits::get_id(s.sit), equal(), policy, forced_seq(),
+                    s.beg, s.end, s.out, f));
+            }
+
+            return result::get(
+                lcos::local::dataflow(
+                    [](std::vector<future<bool> > && r) -> bool
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        return std::all_of(r.begin(), r.end(),
+                            [](future<bool>& v)
+                            {
+                                return v.get();
+                            });
+                    },
+                    std::move(segments_equal)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy && policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first1 == last1)
+                return util::detail::algorithm_result<ExPolicy, bool>::get(true);
+
+            return segmented_equal(
+                std::forward<ExPolicy>(policy), first1, last1, first2,
+                std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy && policy, InIter1 first1, InIter1 last1,
+            InIter2 first2, F && f, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
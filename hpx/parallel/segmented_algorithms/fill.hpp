@@ -0,0 +1,84 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_FILL_DEC_16_2015_1012AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_FILL_DEC_16_2015_1012AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/void_guard.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/fill.hpp>
+#include <hpx/parallel/segmented_algorithms/for_each.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_fill
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The value is sent along to the localities the segments live on,
+        // assigning it is performed by the segmented for_each.
+        template <typename T>
+        struct fill_function
+        {
+            fill_function(T const& val = T())
+              : value_(val)
+            {}
+
+            template <typename U>
+            void operator()(U& val) const
+            {
+                val = value_;
+            }
+
+            T value_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & value_;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, SegIter first, SegIter last, T const& value,
+            std::true_type)
+        {
+            typedef typename util::detail::algorithm_result<ExPolicy>::type
+                result_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            return hpx::util::void_guard<result_type>(),
+                for_each_(std::forward<ExPolicy>(policy), first, last,
+                    fill_function<value_type>(value),
+                    util::projection_identity(), std::true_type());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        fill_(ExPolicy && policy, InIter first, InIter last, T const& value,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
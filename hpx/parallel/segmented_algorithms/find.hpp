@@ -0,0 +1,211 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_FIND_DEC_16_2015_1121AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_FIND_DEC_16_2015_1121AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/find.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_find
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // sequential remote implementation, stops at the first segment which
+        // holds a matching element
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename... Args>
+        static typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_find(Algo && algo, ExPolicy const& policy, SegIter first,
+            SegIter last, boost::mpl::true_, Args &&... args)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            for (segment_type const& s : segments)
+            {
+                local_iterator_type out = dispatch(traits::get_id(s.sit),
+                    algo, policy, true_(), s.beg, s.end, args...);
+                if (out != s.end)
+                    return result::get(traits::compose(s.sit, out));
+            }
+
+            return result::get(std::move(last));
+        }
+
+        // parallel remote implementation, searches all segments concurrently
+        // and selects the match in the left-most segment
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename... Args>
+        static typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_find(Algo && algo, ExPolicy const& policy, SegIter first,
+            SegIter last, boost::mpl::false_, Args &&... args)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<future<local_iterator_type> > segments_found;
+            segments_found.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                segments_found.push_back(dispatch_async(
+                    traits::get_id(s.sit), algo, policy, forced_seq(),
+                    s.beg, s.end, args...));
+            }
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<future<local_iterator_type> > && r)
+                        ->  SegIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        for (std::size_t i = 0; i != r.size(); ++i)
+                        {
+                            local_iterator_type out = r[i].get();
+                            if (out != segments[i].end)
+                                return traits::compose(segments[i].sit, out);
+                        }
+                        return last;
+                    },
+                    std::move(segments_found)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        find_(ExPolicy && policy, SegIter first, SegIter last, T const& val,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, SegIter
+                    >::get(std::move(last));
+            }
+
+            return segmented_find(
+                find<typename traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last, is_seq(), val);
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        find_if_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, SegIter
+                    >::get(std::move(last));
+            }
+
+            return segmented_find(
+                find_if<typename traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last, is_seq(),
+                std::forward<F>(f));
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        find_if_not_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, SegIter
+                    >::get(std::move(last));
+            }
+
+            return segmented_find(
+                find_if_not<typename traits::local_iterator>(),
+                std::forward<ExPolicy>(policy), first, last, is_seq(),
+                std::forward<F>(f));
+        }
+
+        // forward declare the non-segmented versions of these algorithms
+        template <typename ExPolicy, typename InIter, typename T>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_(ExPolicy && policy, InIter first, InIter last, T const& val,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        template <typename ExPolicy, typename InIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy, InIter>::type
+        find_if_not_(ExPolicy && policy, InIter first, InIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
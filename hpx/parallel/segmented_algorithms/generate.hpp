@@ -0,0 +1,87 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_GENERATE_DEC_16_2015_1020AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_GENERATE_DEC_16_2015_1020AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/void_guard.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/generate.hpp>
+#include <hpx/parallel/segmented_algorithms/for_each.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_generate
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Each of the segments invokes its own copy of the generator, in the
+        // same way as each of the chunks of the non-segmented algorithm does.
+        template <typename F>
+        struct generate_function
+        {
+            generate_function()
+            {}
+
+            explicit generate_function(F f)
+              : f_(std::move(f))
+            {}
+
+            template <typename T>
+            void operator()(T& val) const
+            {
+                val = f_();
+            }
+
+            mutable F f_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & f_;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        generate_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            std::true_type)
+        {
+            typedef typename util::detail::algorithm_result<ExPolicy>::type
+                result_type;
+            typedef typename hpx::util::decay<F>::type function_type;
+
+            return hpx::util::void_guard<result_type>(),
+                for_each_(std::forward<ExPolicy>(policy), first, last,
+                    generate_function<function_type>(std::forward<F>(f)),
+                    util::projection_identity(), std::true_type());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename F>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        generate_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
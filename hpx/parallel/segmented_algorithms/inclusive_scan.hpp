@@ -0,0 +1,210 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_INCLUSIVE_SCAN_DEC_16_2015_0945AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_INCLUSIVE_SCAN_DEC_16_2015_0945AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/unwrapped.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_inclusive_scan
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        static typename util::detail::algorithm_result<
+            ExPolicy, SegOutIter
+        >::type
+        segmented_inclusive_scan(ExPolicy const& policy, SegIter first,
+            SegIter last, SegOutIter dest, T init, Op && op,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+            typedef paired_segment<SegIter, SegOutIter> segment_type;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first, last, dest);
+
+            for (std::size_t i = 0; i != segments.size(); ++i)
+            {
+                segment_type const& s = segments[i];
+
+                local_output_iterator_type out = dispatch(
+                    traits::get_id(s.sit),
+                    inclusive_scan<local_output_iterator_type>(), policy,
+                    true_(), s.beg, s.end, s.out, init, op);
+                dest = output_traits::compose(s.sdest, out);
+
+                // the sum of the elements of this segment is needed as part
+                // of the initial value of the next segment only
+                if (i + 1 != segments.size())
+                {
+                    init = op(init, dispatch(traits::get_id(s.sit),
+                        segment_reduce<T>(), policy, true_(),
+                        s.beg, s.end, op));
+                }
+            }
+
+            return util::detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                std::move(dest));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename T, typename Op>
+        static typename util::detail::algorithm_result<
+            ExPolicy, SegOutIter
+        >::type
+        segmented_inclusive_scan(ExPolicy const& policy, SegIter first,
+            SegIter last, SegOutIter dest, T init, Op && op,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+            typedef paired_segment<SegIter, SegOutIter> segment_type;
+            typedef typename hpx::util::decay<Op>::type op_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first, last, dest);
+            HPX_ASSERT(!segments.empty());
+
+            // first pass: reduce all but the last segment concurrently
+            std::vector<shared_future<T> > sums;
+            sums.reserve(segments.size() - 1);
+
+            for (std::size_t i = 0; i != segments.size() - 1; ++i)
+            {
+                segment_type const& s = segments[i];
+                sums.push_back(dispatch_async(traits::get_id(s.sit),
+                    segment_reduce<T>(), policy, forced_seq(),
+                    s.beg, s.end, op));
+            }
+
+            // second pass: scan all segments concurrently, each starting off
+            // the combined sums of the preceding segments
+            op_type f(std::forward<Op>(op));
+            return util::detail::algorithm_result<ExPolicy, SegOutIter>::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<T> > && r) -> SegOutIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        std::vector<shared_future<local_output_iterator_type> >
+                            scans;
+                        scans.reserve(segments.size());
+
+                        T prefix = init;
+                        for (std::size_t i = 0; i != segments.size(); ++i)
+                        {
+                            segment_type const& s = segments[i];
+                            scans.push_back(dispatch_async(
+                                traits::get_id(s.sit),
+                                inclusive_scan<local_output_iterator_type>(),
+                                policy, forced_seq(),
+                                s.beg, s.end, s.out, prefix, f));
+
+                            if (i + 1 != segments.size())
+                                prefix = f(prefix, r[i].get());
+                        }
+
+                        hpx::wait_all(scans);
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(scans, errors);
+
+                        return output_traits::compose(
+                            segments.back().sdest, scans.back().get());
+                    },
+                    std::move(sums)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        inline typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        inclusive_scan_(ExPolicy&& policy, InIter first, InIter last,
+            OutIter dest, T && init, Op && op, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef typename hpx::util::decay<T>::type init_type;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, OutIter>::get(
+                    std::move(dest));
+            }
+
+            return segmented_inclusive_scan(
+                std::forward<ExPolicy>(policy), first, last, dest,
+                init_type(std::forward<T>(init)), std::forward<Op>(op),
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename T, typename Op>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        inclusive_scan_(ExPolicy&& policy, InIter first, InIter last,
+            OutIter dest, T && init, Op && op, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,503 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_MINMAX_DEC_10_2015_0915AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_MINMAX_DEC_10_2015_0915AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/runtime/serialization/map.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_minormax, segmented_minmax
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Select the index of the overall result from the values referred to
+        // by the per-segment results.
+        struct min_element_reduce
+        {
+            template <typename T, typename F, typename Proj>
+            std::size_t operator()(std::vector<T> const& values,
+                F const& f, Proj const& proj) const
+            {
+                return std::distance(values.begin(),
+                    sequential_min_element(values.begin(), values.size(),
+                        f, proj));
+            }
+        };
+
+        struct max_element_reduce
+        {
+            template <typename T, typename F, typename Proj>
+            std::size_t operator()(std::vector<T> const& values,
+                F const& f, Proj const& proj) const
+            {
+                return std::distance(values.begin(),
+                    sequential_max_element(values.begin(), values.size(),
+                        f, proj));
+            }
+        };
+
+        // Each of the per-segment results is dereferenced exactly once, the
+        // comparisons are performed locally.
+        template <typename SegIter, typename F, typename Proj,
+            typename Reduce>
+        SegIter select_segmented_minormax(
+            std::vector<SegIter> const& positions, F const& f,
+            Proj const& proj, Reduce const& reduce)
+        {
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            HPX_ASSERT(!positions.empty());
+
+            std::vector<value_type> values;
+            values.reserve(positions.size());
+            for (SegIter const& it : positions)
+                values.push_back(*it);
+
+            return positions[reduce(values, f, proj)];
+        }
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F, typename Proj, typename Reduce>
+        static typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_minormax(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, Proj && proj,
+            Reduce const& reduce, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            using boost::mpl::true_;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<SegIter> positions;
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        algo, policy, true_(), beg, end, f, proj);
+                    positions.push_back(traits::compose(sit, out));
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        algo, policy, true_(), beg, end, f, proj);
+                    positions.push_back(traits::compose(sit, out));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        local_iterator_type out = dispatch(traits::get_id(sit),
+                            algo, policy, true_(), beg, end, f, proj);
+                        positions.push_back(traits::compose(sit, out));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    local_iterator_type out = dispatch(traits::get_id(sit),
+                        algo, policy, true_(), beg, end, f, proj);
+                    positions.push_back(traits::compose(sit, out));
+                }
+            }
+
+            return result::get(
+                select_segmented_minormax(positions, f, proj, reduce));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename F, typename Proj, typename Reduce>
+        static typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_minormax(Algo && algo, ExPolicy const& policy,
+            SegIter first, SegIter last, F && f, Proj && proj,
+            Reduce const& reduce, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, SegIter> result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<shared_future<local_iterator_type> > segments;
+            segments.reserve(std::distance(sit, send));
+
+            // remember the segment each of the results belongs to
+            std::vector<segment_iterator> segment_positions;
+            segment_positions.reserve(std::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, f, proj));
+                    segment_positions.push_back(sit);
+                }
+            }
+            else {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, f, proj));
+                    segment_positions.push_back(sit);
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            algo, policy, forced_seq(), beg, end, f, proj));
+                        segment_positions.push_back(sit);
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit),
+                        algo, policy, forced_seq(), beg, end, f, proj));
+                    segment_positions.push_back(sit);
+                }
+            }
+            HPX_ASSERT(!segments.empty());
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<shared_future<local_iterator_type> > && r)
+                        ->  SegIter
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        std::vector<SegIter> positions;
+                        positions.reserve(r.size());
+                        for (std::size_t i = 0; i != r.size(); ++i)
+                        {
+                            positions.push_back(traits::compose(
+                                segment_positions[i], r[i].get()));
+                        }
+
+                        return select_segmented_minormax(
+                            positions, f, proj, reduce);
+                    },
+                    std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        min_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            Proj && proj, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+            typedef typename iterator_traits::local_iterator
+                local_iterator_type;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(first));
+            }
+
+            return segmented_minormax(
+                min_element<local_iterator_type>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), std::forward<Proj>(proj),
+                min_element_reduce(), is_seq());
+        }
+
+        template <typename ExPolicy, typename SegIter, typename F,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        max_element_(ExPolicy && policy, SegIter first, SegIter last, F && f,
+            Proj && proj, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+            typedef hpx::traits::segmented_iterator_traits<SegIter>
+                iterator_traits;
+            typedef typename iterator_traits::local_iterator
+                local_iterator_type;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    std::move(first));
+            }
+
+            return segmented_minormax(
+                max_element<local_iterator_type>(),
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), std::forward<Proj>(proj),
+                max_element_reduce(), is_seq());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Combine the per-segment (min, max) pairs the same way as
+        // sequential_minmax_element_ind does: the first of the smallest and
+        // the last of the largest elements is selected. Each of the
+        // per-segment results is dereferenced exactly once.
+        template <typename SegIter, typename F>
+        std::pair<SegIter, SegIter> select_segmented_minmax(
+            std::vector<std::pair<SegIter, SegIter> > const& positions,
+            F const& f)
+        {
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            HPX_ASSERT(!positions.empty());
+
+            std::vector<std::pair<value_type, value_type> > values;
+            values.reserve(positions.size());
+            for (std::pair<SegIter, SegIter> const& p : positions)
+                values.push_back(std::make_pair(*p.first, *p.second));
+
+            std::size_t min_pos = 0, max_pos = 0;
+            for (std::size_t i = 1; i != values.size(); ++i)
+            {
+                if (f(values[i].first, values[min_pos].first))
+                    min_pos = i;
+                if (!f(values[i].second, values[max_pos].second))
+                    max_pos = i;
+            }
+
+            return std::make_pair(
+                positions[min_pos].first, positions[max_pos].second);
+        }
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::pair<SegIter, SegIter>
+        >::type
+        segmented_minmax(ExPolicy const& policy, SegIter first,
+            SegIter last, F && f, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef std::pair<local_iterator_type, local_iterator_type>
+                local_result_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<
+                    ExPolicy, std::pair<SegIter, SegIter>
+                > result;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<std::pair<SegIter, SegIter> > positions;
+            positions.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                local_result_type out = dispatch(traits::get_id(s.sit),
+                    minmax_element<local_iterator_type>(), policy, true_(),
+                    s.beg, s.end, f);
+                positions.push_back(std::make_pair(
+                    traits::compose(s.sit, out.first),
+                    traits::compose(s.sit, out.second)));
+            }
+
+            return result::get(select_segmented_minmax(positions, f));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::pair<SegIter, SegIter>
+        >::type
+        segmented_minmax(ExPolicy const& policy, SegIter first,
+            SegIter last, F && f, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef std::pair<local_iterator_type, local_iterator_type>
+                local_result_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef util::detail::algorithm_result<
+                    ExPolicy, std::pair<SegIter, SegIter>
+                > result;
+            typedef typename hpx::util::decay<F>::type compare_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<future<local_result_type> > segments_minmax;
+            segments_minmax.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                segments_minmax.push_back(dispatch_async(
+                    traits::get_id(s.sit),
+                    minmax_element<local_iterator_type>(), policy,
+                    forced_seq(), s.beg, s.end, f));
+            }
+
+            compare_type comp(std::forward<F>(f));
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<future<local_result_type> > && r)
+                        ->  std::pair<SegIter, SegIter>
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        std::vector<std::pair<SegIter, SegIter> > positions;
+                        positions.reserve(r.size());
+                        for (std::size_t i = 0; i != r.size(); ++i)
+                        {
+                            local_result_type out = r[i].get();
+                            positions.push_back(std::make_pair(
+                                traits::compose(segments[i].sit, out.first),
+                                traits::compose(segments[i].sit, out.second)));
+                        }
+
+                        return select_segmented_minmax(positions, comp);
+                    },
+                    std::move(segments_minmax)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename F>
+        inline typename util::detail::algorithm_result<
+            ExPolicy, std::pair<SegIter, SegIter>
+        >::type
+        minmax_element_(ExPolicy && policy, SegIter first, SegIter last,
+            F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, std::pair<SegIter, SegIter>
+                    >::get(std::make_pair(first, first));
+            }
+
+            return segmented_minmax(
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of these algorithms
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        min_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::false_type);
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        max_element_(ExPolicy && policy, FwdIter first, FwdIter last, F && f,
+            Proj && proj, std::false_type);
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<FwdIter, FwdIter>
+        >::type
+        minmax_element_(ExPolicy && policy, FwdIter first, FwdIter last,
+            F && f, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,146 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_REDUCE_DEC_16_2015_1102AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_REDUCE_DEC_16_2015_1102AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_reduce
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename T, typename F>
+        static typename util::detail::algorithm_result<ExPolicy, T>::type
+        segmented_reduce(ExPolicy const& policy, SegIter first, SegIter last,
+            T init, F && f, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef local_segment<SegIter> segment_type;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            for (segment_type const& s : segments)
+            {
+                init = f(init,
+                    dispatch(traits::get_id(s.sit), segment_reduce<T>(),
+                        policy, true_(), s.beg, s.end, f));
+            }
+
+            return util::detail::algorithm_result<ExPolicy, T>::get(
+                std::move(init));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename T, typename F>
+        static typename util::detail::algorithm_result<ExPolicy, T>::type
+        segmented_reduce(ExPolicy const& policy, SegIter first, SegIter last,
+            T init, F && f, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef local_segment<SegIter> segment_type;
+            typedef typename hpx::util::decay<F>::type op_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<future<T> > segments_sum;
+            segments_sum.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                segments_sum.push_back(dispatch_async(traits::get_id(s.sit),
+                    segment_reduce<T>(), policy, forced_seq(),
+                    s.beg, s.end, f));
+            }
+
+            // combine the partial results in order as the operation is not
+            // required to be commutative
+            op_type op(std::forward<F>(f));
+            return util::detail::algorithm_result<ExPolicy, T>::get(
+                lcos::local::dataflow(
+                    [=](std::vector<future<T> > && r) mutable -> T
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        for (future<T>& sum : r)
+                            init = op(init, sum.get());
+                        return init;
+                    },
+                    std::move(segments_sum)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename T, typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, SegIter first, SegIter last, T init,
+            F && f, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, T>::get(
+                    std::move(init));
+            }
+
+            return segmented_reduce(
+                std::forward<ExPolicy>(policy), first, last, std::move(init),
+                std::forward<F>(f), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename T, typename F>
+        typename util::detail::algorithm_result<ExPolicy, T>::type
+        reduce_(ExPolicy && policy, InIter first, InIter last, T init,
+            F && f, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
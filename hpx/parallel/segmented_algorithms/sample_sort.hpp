@@ -0,0 +1,768 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/segmented_algorithms/sample_sort.hpp
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SAMPLE_SORT_DEC_18_2015_0936AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SAMPLE_SORT_DEC_18_2015_0936AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/runtime/components/new.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The time spent in each of the phases of a \a sample_sort, all values
+    /// are given in nanoseconds.
+    struct sample_sort_timings
+    {
+        sample_sort_timings()
+          : local_sort(0), splitters(0), exchange(0), merge(0)
+        {}
+
+        /// Sorting the segments locally.
+        boost::uint64_t local_sort;
+        /// Sampling the sorted segments and computing the buckets.
+        boost::uint64_t splitters;
+        /// Moving the buckets to the localities of their segments.
+        boost::uint64_t exchange;
+        /// Merging the buckets and storing the values into the segments.
+        boost::uint64_t merge;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sample_sort
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The sample sort first sorts all segments locally. A regular sample
+        // of the sorted segments is used to select one splitter per segment
+        // boundary, those split each of the segments into one bucket per
+        // segment. All buckets with the same index are gathered on the
+        // locality of the corresponding segment and are merged there.
+        // Finally, every segment fetches the values for the global positions
+        // it covers from the merged buckets, which leaves the sizes of the
+        // segments unchanged. The merged buckets are kept in temporary
+        // partitions as the segments can be overwritten only after all of
+        // the values have been moved out of them.
+
+        // The number of samples taken per segment (if enough values are
+        // available).
+        static std::size_t const sample_sort_oversampling = 32;
+
+        // A sorted run of values which has to be moved to another locality.
+        template <typename LocalIter>
+        struct sample_sort_run
+        {
+            hpx::id_type id;
+            LocalIter beg;
+            LocalIter end;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & id & beg & end;
+            }
+        };
+
+        // The part [begin, end) of a merged bucket.
+        struct sample_sort_slice
+        {
+            hpx::id_type bucket;
+            std::size_t begin;
+            std::size_t end;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & bucket & begin & end;
+            }
+        };
+
+        // Collects the remote operations of one of the phases. The sequential
+        // version runs the operations one after the other.
+        template <typename ExPolicy, typename R, typename IsSeq>
+        struct sample_sort_phase
+        {
+            void add(future<R> && f)
+            {
+                if (IsSeq::value)
+                    f.wait();
+                operations_.push_back(std::move(f));
+            }
+
+            std::vector<R> get()
+            {
+                hpx::wait_all(operations_);
+
+                // handle any remote exceptions, will throw on error
+                std::list<boost::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy
+                >::call(operations_, errors);
+
+                std::vector<R> results;
+                results.reserve(operations_.size());
+                for (future<R>& f : operations_)
+                    results.push_back(f.get());
+                return results;
+            }
+
+            std::vector<future<R> > operations_;
+        };
+
+        // Return every stride'th value of a (sorted) segment.
+        template <typename T>
+        struct sample_sort_samples
+          : public detail::algorithm<sample_sort_samples<T>, std::vector<T> >
+        {
+            sample_sort_samples()
+              : sample_sort_samples::algorithm("sample_sort_samples")
+            {}
+
+            template <typename ExPolicy, typename RandomIt>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::size_t stride)
+            {
+                std::size_t count = std::distance(first, last);
+
+                std::vector<T> samples;
+                samples.reserve((count + stride - 1) / stride);
+                for (std::size_t i = 0; i < count; i += stride)
+                    samples.push_back(*(first + i));
+                return samples;
+            }
+        };
+
+        // Return the boundaries of the buckets of a (sorted) segment as
+        // defined by the given splitters.
+        template <typename T>
+        struct sample_sort_buckets
+          : public detail::algorithm<
+                sample_sort_buckets<T>, std::vector<std::size_t>
+            >
+        {
+            sample_sort_buckets()
+              : sample_sort_buckets::algorithm("sample_sort_buckets")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<std::size_t>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<T> const& splitters, Compare && comp,
+                Proj && proj)
+            {
+                compare_projected<Compare, Proj> less(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                std::vector<std::size_t> bounds;
+                bounds.reserve(splitters.size() + 2);
+                bounds.push_back(0);
+
+                RandomIt it = first;
+                for (T const& splitter : splitters)
+                {
+                    it = std::lower_bound(it, last, splitter, less);
+                    bounds.push_back(std::distance(first, it));
+                }
+
+                bounds.push_back(std::distance(first, last));
+                return bounds;
+            }
+        };
+
+        // Return the values of the given part of a segment.
+        template <typename T>
+        struct sample_sort_fetch
+          : public detail::algorithm<sample_sort_fetch<T>, std::vector<T> >
+        {
+            sample_sort_fetch()
+              : sample_sort_fetch::algorithm("sample_sort_fetch")
+            {}
+
+            template <typename ExPolicy, typename RandomIt>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last)
+            {
+                return std::vector<T>(first, last);
+            }
+        };
+
+        // Fetch all runs of a bucket and store them into a new temporary
+        // partition on this locality, returns the id of that partition.
+        template <typename T>
+        struct sample_sort_gather
+          : public detail::algorithm<sample_sort_gather<T>, hpx::id_type>
+        {
+            sample_sort_gather()
+              : sample_sort_gather::algorithm("sample_sort_gather")
+            {}
+
+            template <typename ExPolicy, typename LocalIter>
+            static hpx::id_type
+            sequential(ExPolicy,
+                std::vector<sample_sort_run<LocalIter> > const& runs)
+            {
+                typedef server::partitioned_vector<T> bucket_type;
+
+                std::vector<future<std::vector<T> > > fetched;
+                fetched.reserve(runs.size());
+
+                std::size_t count = 0;
+                for (sample_sort_run<LocalIter> const& r : runs)
+                {
+                    fetched.push_back(dispatch_async(r.id,
+                        sample_sort_fetch<T>(), parallel::seq,
+                        boost::mpl::true_(), r.beg, r.end));
+                    count += std::distance(r.beg, r.end);
+                }
+
+                hpx::id_type bucket =
+                    hpx::new_<bucket_type>(hpx::find_here(), count).get();
+                boost::shared_ptr<bucket_type> ptr =
+                    hpx::get_ptr<bucket_type>(bucket).get();
+
+                hpx::wait_all(fetched);
+
+                // handle any remote exceptions, will throw on error
+                std::list<boost::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    parallel::sequential_execution_policy
+                >::call(fetched, errors);
+
+                typename std::vector<T>::iterator out =
+                    ptr->get_data().begin();
+                for (future<std::vector<T> >& f : fetched)
+                {
+                    std::vector<T> values = f.get();
+                    out = std::copy(values.begin(), values.end(), out);
+                }
+
+                return bucket;
+            }
+        };
+
+        // Merge the sorted runs of a bucket (of the given sizes), neighboring
+        // runs are merged pairwise until only one run is left.
+        template <typename T>
+        struct sample_sort_merge
+          : public detail::algorithm<sample_sort_merge<T>, std::size_t>
+        {
+            sample_sort_merge()
+              : sample_sort_merge::algorithm("sample_sort_merge")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static std::size_t
+            sequential(ExPolicy, hpx::id_type const& bucket,
+                std::vector<std::size_t> const& sizes, Compare && comp,
+                Proj && proj)
+            {
+                typedef server::partitioned_vector<T> bucket_type;
+
+                boost::shared_ptr<bucket_type> ptr =
+                    hpx::get_ptr<bucket_type>(bucket).get();
+                std::vector<T>& data = ptr->get_data();
+
+                compare_projected<Compare, Proj> less(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                std::vector<std::size_t> bounds(1, 0);
+                bounds.reserve(sizes.size() + 1);
+                for (std::size_t size : sizes)
+                    bounds.push_back(bounds.back() + size);
+
+                while (bounds.size() > 2)
+                {
+                    std::vector<std::size_t> merged;
+                    merged.reserve(bounds.size() / 2 + 1);
+
+                    std::size_t i = 0;
+                    for (/**/; i + 2 < bounds.size(); i += 2)
+                    {
+                        std::inplace_merge(data.begin() + bounds[i],
+                            data.begin() + bounds[i + 1],
+                            data.begin() + bounds[i + 2], less);
+                        merged.push_back(bounds[i]);
+                    }
+
+                    // an odd run is carried over to the next round
+                    merged.push_back(bounds[i]);
+                    if (i + 1 < bounds.size())
+                        merged.push_back(bounds.back());
+
+                    bounds.swap(merged);
+                }
+
+                return data.size();
+            }
+        };
+
+        // Return the values of the given part of a merged bucket.
+        template <typename T>
+        struct sample_sort_fetch_slice
+          : public detail::algorithm<
+                sample_sort_fetch_slice<T>, std::vector<T>
+            >
+        {
+            sample_sort_fetch_slice()
+              : sample_sort_fetch_slice::algorithm("sample_sort_fetch_slice")
+            {}
+
+            template <typename ExPolicy>
+            static std::vector<T>
+            sequential(ExPolicy, hpx::id_type const& bucket,
+                std::size_t begin, std::size_t end)
+            {
+                typedef server::partitioned_vector<T> bucket_type;
+
+                boost::shared_ptr<bucket_type> ptr =
+                    hpx::get_ptr<bucket_type>(bucket).get();
+                std::vector<T> const& data = ptr->get_data();
+
+                return std::vector<T>(data.begin() + begin,
+                    data.begin() + end);
+            }
+        };
+
+        // Replace the values of a segment with the given slices of the
+        // merged buckets.
+        template <typename Iter>
+        struct sample_sort_store
+          : public detail::algorithm<sample_sort_store<Iter>, Iter>
+        {
+            sample_sort_store()
+              : sample_sort_store::algorithm("sample_sort_store")
+            {}
+
+            template <typename ExPolicy, typename RandomIt>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<sample_sort_slice> const& slices)
+            {
+                typedef typename std::iterator_traits<RandomIt>::value_type
+                    value_type;
+
+                std::vector<future<std::vector<value_type> > > fetched;
+                fetched.reserve(slices.size());
+
+                for (sample_sort_slice const& s : slices)
+                {
+                    fetched.push_back(dispatch_async(s.bucket,
+                        sample_sort_fetch_slice<value_type>(), parallel::seq,
+                        boost::mpl::true_(), s.bucket, s.begin, s.end));
+                }
+
+                hpx::wait_all(fetched);
+
+                // handle any remote exceptions, will throw on error
+                std::list<boost::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    parallel::sequential_execution_policy
+                >::call(fetched, errors);
+
+                RandomIt out = first;
+                for (future<std::vector<value_type> >& f : fetched)
+                {
+                    std::vector<value_type> values = f.get();
+                    out = std::copy(values.begin(), values.end(), out);
+                }
+
+                HPX_ASSERT(out == last);
+                return last;
+            }
+        };
+
+        // Run all phases of the sample sort, returns the time spent in each
+        // of them.
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj, typename IsSeq>
+        sample_sort_timings
+        sample_sort_phases(ExPolicy const& policy,
+            std::vector<local_segment<SegIter> > const& segments,
+            Compare const& comp, Proj const& proj, IsSeq)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef sample_sort_run<local_iterator_type> run_type;
+
+            using boost::mpl::true_;
+            using hpx::util::high_resolution_clock;
+
+            std::size_t const parts = segments.size();
+            sample_sort_timings timings;
+
+            // sort all segments locally
+            boost::uint64_t t = high_resolution_clock::now();
+
+            sample_sort_phase<ExPolicy, local_iterator_type, IsSeq> sorting;
+            for (segment_type const& s : segments)
+            {
+                sorting.add(dispatch_async(traits::get_id(s.sit),
+                    sort_segment<local_iterator_type>(), policy, IsSeq(),
+                    s.beg, s.end, comp, proj));
+            }
+            sorting.get();
+
+            timings.local_sort = high_resolution_clock::now() - t;
+            if (parts < 2)
+                return timings;
+
+            // select the splitters from a regular sample of all segments, the
+            // splitters are placed at the global positions of the segment
+            // boundaries, which keeps the buckets close to the segment sizes
+            t = high_resolution_clock::now();
+
+            std::vector<std::size_t> offsets(1, 0);
+            offsets.reserve(parts + 1);
+            for (segment_type const& s : segments)
+            {
+                offsets.push_back(
+                    offsets.back() + std::distance(s.beg, s.end));
+            }
+
+            std::size_t const count = offsets.back();
+            std::size_t const stride = (std::max)(std::size_t(1),
+                count / (parts * sample_sort_oversampling));
+
+            sample_sort_phase<ExPolicy, std::vector<value_type>, IsSeq>
+                sampling;
+            for (segment_type const& s : segments)
+            {
+                sampling.add(dispatch_async(traits::get_id(s.sit),
+                    sample_sort_samples<value_type>(), parallel::seq, true_(),
+                    s.beg, s.end, stride));
+            }
+
+            std::vector<value_type> samples;
+            for (std::vector<value_type> const& v : sampling.get())
+                samples.insert(samples.end(), v.begin(), v.end());
+
+            compare_projected<Compare const&, Proj const&> less(comp, proj);
+            std::sort(samples.begin(), samples.end(), less);
+
+            std::vector<value_type> splitters;
+            splitters.reserve(parts - 1);
+            for (std::size_t i = 1; i != parts; ++i)
+            {
+                splitters.push_back(
+                    samples[offsets[i] * samples.size() / count]);
+            }
+
+            sample_sort_phase<ExPolicy, std::vector<std::size_t>, IsSeq>
+                bucketing;
+            for (segment_type const& s : segments)
+            {
+                bucketing.add(dispatch_async(traits::get_id(s.sit),
+                    sample_sort_buckets<value_type>(), parallel::seq, true_(),
+                    s.beg, s.end, splitters, comp, proj));
+            }
+            std::vector<std::vector<std::size_t> > bounds = bucketing.get();
+
+            timings.splitters = high_resolution_clock::now() - t;
+
+            // gather each bucket on the locality of its segment, the runs
+            // are fetched directly from the segments holding them
+            t = high_resolution_clock::now();
+
+            std::vector<std::vector<std::size_t> > run_sizes(parts);
+            std::vector<std::size_t> bucket_offsets(1, 0);
+            bucket_offsets.reserve(parts + 1);
+
+            sample_sort_phase<ExPolicy, hpx::id_type, IsSeq> exchange;
+            for (std::size_t j = 0; j != parts; ++j)
+            {
+                std::vector<run_type> runs;
+                for (std::size_t i = 0; i != parts; ++i)
+                {
+                    std::size_t begin = bounds[i][j];
+                    std::size_t end = bounds[i][j + 1];
+                    if (begin == end)
+                        continue;
+
+                    run_type r = { traits::get_id(segments[i].sit),
+                        std::next(segments[i].beg, begin),
+                        std::next(segments[i].beg, end) };
+                    runs.push_back(r);
+                    run_sizes[j].push_back(end - begin);
+                }
+
+                bucket_offsets.push_back(bucket_offsets.back() +
+                    std::accumulate(run_sizes[j].begin(), run_sizes[j].end(),
+                        std::size_t(0)));
+
+                exchange.add(dispatch_async(traits::get_id(segments[j].sit),
+                    sample_sort_gather<value_type>(), parallel::seq, true_(),
+                    runs));
+            }
+            std::vector<hpx::id_type> buckets = exchange.get();
+
+            timings.exchange = high_resolution_clock::now() - t;
+
+            // merge the buckets and store the values back into the segments,
+            // each segment receives the values for the global positions it
+            // covered before
+            t = high_resolution_clock::now();
+
+            sample_sort_phase<ExPolicy, std::size_t, IsSeq> merging;
+            for (std::size_t j = 0; j != parts; ++j)
+            {
+                merging.add(dispatch_async(buckets[j],
+                    sample_sort_merge<value_type>(), parallel::seq, true_(),
+                    buckets[j], run_sizes[j], comp, proj));
+            }
+            merging.get();
+
+            sample_sort_phase<ExPolicy, local_iterator_type, IsSeq> storing;
+            for (std::size_t i = 0; i != parts; ++i)
+            {
+                std::vector<sample_sort_slice> slices;
+                for (std::size_t j = 0; j != parts; ++j)
+                {
+                    std::size_t begin =
+                        (std::max)(offsets[i], bucket_offsets[j]);
+                    std::size_t end =
+                        (std::min)(offsets[i + 1], bucket_offsets[j + 1]);
+                    if (begin >= end)
+                        continue;
+
+                    sample_sort_slice s = { buckets[j],
+                        begin - bucket_offsets[j], end - bucket_offsets[j] };
+                    slices.push_back(s);
+                }
+
+                segment_type const& s = segments[i];
+                storing.add(dispatch_async(traits::get_id(s.sit),
+                    sample_sort_store<local_iterator_type>(), parallel::seq,
+                    true_(), s.beg, s.end, slices));
+            }
+            storing.get();
+
+            timings.merge = high_resolution_clock::now() - t;
+            return timings;
+        }
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        static typename util::detail::algorithm_result<
+            ExPolicy, sample_sort_timings
+        >::type
+        segmented_sample_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Compare && comp, Proj && proj, boost::mpl::true_)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, sample_sort_timings
+                >::get(sample_sort_phases(policy,
+                    get_local_segments(first, last), comp, proj,
+                    boost::mpl::true_()));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        static typename util::detail::algorithm_result<
+            ExPolicy, sample_sort_timings
+        >::type
+        segmented_sample_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Compare && comp, Proj && proj, boost::mpl::false_)
+        {
+            typedef local_segment<SegIter> segment_type;
+            typedef typename hpx::util::decay<Compare>::type compare_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            compare_type c(std::forward<Compare>(comp));
+            proj_type p(std::forward<Proj>(proj));
+            return util::detail::algorithm_result<
+                    ExPolicy, sample_sort_timings
+                >::get(hpx::async(
+                    [=]() -> sample_sort_timings
+                    {
+                        return sample_sort_phases(policy, segments, c, p,
+                            boost::mpl::false_());
+                    }));
+        }
+
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the segmented range [first, last) in ascending
+    /// order using a distributed sample sort. The order of equal elements is
+    /// not guaranteed to be preserved. The function uses the given comparison
+    /// function object comp (defaults to using operator<()).
+    ///
+    /// All segments are sorted locally first. A regular sample of the sorted
+    /// segments is used to select splitters which divide the values into
+    /// one bucket per segment. The buckets are moved to the localities of
+    /// their segments and merged there. Finally, the sorted values are
+    /// stored back such that each segment keeps its number of elements.
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons. Every element is moved between
+    ///                     localities at most twice.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam SegIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     segmented random access iterator referring to a
+    ///                     \a hpx::partitioned_vector.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values. The value
+    /// type of the sequence has to be registered using
+    /// \a HPX_REGISTER_PARTITIONED_VECTOR as the merged buckets are kept in
+    /// temporary partitions.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequential_execution_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_execution_policy or \a parallel_task_execution_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a sample_sort algorithm returns a
+    ///           \a hpx::future<sample_sort_timings> if the execution policy
+    ///           is of type
+    ///           \a sequential_task_execution_policy or
+    ///           \a parallel_task_execution_policy and returns
+    ///           \a sample_sort_timings otherwise.
+    ///           It returns the time spent in each of the phases of the
+    ///           algorithm.
+    //-----------------------------------------------------------------------------
+    template <typename Proj = util::projection_identity,
+        typename ExPolicy, typename SegIter,
+        typename Compare = std::less<
+            typename std::remove_reference<
+                typename traits::projected_result_of<Proj, SegIter>::type
+            >::type
+        >,
+    HPX_CONCEPT_REQUIRES_(
+        is_execution_policy<ExPolicy>::value &&
+        traits::detail::is_iterator<SegIter>::value &&
+        traits::is_projected<Proj, SegIter>::value &&
+        traits::is_indirect_callable<
+            Compare,
+                traits::projected<Proj, SegIter>,
+                traits::projected<Proj, SegIter>
+        >::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, sample_sort_timings
+    >::type
+    sample_sort(ExPolicy && policy, SegIter first, SegIter last,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        typedef typename std::iterator_traits<SegIter>::iterator_category
+            iterator_category;
+
+        static_assert(
+            (boost::is_base_of<
+                std::random_access_iterator_tag, iterator_category
+            >::value),
+            "Requires a random access iterator.");
+
+        typedef hpx::traits::segmented_iterator_traits<SegIter>
+            iterator_traits;
+        static_assert(iterator_traits::is_segmented_iterator::value,
+            "Requires a segmented iterator.");
+
+        typedef typename parallel::is_sequential_execution_policy<
+                ExPolicy
+            >::type is_seq;
+
+        if (first == last)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, sample_sort_timings
+                >::get(sample_sort_timings());
+        }
+
+        return detail::segmented_sample_sort(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_seq());
+    }
+}}}
+
+#endif
@@ -0,0 +1,403 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_DEC_16_2015_1215PM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_DEC_16_2015_1215PM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The segmented sort first sorts all segments locally. Afterwards,
+        // neighboring segments are repeatedly merged and split again (odd-even
+        // merge-split) such that the lower segment keeps the smallest
+        // elements, while the upper segment keeps the largest ones. The sizes
+        // of the segments are not changed. As the segments may differ in size
+        // the phases are repeated until none of the segment boundaries is out
+        // of order anymore.
+
+        // Sort the part of a segment, this is run on the locality where the
+        // segment lives.
+        template <typename Iter>
+        struct sort_segment
+          : public detail::algorithm<sort_segment<Iter>, Iter>
+        {
+            sort_segment()
+              : sort_segment::algorithm("sort_segment")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::sort(first, last,
+                    compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                typedef typename std::iterator_traits<RandomIt>::value_type
+                    value_type;
+                typedef is_radix_sortable<value_type, Compare, Proj>
+                    use_radix_sort;
+
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    parallel_sort_dispatch(policy, first, last,
+                        std::forward<Compare>(comp), std::forward<Proj>(proj),
+                        use_radix_sort()
+                    ).then(
+                        [last](hpx::future<void> && f) -> RandomIt
+                        {
+                            f.get();
+                            return last;
+                        }));
+            }
+        };
+
+        // Return the (sorted) values of the upper segment which are smaller
+        // than the largest value of the lower segment, those are the only
+        // ones which have to be moved.
+        template <typename T>
+        struct sort_extract_less
+          : public detail::algorithm<sort_extract_less<T>, std::vector<T> >
+        {
+            sort_extract_less()
+              : sort_extract_less::algorithm("sort_extract_less")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                T const& bound, Compare && comp, Proj && proj)
+            {
+                return std::vector<T>(first,
+                    std::lower_bound(first, last, bound,
+                        compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        )));
+            }
+        };
+
+        // Merge the given values into the lower segment, the segment keeps
+        // the smallest values, the largest ones are returned.
+        template <typename T>
+        struct sort_merge_lower
+          : public detail::algorithm<sort_merge_lower<T>, std::vector<T> >
+        {
+            sort_merge_lower()
+              : sort_merge_lower::algorithm("sort_merge_lower")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<T>
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<T> const& values, Compare && comp, Proj && proj)
+            {
+                std::size_t count = std::distance(first, last);
+
+                std::vector<T> merged;
+                merged.reserve(count + values.size());
+                std::merge(first, last, values.begin(), values.end(),
+                    std::back_inserter(merged),
+                    compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)
+                    ));
+
+                std::copy(merged.begin(), merged.begin() + count, first);
+                return std::vector<T>(merged.begin() + count, merged.end());
+            }
+        };
+
+        // Replace the values which were extracted from the beginning of the
+        // upper segment with the given ones and restore the order.
+        template <typename Iter>
+        struct sort_merge_upper
+          : public detail::algorithm<sort_merge_upper<Iter>, Iter>
+        {
+            sort_merge_upper()
+              : sort_merge_upper::algorithm("sort_merge_upper")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename T,
+                typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<T> const& values, Compare && comp, Proj && proj)
+            {
+                RandomIt middle = std::copy(values.begin(), values.end(),
+                    first);
+                std::inplace_merge(first, middle, last,
+                    compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)
+                    ));
+                return last;
+            }
+        };
+
+        // Merge-split two neighboring (locally sorted) segments, returns
+        // whether any values had to be exchanged.
+        template <typename SegIter, typename Compare, typename Proj>
+        bool sort_merge_split(local_segment<SegIter> const& lower,
+            local_segment<SegIter> const& upper, Compare const& comp,
+            Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            using boost::mpl::true_;
+
+            // the segments are in order if the smallest value of the upper
+            // segment is not less than the largest value of the lower one
+            value_type last_lower =
+                *traits::compose(lower.sit, std::prev(lower.end));
+            value_type first_upper = *traits::compose(upper.sit, upper.beg);
+
+            compare_projected<Compare const&, Proj const&> less(comp, proj);
+            if (!less(first_upper, last_lower))
+                return false;
+
+            std::vector<value_type> values = dispatch(
+                traits::get_id(upper.sit), sort_extract_less<value_type>(),
+                parallel::seq, true_(), upper.beg, upper.end, last_lower,
+                comp, proj);
+
+            values = dispatch(
+                traits::get_id(lower.sit), sort_merge_lower<value_type>(),
+                parallel::seq, true_(), lower.beg, lower.end, values,
+                comp, proj);
+
+            dispatch(traits::get_id(upper.sit),
+                sort_merge_upper<local_iterator_type>(), parallel::seq,
+                true_(), upper.beg, upper.end, values, comp, proj);
+
+            return true;
+        }
+
+        // Run the merge-split phases until two consecutive phases did not
+        // exchange any values, the pairs of segments are handled one after
+        // the other.
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        void sort_merge_split_phases(ExPolicy const&,
+            std::vector<local_segment<SegIter> > const& segments,
+            Compare const& comp, Proj const& proj, boost::mpl::true_)
+        {
+            std::size_t quiet_phases = 0;
+            for (std::size_t phase = 0; quiet_phases != 2; ++phase)
+            {
+                bool exchanged = false;
+                for (std::size_t i = phase % 2; i + 1 < segments.size(); i += 2)
+                {
+                    if (sort_merge_split(segments[i], segments[i + 1],
+                            comp, proj))
+                    {
+                        exchanged = true;
+                    }
+                }
+                quiet_phases = exchanged ? 0 : quiet_phases + 1;
+            }
+        }
+
+        // Same as above, but the pairs of segments of a phase are handled
+        // concurrently.
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        void sort_merge_split_phases(ExPolicy const&,
+            std::vector<local_segment<SegIter> > const& segments,
+            Compare const& comp, Proj const& proj, boost::mpl::false_)
+        {
+            std::size_t quiet_phases = 0;
+            for (std::size_t phase = 0; quiet_phases != 2; ++phase)
+            {
+                std::vector<future<bool> > exchanges;
+                exchanges.reserve(segments.size() / 2);
+
+                for (std::size_t i = phase % 2; i + 1 < segments.size(); i += 2)
+                {
+                    exchanges.push_back(hpx::async(
+                        &sort_merge_split<SegIter, Compare, Proj>,
+                        segments[i], segments[i + 1], comp, proj));
+                }
+
+                hpx::wait_all(exchanges);
+
+                // handle any remote exceptions, will throw on error
+                std::list<boost::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy
+                >::call(exchanges, errors);
+
+                bool exchanged = false;
+                for (future<bool>& f : exchanges)
+                {
+                    if (f.get())
+                        exchanged = true;
+                }
+                quiet_phases = exchanged ? 0 : quiet_phases + 1;
+            }
+        }
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        static typename util::detail::algorithm_result<ExPolicy>::type
+        segmented_sort(ExPolicy const& policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef local_segment<SegIter> segment_type;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            for (segment_type const& s : segments)
+            {
+                dispatch(traits::get_id(s.sit),
+                    sort_segment<local_iterator_type>(), policy, true_(),
+                    s.beg, s.end, comp, proj);
+            }
+
+            sort_merge_split_phases(policy, segments, comp, proj, true_());
+
+            return util::detail::algorithm_result<ExPolicy>::get();
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        static typename util::detail::algorithm_result<ExPolicy>::type
+        segmented_sort(ExPolicy const& policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef local_segment<SegIter> segment_type;
+            typedef typename hpx::util::decay<Compare>::type compare_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_local_segments(first, last);
+
+            std::vector<future<local_iterator_type> > sorted;
+            sorted.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                sorted.push_back(dispatch_async(traits::get_id(s.sit),
+                    sort_segment<local_iterator_type>(), policy,
+                    forced_seq(), s.beg, s.end, comp, proj));
+            }
+
+            compare_type c(std::forward<Compare>(comp));
+            proj_type p(std::forward<Proj>(proj));
+            return util::detail::algorithm_result<ExPolicy>::get(
+                lcos::local::dataflow(
+                    [=](std::vector<future<local_iterator_type> > && r)
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        sort_merge_split_phases(policy, segments, c, p,
+                            boost::mpl::false_());
+                    },
+                    std::move(sorted)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy>::type
+        sort_(ExPolicy && policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+                return util::detail::algorithm_result<ExPolicy>::get();
+
+            return segmented_sort(
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj),
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
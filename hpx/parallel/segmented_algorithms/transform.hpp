@@ -0,0 +1,180 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_TRANSFORM_DEC_16_2015_1035AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_TRANSFORM_DEC_16_2015_1035AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/tuple.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/parallel/config/inline_namespace.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segments.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include <boost/type_traits/is_same.hpp>
+
+namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v1)
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_transform
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The output sequence is assumed to be segmented in the same way as
+        // the input sequence.
+
+        // sequential remote implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename F, typename Proj>
+        static typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+        >::type
+        segmented_transform(ExPolicy const& policy, SegIter first,
+            SegIter last, SegOutIter dest, F && f, Proj && proj,
+            boost::mpl::true_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef hpx::util::tuple<
+                    typename traits::local_iterator,
+                    typename output_traits::local_iterator
+                > local_result_type;
+            typedef paired_segment<SegIter, SegOutIter> segment_type;
+            typedef util::detail::algorithm_result<
+                    ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+                > result;
+
+            using boost::mpl::true_;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first, last, dest);
+
+            for (segment_type const& s : segments)
+            {
+                local_result_type r = dispatch(traits::get_id(s.sit),
+                    transform<local_result_type>(), policy, true_(),
+                    s.beg, s.end, s.out, f, proj);
+                dest = output_traits::compose(s.sdest, hpx::util::get<1>(r));
+            }
+
+            return result::get(hpx::util::make_tuple(last, dest));
+        }
+
+        // parallel remote implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename F, typename Proj>
+        static typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+        >::type
+        segmented_transform(ExPolicy const& policy, SegIter first,
+            SegIter last, SegOutIter dest, F && f, Proj && proj,
+            boost::mpl::false_)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef hpx::util::tuple<
+                    typename traits::local_iterator,
+                    typename output_traits::local_iterator
+                > local_result_type;
+            typedef paired_segment<SegIter, SegOutIter> segment_type;
+            typedef util::detail::algorithm_result<
+                    ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+                > result;
+
+            typedef typename std::iterator_traits<SegIter>::iterator_category
+                iterator_category;
+            typedef typename boost::mpl::bool_<boost::is_same<
+                    iterator_category, std::input_iterator_tag
+                >::value> forced_seq;
+
+            std::vector<segment_type> segments =
+                get_paired_segments(first, last, dest);
+            HPX_ASSERT(!segments.empty());
+
+            std::vector<future<local_result_type> > results;
+            results.reserve(segments.size());
+
+            for (segment_type const& s : segments)
+            {
+                results.push_back(dispatch_async(traits::get_id(s.sit),
+                    transform<local_result_type>(), policy, forced_seq(),
+                    s.beg, s.end, s.out, f, proj));
+            }
+
+            return result::get(
+                lcos::local::dataflow(
+                    [=](std::vector<future<local_result_type> > && r)
+                        ->  hpx::util::tuple<SegIter, SegOutIter>
+                    {
+                        // handle any remote exceptions, will throw on error
+                        std::list<boost::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy
+                        >::call(r, errors);
+
+                        return hpx::util::make_tuple(last,
+                            output_traits::compose(segments.back().sdest,
+                                hpx::util::get<1>(r.back().get())));
+                    },
+                    std::move(results)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename F, typename Proj>
+        inline typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+        >::type
+        transform_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, F && f, Proj && proj, std::true_type)
+        {
+            typedef typename parallel::is_sequential_execution_policy<
+                    ExPolicy
+                >::type is_seq;
+
+            if (first == last)
+            {
+                typedef util::detail::algorithm_result<
+                        ExPolicy, hpx::util::tuple<SegIter, SegOutIter>
+                    > result;
+                return result::get(hpx::util::make_tuple(last, dest));
+            }
+
+            return segmented_transform(
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::forward<F>(f), std::forward<Proj>(proj), is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename F, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<InIter, OutIter>
+        >::type
+        transform_(ExPolicy && policy, InIter first, InIter last,
+            OutIter dest, F && f, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -80,7 +80,7 @@ namespace hpx { namespace parallel { namespace traits
     struct projected_result_of
       : detail::projected_result_of<
             typename hpx::util::decay<F>::type,
-            typename hpx::util::decay<Iter>::type>
+            typename hpx::traits::projected_iterator<Iter>::type>
     {};
 
     ///////////////////////////////////////////////////////////////////////////
@@ -65,25 +65,25 @@ namespace hpx { namespace parallel { namespace util { namespace detail
 
         std::vector<tuple_type> shape;
 
-        if (!variable_chunk_sizes || chunk_size != 0)
-        {
-            if (chunk_size == 0)
+        auto test_function =
+            [&]() -> std::size_t
             {
-                auto test_function =
-                    [&]() -> std::size_t
-                    {
-                        std::size_t test_chunk_size = count / 100;
-                        if (test_chunk_size == 0)
-                            return 0;
+                std::size_t test_chunk_size = count / 100;
+                if (test_chunk_size == 0)
+                    return 0;
 
-                        add_ready_future(workitems, f1, first, test_chunk_size);
+                add_ready_future(workitems, f1, first, test_chunk_size);
 
-                        std::advance(first, test_chunk_size);
-                        count -= test_chunk_size;
+                std::advance(first, test_chunk_size);
+                count -= test_chunk_size;
 
-                        return test_chunk_size;
-                    };
+                return test_chunk_size;
+            };
 
+        if (!variable_chunk_sizes || chunk_size != 0)
+        {
+            if (chunk_size == 0)
+            {
                 chunk_size = traits::get_chunk_size(policy.parameters(),
                     policy.executor(), test_function, count);
             }
@@ -105,9 +105,11 @@ namespace hpx { namespace parallel { namespace util { namespace detail
         {
             while (count != 0)
             {
+                // the executor parameters may decide to probe the loop
+                // iterations at any point (see adaptive_chunk_size)
                 chunk_size = traits::get_chunk_size(
                     policy.parameters(), policy.executor(),
-                    [](){ return 0; }, count);
+                    test_function, count);
 
                 if (chunk_size == 0)
                     chunk_size = (count + cores - 1) / cores;
@@ -167,27 +169,27 @@ namespace hpx { namespace parallel { namespace util { namespace detail
 
         std::vector<tuple_type> shape;
 
-        if (!variable_chunk_sizes || chunk_size != 0)
-        {
-            if (chunk_size == 0)
+        auto test_function =
+            [&]() -> std::size_t
             {
-                auto test_function =
-                    [&]() -> std::size_t
-                    {
-                        std::size_t test_chunk_size = count / 100;
-                        if (test_chunk_size == 0)
-                            return 0;
+                std::size_t test_chunk_size = count / 100;
+                if (test_chunk_size == 0)
+                    return 0;
 
-                        add_ready_future_idx(workitems, f1, base_idx, first,
-                            test_chunk_size);
+                add_ready_future_idx(workitems, f1, base_idx, first,
+                    test_chunk_size);
 
-                        base_idx += test_chunk_size;
-                        std::advance(first, test_chunk_size);
-                        count -= test_chunk_size;
+                base_idx += test_chunk_size;
+                std::advance(first, test_chunk_size);
+                count -= test_chunk_size;
 
-                        return test_chunk_size;
-                    };
+                return test_chunk_size;
+            };
 
+        if (!variable_chunk_sizes || chunk_size != 0)
+        {
+            if (chunk_size == 0)
+            {
                 chunk_size = traits::get_chunk_size(policy.parameters(),
                     policy.executor(), test_function, count);
             }
@@ -208,9 +210,11 @@ namespace hpx { namespace parallel { namespace util { namespace detail
         {
             while (count != 0)
             {
+                // the executor parameters may decide to probe the loop
+                // iterations at any point (see adaptive_chunk_size)
                 chunk_size = traits::get_chunk_size(
                     policy.parameters(), policy.executor(),
-                    [](){ return 0; }, count);
+                    test_function, count);
 
                 std::size_t chunk = (std::min)(chunk_size, count);
 
@@ -0,0 +1,172 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_UTIL_DETAIL_SIMD_DISPATCH_DEC_05_2015_0412PM)
+#define HPX_PARALLEL_UTIL_DETAIL_SIMD_DISPATCH_DEC_05_2015_0412PM
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/move.hpp>
+
+#include <boost/atomic.hpp>
+
+// The vectorized kernels are compiled several times for different instruction
+// set extensions. The variant to use is selected at runtime, based on the
+// capabilities of the CPU we're running on. This is currently supported for
+// gcc (V4.9 and newer) and clang (V3.8 and newer) on x86 only, all other
+// platforms use the generic variant.
+#if (defined(__x86_64__) || defined(__i386__)) &&                             \
+    ((defined(__clang__) &&                                                   \
+        (__clang_major__ > 3 ||                                               \
+            (__clang_major__ == 3 && __clang_minor__ >= 8))) ||               \
+     (defined(__GNUC__) && !defined(__clang__) &&                             \
+        !defined(__INTEL_COMPILER) &&                                         \
+        (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#  define HPX_PARALLEL_HAVE_SIMD_DISPATCH
+#  define HPX_PARALLEL_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#  define HPX_PARALLEL_SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#  include <hpx/util/hardware/cpuid.hpp>
+#endif
+
+// Tell the compiler that there are no loop carried dependencies in the
+// annotated loop, which is what the parallel_vector_execution_policy
+// guarantees for the element access functions.
+#if defined(__clang__)
+#  define HPX_PARALLEL_VECTORIZE_LOOP                                         \
+    _Pragma("clang loop vectorize(enable) interleave(enable)")                \
+    /**/
+#elif defined(__GNUC__) && !defined(__INTEL_COMPILER) &&                      \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#  define HPX_PARALLEL_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#elif defined(__INTEL_COMPILER)
+#  define HPX_PARALLEL_VECTORIZE_LOOP _Pragma("simd")
+#elif defined(_MSC_VER) && _MSC_VER >= 1700
+#  define HPX_PARALLEL_VECTORIZE_LOOP __pragma(loop(ivdep))
+#else
+#  define HPX_PARALLEL_VECTORIZE_LOOP
+#endif
+
+namespace hpx { namespace parallel { namespace util { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The instruction set extensions we generate code for.
+    enum simd_isa
+    {
+        simd_isa_generic = 0,
+        simd_isa_avx2 = 1,
+        simd_isa_avx512 = 2
+    };
+
+#if defined(HPX_PARALLEL_HAVE_SIMD_DISPATCH)
+    inline bool has_cpu_feature(hpx::util::hardware::cpu_feature::info f)
+    {
+        using hpx::util::hardware::cpuid_table;
+
+        boost::uint32_t registers[4];
+        hpx::util::hardware::cpuidex(registers, cpuid_table[f].function, 0);
+        return hpx::util::hardware::has_bit_set(
+            registers[cpuid_table[f].register_], cpuid_table[f].bit);
+    }
+
+    inline simd_isa detect_simd_isa()
+    {
+        using hpx::util::hardware::cpu_feature;
+
+        boost::uint32_t registers[4];
+        hpx::util::hardware::cpuid(registers, 0);
+        if (registers[0] < 7)
+            return simd_isa_generic;
+
+        // the operating system has to save the extended register state
+        if (!has_cpu_feature(cpu_feature::osxsave) ||
+            !has_cpu_feature(cpu_feature::avx))
+        {
+            return simd_isa_generic;
+        }
+
+        boost::uint64_t xcr0 = hpx::util::hardware::xgetbv(0);
+        if ((xcr0 & 0x06) != 0x06 || !has_cpu_feature(cpu_feature::avx2))
+            return simd_isa_generic;
+
+        if ((xcr0 & 0xe6) == 0xe6 && has_cpu_feature(cpu_feature::avx512f))
+            return simd_isa_avx512;
+
+        return simd_isa_avx2;
+    }
+#else
+    inline simd_isa detect_simd_isa()
+    {
+        return simd_isa_generic;
+    }
+#endif
+
+    inline boost::atomic<simd_isa>& selected_simd_isa()
+    {
+        static boost::atomic<simd_isa> isa(detect_simd_isa());
+        return isa;
+    }
+
+    inline simd_isa get_simd_isa()
+    {
+        return selected_simd_isa().load(boost::memory_order_relaxed);
+    }
+
+    // Force the code variant to use, this allows to exercise all variants
+    // supported by the CPU we are running on. Returns the previously used
+    // variant.
+    inline simd_isa set_simd_isa(simd_isa isa)
+    {
+        HPX_ASSERT(isa <= detect_simd_isa());
+        return selected_simd_isa().exchange(isa);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke Kernel::call with the code variant best suited for the CPU we
+    // are running on.
+    template <typename Kernel>
+    struct simd_dispatch
+    {
+#if defined(HPX_PARALLEL_HAVE_SIMD_DISPATCH)
+        template <typename... Ts>
+        HPX_PARALLEL_SIMD_TARGET_AVX512
+        static typename Kernel::result_type call_avx512(Ts &&... ts)
+        {
+            return Kernel::call(std::forward<Ts>(ts)...);
+        }
+
+        template <typename... Ts>
+        HPX_PARALLEL_SIMD_TARGET_AVX2
+        static typename Kernel::result_type call_avx2(Ts &&... ts)
+        {
+            return Kernel::call(std::forward<Ts>(ts)...);
+        }
+#endif
+
+        template <typename... Ts>
+        static typename Kernel::result_type call(Ts &&... ts)
+        {
+#if defined(HPX_PARALLEL_HAVE_SIMD_DISPATCH)
+            switch (get_simd_isa())
+            {
+            case simd_isa_avx512:
+                return call_avx512(std::forward<Ts>(ts)...);
+
+            case simd_isa_avx2:
+                return call_avx2(std::forward<Ts>(ts)...);
+
+            default:
+                break;
+            }
+#endif
+            return Kernel::call(std::forward<Ts>(ts)...);
+        }
+    };
+
+    /// \endcond
+}}}}
+
+#endif
@@ -0,0 +1,421 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_UTIL_LOOKBACK_SCAN_PARTITIONER_DEC_08_2015_1105AM)
+#define HPX_PARALLEL_UTIL_LOOKBACK_SCAN_PARTITIONER_DEC_08_2015_1105AM
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/async.hpp>
+#include <hpx/exception_list.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/local/dataflow.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <hpx/parallel/executors/executor_traits.hpp>
+#include <hpx/parallel/executors/executor_information_traits.hpp>
+#include <hpx/parallel/executors/executor_parameter_traits.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The chunks processed by the single pass scan are limited to this
+        // number of elements. This keeps the elements of a chunk in the cache
+        // between the reduction and the final scan of the chunk.
+        static std::size_t const lookback_scan_max_chunk_size = 16384;
+
+        // The state of a chunk as seen by the succeeding chunks.
+        enum lookback_scan_status
+        {
+            lookback_scan_invalid = 0,      // nothing is known yet
+            lookback_scan_aggregate = 1,    // the chunk's reduction is known
+            lookback_scan_prefix = 2,       // the inclusive prefix is known
+            lookback_scan_failed = 3        // the chunk has thrown an exception
+        };
+
+        template <typename T>
+        struct lookback_scan_chunk
+        {
+            lookback_scan_chunk()
+              : status_(lookback_scan_invalid)
+            {}
+
+            boost::atomic<int> status_;
+            T aggregate_;
+            T prefix_;
+
+            // avoid false sharing between neighboring chunks
+            char padding_[64];
+        };
+
+        template <typename FwdIter, typename T>
+        struct lookback_scan_state
+        {
+            typedef hpx::util::tuple<FwdIter, std::size_t> shape_type;
+
+            lookback_scan_state(std::vector<shape_type> && shape)
+              : shape_(std::move(shape)),
+                chunks_(new lookback_scan_chunk<T>[shape_.size()]),
+                next_chunk_(0)
+            {}
+
+            // Wait for the given (preceding) chunk to publish its state.
+            int wait_for(std::size_t chunk) const
+            {
+                int status = lookback_scan_invalid;
+                for (std::size_t k = 0; /**/; ++k)
+                {
+                    status = chunks_[chunk].status_.load(
+                        boost::memory_order_acquire);
+                    if (status != lookback_scan_invalid)
+                        break;
+
+                    // the preceding chunk is being processed by another
+                    // task, let other work proceed on this core
+                    if (k >= 16 && hpx::threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "lookback_scan_state::wait_for");
+                    }
+                }
+                return status;
+            }
+
+            // Walk the preceding chunks, combining their reductions until
+            // the inclusive prefix of one of them is found. Returns false if
+            // any of the preceding chunks has failed.
+            template <typename Op>
+            bool look_back(std::size_t chunk, Op& op, T& prefix) const
+            {
+                HPX_ASSERT(chunk != 0);
+
+                std::size_t k = chunk - 1;
+                int status = wait_for(k);
+                if (status == lookback_scan_failed)
+                    return false;
+
+                if (status == lookback_scan_prefix)
+                {
+                    prefix = chunks_[k].prefix_;
+                    return true;
+                }
+
+                T aggregate = chunks_[k].aggregate_;
+                while (k-- != 0)
+                {
+                    status = wait_for(k);
+                    if (status == lookback_scan_failed)
+                        return false;
+
+                    if (status == lookback_scan_prefix)
+                    {
+                        prefix = op(chunks_[k].prefix_, aggregate);
+                        return true;
+                    }
+                    aggregate = op(chunks_[k].aggregate_, aggregate);
+                }
+
+                HPX_ASSERT(false);      // the first chunk always has a prefix
+                return false;
+            }
+
+            // Process one chunk. The chunk is reduced and its reduction is
+            // published only if the inclusive prefix of the preceding chunk
+            // is not known yet.
+            template <typename F1, typename Op, typename F2>
+            bool process(std::size_t chunk, T const& init, F1& f1, Op& op,
+                F2& f2)
+            {
+                using hpx::util::get;
+
+                FwdIter part_begin = get<0>(shape_[chunk]);
+                std::size_t part_size = get<1>(shape_[chunk]);
+                lookback_scan_chunk<T>& curr = chunks_[chunk];
+
+                try {
+                    T prefix = init;
+                    bool reduced = false;
+
+                    if (chunk != 0)
+                    {
+                        lookback_scan_chunk<T> const& prev = chunks_[chunk - 1];
+                        if (prev.status_.load(boost::memory_order_acquire) ==
+                            lookback_scan_prefix)
+                        {
+                            prefix = prev.prefix_;
+                        }
+                        else
+                        {
+                            curr.aggregate_ = f1(part_begin, part_size);
+                            curr.status_.store(lookback_scan_aggregate,
+                                boost::memory_order_release);
+                            reduced = true;
+
+                            if (!look_back(chunk, op, prefix))
+                            {
+                                curr.status_.store(lookback_scan_failed,
+                                    boost::memory_order_release);
+                                return false;
+                            }
+                        }
+                    }
+
+                    curr.prefix_ = f2(part_begin, part_size, prefix, reduced);
+                    curr.status_.store(lookback_scan_prefix,
+                        boost::memory_order_release);
+                }
+                catch (...) {
+                    curr.status_.store(lookback_scan_failed,
+                        boost::memory_order_release);
+                    throw;
+                }
+                return true;
+            }
+
+            // Each task claims the chunks in order, which guarantees that all
+            // preceding chunks are being processed already.
+            template <typename F1, typename Op, typename F2>
+            void run(T const& init, F1& f1, Op& op, F2& f2)
+            {
+                while (true)
+                {
+                    std::size_t chunk = next_chunk_++;
+                    if (chunk >= shape_.size() ||
+                        !process(chunk, init, f1, op, f2))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            T const& total() const
+            {
+                return chunks_[shape_.size() - 1].prefix_;
+            }
+
+            std::vector<shape_type> shape_;
+            boost::scoped_array<lookback_scan_chunk<T> > chunks_;
+            boost::atomic<std::size_t> next_chunk_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename FwdIter>
+        std::vector<hpx::util::tuple<FwdIter, std::size_t> >
+        get_lookback_scan_shape(ExPolicy policy, FwdIter first,
+            std::size_t count, std::size_t chunk_size)
+        {
+            typedef typename ExPolicy::executor_parameters_type
+                parameters_type;
+            typedef executor_parameter_traits<parameters_type> traits;
+
+            if (chunk_size == 0)
+            {
+                chunk_size = traits::get_chunk_size(policy.parameters(),
+                    policy.executor(), [](){ return 0; }, count);
+
+                if (chunk_size == 0 ||
+                    chunk_size > lookback_scan_max_chunk_size)
+                {
+                    chunk_size = lookback_scan_max_chunk_size;
+                }
+            }
+
+            std::vector<hpx::util::tuple<FwdIter, std::size_t> > shape;
+            shape.reserve(count / chunk_size + 1);
+            while (count != 0)
+            {
+                std::size_t chunk = (std::min)(chunk_size, count);
+
+                shape.push_back(hpx::util::make_tuple(first, chunk));
+                count -= chunk;
+                std::advance(first, chunk);
+            }
+            return shape;
+        }
+
+        template <typename ExPolicy, typename State, typename T,
+            typename F1, typename Op, typename F2>
+        std::vector<hpx::future<void> >
+        spawn_lookback_scan_tasks(ExPolicy policy,
+            boost::shared_ptr<State> const& state, T const& init,
+            F1 && f1, Op && op, F2 && f2)
+        {
+            typedef typename ExPolicy::executor_type executor_type;
+            typedef typename hpx::parallel::executor_traits<executor_type>
+                executor_traits;
+            typedef typename hpx::util::decay<F1>::type f1_type;
+            typedef typename hpx::util::decay<Op>::type op_type;
+            typedef typename hpx::util::decay<F2>::type f2_type;
+
+            std::size_t const cores = executor_information_traits<
+                    executor_type
+                >::processing_units_count(policy.executor(),
+                    policy.parameters());
+            std::size_t const tasks =
+                (std::min)(cores, state->shape_.size());
+
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(tasks);
+
+            f1_type f1_(std::forward<F1>(f1));
+            op_type op_(std::forward<Op>(op));
+            f2_type f2_(std::forward<F2>(f2));
+
+            for (std::size_t i = 0; i != tasks; ++i)
+            {
+                workitems.push_back(executor_traits::async_execute(
+                    policy.executor(),
+                    [state, init, f1_, op_, f2_]() mutable
+                    {
+                        state->run(init, f1_, op_, f2_);
+                    }));
+            }
+            return workitems;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The lookback scan partitioner runs a scan in a single pass over
+        // the data by publishing the state of each chunk (decoupled
+        // look-back).
+        //
+        // f1(part_begin, part_size) -> T
+        //      Reduce the given chunk, this is invoked only if the prefix of
+        //      the chunk is not known yet when the chunk is processed.
+        // op(T, T) -> T
+        //      The (associative) operation used to combine the reductions.
+        // f2(part_begin, part_size, T prefix, bool reduced) -> T
+        //      Run the final scan on the chunk using the exclusive prefix
+        //      of the chunk, returns the inclusive prefix. The flag
+        //      'reduced' tells whether f1 was invoked on this chunk before.
+        // f3(T total) -> R
+        //      Compute the overall result from the inclusive prefix of the
+        //      last chunk.
+        template <typename ExPolicy, typename R, typename T>
+        struct lookback_scan_partitioner
+        {
+            template <typename FwdIter, typename F1, typename Op,
+                typename F2, typename F3>
+            static R call(ExPolicy policy, FwdIter first, std::size_t count,
+                T const& init, F1 && f1, Op && op, F2 && f2, F3 && f3,
+                std::size_t chunk_size = 0)
+            {
+                typedef lookback_scan_state<FwdIter, T> state_type;
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<boost::exception_ptr> errors;
+                boost::shared_ptr<state_type> state;
+
+                try {
+                    HPX_ASSERT(count > 0);
+                    state = boost::make_shared<state_type>(
+                        get_lookback_scan_shape(policy, first, count,
+                            chunk_size));
+
+                    workitems = spawn_lookback_scan_tasks(policy, state, init,
+                        std::forward<F1>(f1), std::forward<Op>(op),
+                        std::forward<F2>(f2));
+                }
+                catch (...) {
+                    detail::handle_local_exceptions<ExPolicy>::call(
+                        boost::current_exception(), errors);
+                }
+
+                // wait for all tasks to finish
+                hpx::wait_all(workitems);
+
+                detail::handle_local_exceptions<ExPolicy>::call(
+                    workitems, errors);
+
+                return f3(state->total());
+            }
+        };
+
+        template <typename R, typename T>
+        struct lookback_scan_partitioner<parallel_task_execution_policy, R, T>
+        {
+            template <typename ExPolicy, typename FwdIter, typename F1,
+                typename Op, typename F2, typename F3>
+            static hpx::future<R> call(ExPolicy policy, FwdIter first,
+                std::size_t count, T const& init, F1 && f1, Op && op,
+                F2 && f2, F3 && f3, std::size_t chunk_size = 0)
+            {
+                typedef lookback_scan_state<FwdIter, T> state_type;
+
+                std::vector<hpx::future<void> > workitems;
+                std::list<boost::exception_ptr> errors;
+                boost::shared_ptr<state_type> state;
+
+                try {
+                    HPX_ASSERT(count > 0);
+                    state = boost::make_shared<state_type>(
+                        get_lookback_scan_shape(policy, first, count,
+                            chunk_size));
+
+                    workitems = spawn_lookback_scan_tasks(policy, state, init,
+                        std::forward<F1>(f1), std::forward<Op>(op),
+                        std::forward<F2>(f2));
+                }
+                catch (std::bad_alloc const&) {
+                    return hpx::make_exceptional_future<R>(
+                        boost::current_exception());
+                }
+                catch (...) {
+                    errors.push_back(boost::current_exception());
+                }
+
+                // wait for all tasks to finish
+                return hpx::lcos::local::dataflow(
+                    [=](std::vector<hpx::future<void> > && r) mutable -> R
+                    {
+                        detail::handle_local_exceptions<ExPolicy>::call(
+                            r, errors);
+
+                        return f3(state->total());
+                    },
+                    std::move(workitems));
+            }
+        };
+
+        template <typename Executor, typename Parameters, typename R,
+            typename T>
+        struct lookback_scan_partitioner<
+                parallel_task_execution_policy_shim<Executor, Parameters>,
+                R, T>
+          : lookback_scan_partitioner<parallel_task_execution_policy, R, T>
+        {};
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // ExPolicy: execution policy
+    // R:        overall result type
+    // T:        type of the values which are scanned
+    template <typename ExPolicy, typename R, typename T>
+    struct lookback_scan_partitioner
+      : detail::lookback_scan_partitioner<
+            typename hpx::util::decay<ExPolicy>::type, R, T>
+    {};
+}}}
+
+#endif
@@ -13,7 +13,7 @@
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/executors/executor_information_traits.hpp>
-#include <hpx/parallel/executors/static_chunk_size.hpp>
+#include <hpx/parallel/executors/pinned_chunk_size.hpp>
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
@@ -27,11 +27,71 @@
 
 namespace hpx { namespace parallel { namespace util
 {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Touch the memory [p, p + count) such that each of its parts is placed
+    /// into the NUMA domain of the processing unit which will access it
+    /// later on. The range is divided evenly between the given executors
+    /// (usually one per NUMA domain), any remaining elements are assigned to
+    /// the last executor. Within each of the parts the elements are touched
+    /// using the \a pinned_chunk_size executor parameters, i.e. parallel
+    /// algorithms invoked using the same executor and the same executor
+    /// parameters on the same part will access the elements from the
+    /// processing unit the memory is local to.
+    template <typename T, typename Executors>
+    void numa_first_touch(Executors const& executors,
+        hpx::threads::topology& topo, T* p, std::size_t count)
+    {
+        HPX_ASSERT(!executors.empty());
+
+        std::size_t part_size = count / executors.size();
+        std::vector<hpx::future<void> > first_touch;
+        first_touch.reserve(executors.size());
+
+        for (std::size_t i = 0; i != executors.size(); ++i)
+        {
+            using namespace hpx::parallel;
+
+            T* begin = p + i * part_size;
+            T* end = (i == executors.size() - 1) ?
+                p + count : begin + part_size;
+            first_touch.push_back(
+                for_each(
+                    par(task).on(executors[i]).with(pinned_chunk_size()),
+                    begin, end,
+                    [&executors, &topo, i](T& val)
+                    {
+                        // touch first byte of every object
+                        *reinterpret_cast<char*>(&val) = 0;
+
+#if defined(HPX_DEBUG)
+                        // make sure memory was placed appropriately
+                        hpx::threads::mask_type mem_mask =
+                            topo.get_thread_affinity_mask_from_lva(
+                                reinterpret_cast<hpx::naming::address_type>(&val));
+
+                        typedef hpx::parallel::executor_information_traits<
+                                typename Executors::value_type
+                            > traits;
+
+                        std::size_t thread_num = hpx::get_worker_thread_num();
+                        hpx::threads::mask_cref_type thread_mask =
+                            traits::get_pu_mask(executors[i], topo, thread_num);
+
+                        HPX_ASSERT(threads::mask_size(mem_mask) ==
+                            threads::mask_size(thread_mask));
+                        HPX_ASSERT(threads::bit_and(mem_mask, thread_mask,
+                            threads::mask_size(mem_mask)));
+#endif
+                    })
+            );
+        }
+        hpx::wait_all(first_touch);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Executors>
     class numa_allocator
     {
-        typedef typename Executors::value_type executor_type;
     public:
         // typedefs
         typedef T value_type;
@@ -76,47 +136,7 @@ namespace hpx { namespace parallel { namespace util
             pointer p = reinterpret_cast<pointer>(topo_.allocate(cnt * sizeof(T)));
 
             // first touch policy, distribute evenly onto executors
-            std::size_t part_size = cnt / executors_.size();
-            std::vector<hpx::future<void> > first_touch;
-            first_touch.reserve(executors_.size());
-
-            for (std::size_t i = 0; i != executors_.size(); ++i)
-            {
-                using namespace hpx::parallel;
-
-                pointer begin = p + i * part_size;
-                pointer end = begin + part_size;
-                first_touch.push_back(
-                    for_each(
-                        par(task).on(executors_[i]).with(static_chunk_size()),
-                        begin, end,
-                        [this, i](T& val)
-                        {
-                            // touch first byte of every object
-                            *reinterpret_cast<char*>(&val) = 0;
-
-#if defined(HPX_DEBUG)
-                            // make sure memory was placed appropriately
-                            hpx::threads::mask_type mem_mask =
-                                topo_.get_thread_affinity_mask_from_lva(
-                                    reinterpret_cast<hpx::naming::address_type>(&val));
-
-                            typedef hpx::parallel::executor_information_traits<
-                                executor_type> traits;
-
-                            std::size_t thread_num = hpx::get_worker_thread_num();
-                            hpx::threads::mask_cref_type thread_mask =
-                                traits::get_pu_mask(executors_[i], topo_, thread_num);
-
-                            HPX_ASSERT(threads::mask_size(mem_mask) ==
-                                threads::mask_size(thread_mask));
-                            HPX_ASSERT(threads::bit_and(mem_mask, thread_mask,
-                                threads::mask_size(mem_mask)));
-#endif
-                        })
-                );
-            }
-            hpx::wait_all(first_touch);
+            numa_first_touch(executors_, topo_, p, cnt);
 
             // return the overall memory block
             return p;
@@ -0,0 +1,391 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_UTIL_VECTOR_LOOP_DEC_05_2015_0430PM)
+#define HPX_PARALLEL_UTIL_VECTOR_LOOP_DEC_05_2015_0430PM
+
+#include <hpx/config.hpp>
+#include <hpx/util/move.hpp>
+#include <hpx/util/tuple.hpp>
+#include <hpx/util/zip_iterator.hpp>
+#include <hpx/util/detail/pack.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/detail/simd_dispatch.hpp>
+
+#include <boost/mpl/bool.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace parallel { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The number of lanes processed at once by the explicitly vectorized
+        // reductions, this is sized to fill the widest supported registers.
+        template <typename T>
+        struct vector_pack_size
+          : std::integral_constant<std::size_t,
+                (sizeof(T) < 64) ? 64 / sizeof(T) : 1>
+        {};
+
+        // Only sequences of arithmetic types are processed by the vectorized
+        // kernels.
+        template <typename T>
+        struct is_vector_value
+          : boost::mpl::bool_<
+                std::is_arithmetic<T>::value &&
+               !std::is_same<T, bool>::value>
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Iter,
+            typename T = typename std::iterator_traits<Iter>::value_type,
+            bool IsVectorValue = is_vector_value<T>::value>
+        struct is_std_vector_iterator
+          : boost::mpl::false_
+        {};
+
+        template <typename Iter, typename T>
+        struct is_std_vector_iterator<Iter, T, true>
+          : boost::mpl::bool_<
+                std::is_same<
+                    Iter, typename std::vector<T>::iterator
+                >::value ||
+                std::is_same<
+                    Iter, typename std::vector<T>::const_iterator
+                >::value>
+        {};
+
+        // Detect iterators referring to contiguous memory. The standard
+        // library wrappers are recognized directly where possible, which
+        // covers containers using custom allocators as well.
+        template <typename Iter>
+        struct is_contiguous_container_iterator
+          : is_std_vector_iterator<Iter>
+        {};
+
+#if defined(__GLIBCXX__)
+        template <typename T, typename Container>
+        struct is_contiguous_container_iterator<
+                __gnu_cxx::__normal_iterator<T*, Container> >
+          : boost::mpl::true_
+        {};
+#elif defined(_LIBCPP_VERSION)
+        template <typename T>
+        struct is_contiguous_container_iterator<std::__wrap_iter<T*> >
+          : boost::mpl::true_
+        {};
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // Map the given iterator onto an equivalent iterator referring to
+        // raw memory, if possible.
+        template <typename Iter, typename Enable = void>
+        struct vector_iterator
+        {
+            typedef boost::mpl::false_ type;
+        };
+
+        template <typename T>
+        struct vector_iterator<T*>
+        {
+            typedef is_vector_value<
+                    typename std::remove_const<T>::type
+                > type;
+
+            typedef T* iterator_type;
+            typedef T& reference;
+
+            static iterator_type call(T* it)
+            {
+                return it;
+            }
+
+            BOOST_FORCEINLINE static reference
+            deref(iterator_type it, std::size_t i)
+            {
+                return it[i];
+            }
+        };
+
+        template <typename Iter>
+        struct vector_iterator<Iter,
+            typename std::enable_if<
+                is_contiguous_container_iterator<Iter>::value
+            >::type>
+          : vector_iterator<
+                typename std::remove_reference<
+                    typename std::iterator_traits<Iter>::reference
+                >::type*>
+        {
+            typedef typename std::remove_reference<
+                    typename std::iterator_traits<Iter>::reference
+                >::type* iterator_type;
+
+            static iterator_type call(Iter it)
+            {
+                return std::addressof(*it);
+            }
+        };
+
+        template <typename... Iters>
+        struct all_vector_iterators;
+
+        template <>
+        struct all_vector_iterators<>
+          : boost::mpl::true_
+        {};
+
+        template <typename Iter, typename... Iters>
+        struct all_vector_iterators<Iter, Iters...>
+          : boost::mpl::bool_<
+                vector_iterator<Iter>::type::value &&
+                all_vector_iterators<Iters...>::value>
+        {};
+
+        template <typename... Iters>
+        struct vector_iterator<hpx::util::zip_iterator<Iters...>,
+            typename std::enable_if<
+                all_vector_iterators<Iters...>::value
+            >::type>
+        {
+            typedef boost::mpl::true_ type;
+
+            typedef hpx::util::tuple<
+                    typename vector_iterator<Iters>::iterator_type...
+                > iterator_type;
+            typedef hpx::util::tuple<
+                    typename vector_iterator<Iters>::reference...
+                > reference;
+
+            template <std::size_t... Is>
+            static iterator_type call(
+                hpx::util::detail::pack_c<std::size_t, Is...>,
+                hpx::util::zip_iterator<Iters...> const& it)
+            {
+                return iterator_type(vector_iterator<Iters>::call(
+                    hpx::util::get<Is>(it.get_iterator_tuple()))...);
+            }
+
+            static iterator_type call(
+                hpx::util::zip_iterator<Iters...> const& it)
+            {
+                return call(typename hpx::util::detail::make_index_pack<
+                        sizeof...(Iters)
+                    >::type(), it);
+            }
+
+            template <std::size_t... Is>
+            BOOST_FORCEINLINE static reference
+            deref(hpx::util::detail::pack_c<std::size_t, Is...>,
+                iterator_type const& it, std::size_t i)
+            {
+                return reference(hpx::util::get<Is>(it)[i]...);
+            }
+
+            BOOST_FORCEINLINE static reference
+            deref(iterator_type const& it, std::size_t i)
+            {
+                return deref(typename hpx::util::detail::make_index_pack<
+                        sizeof...(Iters)
+                    >::type(), it, i);
+            }
+        };
+
+        template <typename ExPolicy, typename Iter>
+        struct is_vectorizable
+          : boost::mpl::bool_<
+                parallel::is_vector_execution_policy<ExPolicy>::value &&
+                vector_iterator<Iter>::type::value>
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        // Call the given function for each element, the elements are
+        // processed in unspecified order.
+        template <typename VecIter>
+        struct vector_loop_kernel
+        {
+            typedef void result_type;
+
+            template <typename F>
+            BOOST_FORCEINLINE static void
+            call(typename VecIter::iterator_type const& first,
+                std::size_t count, F& f)
+            {
+                HPX_PARALLEL_VECTORIZE_LOOP
+                for (std::size_t i = 0; i < count; ++i)
+                    f(VecIter::deref(first, i));
+            }
+        };
+
+        // Reduce the elements using a pack of independent partial results
+        // which are combined at the end. This relies on the reduction
+        // operation being associative and commutative.
+        template <typename VecIter, typename T>
+        struct vector_accumulate_kernel
+        {
+            typedef T result_type;
+            static std::size_t const size = vector_pack_size<T>::value;
+
+            template <typename Reduce, typename Conv>
+            BOOST_FORCEINLINE static T
+            call(typename VecIter::iterator_type const& first,
+                std::size_t count, T init, Reduce& r, Conv& conv)
+            {
+                std::size_t i = 0;
+                if (count >= 2 * size)
+                {
+                    T pack[size];
+                    for (std::size_t j = 0; j != size; ++j)
+                        pack[j] = conv(VecIter::deref(first, j));
+
+                    for (i = size; i + size <= count; i += size)
+                    {
+                        for (std::size_t j = 0; j != size; ++j)
+                        {
+                            pack[j] = r(pack[j],
+                                conv(VecIter::deref(first, i + j)));
+                        }
+                    }
+
+                    for (std::size_t j = 0; j != size; ++j)
+                        init = r(init, pack[j]);
+                }
+
+                for (/**/; i != count; ++i)
+                    init = r(init, conv(VecIter::deref(first, i)));
+
+                return init;
+            }
+        };
+
+        struct vector_identity
+        {
+            template <typename T>
+            BOOST_FORCEINLINE T&& operator()(T&& t) const
+            {
+                return std::forward<T>(t);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename ExPolicy, typename Iter,
+            bool Vectorize = is_vectorizable<ExPolicy, Iter>::value>
+        struct vector_loop_n
+        {
+            template <typename F>
+            static Iter call(Iter it, std::size_t count, F& f)
+            {
+                return util::loop_n(it, count,
+                    [&f](Iter const& curr)
+                    {
+                        f(*curr);
+                    });
+            }
+        };
+
+        template <typename ExPolicy, typename Iter>
+        struct vector_loop_n<ExPolicy, Iter, true>
+        {
+            template <typename F>
+            static Iter call(Iter it, std::size_t count, F& f)
+            {
+                if (count == 0)
+                    return it;
+
+                typedef vector_iterator<Iter> vector_iterator_type;
+                simd_dispatch<
+                        vector_loop_kernel<vector_iterator_type>
+                    >::call(vector_iterator_type::call(it), count, f);
+
+                std::advance(it, count);
+                return it;
+            }
+        };
+
+        template <typename ExPolicy, typename Iter, typename T,
+            bool Vectorize = is_vectorizable<ExPolicy, Iter>::value &&
+                is_vector_value<T>::value>
+        struct vector_accumulate_n
+        {
+            template <typename Reduce, typename Conv>
+            static T call(Iter it, std::size_t count, T init, Reduce& r,
+                Conv& conv)
+            {
+                typedef typename std::iterator_traits<Iter>::reference
+                    reference;
+
+                return util::accumulate_n(it, count, std::move(init),
+                    [&r, &conv](T const& res, reference next)
+                    {
+                        return r(res, conv(next));
+                    });
+            }
+        };
+
+        template <typename ExPolicy, typename Iter, typename T>
+        struct vector_accumulate_n<ExPolicy, Iter, T, true>
+        {
+            template <typename Reduce, typename Conv>
+            static T call(Iter it, std::size_t count, T init, Reduce& r,
+                Conv& conv)
+            {
+                if (count == 0)
+                    return init;
+
+                typedef vector_iterator<Iter> vector_iterator_type;
+                return simd_dispatch<
+                        vector_accumulate_kernel<vector_iterator_type, T>
+                    >::call(vector_iterator_type::call(it), count, init, r,
+                        conv);
+            }
+        };
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Call the given function for each element referred to by the iterators
+    // in [it, it + count). If the execution policy allows for vectorization
+    // and the iterators refer to contiguous sequences of arithmetic values,
+    // the loop is executed using vectorized code paths selected at runtime.
+    template <typename ExPolicy, typename Iter, typename F>
+    BOOST_FORCEINLINE Iter
+    vector_loop_n(Iter it, std::size_t count, F && f)
+    {
+        return detail::vector_loop_n<ExPolicy, Iter>::call(it, count, f);
+    }
+
+    // Reduce the elements referred to by the iterators in [it, it + count),
+    // possibly using vectorized code paths (see vector_loop_n). The
+    // reduction operation is assumed to be associative and commutative.
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Conv>
+    BOOST_FORCEINLINE T
+    vector_accumulate_n(Iter it, std::size_t count, T init, Reduce && r,
+        Conv && conv)
+    {
+        return detail::vector_accumulate_n<ExPolicy, Iter, T>::call(
+            it, count, std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    BOOST_FORCEINLINE T
+    vector_accumulate_n(Iter it, std::size_t count, T init, Reduce && r)
+    {
+        detail::vector_identity conv;
+        return detail::vector_accumulate_n<ExPolicy, Iter, T>::call(
+            it, count, std::move(init), r, conv);
+    }
+}}}
+
+#endif
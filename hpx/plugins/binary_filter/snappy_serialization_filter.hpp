@@ -38,6 +38,8 @@ namespace hpx { namespace plugins { namespace compression
         std::size_t init_data(char const* buffer,
             std::size_t size, std::size_t buffer_size);
 
+        bool reset();
+
     private:
         // serialization support
         friend class hpx::serialization::access;
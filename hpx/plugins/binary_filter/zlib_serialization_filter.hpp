@@ -70,6 +70,8 @@ namespace hpx { namespace plugins { namespace compression
         std::size_t init_data(char const* buffer,
             std::size_t size, std::size_t buffer_size);
 
+        bool reset();
+
     protected:
         std::size_t load_impl(void* dst, std::size_t dst_count,
             void const* src, std::size_t src_count);
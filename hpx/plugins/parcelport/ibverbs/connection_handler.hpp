@@ -30,6 +30,7 @@ namespace hpx { namespace parcelset {
         typedef policies::ibverbs::sender connection_type;
         typedef boost::mpl::false_  send_early_parcel;
         typedef boost::mpl::true_ do_background_work;
+        typedef boost::mpl::false_ send_streamed;
         typedef boost::mpl::false_ do_enable_parcel_handling;
 
         static const char * type()
@@ -7,6 +7,7 @@
 #ifndef HPX_PARCELSET_POLICIES_IBVERBS_SENDER_HPP
 #define HPX_PARCELSET_POLICIES_IBVERBS_SENDER_HPP
 
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/plugins/parcelport/ibverbs/context.hpp>
@@ -126,6 +127,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace ibverbs
                     buffer_->data_point_.time_ = timer_.elapsed_nanoseconds()
                         - buffer_->data_point_.time_;
                     parcels_sent_.add_data(buffer_->data_point_);
+                    adaptive_compression::instance().add_transmission(
+                        buffer_->data_point_.bytes_,
+                        buffer_->data_point_.time_);
                     postprocess_function_type pp;
                     std::swap(pp, postprocess_);
                     pp(ec, there_, shared_from_this());
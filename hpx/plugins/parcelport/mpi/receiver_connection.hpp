@@ -30,8 +30,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
 
         typedef hpx::lcos::local::spinlock mutex_type;
 
-        typedef std::vector<char>
-            data_type;
+        typedef pooled_buffer_type data_type;
         typedef parcel_buffer<data_type, data_type> buffer_type;
 
     public:
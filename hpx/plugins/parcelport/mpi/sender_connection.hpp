@@ -23,7 +23,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
     struct sender_connection
       : parcelset::parcelport_connection<
             sender_connection
-          , std::vector<char>
+          , pooled_buffer_type
         >
     {
     private:
@@ -33,7 +33,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
             void(boost::system::error_code const&, parcel const&)
         > write_handler_type;
 
-        typedef std::vector<char> data_type;
+        typedef pooled_buffer_type data_type;
 
         enum connection_state
         {
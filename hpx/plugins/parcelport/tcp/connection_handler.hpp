@@ -35,6 +35,7 @@ namespace hpx { namespace parcelset
         typedef policies::tcp::sender connection_type;
         typedef boost::mpl::true_  send_early_parcel;
         typedef boost::mpl::false_ do_background_work;
+        typedef boost::mpl::true_  send_streamed;
 
         static const char * type()
         {
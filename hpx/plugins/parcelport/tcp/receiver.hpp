@@ -13,9 +13,13 @@
 #define HPX_PARCELSET_POLICIES_TCP_RECEIVER_HPP
 
 #include <hpx/config/asio.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/serialization/segmented_stream.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 
@@ -28,7 +32,9 @@
 #include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/ref.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/thread/locks.hpp>
@@ -40,8 +46,86 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
 
+    namespace detail
+    {
+        // Reads the segments of a streamed message from the socket. This is
+        // used from an HPX thread which is suspended until the asynchronous
+        // reads of the next segment have completed.
+        struct segment_reader : serialization::segment_source
+        {
+            typedef hpx::lcos::local::promise<boost::system::error_code>
+                promise_type;
+
+            segment_reader(boost::asio::ip::tcp::socket& socket,
+                    boost::uint64_t max_inbound_size)
+              : socket_(socket), max_inbound_size_(max_inbound_size),
+                bytes_read_(0)
+            {}
+
+            bool read_segment(std::vector<char>& segment)
+            {
+                HPX_ASSERT(threads::get_self_ptr() != 0);
+
+                boost::shared_ptr<promise_type> p =
+                    boost::make_shared<promise_type>();
+                hpx::future<boost::system::error_code> f = p->get_future();
+
+                segment.resize(serialization::segment_header_size);
+                boost::asio::async_read(socket_, boost::asio::buffer(segment),
+                    boost::bind(&segment_reader::handle_read_header, this,
+                        boost::asio::placeholders::error,
+                        boost::ref(segment), p));
+
+                boost::system::error_code ec = f.get();
+                if (ec)
+                    boost::throw_exception(boost::system::system_error(ec));
+
+                bytes_read_ += segment.size();
+                return true;
+            }
+
+            void handle_read_header(boost::system::error_code const& e,
+                std::vector<char>& segment,
+                boost::shared_ptr<promise_type> p)
+            {
+                if (e)
+                {
+                    p->set_value(e);
+                    return;
+                }
+
+                std::size_t size =
+                    serialization::get_segment_size(segment.data());
+                if (size > max_inbound_size_)
+                {
+                    p->set_value(boost::asio::error::make_error_code(
+                        boost::asio::error::operation_not_supported));
+                    return;
+                }
+
+                // now read the data of this segment
+                segment.resize(serialization::segment_header_size + size);
+                boost::asio::async_read(socket_, boost::asio::buffer(
+                        &segment[serialization::segment_header_size], size),
+                    boost::bind(&segment_reader::handle_read_data,
+                        boost::asio::placeholders::error, p));
+            }
+
+            static void handle_read_data(boost::system::error_code const& e,
+                boost::shared_ptr<promise_type> p)
+            {
+                p->set_value(e);
+            }
+
+            boost::asio::ip::tcp::socket& socket_;
+            boost::uint64_t max_inbound_size_;
+            std::size_t bytes_read_;
+        };
+    }
+
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<
+            receiver, pooled_buffer_type, pooled_buffer_type>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
@@ -152,6 +236,13 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     return;
                 }
 
+                // a message size of zero announces a streamed message
+                if (inbound_size == 0)
+                {
+                    handle_read_streamed(handler);
+                    return;
+                }
+
                 buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
 
                 // receive buffers
@@ -292,31 +383,101 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 buffer_.data_point_.time_ = timer_.elapsed_nanoseconds() -
                     buffer_.data_point_.time_;
 
-                // now send acknowledgment byte
-                void (receiver::*f)(boost::system::error_code const&,
-                        boost::tuple<Handler>)
-                    = &receiver::handle_write_ack<Handler>;
-
                 // decode the received parcels.
                 decode_parcels(parcelport_, std::move(buffer_), -1);
                 buffer_ = parcel_buffer_type();
 
-                ack_ = true;
+                // now send acknowledgment byte
+                write_ack(handler);
+            }
+        }
+
+        /// Receive and decode a streamed message. The parcels are
+        /// de-serialized on a new HPX thread, which reads the segments of the
+        /// message from the socket as it needs them. This keeps the I/O
+        /// thread available while waiting for the remaining data.
+        template <typename Handler>
+        void handle_read_streamed(boost::tuple<Handler> handler)
+        {
+            void (receiver::*f)(boost::tuple<Handler>)
+                = &receiver::read_streamed<Handler>;
+
+            error_code ec(lightweight);
+            threads::register_thread_nullary(
+                util::bind(f, shared_from_this(), handler),
+                "tcp::receiver::read_streamed", threads::pending, true,
+                threads::thread_priority_boost, std::size_t(-1),
+                threads::thread_stacksize_default, ec);
+
+            if (ec)
+            {
+                // report this problem back to the handler
+                boost::get<0>(handler)(boost::asio::error::make_error_code(
+                    boost::asio::error::operation_aborted));
+            }
+        }
+
+        template <typename Handler>
+        void read_streamed(boost::tuple<Handler> handler)
+        {
+            boost::system::error_code ec;
+            try {
+                detail::segment_reader reader(socket_, max_inbound_size_);
+                serialization::input_stream stream(reader);
+
+                decode_message_stream(parcelport_, stream, buffer_.data_point_);
+
+                // complete data point and pass it along
+                performance_counters::parcels::data_point& data =
+                    buffer_.data_point_;
+                data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+                data.bytes_ = reader.bytes_read_;
+                parcelport_.add_received_data(data);
+            }
+            catch (boost::system::system_error const& e) {
+                ec = e.code();
+            }
+            catch (...) {
+                // the sending end is notified by closing the connection
+                hpx::report_error(boost::current_exception());
+                ec = boost::asio::error::make_error_code(
+                    boost::asio::error::operation_aborted);
+            }
+
+            buffer_ = parcel_buffer_type();
+
+            if (ec)
+            {
+                boost::get<0>(handler)(ec);
+                return;
+            }
+
+            // now send acknowledgment byte
+            write_ack(handler);
+        }
+
+        template <typename Handler>
+        void write_ack(boost::tuple<Handler> handler)
+        {
+            void (receiver::*f)(boost::system::error_code const&,
+                    boost::tuple<Handler>)
+                = &receiver::handle_write_ack<Handler>;
+
+            ack_ = true;
+            {
+                boost::unique_lock<mutex_type> lk(mtx_);
+                if(!socket_.is_open())
                 {
-                    boost::unique_lock<mutex_type> lk(mtx_);
-                    if(!socket_.is_open())
-                    {
-                        lk.unlock();
-                        // report this problem back to the handler
-                        boost::get<0>(handler)(boost::asio::error::make_error_code(
-                            boost::asio::error::not_connected));
-                        return;
-                    }
-                    boost::asio::async_write(socket_,
-                        boost::asio::buffer(&ack_, sizeof(ack_)),
-                        boost::bind(f, shared_from_this(),
-                            boost::asio::placeholders::error, handler));
+                    lk.unlock();
+                    // report this problem back to the handler
+                    boost::get<0>(handler)(boost::asio::error::make_error_code(
+                        boost::asio::error::not_connected));
+                    return;
                 }
+                boost::asio::async_write(socket_,
+                    boost::asio::buffer(&ack_, sizeof(ack_)),
+                    boost::bind(f, shared_from_this(),
+                        boost::asio::placeholders::error, handler));
             }
         }
 
@@ -10,10 +10,15 @@
 #define HPX_PARCELSET_POLICIES_TCP_SENDER_HPP
 
 #include <hpx/config/asio.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset/encode_parcels.hpp>
+#include <hpx/runtime/serialization/segmented_stream.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 
 #include <hpx/util/bind.hpp>
@@ -29,6 +34,7 @@
 #include <boost/bind/protect.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/tuple/tuple.hpp>
@@ -37,8 +43,57 @@
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    namespace detail
+    {
+        // Writes the segments of a streamed message to the socket. This is
+        // used from an HPX thread which is suspended until the asynchronous
+        // write of each segment has completed.
+        struct segment_writer : serialization::segment_sink
+        {
+            typedef hpx::lcos::local::promise<boost::system::error_code>
+                promise_type;
+
+            explicit segment_writer(boost::asio::ip::tcp::socket& socket)
+              : socket_(socket), bytes_written_(0)
+            {}
+
+            void write_segment(std::vector<char>& segment)
+            {
+                write(boost::asio::buffer(segment));
+                bytes_written_ += segment.size();
+            }
+
+            template <typename Buffers>
+            void write(Buffers const& buffers)
+            {
+                HPX_ASSERT(threads::get_self_ptr() != 0);
+
+                boost::shared_ptr<promise_type> p =
+                    boost::make_shared<promise_type>();
+                hpx::future<boost::system::error_code> f = p->get_future();
+
+                boost::asio::async_write(socket_, buffers,
+                    boost::bind(&segment_writer::handle_write,
+                        boost::asio::placeholders::error, p));
+
+                boost::system::error_code ec = f.get();
+                if (ec)
+                    boost::throw_exception(boost::system::system_error(ec));
+            }
+
+            static void handle_write(boost::system::error_code const& e,
+                boost::shared_ptr<promise_type> p)
+            {
+                p->set_value(e);
+            }
+
+            boost::asio::ip::tcp::socket& socket_;
+            std::size_t bytes_written_;
+        };
+    }
+
     class sender
-      : public parcelset::parcelport_connection<sender, std::vector<char> >
+      : public parcelset::parcelport_connection<sender, pooled_buffer_type>
     {
     public:
         /// Construct a sending parcelport_connection with the given io_service.
@@ -149,6 +204,71 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 boost::bind(f, shared_from_this(), ::_1, ::_2));
         }
 
+        /// Serialize the given parcels directly to the socket. The message is
+        /// sent in segments as the serialization proceeds, which avoids
+        /// creating the whole message in memory first. This has to be called
+        /// on an HPX thread, which is suspended while the segments are
+        /// written, complete_streamed_write has to be called afterwards.
+        boost::system::error_code write_streamed(parcel const* ps,
+            std::size_t num_parcels, int archive_flags,
+            std::size_t segment_size,
+            serialization::output_archive::new_gids_map* new_gids)
+        {
+            HPX_ASSERT(buffer_.data_.empty());
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            state_ = state_async_write;
+#endif
+            /// Increment sends and begin timer.
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+
+            // a message size of zero announces a streamed message
+            buffer_.size_ = 0;
+            buffer_.data_size_ = segment_size;
+            buffer_.num_chunks_ = parcel_buffer_type::count_chunks_type(0, 0);
+
+            boost::system::error_code ec;
+            try {
+                detail::segment_writer writer(socket_);
+
+                std::vector<boost::asio::const_buffer> buffers;
+                buffers.push_back(boost::asio::buffer(&buffer_.size_,
+                    sizeof(buffer_.size_)));
+                buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
+                    sizeof(buffer_.data_size_)));
+                buffers.push_back(boost::asio::buffer(&buffer_.num_chunks_,
+                    sizeof(buffer_.num_chunks_)));
+                writer.write(buffers);
+
+                serialization::output_stream stream(writer, segment_size);
+
+                encode_parcels_stream(ps, num_parcels, stream, archive_flags,
+                    buffer_.data_point_, new_gids);
+
+                buffer_.data_point_.raw_bytes_ = writer.bytes_written_;
+            }
+            catch (boost::system::system_error const& e) {
+                ec = e.code();
+            }
+            catch (...) {
+                // the receiving end is notified by closing the connection
+                hpx::report_error(boost::current_exception());
+                ec = boost::asio::error::make_error_code(
+                    boost::asio::error::operation_aborted);
+            }
+            return ec;
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void complete_streamed_write(boost::system::error_code const& ec,
+            Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            handler_ = std::forward<Handler>(handler);
+            postprocess_handler_ = std::forward<ParcelPostprocess>(parcel_postprocess);
+
+            handle_write(ec, 0);
+        }
+
     private:
         /// handle completed write operation
         void handle_write(boost::system::error_code const& e, std::size_t bytes)
@@ -169,6 +289,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             buffer_.data_point_.time_ =
                 timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
             parcels_sent_.add_data(buffer_.data_point_);
+            adaptive_compression::instance().add_transmission(
+                buffer_.data_point_.bytes_, buffer_.data_point_.time_);
 
             // now handle the acknowledgment byte which is sent by the receiver
 #if defined(__linux) || defined(linux) || defined(__linux__)
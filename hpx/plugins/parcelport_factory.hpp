@@ -77,6 +77,9 @@ namespace hpx { namespace plugins
                 "max_connections_per_locality = "
                     "${HPX_PARCEL_" + name_uc + "_MAX_CONNECTIONS_PER_LOCALITY:"
                     "$[hpx.parcel.max_connections_per_locality]}",
+                "priority_connections = "
+                    "${HPX_PARCEL_" + name_uc + "_PRIORITY_CONNECTIONS:"
+                    "$[hpx.parcel.priority_connections]}",
                 "max_message_size =  ${HPX_PARCEL_" + name_uc +
                     "_MAX_MESSAGE_SIZE:$[hpx.parcel.max_message_size]}",
                 "max_outbound_message_size =  ${HPX_PARCEL_" + name_uc +
@@ -87,6 +90,9 @@ namespace hpx { namespace plugins
                 "zero_copy_optimization = ${HPX_PARCEL_" + name_uc +
                     "_ZERO_COPY_OPTIMIZATION:"
                     "$[hpx.parcel.zero_copy_optimization]}",
+                "integer_compression = ${HPX_PARCEL_" + name_uc +
+                    "_INTEGER_COMPRESSION:"
+                    "$[hpx.parcel.integer_compression]}",
                 "enable_security = ${HPX_PARCEL_" + name_uc +
                     "_ENABLE_SECURITY:"
                     "$[hpx.parcel.enable_security]}",
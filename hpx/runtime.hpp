@@ -25,6 +25,7 @@
 #include <hpx/components/security/certificate_store.hpp>
 #endif
 
+#include <boost/atomic.hpp>
 #include <boost/smart_ptr/scoped_ptr.hpp>
 #include <boost/thread/locks.hpp>
 
@@ -185,6 +186,30 @@ namespace hpx
         ///        instance
         void register_counter_types();
 
+        /// The phases of the startup of a locality whose durations are
+        /// recorded (see /runtime/startup/time/...)
+        enum startup_phase
+        {
+            startup_phase_bootstrap = 0,    ///< registration with AGAS
+            startup_phase_components,       ///< loading of components
+            startup_phase_counters,         ///< registration of counter types
+            startup_phase_barrier,          ///< 2nd stage boot barrier
+            startup_phase_startup_functions,///< (pre-)startup functions
+            startup_phase_last
+        };
+
+        /// \brief Record the time [ns] spent in the given startup phase
+        void set_startup_time(startup_phase phase, boost::uint64_t duration)
+        {
+            startup_times_[phase].store(duration);
+        }
+
+        /// \brief Return the time [ns] spent in the given startup phase
+        boost::int64_t get_startup_time(startup_phase phase, bool /*reset*/)
+        {
+            return static_cast<boost::int64_t>(startup_times_[phase].load());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual int run(util::function_nonser<hpx_main_function_type> const& func) = 0;
 
@@ -406,6 +431,7 @@ namespace hpx
         used_cores_map_type used_cores_map_;
 
         boost::atomic<state> state_;
+        boost::atomic<boost::uint64_t> startup_times_[startup_phase_last];
 
         boost::scoped_ptr<components::server::memory> memory_;
         boost::scoped_ptr<components::server::runtime_support> runtime_support_;
@@ -16,21 +16,26 @@
 #include <hpx/state.hpp>
 #include <hpx/lcos/local/mutex.hpp>
 #include <hpx/include/async.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+#include <hpx/runtime/agas/detail/local_address_table.hpp>
+#include <hpx/runtime/agas/detail/primary_namespace_partitions.hpp>
 #include <hpx/runtime/applier/applier.hpp>
 #include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/util/function.hpp>
+#include <hpx/util/interval_timer.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/make_shared.hpp>
-#include <boost/cache/entries/lfu_entry.hpp>
-#include <boost/cache/local_cache.hpp>
-#include <boost/cache/statistics/local_full_statistics.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/thread/locks.hpp>
 
 #include <map>
+#include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 // TODO: split into a base class and two implementations (one for bootstrap,
@@ -66,28 +71,28 @@ struct HPX_EXPORT addressing_service : boost::noncopyable
     // }}}
 
     // {{{ gva cache
-    struct gva_cache_key;
-    struct gva_erase_policy;
-    typedef boost::cache::entries::lfu_entry<gva> gva_entry_type;
-
-    typedef boost::cache::local_cache<
-        gva_cache_key, gva_entry_type,
-        std::less<gva_entry_type>,
-        boost::cache::policies::always<gva_entry_type>,
-        std::map<gva_cache_key, gva_entry_type>,
-        boost::cache::statistics::local_full_statistics
-    > gva_cache_type;
+    typedef detail::gva_cache gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, boost::int64_t> refcnt_requests_type;
 
+    // pending credit requests, grouped by the locality managing the ids
+    typedef std::map<boost::uint32_t, refcnt_requests_type>
+        refcnt_destinations_type;
+
     struct bootstrap_data_type;
     struct hosted_data_type;
 
-    mutable cache_mutex_type gva_cache_mtx_;
     boost::shared_ptr<gva_cache_type> gva_cache_;
+
+    // the table of migrated objects is looked at only if it's not empty
+    mutable cache_mutex_type migrated_objects_mtx_;
     migrated_objects_table_type migrated_objects_table_;
+    boost::atomic<std::size_t> num_migrated_objects_;
+
+    // addresses of the objects living on (and managed by) this locality
+    detail::local_address_table local_address_table_;
 
     mutable mutex_type console_cache_mtx_;
     boost::uint32_t console_cache_;
@@ -95,10 +100,19 @@ struct HPX_EXPORT addressing_service : boost::noncopyable
     std::size_t const max_refcnt_requests_;
 
     mutex_type refcnt_requests_mtx_;
-    std::size_t refcnt_requests_count_;
+    std::size_t refcnt_requests_count_;     // number of pending requests
     bool enable_refcnt_caching_;
 
-    boost::shared_ptr<refcnt_requests_type> refcnt_requests_;
+    boost::shared_ptr<refcnt_destinations_type> refcnt_requests_;
+
+    // sends the pending requests if they were not sent for some time
+    util::interval_timer refcnt_flush_timer_;
+
+    // statistics of the credit requests, a request is saved if it was
+    // combined with another request for the same id
+    boost::atomic<boost::int64_t> refcnt_requests_received_;
+    boost::atomic<boost::int64_t> refcnt_requests_saved_;
+    boost::atomic<boost::int64_t> refcnt_messages_sent_;
 
     service_mode const service_type;
     runtime_mode const runtime_type;
@@ -244,6 +258,7 @@ protected:
     naming::address resolve_full_postproc(
         future<response> f
       , naming::gid_type const& id
+      , boost::uint64_t generation
         );
     bool bind_postproc(
         future<response> f
@@ -256,13 +271,65 @@ protected:
         naming::gid_type const& id
         );
 
+    /// Return whether the given id is managed by the primary namespace
+    /// instance of this locality.
+    bool is_managed_locally(
+        naming::gid_type const& id
+        ) const
+    {
+        return detail::get_primary_namespace_locality_id(id) ==
+            naming::get_locality_id_from_gid(locality_);
+    }
+
+    /// Invoke the given request on the primary namespace instance managing
+    /// the given id. This is the local instance unless the primary namespace
+    /// is partitioned.
+    response service_primary_ns(
+        naming::gid_type const& id
+      , request const& req
+      , error_code& ec
+        );
+
+    /// Resolve the address of an object living on (and being managed by)
+    /// this locality without consulting the primary namespace.
+    bool resolve_local_address_table(
+        naming::gid_type const& id
+      , naming::address& addr
+        ) const;
+
+    /// Remember the given resolved address if it refers to an object living
+    /// on (and being managed by) this locality. The generation has to be
+    /// retrieved from the local address table before the resolution of the
+    /// address was started.
+    void update_local_address_table(
+        naming::gid_type const& id
+      , naming::address const& addr
+      , boost::uint64_t generation
+        );
+
 private:
     /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests(
         boost::unique_lock<mutex_type>& l
+      , boost::uint32_t destination
       , error_code& ec = throws
         );
 
+    /// Assumes that \a refcnt_requests_mtx_ is locked.
+    void send_refcnt_requests_non_blocking(
+        boost::unique_lock<mutex_type>& l
+      , boost::uint32_t destination
+      , error_code& ec
+        );
+
+    /// Send all pending requests, invoked by \a refcnt_flush_timer_.
+    bool flush_refcnt_requests();
+
+    /// Send the given requests to the locality managing the ids.
+    void send_refcnt_requests_non_blocking(
+        refcnt_requests_type const& requests
+        );
+
     /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests_non_blocking(
         boost::unique_lock<mutex_type>& l
@@ -297,6 +364,17 @@ private:
     boost::uint64_t get_cache_update_entry_time(bool reset);
     boost::uint64_t get_cache_erase_entry_time(bool reset);
 
+    // Helper functions to access the statistics of the credit requests
+    boost::int64_t get_refcnt_requests(bool reset);
+    boost::int64_t get_refcnt_requests_saved(bool reset);
+    boost::int64_t get_refcnt_messages(bool reset);
+
+    // Helper functions to access the migration statistics of the local
+    // primary namespace instance
+    boost::int64_t get_migrated_objects_count(bool reset);
+    boost::int64_t get_migration_time(bool reset);
+    boost::int64_t get_stalled_parcels_count(bool reset);
+
 public:
     response service(
         request const& req
@@ -1235,6 +1313,36 @@ public:
       , error_code& ec = throws
         );
 
+    /// \brief Query for all global names starting with the given prefix
+    ///
+    /// This function returns all registered global names which start with
+    /// the given prefix together with the global ids associated with them.
+    /// The names are kept in sorted order by all symbol namespace instances,
+    /// the lookup does not require to scan all registered names.
+    ///
+    /// \param prefix     [in] The prefix of the global names to return. All
+    ///                   registered names are returned if this is empty.
+    /// \param ec         [in,out] this represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    lcos::future<std::map<std::string, naming::id_type> > find_symbols_async(
+        std::string const& prefix
+        );
+
+    std::map<std::string, naming::id_type> find_symbols(
+        std::string const& prefix
+      , error_code& ec = throws
+        )
+    {
+        return find_symbols_async(prefix).get(ec);
+    }
+
     /// \brief Register a global name with a global address (id)
     ///
     /// This function registers an association between a global name
@@ -1361,6 +1469,34 @@ public:
         return resolve_name_async(name).get(ec);
     }
 
+    /// \brief Register a list of global names with global addresses (ids)
+    ///
+    /// This function is equivalent to calling \a register_name for each of
+    /// the given names, except that all names handled by the same symbol
+    /// namespace instance are sent using a single request.
+    ///
+    /// \returns          The function returns for each of the given names
+    ///                   whether it was registered.
+    std::vector<bool> register_names(
+        std::vector<std::pair<std::string, naming::id_type> > const& names
+      , error_code& ec = throws
+        );
+
+    /// \brief Query for the global addresses associated with a list of
+    ///        global names.
+    ///
+    /// This function is equivalent to calling \a resolve_name for each of
+    /// the given names, except that all names handled by the same symbol
+    /// namespace instance are sent using a single request.
+    ///
+    /// \returns          The function returns the ids associated with the
+    ///                   given names, the id is invalid for every name which
+    ///                   is not registered.
+    std::vector<naming::id_type> resolve_names(
+        std::vector<std::string> const& names
+      , error_code& ec = throws
+        );
+
     /// \brief Install a listener for a given symbol namespace event.
     ///
     /// This function installs a listener for a given symbol namespace event.
@@ -1378,9 +1514,12 @@ public:
     /// \returns  A future instance encapsulating the global id which is
     ///           causing the registered listener to be triggered.
     ///
-    /// \note    The only event type which is currently supported is
-    ///          \a symbol_ns_bind, i.e. the listener is triggered whenever a
-    ///          global id is registered with the given name.
+    /// \note    The supported event types are \a symbol_ns_bind, i.e. the
+    ///          listener is triggered whenever a global id is registered with
+    ///          the given name, and \a symbol_ns_unbind, i.e. the listener
+    ///          is triggered whenever the given name is unregistered (the
+    ///          returned id is unmanaged). The latter can be used to
+    ///          invalidate locally cached results of \a resolve_name.
     ///
     future<hpx::id_type> on_symbol_namespace_event(std::string const& name,
         namespace_action_code evt, bool call_for_past_events = false);
@@ -1429,6 +1568,13 @@ public:
         update_cache_entry(gid, g, ec);
     }
 
+    /// \warning This function is for internal use only. It is dangerous and
+    ///          may break your code if you use it.
+    void update_cache_entries(
+        std::vector<gva_cache_type::entry_type> const& entries
+      , error_code& ec = throws
+        );
+
     /// \warning This function is for internal use only. It is dangerous and
     ///          may break your code if you use it.
     void clear_cache(
@@ -1464,6 +1610,19 @@ public:
             );
     hpx::future<bool> end_migration_async(naming::id_type const& id);
 
+    /// start/stop migration of a set of objects, the migration of all
+    /// objects managed by the same primary namespace instance is started
+    /// (stopped) using a single request
+    ///
+    /// \returns Current locality and address of each of the objects
+    hpx::future<std::vector<std::pair<naming::id_type, naming::address> > >
+        begin_migration_async(
+            std::vector<naming::id_type> const& ids
+          , naming::id_type const& target_locality
+            );
+    hpx::future<bool> end_migration_async(
+        std::vector<naming::id_type> const& ids);
+
     /// Maintain list of migrated objects
     bool was_object_migrated(naming::id_type const* ids, std::size_t size);
 };
@@ -22,11 +22,16 @@
 #include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 
+#include <memory>
+#include <vector>
+
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx { namespace agas
 {
 
+struct notification_header;
+
 struct HPX_EXPORT big_boot_barrier : boost::noncopyable
 {
   private:
@@ -42,6 +47,12 @@ struct HPX_EXPORT big_boot_barrier : boost::noncopyable
 
     boost::lockfree::queue<util::unique_function_nonser<void()>* > thunks;
 
+    // notifications for the localities participating in startup
+    // synchronization, sent along a tree once the runtime is up (protected
+    // by mtx)
+    std::unique_ptr<std::vector<notification_header> > notifications;
+    std::size_t const fanout;
+
     void spin();
 
     void notify();
@@ -73,16 +84,14 @@ struct HPX_EXPORT big_boot_barrier : boost::noncopyable
       , util::runtime_configuration const& ini_
         );
 
-    ~big_boot_barrier()
-    {
-        util::unique_function_nonser<void()>* f;
-        while (thunks.pop(f))
-            delete f;
-    }
+    ~big_boot_barrier();
 
     parcelset::locality here() { return bootstrap_agas; }
     parcelset::endpoints_type const &get_endpoints() { return endpoints; }
 
+    // number of localities each locality forwards the notifications to
+    std::size_t get_fanout() const { return fanout; }
+
     template <typename Action, typename... Args>
     void apply(
         boost::uint32_t source_locality_id
@@ -127,6 +136,9 @@ struct HPX_EXPORT big_boot_barrier : boost::noncopyable
     {
         thunks.push(f);
     }
+
+    // the given notification is sent once the runtime is up
+    void add_notification(notification_header && hdr);
 };
 
 HPX_EXPORT void create_big_boot_barrier(
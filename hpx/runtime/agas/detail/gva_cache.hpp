@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_DETAIL_GVA_CACHE_HPP)
+#define HPX_AGAS_DETAIL_GVA_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The client side cache of address translations of the addressing
+    // service.
+    //
+    // The cache is a set associative table: every entry can be stored in one
+    // of a small number of slots (the ways of a set) only. Each set is
+    // protected by a sequence lock, lookups never write to shared memory
+    // (except for setting the referenced bit of the entry found) and are
+    // retried if the set was modified concurrently. Writers are serialized
+    // by a fixed number of locks (shards) the sets are distributed over.
+    // Entries are evicted using the CLOCK algorithm on a per set basis.
+    //
+    // Single objects are stored in the set selected by their id. Ranges are
+    // stored in the sets selected by every bucket of 2^bucket_shift ids they
+    // cover, as lookups can't know the base id of the range. Ranges covering
+    // more than max_range_buckets buckets are kept in a (small) ordered map
+    // which is consulted only if it is not empty.
+    class HPX_EXPORT gva_cache : boost::noncopyable
+    {
+    public:
+        typedef std::pair<naming::gid_type, gva> entry_type;
+
+        enum statistics_type
+        {
+            num_hits = 0,
+            num_misses = 1,
+            num_evictions = 2,
+            num_insertions = 3,
+            get_entry_count = 4,
+            insert_entry_count = 5,
+            update_entry_count = 6,
+            erase_entry_count = 7,
+            get_entry_time = 8,
+            insert_entry_time = 9,
+            update_entry_time = 10,
+            erase_entry_time = 11,
+            num_statistics = 12
+        };
+
+        static const std::size_t num_shards = 64;
+        static const std::size_t num_ways = 8;
+        static const unsigned bucket_shift = 8;
+        static const std::size_t max_range_buckets = 4;
+
+        // the capacity used if the configured cache size is unlimited
+        static const std::size_t max_capacity = std::size_t(1) << 20;
+
+        gva_cache();
+
+        // Make sure the cache can hold at least the given number of entries.
+        // Growing the cache drops all entries currently cached.
+        void reserve(std::size_t capacity);
+
+        std::size_t capacity() const;
+
+        // Find the entry containing the given id.
+        bool get_entry(naming::gid_type const& id, naming::gid_type& base,
+            gva& g);
+
+        // Insert a new entry for the given range. Returns false if the first
+        // id of the range is already contained in a cached entry.
+        bool insert(naming::gid_type const& id, gva const& g);
+
+        // Insert the given entry or replace the data of the cached entry
+        // for the same range.
+        void update(naming::gid_type const& id, gva const& g);
+
+        // Insert or replace all given entries, each lock is acquired at most
+        // once.
+        void update(std::vector<entry_type> const& entries);
+
+        // Remove all entries starting at the given id.
+        void erase(naming::gid_type const& id);
+
+        void clear();
+
+        boost::int64_t get_statistics(statistics_type which, bool reset);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct slot
+        {
+            slot()
+              : count_(0), base_msb_(0), base_lsb_(0), prefix_msb_(0),
+                prefix_lsb_(0), type_(0), lva_(0), offset_(0),
+                referenced_(false)
+            {}
+
+            // a count of zero marks an unused slot
+            boost::atomic<boost::uint64_t> count_;
+            boost::atomic<boost::uint64_t> base_msb_;
+            boost::atomic<boost::uint64_t> base_lsb_;
+            boost::atomic<boost::uint64_t> prefix_msb_;
+            boost::atomic<boost::uint64_t> prefix_lsb_;
+            boost::atomic<boost::int32_t> type_;
+            boost::atomic<boost::uint64_t> lva_;
+            boost::atomic<boost::uint64_t> offset_;
+            boost::atomic<bool> referenced_;
+        };
+
+        struct set
+        {
+            set() : sequence_(0), hand_(0) {}
+
+            // odd while the set is being modified
+            boost::atomic<boost::uint64_t> sequence_;
+            std::size_t hand_;
+            slot slots_[num_ways];
+        };
+
+        struct table
+        {
+            explicit table(std::size_t num_sets);
+
+            std::size_t get_set(naming::gid_type const& id) const;
+            std::size_t get_bucket_set(boost::uint64_t msb,
+                boost::uint64_t bucket) const;
+
+            std::size_t num_sets_;
+            unsigned shift_;
+            std::unique_ptr<set[]> sets_;
+
+            // number of slots holding ranges (count > 1)
+            boost::atomic<std::size_t> num_range_slots_;
+        };
+
+        struct shard
+        {
+            shard();
+
+            mutex_type mtx_;
+            boost::atomic<boost::int64_t> statistics_[num_statistics];
+        };
+
+        class update_on_exit;
+        class set_write_lock;
+
+        struct overflow_entry
+        {
+            gva gva_;
+            bool referenced_;
+        };
+        typedef std::map<naming::gid_type, overflow_entry> overflow_type;
+
+        static std::size_t get_shard(std::size_t set)
+        {
+            return set & (num_shards - 1);
+        }
+
+        // Return the number of buckets covered by the given range.
+        static boost::uint64_t get_num_buckets(naming::gid_type const& id,
+            boost::uint64_t count);
+
+        // All of the functions below expect the ids to be stripped of their
+        // internal bits.
+        bool find(table& t, naming::gid_type const& id,
+            naming::gid_type& base, gva& g);
+        bool find(set& s, naming::gid_type const& id, naming::gid_type& base,
+            gva& g);
+        bool find_overflow(naming::gid_type const& id, naming::gid_type& base,
+            gva& g);
+
+        // Store the given range in the given set, the set's shard has to be
+        // locked. Returns whether a new entry was inserted.
+        bool store(table& t, set& s, shard& sh,
+            naming::gid_type const& id, boost::uint64_t count, gva const& g);
+        bool store_overflow(naming::gid_type const& id, gva const& g);
+        bool store_entry(table& t, naming::gid_type const& id, gva const& g);
+
+        // Remove all entries starting at the given id from the given set.
+        void erase(table& t, set& s, naming::gid_type const& id);
+        void clear_slot(table& t, slot& sl);
+
+        boost::atomic<table*> table_;
+        shard shards_[num_shards];
+
+        // tables replaced by reserve() may still be in use by concurrent
+        // lookups, they are released when the cache is destroyed
+        mutex_type tables_mtx_;
+        std::vector<std::unique_ptr<table> > tables_;
+
+        mutable mutex_type overflow_mtx_;
+        overflow_type overflow_;
+        naming::gid_type overflow_hand_;
+        std::size_t overflow_capacity_;
+        boost::atomic<std::size_t> overflow_size_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_DETAIL_GVA_TABLE_HPP)
+#define HPX_AGAS_DETAIL_GVA_TABLE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The GVA table of the primary namespace maps (ranges of) global ids to
+    // their global virtual address and the locality they live on.
+    //
+    // The id space is split into buckets of 2^bucket_shift consecutive ids,
+    // the buckets are distributed over a fixed number of shards, each of
+    // which holds an ordered map protected by its own lock. A range is
+    // stored in every shard its ids map to, which allows resolving any id by
+    // looking at exactly one shard. Most ranges are small (a single object
+    // or a block of components), these are stored once or twice only. As
+    // ids are assigned sequentially, the objects created by a locality are
+    // spread evenly over all shards.
+    //
+    // Ranges covering at least as many buckets as there are shards are kept
+    // (once) in a separate shard instead, which is looked at only if an id
+    // was not found in its own shard.
+    //
+    // All ranges are expected to be contained in a single MSB (this is
+    // ensured by the primary namespace).
+    class HPX_EXPORT gva_table : boost::noncopyable
+    {
+    public:
+        typedef std::pair<gva, naming::gid_type> data_type;
+
+        enum bind_result
+        {
+            bind_inserted = 0,          // a new range was inserted
+            bind_updated = 1,           // an existing range was updated
+            bind_count_mismatch = 2,    // the block size of an existing range
+                                        // differs
+            bind_update_rejected = 3,   // updating existing ranges was not
+                                        // allowed
+            bind_contained = 4          // the id is contained in an existing
+                                        // range
+        };
+
+        enum unbind_result
+        {
+            unbind_removed = 0,         // the range was removed
+            unbind_not_found = 1,       // no range starts at the given id
+            unbind_count_mismatch = 2   // the range has a different size
+        };
+
+        static const std::size_t num_shards = 64;
+        static const unsigned bucket_shift = 8;
+
+        gva_table() : num_spanning_(0), size_(0) {}
+
+        // Find the range containing the given id. Returns false if the id is
+        // not bound.
+        bool resolve(naming::gid_type const& id, naming::gid_type& base,
+            data_type& data) const;
+
+        // Insert a new range starting at the given id, or update the data of
+        // the range starting at it (if allowed).
+        bind_result bind(naming::gid_type const& id, data_type const& data,
+            bool allow_update);
+
+        // Remove the range of the given size starting at the given id and
+        // return the data stored for it.
+        unbind_result unbind(naming::gid_type const& id, boost::uint64_t count,
+            data_type& data);
+
+        // Return the number of bound ranges
+        std::size_t size() const
+        {
+            return size_.load(boost::memory_order_relaxed);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::map<naming::gid_type, data_type> map_type;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            map_type entries_;
+        };
+
+        class shards_lock;
+
+        static std::size_t get_shard(naming::gid_type const& id);
+
+        // Return whether the given range is stored in the shard for spanning
+        // ranges.
+        static bool is_spanning(naming::gid_type const& id,
+            boost::uint64_t count);
+
+        // Return the set of shards the given (not spanning) range is stored
+        // in (as a bit mask).
+        static boost::uint64_t get_shards(naming::gid_type const& id,
+            boost::uint64_t count);
+
+        static bool find_range(map_type const& entries,
+            naming::gid_type const& id, naming::gid_type& base,
+            data_type& data);
+
+        static bind_result check_bind(map_type const& entries,
+            naming::gid_type const& id, boost::uint64_t count,
+            bool allow_update);
+
+        shard shards_[num_shards];
+        shard spanning_;
+        boost::atomic<std::size_t> num_spanning_;
+        boost::atomic<std::size_t> size_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
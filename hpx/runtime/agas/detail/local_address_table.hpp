@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_DETAIL_LOCAL_ADDRESS_TABLE_HPP)
+#define HPX_AGAS_DETAIL_LOCAL_ADDRESS_TABLE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A direct mapped table holding the local virtual addresses of objects
+    // which live on this locality and whose global ids are managed by this
+    // locality.
+    //
+    // The global ids of such objects are allocated consecutively from the
+    // ranges assigned to this locality, the slot of an id is selected by the
+    // lower bits of its LSB. A lookup is a single array access and never
+    // acquires a lock, every slot is protected by a sequence lock.
+    //
+    // The table is filled lazily from the results of the local primary
+    // namespace. Entries are inserted only if no entry has been removed since
+    // the corresponding resolution was started (see get_generation()).
+    class HPX_EXPORT local_address_table : boost::noncopyable
+    {
+    public:
+        local_address_table();
+
+        // Set the number of slots of the table (rounded up to the next power
+        // of two), a size of zero disables the table. This must be called
+        // before the table is used.
+        void reserve(std::size_t size);
+
+        std::size_t size() const
+        {
+            return slots_ ? mask_ + 1 : 0;
+        }
+
+        // Retrieve the type and local virtual address of the given object.
+        bool get_entry(naming::gid_type const& id,
+            boost::int32_t& type, boost::uint64_t& lva) const;
+
+        // Returns a value which changes whenever an entry is removed.
+        boost::uint64_t get_generation() const
+        {
+            return generation_.load(boost::memory_order_acquire);
+        }
+
+        // Store the address of the given object, unless any entry has been
+        // removed since the given generation was retrieved.
+        bool insert(naming::gid_type const& id, boost::int32_t type,
+            boost::uint64_t lva, boost::uint64_t generation);
+
+        // Remove the entries of the given range of ids.
+        void erase(naming::gid_type const& id, boost::uint64_t count = 1);
+
+        void clear();
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct slot
+        {
+            slot()
+              : sequence_(0), msb_(0), lsb_(0), type_(0), lva_(0)
+            {}
+
+            // odd while the slot is being modified
+            boost::atomic<boost::uint64_t> sequence_;
+
+            // an id of zero marks an unused slot
+            boost::atomic<boost::uint64_t> msb_;
+            boost::atomic<boost::uint64_t> lsb_;
+            boost::atomic<boost::int32_t> type_;
+            boost::atomic<boost::uint64_t> lva_;
+        };
+
+        class slot_write_lock;
+
+        slot& get_slot(boost::uint64_t lsb) const
+        {
+            return slots_[static_cast<std::size_t>(lsb) & mask_];
+        }
+
+        // the writers lock has to be held
+        void store(slot& s, boost::uint64_t msb, boost::uint64_t lsb,
+            boost::int32_t type, boost::uint64_t lva);
+
+        std::unique_ptr<slot[]> slots_;
+        std::size_t mask_;
+
+        mutable mutex_type mtx_;
+        boost::atomic<boost::uint64_t> generation_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
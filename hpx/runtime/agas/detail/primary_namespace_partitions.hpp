@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_DETAIL_PRIMARY_NAMESPACE_PARTITIONS_HPP)
+#define HPX_AGAS_DETAIL_PRIMARY_NAMESPACE_PARTITIONS_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/name.hpp>
+
+#include <boost/cstdint.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // By default, every id is managed by the primary namespace instance of
+    // the locality which allocated it. If the primary namespace is
+    // partitioned, the ids allocated dynamically by the primary namespace are
+    // distributed over the primary namespace instances of the localities
+    // 0...N-1 instead: blocks of primary_namespace_partition_size ids are
+    // assigned to a locality based on a hash of their first id. Allocations
+    // never cross the boundary of a block, which guarantees that all ids of a
+    // bound range are managed by the same instance.
+    //
+    // All other ids (localities, AGAS services, ids encoding local virtual
+    // addresses) are always managed by the locality which created them.
+    BOOST_CONSTEXPR_OR_CONST unsigned primary_namespace_partition_shift = 20;
+    BOOST_CONSTEXPR_OR_CONST boost::uint64_t primary_namespace_partition_size =
+        boost::uint64_t(1) << primary_namespace_partition_shift;
+
+    // The first lsb handed out by the primary namespace, smaller values are
+    // reserved for the AGAS services.
+    BOOST_CONSTEXPR_OR_CONST boost::uint64_t primary_namespace_first_lsb = 0x1000;
+
+    // Set the number of partitions of the primary namespace, zero disables
+    // partitioning. This has to be set to the same value on all localities
+    // before any id is bound.
+    HPX_API_EXPORT void set_primary_namespace_partitions(
+        boost::uint32_t num_partitions);
+    HPX_API_EXPORT boost::uint32_t get_primary_namespace_partitions();
+
+    // Return whether the given id was allocated by the primary namespace.
+    HPX_API_EXPORT bool is_dynamically_allocated(naming::gid_type const& id);
+
+    // Return the id of the locality whose primary namespace instance manages
+    // the given id.
+    HPX_API_EXPORT boost::uint32_t get_primary_namespace_locality_id(
+        naming::gid_type const& id);
+}}}
+
+#endif
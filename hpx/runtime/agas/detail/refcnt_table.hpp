@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_AGAS_DETAIL_REFCNT_TABLE_HPP)
+#define HPX_AGAS_DETAIL_REFCNT_TABLE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The global reference counts of the ids managed by the primary
+    // namespace. Ids are not inserted into the table when they are bound, an
+    // id which is not in the table has the initial global reference count.
+    // The table is split into shards (selected by hashing the id), each of
+    // which is protected by its own lock.
+    class HPX_EXPORT refcnt_table : boost::noncopyable
+    {
+    public:
+        static const std::size_t num_shards = 64;
+
+        // Add the given number of credits to the reference count of all ids
+        // in [lower, upper). The ids whose reference count dropped to zero
+        // are appended to the given list, these stay in the table until
+        // they are explicitly erased. Returns false if a reference count
+        // became negative, in which case the offending id and its reference
+        // count are returned.
+        bool change(naming::gid_type const& lower,
+            naming::gid_type const& upper, boost::int64_t credits,
+            std::list<naming::gid_type>& freed,
+            naming::gid_type& invalid_id, boost::int64_t& invalid_count);
+
+        // Remove the given ids from the table if their reference count is
+        // (still) zero.
+        void erase(std::list<naming::gid_type> const& freed);
+
+        // Return the reference count of the given id if it is in the table
+        bool get(naming::gid_type const& id, boost::int64_t& count) const;
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::map<naming::gid_type, boost::int64_t> map_type;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            map_type entries_;
+        };
+
+        static std::size_t get_shard(naming::gid_type const& id);
+
+        shard shards_[num_shards];
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
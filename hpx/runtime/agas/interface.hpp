@@ -17,6 +17,11 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace hpx { namespace agas
 {
 
@@ -76,6 +81,28 @@ HPX_API_EXPORT lcos::future<naming::id_type> resolve_name(
     std::string const& name
     );
 
+///////////////////////////////////////////////////////////////////////////////
+HPX_API_EXPORT std::vector<bool> register_names_sync(
+    std::vector<std::pair<std::string, naming::id_type> > const& names
+  , error_code& ec = throws
+    );
+
+HPX_API_EXPORT std::vector<naming::id_type> resolve_names_sync(
+    std::vector<std::string> const& names
+  , error_code& ec = throws
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_API_EXPORT lcos::future<std::map<std::string, naming::id_type> >
+    find_symbols(
+        std::string const& prefix = ""
+        );
+
+HPX_API_EXPORT std::map<std::string, naming::id_type> find_symbols_sync(
+    std::string const& prefix = ""
+  , error_code& ec = throws
+    );
+
 ///////////////////////////////////////////////////////////////////////////////
 // HPX_API_EXPORT lcos::future<std::vector<naming::id_type> > get_localities(
 //     components::component_type type = components::component_invalid
@@ -310,6 +337,15 @@ HPX_API_EXPORT hpx::future<std::pair<naming::id_type, naming::address> >
         naming::id_type const& target_locality);
 HPX_API_EXPORT hpx::future<bool> end_migration(naming::id_type const& id);
 
+HPX_API_EXPORT hpx::future<
+        std::vector<std::pair<naming::id_type, naming::address> >
+    >
+    begin_migration(
+        std::vector<naming::id_type> const& ids,
+        naming::id_type const& target_locality);
+HPX_API_EXPORT hpx::future<bool> end_migration(
+    std::vector<naming::id_type> const& ids);
+
 }}
 
 #endif // HPX_A55506A4_4AC7_4FD0_AB0D_ED0D1368FCC5
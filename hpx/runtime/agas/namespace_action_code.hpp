@@ -64,7 +64,8 @@ enum namespace_action_code
     symbol_ns_unbind                        = BOOST_BINARY_U(0010100),
     symbol_ns_iterate_names                 = BOOST_BINARY_U(0010101),
     symbol_ns_on_event                      = BOOST_BINARY_U(0010110),
-    symbol_ns_statistics_counter            = BOOST_BINARY_U(0010111)
+    symbol_ns_statistics_counter            = BOOST_BINARY_U(0010111),
+    symbol_ns_find_prefix                   = BOOST_BINARY_U(0011000)
 };
 
 namespace detail
@@ -405,6 +406,11 @@ namespace detail
           , counter_target_count
           , symbol_ns_on_event
           , symbol_ns_statistics_counter }
+      , {   "count/find_prefix"
+          , ""
+          , counter_target_count
+          , symbol_ns_find_prefix
+          , symbol_ns_statistics_counter }
       // counters exposing API timings
       , {   "time/bind"
           , "ns"
@@ -431,6 +437,11 @@ namespace detail
           , counter_target_time
           , symbol_ns_on_event
           , symbol_ns_statistics_counter }
+      , {   "time/find_prefix"
+          , "ns"
+          , counter_target_time
+          , symbol_ns_find_prefix
+          , symbol_ns_statistics_counter }
     };
     static std::size_t const num_symbol_namespace_services =
         sizeof(symbol_namespace_services)/sizeof(symbol_namespace_services[0]);
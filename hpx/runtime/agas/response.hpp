@@ -23,8 +23,10 @@
 #include <boost/variant.hpp>
 #include <boost/mpl/at.hpp>
 
+#include <map>
 #include <memory>
 #include <numeric>
+#include <string>
 
 namespace hpx { namespace agas
 {
@@ -114,6 +116,12 @@ struct HPX_EXPORT response
       , error status_ = success
         );
 
+    response(
+        namespace_action_code type_
+      , std::map<std::string, naming::gid_type> const& names_
+      , error status_ = success
+        );
+
     ~response();
 
     ///////////////////////////////////////////////////////////////////////////
@@ -196,6 +204,10 @@ struct HPX_EXPORT response
         error_code& ec = throws
         ) const;
 
+    std::map<std::string, naming::gid_type> get_names(
+        error_code& ec = throws
+        ) const;
+
     namespace_action_code get_action_code() const
     {
         return mc;
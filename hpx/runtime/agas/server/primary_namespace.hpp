@@ -15,8 +15,11 @@
 #include <hpx/runtime/agas/request.hpp>
 #include <hpx/runtime/agas/response.hpp>
 #include <hpx/runtime/agas/namespace_action_code.hpp>
+#include <hpx/runtime/agas/detail/gva_table.hpp>
+#include <hpx/runtime/agas/detail/refcnt_table.hpp>
 #include <hpx/runtime/components/component_type.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/logging.hpp>
@@ -34,6 +37,7 @@
 #endif
 
 #include <map>
+#include <vector>
 
 namespace hpx { namespace agas
 {
@@ -122,28 +126,43 @@ struct HPX_EXPORT primary_namespace
 
     typedef boost::int32_t component_type;
 
-    typedef std::pair<gva, naming::gid_type> gva_table_data_type;
-    typedef std::map<naming::gid_type, gva_table_data_type> gva_table_type;
-    typedef std::map<naming::gid_type, boost::int64_t> refcnt_table_type;
+    typedef detail::gva_table::data_type gva_table_data_type;
+    typedef detail::gva_table gva_table_type;
+    typedef detail::refcnt_table refcnt_table_type;
 
     typedef boost::fusion::vector3<naming::gid_type, gva, naming::gid_type>
         resolved_type;
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
+    // The GVA and reference count tables are sharded and protected by their
+    // own locks, this mutex protects the migration table only.
     mutex_type mutex_;
 
     gva_table_type gvas_;
     refcnt_table_type refcnts_;
+    boost::atomic<std::size_t> num_migrating_objects_;
+
+    // Resolution requests for an object which is being migrated wait for the
+    // migration to complete, parcels routed to it are held back instead and
+    // are routed once the migration is complete.
+    struct migration_data
+    {
+        migration_data()
+          : started_at_(hpx::util::high_resolution_clock::now())
+        {}
+
+        lcos::local::condition_variable cond_;
+        std::vector<parcelset::parcel> parcels_;
+        boost::uint64_t started_at_;
+    };
+
 #if !defined(HPX_GCC_VERSION) || HPX_GCC_VERSION >= 408000
-    typedef std::map<naming::gid_type, lcos::local::condition_variable>
-        migration_table_type;
+    typedef std::map<naming::gid_type, migration_data> migration_table_type;
 #else
     typedef std::map<
             naming::gid_type
-          , boost::shared_ptr<lcos::local::condition_variable>
+          , boost::shared_ptr<migration_data>
         > migration_table_type;
 #endif
 
@@ -169,6 +188,9 @@ struct HPX_EXPORT primary_namespace
         };
 
         counter_data()
+          : migrated_objects_(0)
+          , migration_time_(0)
+          , stalled_parcels_(0)
         {}
 
     public:
@@ -195,6 +217,10 @@ struct HPX_EXPORT primary_namespace
         boost::int64_t get_end_migration_time(bool);
         boost::int64_t get_overall_time(bool);
 
+        boost::int64_t get_migrated_objects_count(bool);
+        boost::int64_t get_migration_time(bool);
+        boost::int64_t get_stalled_parcels_count(bool);
+
         // increment counter values
         void increment_route_count();
         void increment_bind_gid_count();
@@ -219,6 +245,12 @@ struct HPX_EXPORT primary_namespace
         api_counter_data allocate_;             // primary_ns_allocate
         api_counter_data begin_migration_;      // primary_ns_begin_migration
         api_counter_data end_migration_;        // primary_ns_end_migration
+
+        // number of completed migrations, overall time objects were being
+        // migrated, and number of parcels held back during migrations
+        boost::atomic<boost::int64_t> migrated_objects_;
+        boost::atomic<boost::int64_t> migration_time_;
+        boost::atomic<boost::int64_t> stalled_parcels_;
     };
     counter_data counter_data_;
 
@@ -239,14 +271,10 @@ struct HPX_EXPORT primary_namespace
     };
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit counts of all ids in the given range.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , boost::unique_lock<mutex_type>& l
       , const char* func_name
         );
 #endif
@@ -265,9 +293,14 @@ struct HPX_EXPORT primary_namespace
       , naming::gid_type id
       , error_code& ec);
 
+    // hold back the given parcel if its destination is being migrated
+    bool hold_back_parcel_if_migrating(
+        parcelset::parcel& p);
+
   public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
+      , num_migrating_objects_(0)
       , locality_(naming::invalid_gid)
     {}
 
@@ -327,6 +360,20 @@ struct HPX_EXPORT primary_namespace
         parcelset::parcel && p
         );
 
+    /// Statistics about the migrations handled by this instance.
+    boost::int64_t get_migrated_objects_count(bool reset)
+    {
+        return counter_data_.get_migrated_objects_count(reset);
+    }
+    boost::int64_t get_migration_time(bool reset)
+    {
+        return counter_data_.get_migration_time(reset);
+    }
+    boost::int64_t get_stalled_parcels_count(bool reset)
+    {
+        return counter_data_.get_stalled_parcels_count(reset);
+    }
+
     response bind_gid(
         request const& req
       , error_code& ec = throws
@@ -363,9 +410,15 @@ struct HPX_EXPORT primary_namespace
         );
 
   private:
-    resolved_type resolve_gid_locked(
-        boost::unique_lock<mutex_type>& l
-      , naming::gid_type const& gid
+    resolved_type resolve_gid_impl(
+        naming::gid_type const& gid
+      , error_code& ec
+        );
+
+    // wait for any migration of the given object to be completed, then
+    // resolve it
+    resolved_type wait_and_resolve_gid(
+        naming::gid_type const& gid
       , error_code& ec
         );
 
@@ -390,8 +443,7 @@ struct HPX_EXPORT primary_namespace
     };
 
     void resolve_free_list(
-        boost::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+        std::list<naming::gid_type> const& free_list
       , std::list<free_entry>& free_entry_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -94,6 +94,7 @@ struct HPX_EXPORT symbol_namespace
         boost::int64_t get_unbind_count(bool);
         boost::int64_t get_iterate_names_count(bool);
         boost::int64_t get_on_event_count(bool);
+        boost::int64_t get_find_prefix_count(bool);
         boost::int64_t get_overall_count(bool);
 
         boost::int64_t get_bind_time(bool);
@@ -101,6 +102,7 @@ struct HPX_EXPORT symbol_namespace
         boost::int64_t get_unbind_time(bool);
         boost::int64_t get_iterate_names_time(bool);
         boost::int64_t get_on_event_time(bool);
+        boost::int64_t get_find_prefix_time(bool);
         boost::int64_t get_overall_time(bool);
 
         // increment counter values
@@ -109,6 +111,7 @@ struct HPX_EXPORT symbol_namespace
         void increment_unbind_count();
         void increment_iterate_names_count();
         void increment_on_event_count();
+        void increment_find_prefix_count();
 
     private:
         friend struct update_time_on_exit;
@@ -119,6 +122,7 @@ struct HPX_EXPORT symbol_namespace
         api_counter_data unbind_;             // symbol_ns_unbind
         api_counter_data iterate_names_;      // symbol_ns_iterate_names
         api_counter_data on_event_;           // symbol_ns_on_event
+        api_counter_data find_prefix_;        // symbol_ns_find_prefix
     };
     counter_data counter_data_;
 
@@ -214,6 +218,11 @@ struct HPX_EXPORT symbol_namespace
       , error_code& ec = throws
         );
 
+    response find_prefix(
+        request const& req
+      , error_code& ec = throws
+        );
+
     response statistics_counter(
         request const& req
       , error_code& ec = throws
@@ -232,6 +241,7 @@ struct HPX_EXPORT symbol_namespace
       , namespace_iterate_names      = symbol_ns_iterate_names
       , namespace_on_event           = symbol_ns_on_event
       , namespace_statistics_counter = symbol_ns_statistics_counter
+      , namespace_find_prefix        = symbol_ns_find_prefix
     }; // }}}
 
     HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, remote_service, service_action);
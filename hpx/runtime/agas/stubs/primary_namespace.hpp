@@ -12,6 +12,7 @@
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/packaged_action.hpp>
 #include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/runtime/agas/detail/primary_namespace_partitions.hpp>
 
 namespace hpx { namespace agas { namespace stubs
 {
@@ -84,7 +85,8 @@ struct HPX_EXPORT primary_namespace
 
     static naming::gid_type get_service_instance(naming::gid_type const& dest)
     {
-        boost::uint32_t service_locality_id = naming::get_locality_id_from_gid(dest);
+        boost::uint32_t service_locality_id =
+            detail::get_primary_namespace_locality_id(dest);
         if (service_locality_id == naming::invalid_locality_id)
         {
             HPX_THROW_EXCEPTION(bad_parameter,
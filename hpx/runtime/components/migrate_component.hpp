@@ -16,8 +16,14 @@
 #include <hpx/lcos/async.hpp>
 #include <hpx/traits/is_component.hpp>
 
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/util/bind.hpp>
+
 #include <boost/utility/enable_if.hpp>
 
+#include <map>
+#include <vector>
+
 namespace hpx { namespace components
 {
     /// Migrate the component with the given id to the specified target locality
@@ -53,6 +59,95 @@ namespace hpx { namespace components
             to_migrate, target_locality);
     }
 
+    namespace detail
+    {
+        typedef std::map<naming::gid_type, std::vector<std::size_t> >
+            migration_groups_type;
+
+        inline std::vector<naming::id_type> bulk_migrate_postproc(
+            future<std::vector<future<std::vector<naming::id_type> > > > f,
+            migration_groups_type const& groups, std::size_t count)
+        {
+            std::vector<naming::id_type> result(count);
+            std::vector<future<std::vector<naming::id_type> > > r = f.get();
+
+            std::size_t k = 0;
+            for (migration_groups_type::value_type const& g : groups)
+            {
+                std::vector<naming::id_type> ids = r[k++].get();
+                HPX_ASSERT(ids.size() == g.second.size());
+
+                for (std::size_t j = 0; j != ids.size(); ++j)
+                    result[g.second[j]] = ids[j];
+            }
+            return result;
+        }
+    }
+
+    /// Migrate the components with the given ids to the specified target
+    /// locality
+    ///
+    /// The function \a migrate<Component> will migrate all components
+    /// referenced by \a to_migrate to the locality specified with
+    /// \a target_locality. The global address resolution service is contacted
+    /// once for all components managed by the same locality, and all
+    /// components currently living on the same locality are transferred with
+    /// a single message.
+    ///
+    /// \param to_migrate      [in] The global ids of the components to
+    ///                        migrate.
+    /// \param target_locality [in] The locality where the components should
+    ///                        be migrated to.
+    ///
+    /// \tparam  The only template argument specifies the component type of the
+    ///          components to migrate.
+    ///
+    /// \returns A future representing the global ids of the migrated
+    ///          component instances (in the same order as \a to_migrate).
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<std::vector<naming::id_type> >
+#else
+    inline typename boost::enable_if<
+        traits::is_component<Component>,
+        future<std::vector<naming::id_type> >
+    >::type
+#endif
+    migrate(std::vector<naming::id_type> const& to_migrate,
+        naming::id_type const& target_locality)
+    {
+        typedef server::trigger_bulk_migrate_component_action<Component>
+            action_type;
+
+        // group the objects by the locality managing their addresses
+        detail::migration_groups_type groups;
+        for (std::size_t i = 0; i != to_migrate.size(); ++i)
+        {
+            groups[naming::get_locality_from_id(to_migrate[i]).get_gid()]
+                .push_back(i);
+        }
+
+        std::vector<future<std::vector<naming::id_type> > > results;
+        results.reserve(groups.size());
+
+        for (detail::migration_groups_type::value_type const& g : groups)
+        {
+            std::vector<naming::id_type> ids;
+            ids.reserve(g.second.size());
+            for (std::size_t i : g.second)
+                ids.push_back(to_migrate[i]);
+
+            results.push_back(async<action_type>(
+                naming::id_type(g.first, naming::id_type::unmanaged),
+                std::move(ids), target_locality));
+        }
+
+        return when_all(results).then(util::bind(
+            &detail::bulk_migrate_postproc, util::placeholders::_1,
+            std::move(groups), to_migrate.size()));
+    }
+
     /// Migrate the given component to the specified target locality
     ///
     /// The function \a migrate_to_storage will migrate the component
@@ -7,12 +7,20 @@
 #define HPX_RUNTIME_COMPONENTS_SERVER_MIGRATE_COMPONENT_JAN_30_2014_0737AM
 
 #include <hpx/config.hpp>
+#include <hpx/exception.hpp>
 #include <hpx/traits/is_component.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/components/stubs/runtime_support.hpp>
 #include <hpx/runtime/agas/interface.hpp>
+#include <hpx/lcos/when_all.hpp>
+
+#include <boost/exception_ptr.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace hpx { namespace components { namespace server
 {
@@ -47,6 +55,15 @@ namespace hpx { namespace components { namespace server
     //       migrated which will delete it once the shared pointer goes out of
     //       scope.
     //
+    // Several objects are migrated at once by the bulk versions of these
+    // steps (trigger_bulk_migrate_component_action and
+    // bulk_migrate_component_action): all objects currently located on the
+    // same locality are transferred to the target locality by a single
+    // action, and the migration is ended with one AGAS request for all
+    // objects. The migration is started for each object separately, so that
+    // it can be rolled back for exactly those objects for which it was
+    // started if starting it fails for any of them.
+    //
     namespace detail
     {
         // clean up (source) memory of migrated object
@@ -60,15 +77,10 @@ namespace hpx { namespace components { namespace server
             return f.get();
         }
 
-        // trigger the actual migration
+        // verify that the given object can be migrated
         template <typename Component>
-        future<naming::id_type> migrate_component_postproc(
-            boost::shared_ptr<Component> const& ptr,
-            naming::id_type const& to_migrate,
-            naming::id_type const& target_locality)
+        bool can_migrate_component(boost::shared_ptr<Component> const& ptr)
         {
-            using components::stubs::runtime_support;
-
             boost::uint32_t pin_count = ptr->pin_count();
 
             if (pin_count == ~0x0u)
@@ -77,7 +89,7 @@ namespace hpx { namespace components { namespace server
                     "hpx::components::server::migrate_component",
                     "attempting to migrate an instance of a component which was "
                     "already migrated");
-                return make_ready_future(naming::invalid_id);
+                return false;
             }
 
             if (pin_count > 1)
@@ -86,9 +98,24 @@ namespace hpx { namespace components { namespace server
                     "hpx::components::server::migrate_component",
                     "attempting to migrate an instance of a component which is "
                     "currently pinned");
-                return make_ready_future(naming::invalid_id);
+                return false;
             }
 
+            return true;
+        }
+
+        // trigger the actual migration
+        template <typename Component>
+        future<naming::id_type> migrate_component_postproc(
+            boost::shared_ptr<Component> const& ptr,
+            naming::id_type const& to_migrate,
+            naming::id_type const& target_locality)
+        {
+            using components::stubs::runtime_support;
+
+            if (!can_migrate_component(ptr))
+                return make_ready_future(naming::invalid_id);
+
             return runtime_support::migrate_component_async<Component>(
                         target_locality, ptr, to_migrate)
                 .then(util::bind(
@@ -196,6 +223,227 @@ namespace hpx { namespace components { namespace server
           , &trigger_migrate_component<Component>
           , trigger_migrate_component_action<Component> >
     {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This will be executed on the locality where the objects live which are
+    // to be migrated
+    template <typename Component>
+    future<std::vector<naming::id_type> > bulk_migrate_component(
+        std::vector<naming::id_type> const& to_migrate,
+        std::vector<naming::address> const& addrs,
+        naming::id_type const& target_locality)
+    {
+        HPX_ASSERT(to_migrate.size() == addrs.size());
+
+        // 'migration' to same locality as before is a no-op
+        if (target_locality == hpx::find_here())
+        {
+            return make_ready_future(to_migrate);
+        }
+
+        if (!Component::supports_migration())
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "hpx::components::server::bulk_migrate_component",
+                "attempting to migrate an instance of a component which "
+                "does not support migration");
+            return make_ready_future(std::vector<naming::id_type>());
+        }
+
+        // retrieve pointers to the objects (must be local)
+        std::vector<boost::shared_ptr<Component> > ptrs;
+        ptrs.reserve(to_migrate.size());
+
+        for (std::size_t i = 0; i != to_migrate.size(); ++i)
+        {
+            ptrs.push_back(hpx::detail::get_ptr_for_migration<Component>(
+                addrs[i], to_migrate[i]));
+
+            if (!detail::can_migrate_component(ptrs.back()))
+                return make_ready_future(std::vector<naming::id_type>());
+        }
+
+        // send the data of all objects over to the target locality at once
+        using components::stubs::runtime_support;
+        return runtime_support::bulk_migrate_component_async<Component>(
+                target_locality, ptrs, to_migrate)
+            .then(
+                [ptrs, to_migrate](
+                    future<std::vector<naming::id_type> > && f)
+                        -> std::vector<naming::id_type>
+                {
+                    for (boost::shared_ptr<Component> const& ptr : ptrs)
+                        ptr->mark_as_migrated();
+
+                    f.get();        // rethrow errors
+                    return to_migrate;
+                });
+    }
+
+    template <typename Component>
+    struct bulk_migrate_component_action
+      : ::hpx::actions::action<
+            future<std::vector<naming::id_type> > (*)(
+                std::vector<naming::id_type> const&,
+                std::vector<naming::address> const&, naming::id_type const&)
+          , &bulk_migrate_component<Component>
+          , bulk_migrate_component_action<Component> >
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This is executed on the locality responsible for managing the address
+    // resolution for all of the given objects.
+    template <typename Component>
+    future<std::vector<naming::id_type> > trigger_bulk_migrate_component(
+        std::vector<naming::id_type> const& to_migrate,
+        naming::id_type const& target_locality)
+    {
+        if (!Component::supports_migration())
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "hpx::components::server::trigger_bulk_migrate_component",
+                "attempting to migrate an instance of a component which "
+                "does not support migration");
+            return make_ready_future(std::vector<naming::id_type>());
+        }
+
+        for (naming::id_type const& id : to_migrate)
+        {
+            if (naming::get_locality_id_from_id(id) != get_locality_id())
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "hpx::components::server::trigger_bulk_migrate_component",
+                    "this function has to be executed on the locality "
+                    "responsible for managing the address of the given "
+                    "objects");
+                return make_ready_future(std::vector<naming::id_type>());
+            }
+        }
+
+        typedef std::pair<naming::id_type, naming::address> resolved_type;
+
+        // the migration is started separately for each of the objects, this
+        // way we know exactly which of them have to be released again
+        std::vector<future<resolved_type> > begun;
+        begun.reserve(to_migrate.size());
+        for (naming::id_type const& id : to_migrate)
+            begun.push_back(agas::begin_migration(id, target_locality));
+
+        return when_all(begun)
+            .then(
+                [to_migrate, target_locality](
+                    future<std::vector<future<resolved_type> > > && f)
+                        -> future<std::vector<naming::id_type> >
+                {
+                    std::vector<future<resolved_type> > rf = f.get();
+
+                    std::vector<naming::id_type> migrating;
+                    std::vector<resolved_type> r;
+                    migrating.reserve(rf.size());
+                    r.reserve(rf.size());
+
+                    boost::exception_ptr e;
+                    for (std::size_t i = 0; i != rf.size(); ++i)
+                    {
+                        if (rf[i].has_exception())
+                        {
+                            if (!e)
+                                e = rf[i].get_exception_ptr();
+                            continue;
+                        }
+
+                        resolved_type p = rf[i].get();
+                        if (!p.first)
+                        {
+                            // the object is not known to AGAS
+                            if (!e)
+                            {
+                                e = HPX_GET_EXCEPTION(bad_parameter,
+                                    "hpx::components::server::"
+                                        "trigger_bulk_migrate_component",
+                                    "attempting to migrate an unknown object");
+                            }
+                            continue;
+                        }
+
+                        migrating.push_back(to_migrate[i]);
+                        r.push_back(std::move(p));
+                    }
+
+                    // roll back the migration of all objects for which it
+                    // was successfully started
+                    if (e)
+                    {
+                        if (!migrating.empty())
+                            agas::end_migration(migrating).get();
+                        boost::rethrow_exception(e);
+                    }
+
+                    // group the objects by the locality they currently live on
+                    typedef std::pair<
+                            std::vector<naming::id_type>,
+                            std::vector<naming::address>
+                        > group_type;
+                    std::map<naming::gid_type, group_type> groups;
+
+                    std::map<naming::gid_type, naming::id_type> localities;
+                    for (std::size_t i = 0; i != r.size(); ++i)
+                    {
+                        naming::gid_type const& locality = r[i].first.get_gid();
+                        localities.insert(
+                            std::make_pair(locality, r[i].first));
+
+                        group_type& g = groups[locality];
+                        g.first.push_back(migrating[i]);
+                        g.second.push_back(r[i].second);
+                    }
+
+                    // perform actual object migration, one action per
+                    // source locality
+                    typedef server::bulk_migrate_component_action<Component>
+                        action_type;
+
+                    std::vector<future<std::vector<naming::id_type> > > results;
+                    results.reserve(groups.size());
+
+                    typedef std::map<naming::gid_type, group_type>::value_type
+                        value_type;
+                    for (value_type const& g : groups)
+                    {
+                        results.push_back(async<action_type>(
+                            localities[g.first], g.second.first,
+                            g.second.second, target_locality));
+                    }
+
+                    return when_all(results).then(
+                        [migrating](future<std::vector<future<
+                                std::vector<naming::id_type> > > > && f)
+                            -> std::vector<naming::id_type>
+                        {
+                            // the migration of all objects was started, it
+                            // has to be ended even if moving some failed
+                            agas::end_migration(migrating).get();
+
+                            // rethrow errors
+                            for (future<std::vector<naming::id_type> >& r :
+                                    f.get())
+                            {
+                                r.get();
+                            }
+
+                            return migrating;
+                        });
+                });
+    }
+
+    template <typename Component>
+    struct trigger_bulk_migrate_component_action
+      : ::hpx::actions::action<
+            future<std::vector<naming::id_type> > (*)(
+                std::vector<naming::id_type> const&, naming::id_type const&)
+          , &trigger_bulk_migrate_component<Component>
+          , trigger_bulk_migrate_component_action<Component> >
+    {};
 }}}
 
 #endif
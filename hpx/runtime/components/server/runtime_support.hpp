@@ -163,6 +163,11 @@ namespace hpx { namespace components { namespace server
         naming::gid_type migrate_component_to_here(
             boost::shared_ptr<Component> const& p, naming::id_type);
 
+        template <typename Component>
+        std::vector<naming::gid_type> bulk_migrate_component_to_here(
+            std::vector<boost::shared_ptr<Component> > const& p,
+            std::vector<naming::id_type>);
+
         /// \brief Action to create new memory block
         naming::gid_type create_memory_block(std::size_t count,
             hpx::actions::manage_object_action_base const& act);
@@ -777,6 +782,26 @@ namespace hpx { namespace components { namespace server
         to_migrate.make_unmanaged();
         return id;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Component>
+    std::vector<naming::gid_type>
+    runtime_support::bulk_migrate_component_to_here(
+        std::vector<boost::shared_ptr<Component> > const& p,
+        std::vector<naming::id_type> to_migrate)
+    {
+        HPX_ASSERT(p.size() == to_migrate.size());
+
+        std::vector<naming::gid_type> ids;
+        ids.reserve(p.size());
+
+        for (std::size_t i = 0; i != p.size(); ++i)
+        {
+            ids.push_back(migrate_component_to_here<Component>(
+                p[i], std::move(to_migrate[i])));
+        }
+        return ids;
+    }
 }}}
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -925,6 +950,15 @@ namespace hpx { namespace components { namespace server
           , &runtime_support::migrate_component_to_here<Component>
           , migrate_component_here_action<Component> >
     {};
+    template <typename Component>
+    struct bulk_migrate_component_here_action
+      : ::hpx::actions::action<
+            std::vector<naming::gid_type> (runtime_support::*)(
+                std::vector<boost::shared_ptr<Component> > const&,
+                std::vector<naming::id_type>)
+          , &runtime_support::bulk_migrate_component_to_here<Component>
+          , bulk_migrate_component_here_action<Component> >
+    {};
 }}}
 
 namespace hpx { namespace traits
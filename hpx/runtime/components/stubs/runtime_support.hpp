@@ -212,6 +212,29 @@ namespace hpx { namespace components { namespace stubs
                 target_locality, p, to_migrate).get();
         }
 
+        // migrate several components to the same locality at once
+        template <typename Component>
+        static lcos::future<std::vector<naming::id_type> >
+        bulk_migrate_component_async(naming::id_type const& target_locality,
+            std::vector<boost::shared_ptr<Component> > const& p,
+            std::vector<naming::id_type> const& to_migrate)
+        {
+            if (!naming::is_locality(target_locality))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "stubs::runtime_support::bulk_migrate_component_async",
+                    "The id passed as the first argument is not representing"
+                        " a locality");
+                return lcos::make_ready_future(
+                    std::vector<naming::id_type>());
+            }
+
+            typedef typename
+                server::bulk_migrate_component_here_action<Component>
+                action_type;
+            return hpx::async<action_type>(target_locality, p, to_migrate);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         static lcos::future<std::vector<naming::id_type> >
         bulk_create_components_async(
@@ -0,0 +1,130 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_ADAPTIVE_COMPRESSION_HPP
+#define HPX_PARCELSET_ADAPTIVE_COMPRESSION_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Compression of parcels which do not have an action specific binary
+    // filter attached can be enabled globally (see hpx.parcel.compression).
+    // Messages smaller than the configured threshold are always sent
+    // uncompressed. For larger messages the expected time needed for
+    // compressing and decompressing the data is compared with the expected
+    // time saved on the wire. The estimates for these are collected from the
+    // messages sent and received so far (compression ratio and throughput of
+    // the codec) and from the measured (or configured) link bandwidth. Even if
+    // compression does not pay off, every so often a message is compressed
+    // anyways to keep the estimates current.
+    class HPX_EXPORT adaptive_compression : boost::noncopyable
+    {
+    public:
+        enum statistics_type
+        {
+            num_compressed = 0,         // number of compressed messages
+            num_skipped = 1,            // messages above the threshold sent
+                                        // uncompressed
+            compression_ratio = 2,      // compressed size of the data relative
+                                        // to its original size (in percent)
+            compression_time = 3,       // time spent compressing [ns]
+            decompression_time = 4      // time spent decompressing [ns]
+        };
+
+        // Return the (process-wide) instance
+        static adaptive_compression& instance();
+
+        // Configure the name of the binary filter plugin used for compressing
+        // the data (compression is disabled if this is empty), the minimal
+        // size of messages to compress, whether the cost model is applied to
+        // these, and the link bandwidth in bytes per second (measured if 0).
+        void configure(std::string const& codec, std::size_t threshold,
+            bool adaptive, boost::uint64_t bandwidth);
+
+        // Return a new binary filter to be used for serializing a message of
+        // the given (estimated) size or zero if the message should not be
+        // compressed. The caller is responsible for deleting the filter.
+        serialization::binary_filter* create_filter(std::size_t size);
+
+        // Update the estimates the decision whether to compress is based on
+        void add_compression(std::size_t size, std::size_t compressed_size,
+            boost::int64_t time);
+        void add_decompression(std::size_t size, boost::int64_t time);
+        void add_transmission(std::size_t size, boost::int64_t time);
+
+        boost::int64_t get_statistics(statistics_type type, bool reset);
+
+    private:
+        adaptive_compression();
+
+        struct impl;
+        impl* impl_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The binary filter used for globally enabled compression. It delegates
+    // to the configured codec plugin but falls back to sending the data
+    // uncompressed if compressing does not reduce its size. The name of the
+    // codec is sent along with the filter, the first byte of the (filtered)
+    // data tells whether it was compressed.
+    struct HPX_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        explicit adaptive_serialization_filter(
+                std::string const& codec = std::string())
+          : codec_(codec), current_(0), flushed_(false)
+        {}
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(char const* buffer,
+            std::size_t size, std::size_t buffer_size);
+
+        bool reset();
+
+    private:
+        void compress();
+
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int)
+        {
+            ar & codec_;
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter);
+
+        std::string codec_;
+        std::unique_ptr<serialization::binary_filter> codec_filter_;
+
+        std::vector<char> buffer_;      // uncompressed data
+        std::vector<char> filtered_;    // data as sent over the wire
+        std::size_t current_;
+        bool flushed_;
+    };
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
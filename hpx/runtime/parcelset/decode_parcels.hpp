@@ -10,8 +10,10 @@
 #include <hpx/config.hpp>
 
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/segmented_stream.hpp>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 
 #include <vector>
 
@@ -79,15 +81,69 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        // De-serialize the parcels from the given archive and hand them to
+        // the parcelport. A parcel_count of zero means that the number of
+        // parcels is stored in the archive.
+        template <typename Parcelport>
+        void decode_archive(Parcelport & pp,
+            serialization::input_archive & archive, std::size_t parcel_count,
+            util::high_resolution_timer const& timer,
+            performance_counters::parcels::data_point & data,
+            std::size_t num_thread)
+        {
+            boost::int64_t overall_add_parcel_time = 0;
+
+            if(parcel_count == 0)
+                archive >> parcel_count; //-V128
+            for(std::size_t i = 0; i != parcel_count; ++i)
+            {
+                // de-serialize parcel and add it to incoming parcel queue
+                parcel p;
+                archive >> p;
+                // make sure this parcel ended up on the right locality
+#ifdef HPX_DEBUG
+                if(hpx::get_runtime_ptr() && hpx::get_locality())
+                    HPX_ASSERT(p.destination_locality() == hpx::get_locality());
+#endif
+
+                // be sure not to measure add_parcel as serialization time
+                boost::int64_t add_parcel_time = timer.elapsed_nanoseconds();
+                pp.add_received_parcel(std::move(p), num_thread);
+                overall_add_parcel_time += timer.elapsed_nanoseconds() -
+                    add_parcel_time;
+            }
+
+            // complete received data with parcel count
+            data.num_parcels_ = parcel_count;
+            data.raw_bytes_ = archive.bytes_read();
+
+            // store the time required for serialization
+            data.serialization_time_ = timer.elapsed_nanoseconds() -
+                overall_add_parcel_time;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message(
         Parcelport & pp
-      , Buffer buffer
+      , Buffer buffer_
       , std::size_t parcel_count
       , std::size_t num_thread = -1
     )
     {
+        // If the message carries zero-copy chunks, the received buffer is
+        // kept alive for as long as any de-serialized object (for instance a
+        // serialize_buffer) refers to the memory of one of its chunks. This
+        // avoids copying the chunk data a second time.
+        boost::shared_ptr<Buffer> chunks_owner;
+        if (buffer_.num_chunks_.first != 0)
+            chunks_owner = boost::make_shared<Buffer>(std::move(buffer_));
+
+        Buffer& buffer = chunks_owner ? *chunks_owner : buffer_;
+
         std::vector<serialization::serialization_chunk> chunks(
             decode_chunks(buffer));
         boost::uint64_t inbound_data_size = buffer.data_size_;
@@ -97,44 +153,18 @@ namespace hpx { namespace parcelset
             try {
                 // mark start of serialization
                 util::high_resolution_timer timer;
-                boost::int64_t overall_add_parcel_time = 0;
                 performance_counters::parcels::data_point& data =
                     buffer.data_point_;
 
                 {
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
-
-                    if(parcel_count == 0)
-                        archive >> parcel_count; //-V128
-                    for(std::size_t i = 0; i != parcel_count; ++i)
-                    {
-                        // de-serialize parcel and add it to incoming parcel queue
-                        parcel p;
-                        archive >> p;
-                        // make sure this parcel ended up on the right locality
-#ifdef HPX_DEBUG
-                        if(hpx::get_runtime_ptr() && hpx::get_locality())
-                            HPX_ASSERT(p.destination_locality() == hpx::get_locality());
-#endif
-
-                        // be sure not to measure add_parcel as serialization time
-                        boost::int64_t add_parcel_time = timer.elapsed_nanoseconds();
-                        pp.add_received_parcel(std::move(p), num_thread);
-                        overall_add_parcel_time += timer.elapsed_nanoseconds() -
-                            add_parcel_time;
-                    }
+                        inbound_data_size, &chunks, chunks_owner);
 
-                    // complete received data with parcel count
-                    data.num_parcels_ = parcel_count;
-                    data.raw_bytes_ = archive.bytes_read();
+                    detail::decode_archive(pp, archive, parcel_count, timer,
+                        data, num_thread);
                 }
 
-                // store the time required for serialization
-                data.serialization_time_ = timer.elapsed_nanoseconds() -
-                    overall_add_parcel_time;
-
                 pp.add_received_data(data);
             }
             catch (hpx::exception const& e) {
@@ -169,6 +199,25 @@ namespace hpx { namespace parcelset
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Decode a streamed message, the segments of the message are pulled from
+    // the given stream while the parcels are de-serialized. Any errors are
+    // reported by throwing an exception as the connection the segments are
+    // read from is unusable afterwards.
+    template <typename Parcelport>
+    void decode_message_stream(
+        Parcelport & pp
+      , serialization::input_stream & stream
+      , performance_counters::parcels::data_point & data
+      , std::size_t num_thread = -1
+    )
+    {
+        util::high_resolution_timer timer;
+
+        serialization::input_archive archive(stream);
+        detail::decode_archive(pp, archive, 0, timer, data, num_thread);
+    }
+
     template <typename Parcelport, typename Buffer>
     void decode_parcel(Parcelport & parcelport, Buffer buffer, std::size_t num_thread)
     {
@@ -10,8 +10,10 @@
 #ifndef HPX_PARCELSET_ENCODE_PARCEL_HPP
 #define HPX_PARCELSET_ENCODE_PARCEL_HPP
 
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/segmented_stream.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/integer/endian.hpp>
 #include <hpx/traits/is_chunk_allocator.hpp>
@@ -165,6 +167,16 @@ namespace hpx
                             archive_flags, dest_locality_id, &buffer.chunks_);
                     }
 
+                    // compress the message if compression was enabled
+                    // globally and the action does not use a filter itself
+                    if (filter.get() == 0)
+                    {
+                        filter.reset(adaptive_compression::instance()
+                            .create_filter(arg_size));
+                        if (filter.get() != 0)
+                            archive_flags |= serialization::enable_compression;
+                    }
+
                     buffer.data_.reserve((std::max)(chunk_default, arg_size));
 
                     // mark start of serialization
@@ -244,6 +256,59 @@ namespace hpx
 
             return parcels_sent;
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialize the given parcels into a segmented stream instead of a
+        // buffer. This is used by parcelports which hand the segments to the
+        // network while the remaining data is still being serialized. Errors
+        // are reported by throwing an exception, as the receiving end has
+        // to be notified by closing the connection.
+        template <typename NewGids>
+        void encode_parcels_stream(parcel const * ps, std::size_t num_parcels,
+            serialization::output_stream & stream, int archive_flags_,
+            performance_counters::parcels::data_point & data, NewGids new_gids)
+        {
+            // each segment is filtered separately
+            std::unique_ptr<serialization::binary_filter> filter(
+                ps[0].get_serialization_filter());
+            if (filter.get() == 0)
+            {
+                filter.reset(adaptive_compression::instance()
+                    .create_filter(stream.segment_size_));
+            }
+
+            int archive_flags = archive_flags_;
+            if (filter.get() != 0)
+                archive_flags |= serialization::enable_compression;
+
+            // mark start of serialization
+            util::high_resolution_timer timer;
+
+            {
+                serialization::output_archive archive(
+                    stream
+                  , archive_flags
+                  , ps[0].destination_locality_id()
+                  , 0
+                  , filter.get()
+                  , new_gids);
+
+                archive << num_parcels; //-V128
+                for(std::size_t i = 0; i != num_parcels; ++i)
+                {
+                    LPT_(debug) << ps[i];
+                    archive << ps[i];
+                }
+                archive.flush();
+
+                data.bytes_ = archive.bytes_written();
+            }
+
+            // store the time required for serialization, this includes the
+            // time needed to hand the segments to the network
+            data.serialization_time_ = timer.elapsed_nanoseconds();
+            data.num_parcels_ = num_parcels;
+        }
     }
 }
 
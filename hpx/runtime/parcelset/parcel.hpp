@@ -189,7 +189,7 @@ namespace hpx { namespace parcelset
             bool has_source_id_;
         };
 
-        parcel() {}
+        parcel() : high_priority_(false) {}
 
         template <
             typename Action
@@ -210,7 +210,8 @@ namespace hpx { namespace parcelset
           : dests_(dests),
             addrs_(addrs),
 #endif
-            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...))
+            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...)),
+            high_priority_(false)
         {
             HPX_ASSERT(is_valid());
         }
@@ -230,7 +231,8 @@ namespace hpx { namespace parcelset
         )
           : dests_(dests),
             addrs_(addrs),
-            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...))
+            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...)),
+            high_priority_(false)
         {
             HPX_ASSERT(is_valid());
         }
@@ -268,7 +270,8 @@ namespace hpx { namespace parcelset
                 new typename util::decay<Continuation>
                     ::type(std::forward<Continuation>(cont))
             ),
-            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...))
+            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...)),
+            high_priority_(false)
         {
             HPX_ASSERT(is_valid());
         }
@@ -296,7 +299,8 @@ namespace hpx { namespace parcelset
             addrs_(addrs),
 #endif
             cont_(std::move(cont)),
-            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...))
+            action_(new actions::transfer_action<Action>(std::forward<Args>(args)...)),
+            high_priority_(false)
         {
             HPX_ASSERT(is_valid());
         }
@@ -307,7 +311,8 @@ namespace hpx { namespace parcelset
             dests_(std::move(other.dests_)),
             addrs_(std::move(other.addrs_)),
             cont_(std::move(other.cont_)),
-            action_(std::move(other.action_))
+            action_(std::move(other.action_)),
+            high_priority_(other.high_priority_)
         {
             HPX_ASSERT(is_valid());
         }
@@ -320,6 +325,7 @@ namespace hpx { namespace parcelset
             addrs_ = std::move(other.addrs_);
             cont_ = std::move(other.cont_);
             action_ = std::move(other.action_);
+            high_priority_ = other.high_priority_;
 
             other.reset();
 
@@ -340,6 +346,7 @@ namespace hpx { namespace parcelset
 #endif
             cont_.reset();
             action_.reset();
+            high_priority_ = false;
         }
 
         actions::base_action *get_action() const
@@ -434,6 +441,28 @@ namespace hpx { namespace parcelset
             return action_->get_thread_priority();
         }
 
+        // High priority parcels are sent through a separate lane of the
+        // parcelport, overtaking other parcels pending for the same
+        // destination. This is the case for parcels explicitly marked as
+        // such and for all actions scheduled with critical (or boosted)
+        // priority on the receiving end. The flag is not sent over the wire.
+        void set_high_priority(bool high_priority = true)
+        {
+            high_priority_ = high_priority;
+        }
+
+        bool is_high_priority() const
+        {
+            if (high_priority_)
+                return true;
+            if (!action_)
+                return false;
+
+            threads::thread_priority priority = action_->get_thread_priority();
+            return priority == threads::thread_priority_critical ||
+                priority == threads::thread_priority_boost;
+        }
+
         naming::gid_type const parcel_id() const
         {
             return data_.parcel_id_;
@@ -485,6 +514,7 @@ namespace hpx { namespace parcelset
 #endif
         std::unique_ptr<actions::continuation> cont_;
         std::unique_ptr<actions::base_action> action_;
+        bool high_priority_;
     };
 
     HPX_EXPORT std::string dump_parcel(parcel const& p);
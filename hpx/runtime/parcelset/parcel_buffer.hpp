@@ -11,6 +11,7 @@
 #include <hpx/runtime/serialization/serialization_chunk.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/util/integer/endian.hpp>
+#include <hpx/util/size_class_pool.hpp>
 
 #include <boost/atomic.hpp>
 
@@ -18,6 +19,12 @@
 
 namespace hpx { namespace parcelset
 {
+    // Buffer type used by parcelports for their (de-)serialization buffers.
+    // The memory is drawn from the size-classed buffer pool, which avoids
+    // going to the system allocator for each sent or received message.
+    typedef std::vector<char, util::size_class_allocator<char> >
+        pooled_buffer_type;
+
     template <typename BufferType,
         typename ChunkType = serialization::serialization_chunk>
     struct parcel_buffer
@@ -298,7 +298,10 @@ namespace hpx { namespace parcelset
         boost::uint64_t get_pending_parcels_count(bool /*reset*/)
         {
             boost::lock_guard<lcos::local::spinlock> l(mtx_);
-            return pending_parcels_.size();
+            std::size_t count = 0;
+            for (std::size_t lane = 0; lane != num_priority_lanes; ++lane)
+                count += pending_parcels_[lane].size();
+            return count;
         }
 
 
@@ -343,6 +346,12 @@ namespace hpx { namespace parcelset
             return allow_zero_copy_optimizations_;
         }
 
+        /// Return whether integral values and gids should be compressed
+        bool allow_integer_compression() const
+        {
+            return allow_integer_compression_;
+        }
+
         bool enable_security() const
         {
             return enable_security_;
@@ -377,10 +386,26 @@ namespace hpx { namespace parcelset
 #endif
             map_second_type;
         typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
 
         typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
+
+        /// Parcels are queued separately for each priority lane, pending
+        /// high priority parcels are always sent first.
+        enum priority_lane
+        {
+            normal_priority_lane = 0,
+            high_priority_lane = 1,
+            num_priority_lanes = 2
+        };
+
+        static priority_lane get_priority_lane(parcel const& p)
+        {
+            return p.is_high_priority() ?
+                high_priority_lane : normal_priority_lane;
+        }
+
+        pending_parcels_map pending_parcels_[num_priority_lanes];
+        pending_parcels_destinations parcel_destinations_[num_priority_lanes];
 
         /// The local locality
         locality here_;
@@ -397,6 +422,9 @@ namespace hpx { namespace parcelset
         bool allow_array_optimizations_;
         bool allow_zero_copy_optimizations_;
 
+        /// serialization is allowed to use variable-length integers
+        bool allow_integer_compression_;
+
         /// enable security
         bool enable_security_;
 
@@ -91,6 +91,15 @@ namespace hpx { namespace parcelset
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        static bool priority_connections(util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<int>(
+                ini, key + ".priority_connections", "0") != 0;
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -101,7 +110,17 @@ namespace hpx { namespace parcelset
           , io_service_pool_(thread_pool_size(ini),
                 on_start_thread, on_stop_thread, pool_name(), pool_name_postfix())
           , connection_cache_(max_connections(ini), max_connections_per_loc(ini))
+          , priority_connection_cache_(
+                max_connections(ini), max_connections_per_loc(ini))
+          , priority_connections_(priority_connections(ini))
           , archive_flags_(0)
+          , streaming_threshold_(hpx::util::get_entry_as<std::size_t>(ini,
+                std::string("hpx.parcel.") + connection_handler_type() +
+                    ".streaming_threshold", "0"))
+          , streaming_segment_size_(hpx::util::get_entry_as<std::size_t>(ini,
+                std::string("hpx.parcel.") + connection_handler_type() +
+                    ".streaming_segment_size",
+                std::size_t(HPX_PARCEL_STREAMING_SEGMENT_SIZE)))
           , operations_in_flight_(0)
           , num_thread_(0)
           , max_background_thread_(hpx::util::safe_lexical_cast<std::size_t>(
@@ -132,11 +151,17 @@ namespace hpx { namespace parcelset
                 if (!this->allow_zero_copy_optimizations())
                     archive_flags_ |= serialization::disable_data_chunking;
             }
+
+            // the receiving end picks up the archive format from the flags
+            // stored in the archive itself, no further negotiation is needed
+            if (this->allow_integer_compression())
+                archive_flags_ |= serialization::enable_integer_compression;
         }
 
         ~parcelport_impl()
         {
             connection_cache_.clear();
+            priority_connection_cache_.clear();
         }
 
         bool can_bootstrap() const
@@ -175,9 +200,11 @@ namespace hpx { namespace parcelset
             io_service_pool_.stop();
             if (blocking) {
                 connection_cache_.shutdown();
+                priority_connection_cache_.shutdown();
                 connection_handler().do_stop();
                 io_service_pool_.join();
                 connection_cache_.clear();
+                priority_connection_cache_.clear();
                 io_service_pool_.clear();
             }
 
@@ -233,13 +260,15 @@ namespace hpx { namespace parcelset
                 hpx::serialization::detail::future_await_container
             > const & future_await)
         {
+            priority_lane lane = get_priority_lane(p);
+
             // enqueue the outgoing parcel ...
-            enqueue_parcel(
-                dest, std::move(p), std::move(f), std::move(future_await->new_gids_));
+            enqueue_parcel(lane, dest, std::move(p), std::move(f),
+                std::move(future_await->new_gids_));
 
             if (trigger)
             {
-                get_connection_and_send_parcels(dest);
+                get_connection_and_send_parcels(dest, lane);
             }
         }
 
@@ -274,7 +303,8 @@ namespace hpx { namespace parcelset
                     false);
             }
 
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(locality_id, high_priority_lane);
+            get_connection_and_send_parcels(locality_id, normal_priority_lane);
         }
 
         void send_early_parcel(locality const & dest, parcel p)
@@ -326,6 +356,7 @@ namespace hpx { namespace parcelset
             }
 
             connection_cache_.clear(loc);
+            priority_connection_cache_.clear(loc);
         }
 
         void remove_from_connection_cache(locality const& loc)
@@ -360,19 +391,24 @@ namespace hpx { namespace parcelset
         {
             switch (t) {
                 case connection_cache_insertions:
-                    return connection_cache_.get_cache_insertions(reset);
+                    return connection_cache_.get_cache_insertions(reset) +
+                        priority_connection_cache_.get_cache_insertions(reset);
 
                 case connection_cache_evictions:
-                    return connection_cache_.get_cache_evictions(reset);
+                    return connection_cache_.get_cache_evictions(reset) +
+                        priority_connection_cache_.get_cache_evictions(reset);
 
                 case connection_cache_hits:
-                    return connection_cache_.get_cache_hits(reset);
+                    return connection_cache_.get_cache_hits(reset) +
+                        priority_connection_cache_.get_cache_hits(reset);
 
                 case connection_cache_misses:
-                    return connection_cache_.get_cache_misses(reset);
+                    return connection_cache_.get_cache_misses(reset) +
+                        priority_connection_cache_.get_cache_misses(reset);
 
                 case connection_cache_reclaims:
-                    return connection_cache_.get_cache_reclaims(reset);
+                    return connection_cache_.get_cache_reclaims(reset) +
+                        priority_connection_cache_.get_cache_reclaims(reset);
 
                 default:
                     break;
@@ -471,15 +507,90 @@ namespace hpx { namespace parcelset
             return false;
         }
 
+        // Stream the given parcels to their destination if their overall
+        // size exceeds the configured threshold. The data is sent while the
+        // parcels are serialized, avoiding to create the whole message in
+        // memory first. Returns false if the parcels should be sent normally.
+        template <typename ConnectionHandler_>
+        typename boost::enable_if<
+            typename connection_handler_traits<
+                ConnectionHandler_
+            >::send_streamed,
+            bool
+        >::type
+        send_streamed_impl(boost::shared_ptr<connection> const& sender_connection,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers,
+            new_gids_map& new_gids, priority_lane lane)
+        {
+            // the streamed write suspends the calling HPX thread
+            if (streaming_threshold_ == 0 || threads::get_self_ptr() == 0)
+                return false;
+
+            boost::uint32_t dest_locality_id =
+                parcels[0].destination_locality_id();
+
+            std::size_t size = 0;
+            for (parcel const& p : parcels)
+            {
+                size += detail::get_archive_size(p, archive_flags_,
+                    dest_locality_id, 0);
+                if (size >= streaming_threshold_)
+                    break;
+            }
+            if (size < streaming_threshold_)
+                return false;
+
+            ++operations_in_flight_;
+
+            // this suspends until all data was handed to the network
+            boost::system::error_code ec = sender_connection->write_streamed(
+                &parcels[0], parcels.size(), archive_flags_,
+                streaming_segment_size_, &new_gids);
+
+            using hpx::parcelset::detail::call_for_each;
+            using namespace hpx::util::placeholders;
+            sender_connection->complete_streamed_write(ec,
+                call_for_each(std::move(handlers), std::move(parcels)),
+                util::bind(&parcelport_impl::send_pending_parcels_trampoline,
+                    this, _1, _2, _3, lane));
+
+            return true;
+        }
+
+        template <typename ConnectionHandler_>
+        typename boost::disable_if<
+            typename connection_handler_traits<
+                ConnectionHandler_
+            >::send_streamed,
+            bool
+        >::type
+        send_streamed_impl(boost::shared_ptr<connection> const&,
+            std::vector<parcel>&, std::vector<write_handler_type>&,
+            new_gids_map&, priority_lane)
+        {
+            return false;
+        }
+
         ///////////////////////////////////////////////////////////////////////
+        // High priority parcels use their own connections if configured,
+        // otherwise all lanes share the same connections.
+        util::connection_cache<connection, locality>&
+        get_connection_cache(priority_lane lane)
+        {
+            if (lane == high_priority_lane && priority_connections_)
+                return priority_connection_cache_;
+            return connection_cache_;
+        }
+
         boost::shared_ptr<connection> get_connection(
-            locality const& l, bool force, error_code& ec)
+            locality const& l, priority_lane lane, bool force, error_code& ec)
         {
             // Request new connection from connection cache.
             boost::shared_ptr<connection> sender_connection;
 
             // Get a connection or reserve space for a new connection.
-            if (!connection_cache_.get_or_reserve(l, sender_connection))
+            if (!get_connection_cache(lane).get_or_reserve(l, sender_connection))
             {
                 // If no slot is available it's not a problem as the parcel
                 // will be sent out whenever the next connection is returned
@@ -517,7 +628,7 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(locality const& locality_id,
+        void enqueue_parcel(priority_lane lane, locality const& locality_id,
             parcel&& p, write_handler_type&& f, new_gids_map && new_gids)
         {
             typedef pending_parcels_map::mapped_type mapped_type;
@@ -530,7 +641,7 @@ namespace hpx { namespace parcelset
                 boost::unique_lock<lcos::local::spinlock>
             > il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels_[lane][locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
                 util::get<0>(e) = boost::make_shared<std::vector<parcel> >();
@@ -542,10 +653,10 @@ namespace hpx { namespace parcelset
 
             merge_gids(util::get<2>(e), std::move(new_gids));
 
-            parcel_destinations_.insert(locality_id);
+            parcel_destinations_[lane].insert(locality_id);
         }
 
-        void enqueue_parcels(locality const& locality_id,
+        void enqueue_parcels(priority_lane lane, locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers, new_gids_map && new_gids)
         {
@@ -561,7 +672,7 @@ namespace hpx { namespace parcelset
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels_[lane][locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
             {
@@ -622,10 +733,10 @@ namespace hpx { namespace parcelset
 
             merge_gids(util::get<2>(e), std::move(new_gids));
 
-            parcel_destinations_.insert(locality_id);
+            parcel_destinations_[lane].insert(locality_id);
         }
 
-        bool dequeue_parcels(locality const& locality_id,
+        bool dequeue_parcels(priority_lane lane, locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers,
             new_gids_map & new_gids)
@@ -635,14 +746,16 @@ namespace hpx { namespace parcelset
             {
                 boost::lock_guard<lcos::local::spinlock> l(mtx_);
 
-                iterator it = pending_parcels_.find(locality_id);
+                pending_parcels_map& pending_parcels = pending_parcels_[lane];
+                iterator it = pending_parcels.find(locality_id);
 
                 // do nothing if parcels have already been picked up by
                 // another thread
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it != pending_parcels_.end() && !util::get<0>(it->second)->empty())
+                if (it != pending_parcels.end() &&
+                    util::get<0>(it->second) && !util::get<0>(it->second)->empty())
 #else
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
+                if (it != pending_parcels.end() && !util::get<0>(it->second).empty())
 #endif
                 {
                     HPX_ASSERT(it->first == locality_id);
@@ -660,11 +773,12 @@ namespace hpx { namespace parcelset
                 }
                 else
                 {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
+                    HPX_ASSERT(it == pending_parcels.end() ||
+                        util::get<1>(it->second).empty());
                     return false;
                 }
 
-                parcel_destinations_.erase(locality_id);
+                parcel_destinations_[lane].erase(locality_id);
 
                 return true;
             }
@@ -674,36 +788,38 @@ namespace hpx { namespace parcelset
         {
             if(hpx::is_stopped()) return true;
 
-            std::vector<locality> destinations;
+            std::vector<locality> destinations[num_priority_lanes];
 
             {
                 boost::unique_lock<lcos::local::spinlock> l(mtx_, boost::try_to_lock);
                 if(l.owns_lock())
                 {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
+                    for (std::size_t lane = 0; lane != num_priority_lanes; ++lane)
                     {
-                        destinations.push_back(loc);
+                        destinations[lane].assign(
+                            parcel_destinations_[lane].begin(),
+                            parcel_destinations_[lane].end());
                     }
                 }
             }
 
             // Create new HPX threads which send the parcels that are still
-            // pending.
-            for (locality const& loc : destinations)
+            // pending, high priority parcels first.
+            for (locality const& loc : destinations[high_priority_lane])
+            {
+                get_connection_and_send_parcels(loc, high_priority_lane);
+            }
+            for (locality const& loc : destinations[normal_priority_lane])
             {
-                get_connection_and_send_parcels(loc);
+                get_connection_and_send_parcels(loc, normal_priority_lane);
             }
 
             return true;
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void get_connection_and_send_parcels(
-            locality const& locality_id, bool background = false)
+        void get_connection_and_send_parcels(locality const& locality_id,
+            priority_lane lane, bool background = false)
         {
             // repeat until no more parcels are to be sent
 //             while (!hpx::is_stopped())
@@ -712,7 +828,8 @@ namespace hpx { namespace parcelset
                 std::vector<write_handler_type> handlers;
                 new_gids_map new_gids;
 
-                if(!dequeue_parcels(locality_id, parcels, handlers, new_gids))
+                if(!dequeue_parcels(lane, locality_id, parcels, handlers,
+                        new_gids))
                 {
                     return;
                 }
@@ -723,12 +840,12 @@ namespace hpx { namespace parcelset
 
                 error_code ec;
                 boost::shared_ptr<connection> sender_connection =
-                    get_connection(locality_id, force_connection, ec);
+                    get_connection(locality_id, lane, force_connection, ec);
 
                 if (!sender_connection)
                 {
                     // give the parcels back to the queues for later
-                    enqueue_parcels(locality_id, std::move(parcels),
+                    enqueue_parcels(lane, locality_id, std::move(parcels),
                         std::move(handlers), std::move(new_gids));
 
                     // We can safely return if no connection is available
@@ -752,9 +869,13 @@ namespace hpx { namespace parcelset
                           , std::move(parcels)
                           , std::move(handlers)
                           , std::move(new_gids)
+                          , lane
                         )
                       , "parcelport_impl::send_pending_parcels"
-                      , threads::pending, true, threads::thread_priority_boost,
+                      , threads::pending, true,
+                        lane == high_priority_lane ?
+                            threads::thread_priority_critical :
+                            threads::thread_priority_boost,
                         get_next_num_thread(), threads::thread_stacksize_default
                     );
                 }
@@ -763,7 +884,7 @@ namespace hpx { namespace parcelset
                     send_pending_parcels(
                         locality_id,
                         sender_connection, std::move(parcels),
-                        std::move(handlers), std::move(new_gids));
+                        std::move(handlers), std::move(new_gids), lane);
                 }
 
                 // We yield here for a short amount of time to give another
@@ -774,43 +895,61 @@ namespace hpx { namespace parcelset
             }
         }
 
+        bool has_pending_parcels(locality const& locality_id,
+            priority_lane lane)
+        {
+            boost::lock_guard<lcos::local::spinlock> l(mtx_);
+
+            pending_parcels_map::iterator it =
+                pending_parcels_[lane].find(locality_id);
+#if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
+            return it != pending_parcels_[lane].end() &&
+                util::get<0>(it->second) && !util::get<0>(it->second)->empty();
+#else
+            return it != pending_parcels_[lane].end() &&
+                !util::get<0>(it->second).empty();
+#endif
+        }
+
         void send_pending_parcels_trampoline(
             boost::system::error_code const& ec,
             locality const& locality_id,
-            boost::shared_ptr<connection> sender_connection)
+            boost::shared_ptr<connection> sender_connection,
+            priority_lane lane)
         {
             --operations_in_flight_;
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             client_connection->set_state(parcelport_connection::state_scheduled_thread);
 #endif
+            util::connection_cache<connection, locality>& cache =
+                get_connection_cache(lane);
             if (!ec)
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                cache.reclaim(locality_id, sender_connection);
             }
             else
             {
                 // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
+                cache.clear(locality_id, sender_connection);
             }
-            {
-                boost::lock_guard<lcos::local::spinlock> l(mtx_);
 
-                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-#if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it == pending_parcels_.end() ||
-                    (util::get<0>(it->second) && util::get<0>(it->second)->empty()))
-#else
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
-#endif
-                    return;
-            }
+            HPX_ASSERT(locality_id == sender_connection->destination());
 
-            // Create a new HPX thread which sends parcels that are still
-            // pending.
-            get_connection_and_send_parcels(locality_id);
+            // Create new HPX threads which send parcels that are still
+            // pending for the lanes using this cache, high priority parcels
+            // first.
+            priority_lane const lanes[] =
+                { high_priority_lane, normal_priority_lane };
+            for (priority_lane l : lanes)
+            {
+                if (&get_connection_cache(l) == &cache &&
+                    has_pending_parcels(locality_id, l))
+                {
+                    get_connection_and_send_parcels(locality_id, l);
+                }
+            }
         }
 
         void send_pending_parcels(
@@ -818,7 +957,7 @@ namespace hpx { namespace parcelset
             boost::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers,
-            new_gids_map new_gids)
+            new_gids_map new_gids, priority_lane lane)
         {
             // If we are stopped already, discard the remaining pending parcels
             if (hpx::is_stopped()) return;
@@ -832,6 +971,13 @@ namespace hpx { namespace parcelset
             HPX_ASSERT(parcel_locality_id == sender_connection->destination());
             sender_connection->verify(parcel_locality_id);
 #endif
+            // very large messages are sent while being serialized
+            if (send_streamed_impl<ConnectionHandler>(
+                    sender_connection, parcels, handlers, new_gids, lane))
+            {
+                return;
+            }
+
             // encode the parcels
             std::size_t num_parcels = encode_parcels(&parcels[0],
                     parcels.size(), sender_connection->buffer_,
@@ -848,7 +994,7 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, lane));
             }
             else
             {
@@ -872,13 +1018,13 @@ namespace hpx { namespace parcelset
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, lane));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
-                enqueue_parcels(parcel_locality_id, std::move(parcels),
+                enqueue_parcels(lane, parcel_locality_id, std::move(parcels),
                     std::move(handlers), std::move(new_gids));
             }
 
@@ -903,9 +1049,20 @@ namespace hpx { namespace parcelset
         /// The connection cache for sending connections
         util::connection_cache<connection, locality> connection_cache_;
 
+        /// The connections dedicated to high priority parcels (used only if
+        /// priority_connections_ is set)
+        util::connection_cache<connection, locality> priority_connection_cache_;
+        bool const priority_connections_;
+
         typedef hpx::lcos::local::spinlock mutex_type;
 
         int archive_flags_;
+
+        // messages larger than this are streamed (if supported, zero disables
+        // streaming), using segments of the given size
+        std::size_t const streaming_threshold_;
+        std::size_t const streaming_segment_size_;
+
         boost::atomic<std::size_t> operations_in_flight_;
 
         boost::atomic<std::size_t> num_thread_;
@@ -28,6 +28,11 @@ namespace hpx { namespace serialization
             std::size_t size, std::size_t buffer_size) = 0;
         virtual void load(void* dst, std::size_t dst_count) = 0;
 
+        // Prepare the filter for (de-)compressing another, independent block
+        // of data (as needed for streamed serialization). Returns false if
+        // this is not supported by the filter.
+        virtual bool reset() { return false; }
+
         template <class T> void serialize(T& ar, unsigned){}
         HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(binary_filter);
 
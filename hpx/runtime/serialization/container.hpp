@@ -26,6 +26,7 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void save_binary(void const* address, std::size_t count) = 0;
         virtual void save_binary_chunk(void const* address, std::size_t count) = 0;
+        virtual void flush() {}
     };
 
     struct erased_input_container
@@ -36,6 +37,8 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void * address, std::size_t count) = 0;
         virtual void load_binary_chunk(void * address, std::size_t count) = 0;
+        virtual void* adopt_binary_chunk(std::size_t count,
+            std::size_t alignment) = 0;
     };
 }}
 
@@ -0,0 +1,178 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_DETAIL_POINTER_TRACKER_HPP
+#define HPX_SERIALIZATION_DETAIL_POINTER_TRACKER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/size_class_pool.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace serialization { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The key marking an unused slot, tracked pointers are never null and
+    // archive positions are never equal to npos.
+    template <typename Key>
+    struct pointer_tracker_key
+    {
+        static Key empty() { return Key(-1); }
+
+        static boost::uint64_t hash(Key key)
+        {
+            return static_cast<boost::uint64_t>(key);
+        }
+    };
+
+    template <>
+    struct pointer_tracker_key<void const*>
+    {
+        static void const* empty() { return 0; }
+
+        static boost::uint64_t hash(void const* key)
+        {
+            // the lower bits of pointers are mostly zero
+            return static_cast<boost::uint64_t>(
+                reinterpret_cast<std::size_t>(key) >> 3);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps the addresses of the objects referred to by (shared) pointers to
+    // their position in the archive (and vice versa while loading). This is
+    // an open addressing hash table using linear probing, no memory is
+    // allocated for archives not containing any tracked pointers. The slots
+    // are allocated from the size_class_pool, which makes their memory
+    // available for reuse by the next archive created on the same thread.
+    template <typename Key, typename Value>
+    class pointer_tracker
+    {
+    private:
+        typedef pointer_tracker_key<Key> key_traits;
+
+        struct slot
+        {
+            slot() : key_(key_traits::empty()), value_() {}
+
+            slot(slot && rhs)
+              : key_(rhs.key_), value_(std::move(rhs.value_))
+            {}
+
+            slot& operator=(slot && rhs)
+            {
+                key_ = rhs.key_;
+                value_ = std::move(rhs.value_);
+                return *this;
+            }
+
+            Key key_;
+            Value value_;
+        };
+
+        typedef std::vector<slot, util::size_class_allocator<slot> >
+            slots_type;
+
+        static const std::size_t initial_capacity = 16;
+
+    public:
+        pointer_tracker()
+          : size_(0), shift_(64)
+        {}
+
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        // Return the value stored for the given key or zero if the key is
+        // not known.
+        Value* find(Key key)
+        {
+            HPX_ASSERT(key != key_traits::empty());
+            if (size_ == 0)
+                return 0;
+
+            std::size_t mask = slots_.size() - 1;
+            for (std::size_t i = get_index(key); /**/; i = (i + 1) & mask)
+            {
+                slot& s = slots_[i];
+                if (s.key_ == key)
+                    return &s.value_;
+                if (s.key_ == key_traits::empty())
+                    return 0;
+            }
+        }
+
+        // Insert the given key/value pair if the key is not known yet.
+        // Return the value stored for the key and whether it was inserted.
+        std::pair<Value*, bool> insert(Key key, Value && value)
+        {
+            HPX_ASSERT(key != key_traits::empty());
+            if ((size_ + 1) * 4 > slots_.size() * 3)
+                grow();
+
+            std::size_t mask = slots_.size() - 1;
+            for (std::size_t i = get_index(key); /**/; i = (i + 1) & mask)
+            {
+                slot& s = slots_[i];
+                if (s.key_ == key)
+                    return std::make_pair(&s.value_, false);
+
+                if (s.key_ == key_traits::empty())
+                {
+                    s.key_ = key;
+                    s.value_ = std::move(value);
+                    ++size_;
+                    return std::make_pair(&s.value_, true);
+                }
+            }
+        }
+
+    private:
+        // Fibonacci hashing, spreads consecutive keys over the whole table
+        std::size_t get_index(Key key) const
+        {
+            return static_cast<std::size_t>(
+                (key_traits::hash(key) * 0x9E3779B97F4A7C15ull) >> shift_);
+        }
+
+        void grow()
+        {
+            std::size_t capacity = slots_.empty() ?
+                std::size_t(initial_capacity) : slots_.size() * 2;
+
+            slots_type slots(capacity);
+            slots.swap(slots_);
+
+            shift_ = 64;
+            for (std::size_t c = capacity; c > 1; c >>= 1)
+                --shift_;
+
+            // re-insert all existing entries
+            std::size_t mask = capacity - 1;
+            for (slot& s : slots)
+            {
+                if (s.key_ == key_traits::empty())
+                    continue;
+
+                std::size_t i = get_index(s.key_);
+                while (slots_[i].key_ != key_traits::empty())
+                    i = (i + 1) & mask;
+
+                slots_[i] = std::move(s);
+            }
+        }
+
+        slots_type slots_;
+        std::size_t size_;
+        unsigned shift_;
+    };
+}}}
+
+#endif
@@ -0,0 +1,72 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_DETAIL_VARINT_HPP
+#define HPX_SERIALIZATION_DETAIL_VARINT_HPP
+
+#include <hpx/config.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace serialization { namespace detail
+{
+    // The maximal number of bytes a 64 bit integer needs if encoded as a
+    // LEB128 variable-length integer.
+    static const std::size_t max_varint_size = 10;
+
+    // Map signed integers onto unsigned integers such that numbers with a
+    // small absolute value have a small encoding (zigzag encoding):
+    //  0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+    BOOST_FORCEINLINE boost::uint64_t zigzag_encode(boost::int64_t val)
+    {
+        return (static_cast<boost::uint64_t>(val) << 1) ^
+            static_cast<boost::uint64_t>(val >> 63);
+    }
+
+    BOOST_FORCEINLINE boost::int64_t zigzag_decode(boost::uint64_t val)
+    {
+        return static_cast<boost::int64_t>(val >> 1) ^
+            -static_cast<boost::int64_t>(val & 1);
+    }
+
+    // Encode the given value as an (unsigned) LEB128 variable-length integer
+    // into the given buffer, which must be at least max_varint_size bytes
+    // large. Returns the number of bytes written.
+    BOOST_FORCEINLINE std::size_t varint_encode(boost::uint64_t val,
+        unsigned char* buffer)
+    {
+        std::size_t size = 0;
+        while (val >= 0x80)
+        {
+            buffer[size++] = static_cast<unsigned char>(val | 0x80);
+            val >>= 7;
+        }
+        buffer[size++] = static_cast<unsigned char>(val);
+        return size;
+    }
+
+    BOOST_FORCEINLINE std::size_t varint_encode(boost::int64_t val,
+        unsigned char* buffer)
+    {
+        return varint_encode(zigzag_encode(val), buffer);
+    }
+
+    // Return the number of bytes the given value occupies when encoded as a
+    // LEB128 variable-length integer.
+    BOOST_FORCEINLINE std::size_t varint_size(boost::uint64_t val)
+    {
+        std::size_t size = 1;
+        while (val >= 0x80)
+        {
+            val >>= 7;
+            ++size;
+        }
+        return size;
+    }
+}}}
+
+#endif
@@ -12,6 +12,9 @@
 #include <hpx/runtime/serialization/input_container.hpp>
 #include <hpx/runtime/serialization/detail/raw_ptr.hpp>
 #include <hpx/runtime/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/runtime/serialization/detail/pointer_tracker.hpp>
+#include <hpx/runtime/serialization/detail/varint.hpp>
+#include <hpx/util/unused.hpp>
 
 #include <boost/config.hpp>
 #include <boost/shared_ptr.hpp>
@@ -33,34 +36,44 @@ namespace hpx { namespace serialization
         typedef basic_archive<input_archive> base_type;
 
         typedef
-            std::map<boost::uint64_t, detail::ptr_helper_ptr>
+            detail::pointer_tracker<boost::uint64_t, detail::ptr_helper_ptr>
             pointer_tracker;
 
+        // The (optional) chunks_owner keeps the memory referenced by the
+        // zero-copy chunks alive. If it is given, de-serialized objects may
+        // take over the chunk memory instead of copying it, see
+        // adopt_binary_chunk.
         template <typename Container>
         input_archive(Container & buffer,
             std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = 0)
+            const std::vector<serialization_chunk>* chunks = 0,
+            boost::shared_ptr<void> const& chunks_owner =
+                boost::shared_ptr<void>())
           : base_type(0U)
           , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , chunks_owner_(chunks_owner)
+          , dest_locality_id_(~0U)
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
-
-            // FIXME: make bool once integer compression is implemented
             boost::uint64_t endianess = 0ul;
-            load(endianess);
+            load_integral_raw(endianess);
             if (endianess)
                 this->base_type::flags_ = hpx::serialization::endian_big;
 
             // load flags sent by the other end to make sure both ends have
             // the same assumptions about the archive format
             boost::uint32_t flags = 0;
-            load(flags);
+            load_integral_raw(flags);
             this->base_type::flags_ = flags;
 
             bool has_filter = false;
             load(has_filter);
 
+            // compressed gids are encoded relative to the destination
+            if (enable_integer_compression())
+                load(dest_locality_id_);
+
             serialization::binary_filter* filter = 0;
             if (has_filter && enable_compression())
             {
@@ -127,6 +140,50 @@ namespace hpx { namespace serialization
             return size_;
         }
 
+        // Try to take over the memory of the next zero-copy chunk holding
+        // exactly count bytes instead of copying it into a separately
+        // allocated buffer. On success the chunk is consumed, owner is set to
+        // the object keeping the returned memory alive, and the address of
+        // the data is returned. Otherwise nothing is consumed and 0 is
+        // returned, in which case the data has to be loaded as usual.
+        //
+        // Small chunks are not handed out, holding on to them would keep the
+        // whole receive buffer alive (see HPX_ZERO_COPY_ADOPTION_THRESHOLD).
+        void* adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            boost::shared_ptr<void>& owner)
+        {
+            if (!chunks_owner_ || count < HPX_ZERO_COPY_ADOPTION_THRESHOLD ||
+                disable_array_optimization() || disable_data_chunking())
+            {
+                return 0;
+            }
+
+            // the data has to be used as is, which requires the sender to
+            // have the same byte order
+#ifdef BOOST_BIG_ENDIAN
+            if (endian_little())
+                return 0;
+#else
+            if (endian_big())
+                return 0;
+#endif
+
+            void* address = buffer_->adopt_binary_chunk(count, alignment);
+            if (address)
+            {
+                owner = chunks_owner_;
+                size_ += count;
+            }
+            return address;
+        }
+
+        // Returns the locality this archive was created for, this is known
+        // only if integer compression is enabled for this archive.
+        boost::uint32_t get_dest_locality_id() const
+        {
+            return dest_locality_id_;
+        }
+
         // this function is needed to avoid a MSVC linker error
         std::size_t current_pos() const
         {
@@ -150,7 +207,9 @@ namespace hpx { namespace serialization
         {
             static_assert(!boost::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if(disable_array_optimization())
+
+            // integer compression requires to see the individual members
+            if(disable_array_optimization() || enable_integer_compression())
             {
                 serialize(*this, t, 0);
             }
@@ -191,16 +250,51 @@ namespace hpx { namespace serialization
 #if defined(BOOST_HAS_INT128)
         void load_integral(boost::int128_type& t, boost::mpl::false_)
         {
-            load_integral_impl(t);
+            load_integral_raw(t);
         }
 
         void load_integral(boost::uint128_type& t, boost::mpl::true_)
         {
-            load_integral_impl(t);
+            load_integral_raw(t);
         }
 #endif
+        void load_integral_impl(boost::uint64_t& l)
+        {
+            if (enable_integer_compression())
+                l = load_varint();
+            else
+                load_integral_raw(l);
+        }
+
+        void load_integral_impl(boost::int64_t& l)
+        {
+            if (enable_integer_compression())
+                l = detail::zigzag_decode(load_varint());
+            else
+                load_integral_raw(l);
+        }
+
+        boost::uint64_t load_varint()
+        {
+            boost::uint64_t val = 0;
+            for (std::size_t shift = 0; shift < 64; shift += 7)
+            {
+                unsigned char c = 0;
+                load_binary(&c, sizeof(c));
+
+                val |= static_cast<boost::uint64_t>(c & 0x7f) << shift;
+                if (!(c & 0x80))
+                    return val;
+            }
+
+            HPX_THROW_EXCEPTION(serialization_error
+              , "input_archive::load_varint"
+              , "archive data bstream contains malformed integer");
+            return val;
+        }
+
         template <class Promoted>
-        void load_integral_impl(Promoted& l)
+        void load_integral_raw(Promoted& l)
         {
             const std::size_t size = sizeof(Promoted);
             char* cptr = reinterpret_cast<char *>(&l); //-V206
@@ -240,26 +334,25 @@ namespace hpx { namespace serialization
         friend void register_pointer(input_archive& ar,
                 boost::uint64_t pos, detail::ptr_helper_ptr helper)
         {
-            pointer_tracker& tracker = ar.pointer_tracker_;
-            HPX_ASSERT(tracker.find(pos) == tracker.end());
-
-            tracker.insert(std::make_pair(pos, std::move(helper)));
+            bool inserted =
+                ar.pointer_tracker_.insert(pos, std::move(helper)).second;
+            HPX_ASSERT(inserted);
+            HPX_UNUSED(inserted);
         }
 
         template <typename Helper>
         friend Helper & tracked_pointer(input_archive& ar, boost::uint64_t pos)
         {
-            // gcc has some lookup problems when using
-            // nested type inside friend function
-            std::map<boost::uint64_t, detail::ptr_helper_ptr>::iterator
-                it = ar.pointer_tracker_.find(pos);
-            HPX_ASSERT(it != ar.pointer_tracker_.end());
+            detail::ptr_helper_ptr* helper = ar.pointer_tracker_.find(pos);
+            HPX_ASSERT(helper != 0);
 
-            return static_cast<Helper &>(*it->second);
+            return static_cast<Helper &>(**helper);
         }
 
         std::unique_ptr<erased_input_container> buffer_;
         pointer_tracker pointer_tracker_;
+        boost::shared_ptr<void> chunks_owner_;
+        boost::uint32_t dest_locality_id_;
     };
 }}
 
@@ -146,14 +146,41 @@ namespace hpx { namespace serialization
                     return;
                 }
 
-                // unfortunately we can't implement a zero copy policy on
-                // the receiving end
-                // as the memory was already allocated by the serialization code
+                // the memory was already allocated by the serialization code,
+                // see adopt_binary_chunk for a zero copy alternative
                 std::memcpy(address, get_chunk_data(current_chunk_).pos_, count);
                 ++current_chunk_;
             }
         }
 
+        // Return the address of the current zero-copy chunk (and skip it) if
+        // it holds exactly the requested number of bytes at an address with
+        // the requested alignment, otherwise return 0 without consuming any
+        // data.
+        void* adopt_binary_chunk(std::size_t count,
+            std::size_t alignment) // override
+        {
+            if (filter_.get() || chunks_ == 0 ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            {
+                return 0;
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            if (get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return 0;
+            }
+
+            void* pos = get_chunk_data(current_chunk_).pos_;
+            if (reinterpret_cast<std::size_t>(pos) % alignment != 0)
+                return 0;
+
+            ++current_chunk_;
+            return pos;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -12,6 +12,8 @@
 #include <hpx/runtime/serialization/output_container.hpp>
 #include <hpx/runtime/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/runtime/serialization/detail/raw_ptr.hpp>
+#include <hpx/runtime/serialization/detail/pointer_tracker.hpp>
+#include <hpx/runtime/serialization/detail/varint.hpp>
 
 #include <boost/mpl/or.hpp>
 #include <boost/type_traits/is_integral.hpp>
@@ -53,17 +55,25 @@ namespace hpx { namespace serialization
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
 
-            // FIXME: make bool once integer compression is implemented
+            // the archive header is always written uncompressed as the
+            // receiving end has to know the flags before it can decode
+            // any variable-length integers
             boost::uint64_t endianess = this->base_type::endian_big() ? ~0ul : 0ul;
-            save(endianess);
+            save_integral_raw(endianess);
 
             // send flags sent by the other end to make sure both ends have
             // the same assumptions about the archive format
-            save(flags);
+            save_integral_raw(flags);
 
             bool has_filter = filter != 0;
             save(has_filter);
 
+            // gids are encoded relative to the destination locality if
+            // integer compression is enabled, the receiving end needs to
+            // know which locality the archive was created for
+            if (enable_integer_compression())
+                save(dest_locality_id_);
+
             if (has_filter && enable_compression())
             {
                 *this << detail::raw_ptr(filter);
@@ -100,6 +110,12 @@ namespace hpx { namespace serialization
             return size_;
         }
 
+        // write out any data still buffered by the underlying container
+        void flush()
+        {
+            buffer_->flush();
+        }
+
         void add_gid(naming::gid_type const & gid,
             naming::gid_type const & splitted_gid);
 
@@ -183,7 +199,9 @@ namespace hpx { namespace serialization
         {
             static_assert(!boost::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if(disable_array_optimization())
+
+            // integer compression requires to see the individual members
+            if(disable_array_optimization() || enable_integer_compression())
             {
                 serialize(*this, t, 0);
             }
@@ -220,17 +238,33 @@ namespace hpx { namespace serialization
 #if defined(BOOST_HAS_INT128)
         void save_integral(boost::int128_type t, boost::mpl::false_)
         {
-            save_integral_impl(t);
+            save_integral_raw(t);
         }
 
         void save_integral(boost::uint128_type t, boost::mpl::true_)
         {
-            save_integral_impl(t);
+            save_integral_raw(t);
         }
 #endif
 
         template <class Promoted>
         void save_integral_impl(Promoted l)
+        {
+            if (enable_integer_compression())
+            {
+                // LEB128 encoding is independent of the byte order, signed
+                // values are zigzag encoded before being written
+                unsigned char buffer[detail::max_varint_size];
+                save_binary(buffer, detail::varint_encode(l, buffer));
+            }
+            else
+            {
+                save_integral_raw(l);
+            }
+        }
+
+        template <class Promoted>
+        void save_integral_raw(Promoted l)
         {
             const std::size_t size = sizeof(Promoted);
             char* cptr = reinterpret_cast<char *>(&l); //-V206
@@ -262,20 +296,17 @@ namespace hpx { namespace serialization
               buffer_->save_binary_chunk(address, count);
         }
 
-        typedef std::map<const void *, boost::uint64_t> pointer_tracker;
+        typedef detail::pointer_tracker<const void *, boost::uint64_t>
+            pointer_tracker;
 
         // FIXME: make this function capable for ADL lookup and hence if used
         // as a dependent name it doesn't require output_archive to be complete
         // type or itself to be forwarded
         friend boost::uint64_t track_pointer(output_archive& ar, const void* pos)
         {
-            pointer_tracker::iterator it = ar.pointer_tracker_.find(pos);
-            if(it == ar.pointer_tracker_.end())
-            {
-                ar.pointer_tracker_.insert(std::make_pair(pos, ar.size_));
-                return npos;
-            }
-            return it->second;
+            std::pair<boost::uint64_t*, bool> p =
+                ar.pointer_tracker_.insert(pos, boost::uint64_t(ar.size_));
+            return p.second ? npos : *p.first;
         }
 
         std::unique_ptr<erased_output_container> buffer_;
@@ -0,0 +1,364 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_SEGMENTED_STREAM_HPP
+#define HPX_SERIALIZATION_SEGMENTED_STREAM_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/runtime/serialization/container.hpp>
+#include <hpx/runtime/serialization/input_container.hpp>
+#include <hpx/runtime/serialization/output_container.hpp>
+#include <hpx/util/integer/endian.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Archives are normally serialized into (or de-serialized from) a single
+// contiguous buffer. An archive created for an output_stream instead hands
+// its data to a segment_sink in segments of (at most) a fixed size as soon
+// as those are complete, an archive created for an input_stream pulls the
+// segments from a segment_source whenever it needs more data. This bounds
+// the memory needed for very large archives to about the size of a segment
+// and allows to overlap the (de-)serialization with the transmission of the
+// data. Note that output_archive::flush() has to be called once all data
+// was written to the archive.
+//
+// Each segment starts with a header holding the number of (possibly
+// compressed) bytes following the header and the number of bytes these
+// represent after decompression. A binary_filter attached to the archive is
+// applied to each segment separately.
+
+namespace hpx { namespace serialization
+{
+    ///////////////////////////////////////////////////////////////////////////
+    struct segment_header
+    {
+        util::integer::ulittle32_t size_;       // size of the segment data
+        util::integer::ulittle32_t raw_size_;   // size after decompression
+    };
+
+    static const std::size_t segment_header_size = sizeof(segment_header);
+
+    // Return the number of data bytes following the given segment header
+    inline std::size_t get_segment_size(char const* header)
+    {
+        segment_header h;
+        std::memcpy(&h, header, sizeof(segment_header));
+        return static_cast<boost::uint32_t>(h.size_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Receives the segments produced by an archive writing to an
+    // output_stream.
+    struct segment_sink
+    {
+        virtual ~segment_sink() {}
+
+        // The sink may take over the given segment (by swapping it). This
+        // function may block to throttle the producer.
+        virtual void write_segment(std::vector<char>& segment) = 0;
+    };
+
+    // Supplies the segments consumed by an archive reading from an
+    // input_stream.
+    struct segment_source
+    {
+        virtual ~segment_source() {}
+
+        // Replace the content of the given vector with the next segment
+        // (including its header), return false if no more segments are
+        // available.
+        virtual bool read_segment(std::vector<char>& segment) = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pass an output_stream instead of a container to an output_archive to
+    // serialize into a sequence of segments.
+    struct output_stream
+    {
+        output_stream(segment_sink& sink, std::size_t segment_size)
+          : sink_(sink), segment_size_(segment_size)
+        {
+            HPX_ASSERT(segment_size_ != 0);
+        }
+
+        segment_sink& sink_;
+        std::size_t segment_size_;
+    };
+
+    // Pass an input_stream instead of a container to an input_archive to
+    // de-serialize from a sequence of segments.
+    struct input_stream
+    {
+        explicit input_stream(segment_source& source)
+          : source_(source)
+        {}
+
+        segment_source& source_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <>
+    struct output_container<output_stream> : erased_output_container
+    {
+        // zero-copy chunks are not supported, their data is streamed inline
+        output_container(output_stream& stream,
+                std::vector<serialization_chunk>*, binary_filter*)
+          : sink_(stream.sink_), segment_size_(stream.segment_size_),
+            raw_size_(0), filter_(0), reset_filter_(false)
+        {
+            start_segment();
+        }
+
+        bool is_saving() const { return true; }
+        bool is_future_awaiting() const { return false; }
+
+        void await_future(
+            hpx::lcos::detail::future_data_refcnt_base & future_data)
+        {}
+
+        void set_filter(binary_filter* filter) // override
+        {
+            HPX_ASSERT(0 == filter_);
+
+            // the archive header is sent uncompressed in a segment of its own
+            flush_segment();
+
+            filter_ = filter;
+            if (filter_)
+                filter_->set_max_length(segment_size_);
+        }
+
+        void save_binary(void const* address, std::size_t count) // override
+        {
+            HPX_ASSERT(count != 0);
+
+            char const* data = static_cast<char const*>(address);
+            while (count != 0)
+            {
+                if (raw_size_ == segment_size_)
+                    flush_segment();
+
+                if (reset_filter_)
+                {
+                    if (!filter_->reset())
+                    {
+                        HPX_THROW_EXCEPTION(serialization_error
+                          , "output_container<output_stream>::save_binary"
+                          , "the binary filter does not support streamed "
+                            "serialization");
+                        return;
+                    }
+                    filter_->set_max_length(segment_size_);
+                    reset_filter_ = false;
+                }
+
+                std::size_t n = (std::min)(count, segment_size_ - raw_size_);
+                if (filter_)
+                    filter_->save(data, n);
+                else
+                    segment_.insert(segment_.end(), data, data + n);
+
+                raw_size_ += n;
+                data += n;
+                count -= n;
+            }
+        }
+
+        void save_binary_chunk(void const* address, std::size_t count) // override
+        {
+            this->output_container::save_binary(address, count);
+        }
+
+        // Hand the last (partial) segment to the sink. This is not done
+        // implicitly as writing to the sink may fail.
+        void flush() // override
+        {
+            flush_segment();
+        }
+
+    private:
+        void start_segment()
+        {
+            segment_.clear();
+            segment_.reserve(segment_header_size + segment_size_);
+            segment_.resize(segment_header_size);
+            raw_size_ = 0;
+        }
+
+        void flush_segment()
+        {
+            if (raw_size_ == 0)
+                return;
+
+            if (filter_)
+            {
+                // compress the collected data into the segment
+                std::size_t current = segment_header_size;
+                segment_.resize(segment_header_size + raw_size_ + 64);
+
+                do {
+                    std::size_t written = 0;
+                    bool flushed = filter_->flush(&segment_[current],
+                        segment_.size() - current, written);
+
+                    current += written;
+                    if (flushed)
+                        break;
+
+                    segment_.resize(segment_.size() * 2);
+
+                } while (true);
+
+                segment_.resize(current);
+                reset_filter_ = true;
+            }
+
+            segment_header h;
+            h.size_ = static_cast<boost::uint32_t>(
+                segment_.size() - segment_header_size);
+            h.raw_size_ = static_cast<boost::uint32_t>(raw_size_);
+            std::memcpy(segment_.data(), &h, sizeof(segment_header));
+
+            sink_.write_segment(segment_);
+            start_segment();
+        }
+
+        segment_sink& sink_;
+        std::size_t segment_size_;
+
+        std::vector<char> segment_;
+        std::size_t raw_size_;
+
+        binary_filter* filter_;
+        bool reset_filter_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <>
+    struct input_container<input_stream> : erased_input_container
+    {
+        input_container(input_stream& stream,
+                std::vector<serialization_chunk> const*, std::size_t)
+          : source_(stream.source_), current_(0), raw_size_(0),
+            filter_(), reset_filter_(false)
+        {}
+
+        void set_filter(binary_filter* filter) // override
+        {
+            // the archive header is received in a segment of its own
+            if (current_ != raw_size_)
+            {
+                HPX_THROW_EXCEPTION(serialization_error
+                  , "input_container<input_stream>::set_filter"
+                  , "archive data bstream structure mismatch");
+                return;
+            }
+            filter_.reset(filter);
+        }
+
+        void load_binary(void* address, std::size_t count) // override
+        {
+            char* data = static_cast<char*>(address);
+            while (count != 0)
+            {
+                if (current_ == raw_size_)
+                    next_segment();
+
+                std::size_t n = (std::min)(count, raw_size_ - current_);
+                if (filter_)
+                    filter_->load(data, n);
+                else
+                    std::memcpy(data, &segment_[segment_header_size + current_], n);
+
+                current_ += n;
+                data += n;
+                count -= n;
+            }
+        }
+
+        void load_binary_chunk(void* address, std::size_t count) // override
+        {
+            this->input_container::load_binary(address, count);
+        }
+
+        void* adopt_binary_chunk(std::size_t, std::size_t) // override
+        {
+            return 0;
+        }
+
+    private:
+        void next_segment()
+        {
+            if (!source_.read_segment(segment_))
+            {
+                HPX_THROW_EXCEPTION(serialization_error
+                  , "input_container<input_stream>::next_segment"
+                  , "archive data bstream is too short");
+                return;
+            }
+
+            segment_header h;
+            if (segment_.size() >= segment_header_size)
+                std::memcpy(&h, segment_.data(), sizeof(segment_header));
+
+            if (segment_.size() < segment_header_size ||
+                segment_.size() - segment_header_size !=
+                    static_cast<boost::uint32_t>(h.size_) ||
+                static_cast<boost::uint32_t>(h.raw_size_) == 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error
+                  , "input_container<input_stream>::next_segment"
+                  , "archive data bstream structure mismatch");
+                return;
+            }
+
+            current_ = 0;
+            raw_size_ = static_cast<boost::uint32_t>(h.raw_size_);
+
+            if (filter_)
+            {
+                // every segment after the first one needs a fresh filter
+                if (reset_filter_ && !filter_->reset())
+                {
+                    HPX_THROW_EXCEPTION(serialization_error
+                      , "input_container<input_stream>::next_segment"
+                      , "the binary filter does not support streamed "
+                        "serialization");
+                    return;
+                }
+                reset_filter_ = true;
+
+                std::size_t decompressed = filter_->init_data(
+                    &segment_[segment_header_size],
+                    segment_.size() - segment_header_size, raw_size_);
+                if (decompressed < raw_size_)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error
+                      , "input_container<input_stream>::next_segment"
+                      , "archive data bstream is too short");
+                    return;
+                }
+            }
+        }
+
+        segment_source& source_;
+
+        std::vector<char> segment_;
+        std::size_t current_;
+        std::size_t raw_size_;
+
+        std::unique_ptr<binary_filter> filter_;
+        bool reset_filter_;
+    };
+}}
+
+#endif
@@ -21,6 +21,13 @@
 #  define HPX_ZERO_COPY_SERIALIZATION_THRESHOLD     256
 #endif
 
+// Received zero-copy chunks smaller than this are copied out of the receive
+// buffer instead of being taken over by the de-serialized object, as the
+// adopted chunk keeps the whole receive buffer alive.
+#if !defined(HPX_ZERO_COPY_ADOPTION_THRESHOLD)
+#  define HPX_ZERO_COPY_ADOPTION_THRESHOLD          65536
+#endif
+
 namespace hpx { namespace serialization
 {
     ///////////////////////////////////////////////////////////////////////
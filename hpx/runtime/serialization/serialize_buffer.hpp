@@ -8,15 +8,19 @@
 #define HPX_SERIALIZATION_SERIALIZE_BUFFER_APR_05_2013_0312PM
 
 #include <hpx/config.hpp>
+#include <hpx/traits/adopt_received_chunk.hpp>
 #include <hpx/util/bind.hpp>
 
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/array.hpp>
 
 #include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/mpl/bool.hpp>
+#include <boost/type_traits/alignment_of.hpp>
 
 #include <algorithm>
+#include <memory>
 
 namespace hpx { namespace serialization
 {
@@ -35,6 +39,12 @@ namespace hpx { namespace serialization
             dealloc.deallocate(p, size);
         }
 
+        // The data of a received zero-copy chunk is placed by the allocator
+        // (see traits::adopt_received_chunk), this is possible only if it
+        // does not need to be de-serialized element by element.
+        typedef typename hpx::traits::is_bitwise_serializable<T>::type
+            can_adopt_chunk;
+
     public:
         enum init_mode
         {
@@ -251,12 +261,47 @@ namespace hpx { namespace serialization
         }
 
         ///////////////////////////////////////////////////////////////////////
+        template <typename Archive>
+        bool adopt_chunk(Archive& ar, boost::mpl::false_)
+        {
+            return false;
+        }
+
+        template <typename Archive>
+        bool adopt_chunk(Archive& ar, boost::mpl::true_)
+        {
+            // let the allocator decide where the data of the (received)
+            // chunk ends up, this avoids copying it through the archive
+            boost::shared_ptr<void> owner;
+            void* address = ar.adopt_binary_chunk(size_ * sizeof(T),
+                boost::alignment_of<T>::value, owner);
+            if (0 == address)
+                return false;
+
+            T* chunk = static_cast<T*>(address);
+            data_ = hpx::traits::adopt_received_chunk<allocator_type>::call(
+                alloc_, chunk, size_, owner);
+
+            if (!data_)
+            {
+                using util::placeholders::_1;
+                data_.reset(alloc_.allocate(size_),
+                    util::bind(&serialize_buffer::deleter<allocator_type>, _1,
+                        alloc_, size_));
+                std::copy(chunk, chunk + size_, data_.get());
+            }
+            return true;
+        }
+
         template <typename Archive>
         void load(Archive& ar, const unsigned int version)
         {
             using util::placeholders::_1;
             ar >> size_ >> alloc_; //-V128
 
+            if (size_ != 0 && adopt_chunk(ar, can_adopt_chunk()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind(&serialize_buffer::deleter<allocator_type>, _1,
                     alloc_, size_));
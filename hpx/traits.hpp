@@ -154,6 +154,12 @@ namespace hpx { namespace traits
     template <typename T, typename Enable = void>
     struct supports_streaming_with_any;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point for placing received zero-copy chunks into a
+    // serialize_buffer
+    template <typename Allocator, typename Enable = void>
+    struct adopt_received_chunk;
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iterator, typename Enable = void>
     struct segmented_iterator_traits;
@@ -0,0 +1,64 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_TRAITS_ADOPT_RECEIVED_CHUNK_DEC_19_2015_1102AM)
+#define HPX_TRAITS_ADOPT_RECEIVED_CHUNK_DEC_19_2015_1102AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits.hpp>
+#include <hpx/util/bind.hpp>
+
+#include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace hpx { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point deciding where a serialize_buffer using the given
+    // allocator places the data of a received zero-copy chunk.
+    //
+    // call() is given the allocator of the buffer, the received data (which
+    // stays valid for as long as owner is referenced) and the number of
+    // elements. It returns the array the buffer refers to from then on. An
+    // empty array makes the buffer allocate its memory through the allocator
+    // and copy the data into it.
+    //
+    // Allocators handing out a pre-posted destination (or registered memory)
+    // can specialize this to place the data themselves, for instance by
+    // copying it straight out of the receive buffer into the destination.
+    template <typename Allocator, typename Enable>
+    struct adopt_received_chunk
+    {
+        template <typename T>
+        static boost::shared_array<T>
+        call(Allocator&, T*, std::size_t, boost::shared_ptr<void> const&)
+        {
+            return boost::shared_array<T>();
+        }
+    };
+
+    // The default allocator takes over the memory of the received chunk.
+    template <typename T>
+    struct adopt_received_chunk<std::allocator<T> >
+    {
+        static boost::shared_array<T>
+        call(std::allocator<T>&, T* data, std::size_t,
+            boost::shared_ptr<void> const& owner)
+        {
+            using util::placeholders::_1;
+            return boost::shared_array<T>(data,
+                util::bind(&adopt_received_chunk::keep_alive, _1, owner));
+        }
+
+    private:
+        // keeps the memory of the received chunk alive
+        static void keep_alive(T*, boost::shared_ptr<void> const&) {}
+    };
+}}
+
+#endif
@@ -49,7 +49,10 @@
             sse4_2  = 13,
             avx     = 14,
             xop     = 15,
-            fma     = 16
+            fma     = 16,
+            osxsave = 17,
+            avx2    = 18,
+            avx512f = 19
         };
     };
 
@@ -79,7 +82,10 @@
         {cpu_feature::sse4_2,  "sse4.2",  0x00000001, cpuid_register::ecx, 20},
         {cpu_feature::avx,     "avx",     0x00000001, cpuid_register::ecx, 28},
         {cpu_feature::xop,     "xop",     0x80000001, cpuid_register::edx, 11},
-        {cpu_feature::fma,     "fma",     0x80000001, cpuid_register::edx, 16}
+        {cpu_feature::fma,     "fma",     0x80000001, cpuid_register::edx, 16},
+        {cpu_feature::osxsave, "osxsave", 0x00000001, cpuid_register::ecx, 27},
+        {cpu_feature::avx2,    "avx2",    0x00000007, cpuid_register::ebx, 5},
+        {cpu_feature::avx512f, "avx512f", 0x00000007, cpuid_register::ebx, 16}
     };
 
     }}}
@@ -26,7 +26,7 @@ struct cpuid_register
     };
 };
 
-void cpuid(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax)
+inline void cpuid(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax)
 {
     __asm__ __volatile__ (
         "cpuid ;\n"
@@ -38,7 +38,7 @@ void cpuid(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax)
         :);
 }
 
-void cpuidex(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax,
+inline void cpuidex(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax,
              boost::uint32_t ecx)
 {
     __asm__ __volatile__ (
@@ -51,6 +51,18 @@ void cpuidex(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax,
         :);
 }
 
+// read the extended control register with the given index
+inline boost::uint64_t xgetbv(boost::uint32_t index)
+{
+    boost::uint32_t eax, edx;
+    __asm__ __volatile__ (
+        ".byte 0x0f, 0x01, 0xd0 ;\n"     // xgetbv
+        : "=a" (eax), "=d" (edx)
+        : "c" (index)
+        :);
+    return (boost::uint64_t(edx) << 32) | eax;
+}
+
 }}}
 
 #endif // HPX_AC3F9C65_08DE_418F_9937_D9898E808454
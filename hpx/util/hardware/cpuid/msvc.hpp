@@ -28,13 +28,17 @@ struct cpuid_register
     };
 };
 
-void cpuid(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax)
+inline void cpuid(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax)
 { ::__cpuid(cpuinfo, eax); }
 
-void cpuidex(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax,
+inline void cpuidex(boost::uint32_t (&cpuinfo)[4], boost::uint32_t eax,
              boost::uint32_t ecx)
 { ::__cpuidex(cpuinfo, eax, ecx); }
 
+// read the extended control register with the given index
+inline boost::uint64_t xgetbv(boost::uint32_t index)
+{ return ::_xgetbv(index); }
+
 }}}
 
 #endif // HPX_1AB68005_619C_4049_9C2B_DCD5F336B508
@@ -75,8 +75,22 @@ namespace hpx { namespace util
 
         bool get_agas_range_caching_mode() const;
 
+        // Get whether the primary namespace is partitioned over all
+        // localities
+        bool get_agas_hashed_primary_namespace_mode() const;
+
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the time (in microseconds) after which pending decrements of
+        // global reference counts are sent to AGAS
+        boost::int64_t get_agas_refcnt_flush_interval() const;
+
+        std::size_t get_agas_local_address_table_size() const;
+
+        // Get the number of localities each locality forwards the AGAS
+        // startup notifications to
+        std::size_t get_agas_bootstrap_fanout() const;
+
         // Get whether the AGAS server is running as a dedicated runtime.
         // This decides whether the AGAS actions are executed with normal
         // priority (if dedicated) or with high priority (non-dedicated)
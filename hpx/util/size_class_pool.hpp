@@ -0,0 +1,144 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_SIZE_CLASS_POOL_HPP
+#define HPX_UTIL_SIZE_CLASS_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The size_class_pool manages memory blocks in power-of-two size classes
+    // (64 bytes up to 64 MBytes). Freed blocks are kept in a cache local to
+    // the freeing OS-thread first, and are handed over to a shared (per size
+    // class) free list once the thread local cache is full. Blocks are
+    // released to the system only if the overall amount of cached memory
+    // exceeds the configured limit. Requests larger than the largest size
+    // class are directly forwarded to the system.
+    //
+    // As memory is normally touched first by the thread allocating it, and
+    // as blocks are preferably reused by the same thread, the thread local
+    // caches keep the memory on the NUMA domain of the thread using it.
+    class HPX_EXPORT size_class_pool : boost::noncopyable
+    {
+    public:
+        enum statistics_type
+        {
+            num_allocations = 0,        // overall number of allocations
+            num_allocations_avoided = 1,// allocations served from the pool
+            num_bytes_resident = 2      // bytes currently held by the pool
+        };
+
+        // Return the (process-wide) instance of the pool
+        static size_class_pool& instance();
+
+        void* allocate(std::size_t size);
+        void deallocate(void* p, std::size_t size);
+
+        // Configure the pool: the maximal number of bytes kept cached in the
+        // thread local caches and the shared free lists and whether to back
+        // large blocks with huge pages (if supported by the system).
+        void configure(std::size_t max_cached_bytes, bool use_huge_pages);
+
+        boost::int64_t get_statistics(statistics_type type, bool reset);
+
+    private:
+        size_class_pool();
+
+        struct impl;
+        impl* impl_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Standard conforming allocator drawing its memory from the process-wide
+    // size_class_pool.
+    template <typename T>
+    struct size_class_allocator
+    {
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T value_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef size_class_allocator<U> other;
+        };
+
+        size_class_allocator() throw() {}
+
+        template <typename U>
+        size_class_allocator(size_class_allocator<U> const&) throw() {}
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        pointer allocate(size_type n, void const* /*hint*/ = 0)
+        {
+            return static_cast<T*>(
+                size_class_pool::instance().allocate(sizeof(T) * n));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            size_class_pool::instance().deallocate(p, sizeof(T) * n);
+        }
+
+        size_type max_size() const throw()
+        {
+            return (std::numeric_limits<std::size_t>::max)() / sizeof(T);
+        }
+
+        void construct(pointer p)
+        {
+            new (p) T();
+        }
+
+        template <typename U>
+        void construct(pointer p, U && val)
+        {
+            new (p) typename util::decay<T>::type(std::forward<U>(val));
+        }
+
+        void destroy(pointer p)
+        {
+            p->~T();
+        }
+
+        template <typename U>
+        bool operator==(size_class_allocator<U> const&) const
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(size_class_allocator<U> const&) const
+        {
+            return false;
+        }
+    };
+}}
+
+#endif
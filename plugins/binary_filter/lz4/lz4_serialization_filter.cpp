@@ -0,0 +1,113 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+
+#include <lz4.h>
+
+#include <cstring>
+#include <iterator>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        buffer_.resize(buffer_size);
+        int decompressed = LZ4_decompress_safe(buffer, buffer_.data(),
+            static_cast<int>(size), static_cast<int>(buffer_size));
+
+        if (decompressed < 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                "decompression failure, malformed input data");
+            return 0;
+        }
+
+        buffer_.resize(static_cast<std::size_t>(decompressed));
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = static_cast<std::size_t>(
+            LZ4_compressBound(static_cast<int>(buffer_.size())));
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        int compressed_length = LZ4_compress_default(buffer_.data(),
+            static_cast<char*>(dst), static_cast<int>(buffer_.size()),
+            static_cast<int>(dst_count));
+
+        if (compressed_length <= 0 && !buffer_.empty())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        written = static_cast<std::size_t>(compressed_length);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::reset()
+    {
+        buffer_.clear();
+        current_ = 0;
+        return true;
+    }
+}}}
@@ -91,5 +91,12 @@ namespace hpx { namespace plugins { namespace compression
         written = compressed_length;
         return true;
     }
-}}}
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool snappy_serialization_filter::reset()
+    {
+        buffer_.clear();
+        current_ = 0;
+        return true;
+    }
+}}}
@@ -139,5 +139,13 @@ namespace hpx { namespace plugins { namespace compression
         written = dst_begin-static_cast<char*>(dst);
         return !eof;
     }
-}}}
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool zlib_serialization_filter::reset()
+    {
+        compdecomp_.close();
+        buffer_.clear();
+        current_ = 0;
+        return true;
+    }
+}}}
@@ -0,0 +1,117 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+
+#include <zstd.h>
+
+#include <cstring>
+#include <iterator>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    // parcels are compressed on the critical path, use the fastest setting
+    static const int zstd_compression_level = 1;
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        buffer_.resize(buffer_size);
+        std::size_t decompressed = ZSTD_decompress(buffer_.data(),
+            buffer_size, buffer, size);
+
+        if (ZSTD_isError(decompressed))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                std::string("decompression failure: ") +
+                    ZSTD_getErrorName(decompressed));
+            return 0;
+        }
+
+        buffer_.resize(decompressed);
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        std::size_t compressed_length = ZSTD_compress(dst, dst_count,
+            buffer_.data(), buffer_.size(), zstd_compression_level);
+
+        if (ZSTD_isError(compressed_length))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::flush",
+                std::string("compression failure: ") +
+                    ZSTD_getErrorName(compressed_length));
+            return false;
+        }
+
+        written = compressed_length;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::reset()
+    {
+        buffer_.clear();
+        current_ = 0;
+        return true;
+    }
+}}}
@@ -53,6 +53,7 @@ namespace hpx { namespace parcelset
         typedef policies::mpi::sender_connection connection_type;
         typedef boost::mpl::true_  send_early_parcel;
         typedef boost::mpl::true_ do_background_work;
+        typedef boost::mpl::false_ send_streamed;
 
         static const char * type()
         {
@@ -10,6 +10,8 @@
 
 #include <hpx/plugins/parcelport_factory.hpp>
 
+#include <boost/preprocessor/stringize.hpp>
+
 namespace hpx { namespace traits
 {
     // Inject additional configuration data into the factory registry for this
@@ -19,6 +21,8 @@ namespace hpx { namespace traits
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      streaming_threshold = 0
+    //      streaming_segment_size = 1048576
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -33,7 +37,11 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return
+                "streaming_threshold = ${HPX_PARCEL_TCP_STREAMING_THRESHOLD:0}\n"
+                "streaming_segment_size = ${HPX_PARCEL_TCP_STREAMING_SEGMENT_SIZE:"
+                    BOOST_PP_STRINGIZE(HPX_PARCEL_STREAMING_SEGMENT_SIZE) "}\n"
+                ;
         }
     };
 }}
@@ -12,9 +12,12 @@
 #include <hpx/runtime/applier/applier.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/util/logging.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/lcos/barrier.hpp>
 #include <hpx/runtime/agas/interface.hpp>
 
+#include <boost/chrono/chrono.hpp>
+
 #define HPX_USE_FAST_BOOTSTRAP_SYNCHRONIZATION
 
 #if defined(HPX_USE_FAST_BOOTSTRAP_SYNCHRONIZATION)
@@ -73,25 +76,35 @@ inline void delete_barrier(lcos::barrier& b, char const* symname)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Find a registered barrier object from its symbolic name.
-inline lcos::barrier
+// Find a registered barrier object from its symbolic name. The returned future
+// becomes ready as soon as the barrier has been registered.
+inline lcos::future<naming::id_type>
 find_barrier(char const* symname)
 {
-    naming::id_type barrier_id;
-    for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
-    {
-        if (agas::resolve_name_sync(symname, barrier_id))
-            break;
+    return agas::on_symbol_namespace_event(symname, agas::symbol_ns_bind, true);
+}
 
-        boost::this_thread::sleep(boost::get_system_time() +
-            boost::posix_time::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
-    }
-    if (HPX_UNLIKELY(!barrier_id))
+inline lcos::barrier
+get_barrier(lcos::future<naming::id_type>& f, char const* symname)
+{
+    boost::chrono::milliseconds timeout(
+        HPX_MAX_NETWORK_RETRIES * HPX_NETWORK_RETRIES_SLEEP);
+    if (HPX_UNLIKELY(f.wait_for(timeout) == lcos::future_status::timeout))
     {
         HPX_THROW_EXCEPTION(network_error, "pre_main::find_barrier",
             std::string("couldn't find boot barrier ") + symname);
     }
-    return lcos::barrier(barrier_id);
+    return lcos::barrier(f.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Record the time spent in the given startup phase, returns the current time.
+inline boost::uint64_t
+record_startup_time(runtime::startup_phase phase, boost::uint64_t start)
+{
+    boost::uint64_t now = util::high_resolution_clock::now();
+    get_runtime().set_startup_time(phase, now - start);
+    return now;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -136,6 +149,7 @@ int pre_main(runtime_mode mode)
     util::runtime_configuration const& cfg = rt.get_config();
 
     int exit_code = 0;
+    boost::uint64_t start = util::high_resolution_clock::now();
     if (runtime_mode_connect == mode)
     {
         LBT_(info) << "(2nd stage) pre_main: locality is in connect mode, "
@@ -146,8 +160,10 @@ int pre_main(runtime_mode mode)
         exit_code = runtime_support::load_components(find_here());
         LBT_(info) << "(2nd stage) pre_main: loaded components"
             << (exit_code ? ", application exit has been requested" : "");
+        start = record_startup_time(runtime::startup_phase_components, start);
 
         register_counter_types();
+        start = record_startup_time(runtime::startup_phase_counters, start);
 
         rt.set_state(state_pre_startup);
         runtime_support::call_startup_functions(find_here(), true);
@@ -156,6 +172,7 @@ int pre_main(runtime_mode mode)
         rt.set_state(state_startup);
         runtime_support::call_startup_functions(find_here(), false);
         LBT_(info) << "(3rd stage) pre_main: ran startup functions";
+        record_startup_time(runtime::startup_phase_startup_functions, start);
     }
     else
     {
@@ -165,8 +182,10 @@ int pre_main(runtime_mode mode)
         exit_code = runtime_support::load_components(find_here());
         LBT_(info) << "(2nd stage) pre_main: loaded components"
             << (exit_code ? ", application exit has been requested" : "");
+        start = record_startup_time(runtime::startup_phase_components, start);
 
         lcos::barrier startup_barrier;
+        lcos::future<naming::id_type> startup_barrier_id;
 
         // {{{ Second and third stage barrier creation.
         if (agas_client.is_bootstrap())
@@ -192,10 +211,9 @@ int pre_main(runtime_mode mode)
         }
         else // Hosted.
         {
-            // Initialize the barrier clients (find them in AGAS)
-            startup_barrier = find_barrier(startup_barrier_name);
-
-            LBT_(info) << "(2nd stage) pre_main: found 2nd and 3rd stage boot barriers";
+            // Initialize the barrier clients (find them in AGAS), this is
+            // overlapped with the registration of the counter types below.
+            startup_barrier_id = find_barrier(startup_barrier_name);
         }
         // }}}
 
@@ -203,6 +221,15 @@ int pre_main(runtime_mode mode)
         // executed.
         register_counter_types();
 
+        if (startup_barrier_id.valid())
+        {
+            startup_barrier = get_barrier(startup_barrier_id,
+                startup_barrier_name);
+
+            LBT_(info) << "(2nd stage) pre_main: found 2nd and 3rd stage boot barriers";
+        }
+        start = record_startup_time(runtime::startup_phase_counters, start);
+
         // Second stage bootstrap synchronizes component loading across all
         // localities, ensuring that the component namespace tables are fully
         // populated before user code is executed.
@@ -211,6 +238,7 @@ int pre_main(runtime_mode mode)
             startup_barrier.wait();
             LBT_(info) << "(2nd stage) pre_main: passed 2nd stage boot barrier";
         }
+        start = record_startup_time(runtime::startup_phase_barrier, start);
 
 #if defined(HPX_USE_FAST_BOOTSTRAP_SYNCHRONIZATION)
         if (agas_client.is_bootstrap())
@@ -252,6 +280,7 @@ int pre_main(runtime_mode mode)
             if (agas_client.is_bootstrap())
                 delete_barrier(startup_barrier, startup_barrier_name);
         }
+        record_startup_time(runtime::startup_phase_startup_functions, start);
     }
 
     // Enable logging. Even if we terminate at this point we will see all
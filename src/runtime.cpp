@@ -22,6 +22,7 @@
 #include <hpx/util/command_line_handling.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/backtrace.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/query_counters.hpp>
 #include <hpx/util/thread_mapper.hpp>
 #include <hpx/util/coroutine/coroutine.hpp>
@@ -496,6 +497,9 @@ namespace hpx
         util::reinit_construct();       // call only after TLS was initialized
 
         counters_.reset(new performance_counters::registry());
+
+        for (std::size_t i = 0; i != startup_phase_last; ++i)
+            startup_times_[i].store(0);
     }
 
     runtime::~runtime()
@@ -784,6 +788,86 @@ namespace hpx
         performance_counters::install_counter_types(
             arithmetic_counter_types,
             sizeof(arithmetic_counter_types)/sizeof(arithmetic_counter_types[0]));
+
+        // startup time counters
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        util::function_nonser<boost::int64_t(bool)> bootstrap_time(
+            util::bind(&runtime::get_startup_time, this,
+                startup_phase_bootstrap, _1));
+        util::function_nonser<boost::int64_t(bool)> components_time(
+            util::bind(&runtime::get_startup_time, this,
+                startup_phase_components, _1));
+        util::function_nonser<boost::int64_t(bool)> counters_time(
+            util::bind(&runtime::get_startup_time, this,
+                startup_phase_counters, _1));
+        util::function_nonser<boost::int64_t(bool)> barrier_time(
+            util::bind(&runtime::get_startup_time, this,
+                startup_phase_barrier, _1));
+        util::function_nonser<boost::int64_t(bool)> startup_functions_time(
+            util::bind(&runtime::get_startup_time, this,
+                startup_phase_startup_functions, _1));
+
+        performance_counters::generic_counter_type_data startup_counter_types[] =
+        {
+            { "/runtime/startup/time/bootstrap",
+              performance_counters::counter_raw,
+              "returns the time spent registering the referenced locality "
+              "with AGAS (including waiting for all initial localities to "
+              "connect)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, bootstrap_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { "/runtime/startup/time/components",
+              performance_counters::counter_raw,
+              "returns the time spent loading the components on the "
+              "referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, components_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { "/runtime/startup/time/counters",
+              performance_counters::counter_raw,
+              "returns the time spent registering the performance counter "
+              "types and locating the startup barrier on the referenced "
+              "locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, counters_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { "/runtime/startup/time/barrier",
+              performance_counters::counter_raw,
+              "returns the time spent waiting for all localities to finish "
+              "loading their components on the referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, barrier_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { "/runtime/startup/time/startup_functions",
+              performance_counters::counter_raw,
+              "returns the time spent running the pre-startup and startup "
+              "functions (including the final boot barrier) on the "
+              "referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, startup_functions_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            }
+        };
+        performance_counters::install_counter_types(
+            startup_counter_types,
+            sizeof(startup_counter_types)/sizeof(startup_counter_types[0]));
     }
 
     boost::uint32_t runtime::assign_cores(std::string const& locality_basename,
@@ -26,13 +26,14 @@
 #include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/include/performance_counters.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/lcos/broadcast.hpp>
 
 #include <boost/format.hpp>
-#include <boost/icl/closed_interval.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/thread/locks.hpp>
 
@@ -117,101 +118,25 @@ struct addressing_service::hosted_data_type
     server::symbol_namespace symbol_ns_server_;
 }; // }}}
 
-struct addressing_service::gva_cache_key
-{ // {{{ gva_cache_key implementation
-  private:
-    typedef boost::icl::closed_interval<naming::gid_type, std::less>
-        key_type;
-
-    key_type key_;
-
-  public:
-    gva_cache_key()
-      : key_()
-    {}
-
-    explicit gva_cache_key(
-        naming::gid_type const& id_
-      , boost::uint64_t count_ = 1
-        )
-      : key_(naming::detail::get_stripped_gid(id_)
-           , naming::detail::get_stripped_gid(id_) + (count_ - 1))
-    {
-        HPX_ASSERT(count_);
-    }
-
-    naming::gid_type get_gid() const
-    {
-        return boost::icl::lower(key_);
-    }
-
-    boost::uint64_t get_count() const
-    {
-        naming::gid_type const size = boost::icl::length(key_);
-        HPX_ASSERT(size.get_msb() == 0);
-        return size.get_lsb();
-    }
-
-    friend bool operator<(
-        gva_cache_key const& lhs
-      , gva_cache_key const& rhs
-        )
-    {
-        return boost::icl::exclusive_less(lhs.key_, rhs.key_);
-    }
-
-    friend bool operator==(
-        gva_cache_key const& lhs
-      , gva_cache_key const& rhs
-        )
-    {
-        // Is lhs in rhs?
-        if (1 == lhs.get_count() && 1 != rhs.get_count())
-            return boost::icl::contains(rhs.key_, lhs.key_);
-
-        // Is rhs in lhs?
-        else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            return boost::icl::contains(lhs.key_, rhs.key_);
-
-        // Direct hit
-        return lhs.key_ == rhs.key_;
-    }
-}; // }}}
-
-struct addressing_service::gva_erase_policy
-{ // {{{ gva_erase_policy implementation
-    gva_erase_policy(
-        naming::gid_type const& id
-      , boost::uint64_t count
-        )
-      : entry(id, count)
-    {}
-
-    typedef std::pair<
-        gva_cache_key, boost::cache::entries::lfu_entry<gva>
-    > entry_type;
-
-    bool operator()(
-        entry_type const& p
-        ) const
-    {
-        return p.first == entry;
-    }
-
-    gva_cache_key entry;
-}; // }}}
-
 addressing_service::addressing_service(
     parcelset::parcelhandler& ph
   , util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
   : gva_cache_(new gva_cache_type)
+  , num_migrated_objects_(0)
   , console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
-  , refcnt_requests_(new refcnt_requests_type)
+  , refcnt_requests_(new refcnt_destinations_type)
+  , refcnt_flush_timer_(
+        boost::bind(&addressing_service::flush_refcnt_requests, this),
+        ini_.get_agas_refcnt_flush_interval(),
+        "addressing_service::refcnt_flush_timer", true)
+  , refcnt_requests_received_(0)
+  , refcnt_requests_saved_(0)
+  , refcnt_messages_sent_(0)
   , service_type(ini_.get_agas_service_mode())
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
@@ -229,6 +154,12 @@ addressing_service::addressing_service(
     if (caching_)
         gva_cache_->reserve(ini_.get_agas_local_cache_size());
 
+    local_address_table_.reserve(ini_.get_agas_local_address_table_size());
+
+    // distribute the primary namespace over all initially known localities
+    if (ini_.get_agas_hashed_primary_namespace_mode())
+        detail::set_primary_namespace_partitions(ini_.get_num_localities());
+
     if (service_type == service_mode_bootstrap)
     {
         launch_bootstrap(pp, ph.endpoints(), ini_);
@@ -475,6 +406,70 @@ response addressing_service::service(
     return response();
 } // }}}
 
+response addressing_service::service_primary_ns(
+    naming::gid_type const& id
+  , request const& req
+  , error_code& ec
+    )
+{ // {{{
+    // forward the request if the id is managed by another partition
+    if (detail::get_primary_namespace_partitions() != 0 &&
+        !is_managed_locally(id))
+    {
+        naming::id_type const target(
+            stubs::primary_namespace::get_service_instance(id)
+          , naming::id_type::unmanaged);
+
+        return stubs::primary_namespace::service(
+            target, req, action_priority_, ec);
+    }
+
+    if (is_bootstrap())
+        return bootstrap->primary_ns_server_.service(req, ec);
+    return hosted->primary_ns_server_.service(req, ec);
+} // }}}
+
+bool addressing_service::resolve_local_address_table(
+    naming::gid_type const& id
+  , naming::address& addr
+    ) const
+{ // {{{
+    boost::int32_t type = 0;
+    boost::uint64_t lva = 0;
+    if (!local_address_table_.get_entry(id, type, lva))
+        return false;
+
+    addr.locality_ = get_local_locality();
+    addr.type_ = type;
+    addr.address_ = lva;
+    return true;
+} // }}}
+
+void addressing_service::update_local_address_table(
+    naming::gid_type const& id
+  , naming::address const& addr
+  , boost::uint64_t generation
+    )
+{ // {{{
+    if (!addr.address_ || addr.locality_ != get_local_locality() ||
+        !naming::detail::store_in_cache(id) || !is_managed_locally(id))
+    {
+        return;
+    }
+
+    // Migrated objects are always resolved through the primary namespace.
+    // The object is marked as migrated before its entry is removed from the
+    // table, which makes sure it's not inserted again afterwards.
+    if (num_migrated_objects_.load(boost::memory_order_relaxed) != 0)
+    {
+        boost::lock_guard<cache_mutex_type> lock(migrated_objects_mtx_);
+        if (was_object_migrated_locked(id))
+            return;
+    }
+
+    local_address_table_.insert(id, addr.type_, addr.address_, generation);
+} // }}}
+
 std::vector<response> addressing_service::bulk_service(
     std::vector<request> const& req
   , error_code& ec
@@ -1093,18 +1088,16 @@ bool addressing_service::bind_range_local(
 
         request req(primary_ns_bind_gid, lower_id, g,
             naming::get_locality_from_gid(lower_id));
-        response rep;
-
-        if (is_bootstrap())
-            rep = bootstrap->primary_ns_server_.service(req, ec);
-        else
-            rep = hosted->primary_ns_server_.service(req, ec);
+        response rep = service_primary_ns(lower_id, req, ec);
 
         error const s = rep.get_status();
 
         if (ec || (success != s && repeated_request != s))
             return false;
 
+        // the ids might have been bound to another address before
+        local_address_table_.erase(lower_id, count);
+
         if(range_caching_)
         {
             // Put the range into the cache.
@@ -1137,6 +1130,9 @@ bool addressing_service::bind_postproc(
     if (success != s && repeated_request != s)
         return false;
 
+    // the ids might have been bound to another address before
+    local_address_table_.erase(lower_id, g.count);
+
     if(range_caching_)
     {
         // Put the range into the cache.
@@ -1193,29 +1189,13 @@ bool addressing_service::unbind_range_local(
 { // {{{ unbind_range implementation
     try {
         request req(primary_ns_unbind_gid, lower_id, count);
-        response rep;
-
-//         if (get_status() == running &&
-//             naming::get_locality_id_from_gid(lower_id) !=
-//                 naming::get_locality_id_from_gid(locality_))
-//         {
-//             naming::id_type target(
-//                 stubs::primary_namespace::get_service_instance(lower_id)
-//               , naming::id_type::unmanaged);
-//
-//             rep = stubs::primary_namespace::service(
-//                 target, req, threads::thread_priority_default, ec);
-//         }
-//         else
-
-        if (is_bootstrap())
-            rep = bootstrap->primary_ns_server_.service(req, ec);
-        else
-            rep = hosted->primary_ns_server_.service(req, ec);
+        response rep = service_primary_ns(lower_id, req, ec);
 
         if (ec || (success != rep.get_status()))
             return false;
 
+        local_address_table_.erase(lower_id, count);
+
         // I'm afraid that this will break the first form of paged caching,
         // so it's commented out for now.
         //boost::lock_guard<cache_mutex_type> lock(hosted->gva_cache_mtx_);
@@ -1451,7 +1431,18 @@ bool addressing_service::resolve_full_local(
   , error_code& ec
     )
 { // {{{ resolve implementation
+    // objects living on (and managed by) this locality
+    if (resolve_local_address_table(id, addr))
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return true;
+    }
+
     try {
+        boost::uint64_t const generation =
+            local_address_table_.get_generation();
+
         request req(primary_ns_resolve_gid, id);
         response rep;
 
@@ -1474,6 +1465,8 @@ bool addressing_service::resolve_full_local(
         addr.type_ = g.type;
         addr.address_ = g.lva();
 
+        update_local_address_table(id, addr, generation);
+
         if (addr.address_)
         {
             if(range_caching_)
@@ -1517,6 +1510,14 @@ bool addressing_service::resolve_cached(
     if (resolve_locally_known_addresses(id, addr))
         return true;
 
+    // objects living on (and managed by) this locality
+    if (resolve_local_address_table(id, addr))
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return true;
+    }
+
     // If caching is disabled, bail
     if (!caching_)
     {
@@ -1534,50 +1535,35 @@ bool addressing_service::resolve_cached(
     }
 
     // don't look at the cache if the id is locally managed
-    if (naming::get_locality_id_from_gid(id) ==
-        naming::get_locality_id_from_gid(locality_))
+    if (is_managed_locally(id))
     {
         if (&ec != &throws)
             ec = make_success_code();
         return false;
     }
 
-    // first look up the requested item in the cache
-    gva_cache_key k(id);
-    gva_cache_key idbase;
-    gva_cache_type::entry_type e;
-
-    cache_mutex_type::scoped_lock lock(gva_cache_mtx_);
-
     // force routing if target object was migrated
-    if (was_object_migrated_locked(id))
-    {
-        if (&ec != &throws)
-            ec = make_success_code();
-        return false;
-    }
-
-    // Check if the entry is currently in the cache
-    if (gva_cache_->get_entry(k, idbase, e))
+    if (num_migrated_objects_.load(boost::memory_order_relaxed) != 0)
     {
-        const boost::uint64_t id_msb =
-            naming::detail::strip_internal_bits_from_gid(id.get_msb());
-
-        if (HPX_UNLIKELY(id_msb != idbase.get_gid().get_msb()))
+        boost::lock_guard<cache_mutex_type> lock(migrated_objects_mtx_);
+        if (was_object_migrated_locked(id))
         {
-            HPX_THROWS_IF(ec, internal_server_error
-              , "addressing_service::resolve_cached"
-              , "bad entry in cache, MSBs of GID base and GID do not match");
+            if (&ec != &throws)
+                ec = make_success_code();
             return false;
         }
+    }
 
-        gva const& g = e.get();
+    // first look up the requested item in the cache
+    naming::gid_type idbase;
+    gva g;
 
+    // Check if the entry is currently in the cache
+    if (gva_cache_->get_entry(id, idbase, g))
+    {
         addr.locality_ = g.prefix;
         addr.type_ = g.type;
-        addr.address_ = g.lva(id, idbase.get_gid());
-
-        lock.unlock();
+        addr.address_ = g.lva(id, idbase);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1589,7 +1575,7 @@ bool addressing_service::resolve_cached(
                 "cache hit for address %1%, lva %2% (base %3%, lva %4%)")
             % id
             % reinterpret_cast<void*>(addr.address_)
-            % idbase.get_gid()
+            % idbase
             % reinterpret_cast<void*>(g.lva()));
 */
 
@@ -1662,7 +1648,7 @@ hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
 
 ///////////////////////////////////////////////////////////////////////////////
 naming::address addressing_service::resolve_full_postproc(
-    future<response> f, naming::gid_type const& id
+    future<response> f, naming::gid_type const& id, boost::uint64_t generation
     )
 {
     naming::address addr;
@@ -1687,6 +1673,8 @@ naming::address addressing_service::resolve_full_postproc(
     addr.type_ = g.type;
     addr.address_ = g.lva();
 
+    update_local_address_table(id, addr, generation);
+
     if(range_caching_)
     {
         // Put the range into the cache.
@@ -1713,6 +1701,8 @@ hpx::future<naming::address> addressing_service::resolve_full_async(
         return make_ready_future(naming::address());
     }
 
+    boost::uint64_t const generation = local_address_table_.get_generation();
+
     // ask server
     request req(primary_ns_resolve_gid, gid);
     naming::id_type target(
@@ -1724,7 +1714,7 @@ hpx::future<naming::address> addressing_service::resolve_full_async(
         stubs::primary_namespace::service_async<response>(target, req);
     return f.then(util::bind(
             util::one_shot(&addressing_service::resolve_full_postproc),
-            this, _1, gid
+            this, _1, gid, generation
         ));
 }
 
@@ -1773,6 +1763,9 @@ bool addressing_service::resolve_full_local(
         if (ec)
             return false;
 
+        std::vector<gva_cache_type::entry_type> entries;
+        entries.reserve(reps.size());
+
         std::size_t j = 0;
         for (std::size_t i = 0; i != count; ++i)
         {
@@ -1798,20 +1791,23 @@ bool addressing_service::resolve_full_local(
             if(range_caching_)
             {
                 // Put the range into the cache.
-                update_cache_entry(base_gid, base_gva, ec);
+                entries.push_back(
+                    gva_cache_type::entry_type(base_gid, base_gva));
             }
             else
             {
                 // Put the fully resolved gva into the cache.
-                update_cache_entry(gids[i], g, ec);
+                entries.push_back(gva_cache_type::entry_type(gids[i], g));
             }
 
-            if (ec)
-                return false;
-
             ++j;
         }
 
+        // insert all resolved addresses into the cache at once
+        update_cache_entries(entries, ec);
+        if (ec)
+            return false;
+
         if (&ec != &throws)
             ec = make_success_code();
 
@@ -1961,6 +1957,8 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
     bool has_pending_incref = false;
     boost::int64_t pending_decrefs = 0;
 
+    ++refcnt_requests_received_;
+
     {
         boost::lock_guard<mutex_type> l(refcnt_requests_mtx_);
 
@@ -1968,12 +1966,18 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
 
         naming::gid_type raw = naming::detail::get_stripped_gid(gid);
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        refcnt_requests_type& requests = (*refcnt_requests_)[
+            detail::get_primary_namespace_locality_id(raw)];
+
+        iterator matches = requests.find(raw);
+        if (matches != requests.end())
         {
             pending_decrefs = matches->second;
             matches->second += credit;
 
+            // the incref is combined with the pending decref
+            ++refcnt_requests_saved_;
+
             // Increment requests need to be handled immediately.
 
             // If the given incref was fully compensated by a pending decref
@@ -1986,13 +1990,16 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
                 pending_incref = mapping(matches->first, matches->second);
                 has_pending_incref = true;
 
-                refcnt_requests_->erase(matches);
+                requests.erase(matches);
+                --refcnt_requests_count_;
             }
             else if (matches->second == 0)
             {
                 // credit == decref (case no. 3): if the incref offsets any
                 // pending decref, just remove the pending decref request.
-                refcnt_requests_->erase(matches);
+                requests.erase(matches);
+                --refcnt_requests_count_;
+                ++refcnt_requests_saved_;
             }
             else
             {
@@ -2020,6 +2027,7 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
         stubs::primary_namespace::get_service_instance(e_lower)
       , naming::id_type::unmanaged);
 
+    ++refcnt_messages_sent_;
     lcos::future<boost::int64_t> f =
         stubs::primary_namespace::service_async<boost::int64_t>(target, req);
 
@@ -2064,37 +2072,58 @@ void addressing_service::decref(
         return;
     }
 
+    ++refcnt_requests_received_;
+
     try {
         naming::gid_type raw = naming::detail::get_stripped_gid(gid);
-        boost::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+        boost::uint32_t destination =
+            detail::get_primary_namespace_locality_id(raw);
 
-        // Match the decref request with entries in the incref table
-        typedef refcnt_requests_type::iterator iterator;
-        typedef refcnt_requests_type::value_type mapping;
+        bool start_timer = false;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
-        {
-            matches->second -= credit;
-        }
-        else
         {
-            std::pair<iterator, bool> p =
-                refcnt_requests_->insert(mapping(raw, -credit));
+            boost::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+
+            // Match the decref request with entries in the incref table
+            typedef refcnt_requests_type::iterator iterator;
+            typedef refcnt_requests_type::value_type mapping;
 
-            if (HPX_UNLIKELY(!p.second))
+            refcnt_requests_type& requests = (*refcnt_requests_)[destination];
+
+            iterator matches = requests.find(raw);
+            if (matches != requests.end())
             {
-                l.unlock();
+                matches->second -= credit;
+                ++refcnt_requests_saved_;
+            }
+            else
+            {
+                std::pair<iterator, bool> p =
+                    requests.insert(mapping(raw, -credit));
 
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "addressing_service::decref"
-                  , boost::str(boost::format("couldn't insert decref request "
-                        "for %1% (%2%)") % raw % credit));
-                return;
+                if (HPX_UNLIKELY(!p.second))
+                {
+                    l.unlock();
+
+                    HPX_THROWS_IF(ec, bad_parameter
+                      , "addressing_service::decref"
+                      , boost::str(boost::format("couldn't insert decref "
+                            "request for %1% (%2%)") % raw % credit));
+                    return;
+                }
+
+                // (re-)start the flush timer for the first pending request
+                if (0 == refcnt_requests_count_++)
+                    start_timer = enable_refcnt_caching_;
             }
+
+            send_refcnt_requests(l, destination, ec);
         }
 
-        send_refcnt_requests(l, ec);
+        if (start_timer && refcnt_flush_timer_.get_interval() != 0)
+        {
+            refcnt_flush_timer_.start(false);
+        }
     }
     catch (hpx::exception const& e) {
         HPX_RETHROWS_IF(ec, e, "addressing_service::decref");
@@ -2245,6 +2274,199 @@ lcos::future<naming::id_type> addressing_service::resolve_name_async(
         name, req, action_priority_);
 } // }}}
 
+namespace detail
+{
+    // Sort the given names by the symbol namespace instance responsible for
+    // them.
+    typedef std::map<naming::gid_type, std::vector<std::size_t> >
+        symbol_namespace_groups_type;
+
+    template <typename F>
+    symbol_namespace_groups_type group_by_symbol_namespace(std::size_t count,
+        F const& get_name)
+    {
+        symbol_namespace_groups_type groups;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            naming::id_type service =
+                stubs::symbol_namespace::symbol_namespace_locality(get_name(i));
+            groups[service.get_gid()].push_back(i);
+        }
+        return groups;
+    }
+
+    struct get_first_name
+    {
+        typedef std::vector<std::pair<std::string, naming::id_type> >
+            names_type;
+
+        get_first_name(names_type const& names)
+          : names_(names)
+        {}
+
+        std::string const& operator()(std::size_t i) const
+        {
+            return names_[i].first;
+        }
+
+        names_type const& names_;
+    };
+
+    struct get_name
+    {
+        get_name(std::vector<std::string> const& names)
+          : names_(names)
+        {}
+
+        std::string const& operator()(std::size_t i) const
+        {
+            return names_[i];
+        }
+
+        std::vector<std::string> const& names_;
+    };
+
+    naming::id_type make_id_from_name_gid(naming::gid_type const& gid)
+    {
+        if (!gid)
+            return naming::invalid_id;
+
+        if (naming::detail::has_credits(gid))
+            return naming::id_type(gid, naming::id_type::managed);
+
+        return naming::id_type(gid, naming::id_type::unmanaged);
+    }
+}
+
+std::vector<bool> addressing_service::register_names(
+    std::vector<std::pair<std::string, naming::id_type> > const& names
+  , error_code& ec
+    )
+{ // {{{
+    std::vector<bool> result(names.size(), false);
+    std::vector<boost::int64_t> new_credits(names.size(), 0);
+
+    try {
+        detail::symbol_namespace_groups_type groups =
+            detail::group_by_symbol_namespace(names.size(),
+                detail::get_first_name(names));
+
+        std::vector<lcos::future<std::vector<response> > > futures;
+        futures.reserve(groups.size());
+
+        for (detail::symbol_namespace_groups_type::value_type const& g : groups)
+        {
+            std::vector<request> reqs;
+            reqs.reserve(g.second.size());
+
+            for (std::size_t i : g.second)
+            {
+                // We need to modify the reference count.
+                naming::gid_type& mutable_gid =
+                    const_cast<naming::id_type&>(names[i].second).get_gid();
+                naming::gid_type new_gid =
+                    naming::detail::split_gid_if_needed(mutable_gid).get();
+
+                new_credits[i] = naming::detail::get_credit_from_gid(new_gid);
+                reqs.push_back(request(symbol_ns_bind, names[i].first, new_gid));
+            }
+
+            futures.push_back(stubs::symbol_namespace::bulk_service_async(
+                naming::id_type(g.first, naming::id_type::unmanaged),
+                reqs, action_priority_));
+        }
+
+        lcos::wait_all(futures);
+
+        std::size_t k = 0;
+        for (detail::symbol_namespace_groups_type::value_type const& g : groups)
+        {
+            lcos::future<std::vector<response> >& f = futures[k++];
+            if (f.has_exception())
+                continue;
+
+            std::vector<response> reps = f.get();
+            HPX_ASSERT(reps.size() == g.second.size());
+
+            for (std::size_t j = 0; j != reps.size(); ++j)
+                result[g.second[j]] = (success == reps[j].get_status());
+        }
+
+        // Return the credits to the GIDs which were not registered
+        for (std::size_t i = 0; i != names.size(); ++i)
+        {
+            if (!result[i] && new_credits[i] != 0)
+            {
+                naming::detail::add_credit_to_gid(
+                    const_cast<naming::id_type&>(names[i].second).get_gid(),
+                    new_credits[i]);
+            }
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::register_names");
+    }
+    return result;
+} // }}}
+
+std::vector<naming::id_type> addressing_service::resolve_names(
+    std::vector<std::string> const& names
+  , error_code& ec
+    )
+{ // {{{
+    std::vector<naming::id_type> result(names.size());
+
+    try {
+        detail::symbol_namespace_groups_type groups =
+            detail::group_by_symbol_namespace(names.size(),
+                detail::get_name(names));
+
+        std::vector<lcos::future<std::vector<response> > > futures;
+        futures.reserve(groups.size());
+
+        for (detail::symbol_namespace_groups_type::value_type const& g : groups)
+        {
+            std::vector<request> reqs;
+            reqs.reserve(g.second.size());
+
+            for (std::size_t i : g.second)
+                reqs.push_back(request(symbol_ns_resolve, names[i]));
+
+            futures.push_back(stubs::symbol_namespace::bulk_service_async(
+                naming::id_type(g.first, naming::id_type::unmanaged),
+                reqs, action_priority_));
+        }
+
+        lcos::wait_all(futures);
+
+        std::size_t k = 0;
+        for (detail::symbol_namespace_groups_type::value_type const& g : groups)
+        {
+            std::vector<response> reps = futures[k++].get();
+            HPX_ASSERT(reps.size() == g.second.size());
+
+            for (std::size_t j = 0; j != reps.size(); ++j)
+            {
+                if (success == reps[j].get_status())
+                {
+                    result[g.second[j]] =
+                        detail::make_id_from_name_gid(reps[j].get_gid());
+                }
+            }
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::resolve_names");
+    }
+    return result;
+} // }}}
+
 namespace detail
 {
     hpx::future<hpx::id_type> on_register_event(hpx::future<bool> f,
@@ -2271,7 +2493,7 @@ future<hpx::id_type> addressing_service::on_symbol_namespace_event(
     std::string const& name, namespace_action_code evt,
     bool call_for_past_events)
 {
-    if (evt != symbol_ns_bind)
+    if (evt != symbol_ns_bind && evt != symbol_ns_unbind)
     {
         HPX_THROW_EXCEPTION(bad_parameter,
             "addressing_service::on_symbol_namespace_event",
@@ -2339,6 +2561,47 @@ bool addressing_service::iterate_ids(
     }
 } // }}}
 
+namespace detail
+{
+    // Combine the names found by all symbol namespace instances.
+    std::map<std::string, naming::id_type> merge_found_symbols(
+        lcos::future<std::vector<response> > f)
+    {
+        std::map<std::string, naming::id_type> result;
+
+        typedef std::map<std::string, naming::gid_type> names_type;
+        for (response const& rep : f.get())
+        {
+            names_type names = rep.get_names();
+            for (names_type::value_type const& v : names)
+            {
+                result.insert(result.end(), std::make_pair(
+                    v.first, make_id_from_name_gid(v.second)));
+            }
+        }
+        return result;
+    }
+}
+
+lcos::future<std::map<std::string, naming::id_type> >
+addressing_service::find_symbols_async(
+    std::string const& prefix
+    )
+{ // {{{
+    request req(symbol_ns_find_prefix, prefix);
+
+    // names starting with '/0' are all managed by locality 0
+    std::vector<hpx::id_type> ids;
+    if (prefix.size() >= 2 && prefix[1] == '0' && prefix[0] == '/')
+        ids.push_back(stubs::symbol_namespace::symbol_namespace_locality(prefix));
+    else
+        ids = detail::find_all_symbol_namespace_services();
+
+    symbol_namespace_service_action act;
+    return lcos::broadcast(act, ids, req).then(
+        util::one_shot(&detail::merge_found_symbols));
+} // }}}
+
 void addressing_service::insert_cache_entry(
     naming::gid_type const& gid
   , gva const& g
@@ -2363,8 +2626,7 @@ void addressing_service::insert_cache_entry(
     }
 
     // don't look at the cache if the id is locally managed
-    if (naming::get_locality_id_from_gid(gid) ==
-        naming::get_locality_id_from_gid(locality_))
+    if (is_managed_locally(gid))
     {
         if (&ec != &throws)
             ec = make_success_code();
@@ -2373,7 +2635,7 @@ void addressing_service::insert_cache_entry(
 
     try {
         // The entry in AGAS for a locality's RTS component has a count of 0,
-        // so we convert it to 1 here so that the cache doesn't break.
+        // the cache treats it as a single id.
         const boost::uint64_t count = (g.count ? g.count : 1);
 
         LAGAS_(debug) <<
@@ -2381,22 +2643,17 @@ void addressing_service::insert_cache_entry(
             "addressing_service::insert_cache_entry, gid(%1%), count(%2%)")
             % gid % count);
 
-        boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-
-        const gva_cache_key key(gid, count);
-
-        if (!gva_cache_->insert(key, g))
+        if (!gva_cache_->insert(gid, g))
         {
             // Figure out who we collided with.
-            gva_cache_key idbase;
-            gva_cache_type::entry_type e;
+            naming::gid_type idbase;
+            gva e;
 
-            if (!gva_cache_->get_entry(key, idbase, e))
+            if (!gva_cache_->get_entry(gid, idbase, e))
             {
-                // This is impossible under sane conditions.
-                HPX_THROWS_IF(ec, invalid_data
-                  , "addressing_service::insert_cache_entry"
-                  , "data corruption or lock error occurred in cache");
+                // The colliding entry was evicted concurrently.
+                if (&ec != &throws)
+                    ec = make_success_code();
                 return;
             }
 
@@ -2405,7 +2662,7 @@ void addressing_service::insert_cache_entry(
                     "addressing_service::insert_cache_entry, "
                     "aborting insert due to key collision in cache, "
                     "new_gid(%1%), new_count(%2%), old_gid(%3%), old_count(%4%)"
-                ) % gid % count % idbase.get_gid() % idbase.get_count());
+                ) % gid % count % idbase % e.count);
         }
 
         if (&ec != &throws)
@@ -2416,17 +2673,6 @@ void addressing_service::insert_cache_entry(
     }
 } // }}}
 
-// This function has to return false if the key is already in the cache (true
-// means go ahead with the cache update).
-bool check_for_collisions(
-    addressing_service::gva_cache_key const& new_key
-  , addressing_service::gva_cache_key const& old_key
-    )
-{
-    return (new_key.get_gid() != old_key.get_gid())
-        || (new_key.get_count() != old_key.get_count());
-}
-
 void addressing_service::update_cache_entry(
     naming::gid_type const& gid
   , gva const& g
@@ -2450,8 +2696,7 @@ void addressing_service::update_cache_entry(
     }
 
     // don't look at the cache if the id is locally managed
-    if (naming::get_locality_id_from_gid(gid) ==
-        naming::get_locality_id_from_gid(locality_))
+    if (is_managed_locally(gid))
     {
         if (&ec != &throws)
             ec = make_success_code();
@@ -2460,7 +2705,7 @@ void addressing_service::update_cache_entry(
 
     try {
         // The entry in AGAS for a locality's RTS component has a count of 0,
-        // so we convert it to 1 here so that the cache doesn't break.
+        // the cache treats it as a single id.
         const boost::uint64_t count = (g.count ? g.count : 1);
 
         LAGAS_(debug) <<
@@ -2468,41 +2713,56 @@ void addressing_service::update_cache_entry(
             "addressing_service::update_cache_entry, gid(%1%), count(%2%)"
             ) % gid % count);
 
-        boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
+        gva_cache_->update(gid, g);
 
-        const gva_cache_key key(gid, count);
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::update_cache_entry");
+    }
+} // }}}
 
-        if (!gva_cache_->update_if(key, g, check_for_collisions))
-        {
-            if (LAGAS_ENABLED(warning))
-            {
-                // Figure out who we collided with.
-                gva_cache_key idbase;
-                gva_cache_type::entry_type e;
+void addressing_service::update_cache_entries(
+    std::vector<gva_cache_type::entry_type> const& entries
+  , error_code& ec
+    )
+{ // {{{
+    if (!caching_)
+    {
+        // If caching is disabled, we silently pretend success.
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
 
-                if (!gva_cache_->get_entry(key, idbase, e))
-                {
-                    // This is impossible under sane conditions.
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "addressing_service::update_cache_entry"
-                      , "data corruption or lock error occurred in cache");
-                    return;
-                }
+    try {
+        LAGAS_(debug) <<
+            ( boost::format(
+            "addressing_service::update_cache_entries, count(%1%)"
+            ) % entries.size());
 
-                LAGAS_(warning) <<
-                    ( boost::format(
-                        "addressing_service::update_cache_entry, "
-                        "aborting update due to key collision in cache, "
-                        "new_gid(%1%), new_count(%2%), old_gid(%3%), old_count(%4%)"
-                    ) % gid % count % idbase.get_gid() % idbase.get_count());
+        // don't put entries into the cache which are marked as non-cache-able
+        // or are locally managed
+        std::vector<gva_cache_type::entry_type> cacheable;
+        cacheable.reserve(entries.size());
+
+        for (gva_cache_type::entry_type const& e : entries)
+        {
+            if (naming::detail::store_in_cache(e.first) &&
+                !is_managed_locally(e.first))
+            {
+                cacheable.push_back(e);
             }
         }
 
+        gva_cache_->update(cacheable);
+
         if (&ec != &throws)
             ec = make_success_code();
     }
     catch (hpx::exception const& e) {
-        HPX_RETHROWS_IF(ec, e, "addressing_service::update_cache_entry");
+        HPX_RETHROWS_IF(ec, e, "addressing_service::update_cache_entries");
     }
 } // }}}
 
@@ -2521,8 +2781,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2555,8 +2813,7 @@ void addressing_service::remove_cache_entry(
     }
 
     // don't look at the cache if the id is locally managed
-    if (naming::get_locality_id_from_gid(gid) ==
-        naming::get_locality_id_from_gid(locality_))
+    if (is_managed_locally(gid))
     {
         if (&ec != &throws)
             ec = make_success_code();
@@ -2566,13 +2823,7 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva_entry_type> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+        gva_cache_->erase(gid);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2585,6 +2836,8 @@ void addressing_service::remove_cache_entry(
 // Disable refcnt caching during shutdown
 void addressing_service::start_shutdown(error_code& ec)
 {
+    refcnt_flush_timer_.stop();
+
     // If caching is disabled, we silently pretend success.
     if (!caching_)
         return;
@@ -2752,75 +3005,98 @@ bool addressing_service::retrieve_statistics_counter(
 // Helper functions to access the current cache statistics
 boost::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return gva_cache_->get_statistics(gva_cache_type::num_hits, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return gva_cache_->get_statistics(gva_cache_type::num_misses, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return gva_cache_->get_statistics(gva_cache_type::num_evictions, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return gva_cache_->get_statistics(gva_cache_type::num_insertions, reset);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 boost::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return gva_cache_->get_statistics(gva_cache_type::get_entry_count, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_insert_entry_count(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return gva_cache_->get_statistics(
+        gva_cache_type::insert_entry_count, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return gva_cache_->get_statistics(
+        gva_cache_type::update_entry_count, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return gva_cache_->get_statistics(gva_cache_type::erase_entry_count, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return gva_cache_->get_statistics(gva_cache_type::get_entry_time, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_insert_entry_time(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return gva_cache_->get_statistics(gva_cache_type::insert_entry_time, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return gva_cache_->get_statistics(gva_cache_type::update_entry_time, reset);
 }
 
 boost::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return gva_cache_->get_statistics(gva_cache_type::erase_entry_time, reset);
+}
+
+boost::int64_t addressing_service::get_refcnt_requests(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_received_, reset);
+}
+
+boost::int64_t addressing_service::get_refcnt_requests_saved(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_saved_, reset);
+}
+
+boost::int64_t addressing_service::get_refcnt_messages(bool reset)
+{
+    return util::get_and_reset_value(refcnt_messages_sent_, reset);
+}
+
+boost::int64_t addressing_service::get_migrated_objects_count(bool reset)
+{
+    return reinterpret_cast<server::primary_namespace*>(get_primary_ns_lva())->
+        get_migrated_objects_count(reset);
+}
+
+boost::int64_t addressing_service::get_migration_time(bool reset)
+{
+    return reinterpret_cast<server::primary_namespace*>(get_primary_ns_lva())->
+        get_migration_time(reset);
+}
+
+boost::int64_t addressing_service::get_stalled_parcels_count(bool reset)
+{
+    return reinterpret_cast<server::primary_namespace*>(get_primary_ns_lva())->
+        get_stalled_parcels_count(reset);
 }
 
 /// Install performance counter types exposing properties from the local cache.
@@ -2854,6 +3130,20 @@ void addressing_service::register_counter_types()
     util::function_nonser<boost::int64_t(bool)> cache_erase_entry_time(
         boost::bind(&addressing_service::get_cache_erase_entry_time, this, ::_1));
 
+    util::function_nonser<boost::int64_t(bool)> refcnt_requests(
+        boost::bind(&addressing_service::get_refcnt_requests, this, ::_1));
+    util::function_nonser<boost::int64_t(bool)> refcnt_requests_saved(
+        boost::bind(&addressing_service::get_refcnt_requests_saved, this, ::_1));
+    util::function_nonser<boost::int64_t(bool)> refcnt_messages(
+        boost::bind(&addressing_service::get_refcnt_messages, this, ::_1));
+
+    util::function_nonser<boost::int64_t(bool)> migrated_objects(
+        boost::bind(&addressing_service::get_migrated_objects_count, this, ::_1));
+    util::function_nonser<boost::int64_t(bool)> migration_time(
+        boost::bind(&addressing_service::get_migration_time, this, ::_1));
+    util::function_nonser<boost::int64_t(bool)> stalled_parcels(
+        boost::bind(&addressing_service::get_stalled_parcels_count, this, ::_1));
+
     performance_counters::generic_counter_type_data const counter_types[] =
     {
         { "/agas/count/cache/hits", performance_counters::counter_raw,
@@ -2961,6 +3251,65 @@ void addressing_service::register_counter_types()
               _1, cache_erase_entry_time, _2),
           &performance_counters::locality_counter_discoverer,
           "ns"
+        },
+
+        { "/agas/count/refcnt/requests", performance_counters::counter_raw,
+          "returns the number of requests to increment or decrement global "
+                "reference counts issued by this locality",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt/saved", performance_counters::counter_raw,
+          "returns the number of requests to increment or decrement global "
+                "reference counts which were not sent to AGAS because they "
+                "were combined with other requests for the same global id",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_saved, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt/messages", performance_counters::counter_raw,
+          "returns the number of messages sent to AGAS for incrementing or "
+                "decrementing global reference counts",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_messages, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+
+        { "/agas/count/migration/objects", performance_counters::counter_raw,
+          "returns the number of objects whose migration was completed by "
+                "the primary namespace instance hosted on this locality",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, migrated_objects, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/time/migration/objects", performance_counters::counter_raw,
+          "returns the overall time the objects counted by "
+                "/agas/count/migration/objects were being migrated",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, migration_time, _2),
+          &performance_counters::locality_counter_discoverer,
+          "ns"
+        },
+        { "/agas/count/migration/stalled_parcels",
+          performance_counters::counter_raw,
+          "returns the number of parcels which were held back by the primary "
+                "namespace instance hosted on this locality because their "
+                "destination was being migrated",
+          HPX_PERFORMANCE_COUNTER_V1,
+          boost::bind(&performance_counters::locality_raw_counter_creator,
+              _1, stalled_parcels, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
         }
     };
     performance_counters::install_counter_types(
@@ -3007,6 +3356,7 @@ void addressing_service::garbage_collect(
 
 void addressing_service::send_refcnt_requests(
     boost::unique_lock<addressing_service::mutex_type>& l
+  , boost::uint32_t destination
   , error_code& ec
     )
 {
@@ -3018,17 +3368,44 @@ void addressing_service::send_refcnt_requests(
         return;
     }
 
-    if (!enable_refcnt_caching_ || max_refcnt_requests_ == ++refcnt_requests_count_)
+    if (!enable_refcnt_caching_)
+    {
         send_refcnt_requests_non_blocking(l, ec);
-
+    }
+    else if ((*refcnt_requests_)[destination].size() >= max_refcnt_requests_)
+    {
+        send_refcnt_requests_non_blocking(l, destination, ec);
+    }
     else if (&ec != &throws)
+    {
         ec = make_success_code();
+    }
+}
+
+bool addressing_service::flush_refcnt_requests()
+{
+    boost::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+
+    error_code ec(lightweight);
+    send_refcnt_requests_non_blocking(l, ec);
+
+    if (!l.owns_lock())
+        l.lock();
+
+    // Stop the timer if no requests are pending anymore, it is restarted
+    // once the next request is cached. This is done while holding the lock
+    // to not miss any request cached concurrently. Note that returning false
+    // instead would terminate the timer for good.
+    if (refcnt_requests_count_ == 0)
+        refcnt_flush_timer_.stop();
+
+    return true;
 }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         boost::unique_lock<addressing_service::mutex_type>& l
-      , addressing_service::refcnt_requests_type const& requests
+      , addressing_service::refcnt_destinations_type const& requests
       , const char* func_name
         )
     {
@@ -3036,26 +3413,61 @@ void addressing_service::send_refcnt_requests(
 
         std::stringstream ss;
         ss << ( boost::format(
-              "%1%, dumping client-side refcnt table, requests(%2%):")
+              "%1%, dumping client-side refcnt table, destinations(%2%):")
               % func_name % requests.size());
 
+        typedef addressing_service::refcnt_destinations_type::const_reference
+            destination_reference;
         typedef addressing_service::refcnt_requests_type::const_reference
             const_reference;
 
-        for (const_reference e : requests)
+        for (destination_reference d : requests)
         {
-            // The [client] tag is in there to make it easier to filter
-            // through the logs.
-            ss << ( boost::format(
-                  "\n  [client] gid(%1%), credits(%2%)")
-                  % e.first
-                  % e.second);
+            for (const_reference e : d.second)
+            {
+                // The [client] tag is in there to make it easier to filter
+                // through the logs.
+                ss << ( boost::format(
+                      "\n  [client] locality(%1%), gid(%2%), credits(%3%)")
+                      % d.first
+                      % e.first
+                      % e.second);
+            }
         }
 
         LAGAS_(debug) << ss.str();
     }
 #endif
 
+void addressing_service::send_refcnt_requests_non_blocking(
+    refcnt_requests_type const& requests
+    )
+{
+    if (requests.empty())
+        return;
+
+    // all requests are handled by the same primary namespace instance
+    naming::id_type target(
+        stubs::primary_namespace::get_service_instance(requests.begin()->first)
+      , naming::id_type::unmanaged);
+
+    std::vector<request> reqs;
+    reqs.reserve(requests.size());
+
+    for (refcnt_requests_type::const_reference e : requests)
+    {
+        HPX_ASSERT(e.second < 0);
+
+        naming::gid_type raw(e.first);
+        reqs.push_back(
+            request(primary_ns_decrement_credit, raw, raw, e.second));
+    }
+
+    ++refcnt_messages_sent_;
+    stubs::primary_namespace::bulk_service_non_blocking(
+        target, reqs, action_priority_);
+}
+
 void addressing_service::send_refcnt_requests_non_blocking(
     boost::unique_lock<addressing_service::mutex_type>& l
   , error_code& ec
@@ -3064,13 +3476,14 @@ void addressing_service::send_refcnt_requests_non_blocking(
     HPX_ASSERT(l.owns_lock());
 
     try {
-        if (refcnt_requests_->empty())
+        if (0 == refcnt_requests_count_)
         {
             l.unlock();
             return;
         }
 
-        boost::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
+        boost::shared_ptr<refcnt_destinations_type> p(
+            new refcnt_destinations_type);
 
         p.swap(refcnt_requests_);
         refcnt_requests_count_ = 0;
@@ -3079,7 +3492,7 @@ void addressing_service::send_refcnt_requests_non_blocking(
 
         LAGAS_(info) << (boost::format(
             "addressing_service::send_refcnt_requests_non_blocking, "
-            "requests(%1%)")
+            "destinations(%1%)")
             % p->size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
@@ -3088,31 +3501,42 @@ void addressing_service::send_refcnt_requests_non_blocking(
                 "addressing_service::send_refcnt_requests_non_blocking");
 #endif
 
-        // collect all requests for each locality
-        typedef std::map<naming::id_type, std::vector<request> > requests_type;
-        requests_type requests;
-
-        for (refcnt_requests_type::const_reference e : *p)
+        // send requests to all localities
+        for (refcnt_destinations_type::const_reference d : *p)
         {
-            HPX_ASSERT(e.second < 0);
+            send_refcnt_requests_non_blocking(d.second);
+        }
 
-            naming::gid_type raw(e.first);
-            request const req(primary_ns_decrement_credit, raw, raw, e.second);
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e,
+            "addressing_service::send_refcnt_requests_non_blocking");
+    }
+}
 
-            naming::id_type target(
-                stubs::primary_namespace::get_service_instance(raw)
-              , naming::id_type::unmanaged);
+void addressing_service::send_refcnt_requests_non_blocking(
+    boost::unique_lock<addressing_service::mutex_type>& l
+  , boost::uint32_t destination
+  , error_code& ec
+    )
+{
+    HPX_ASSERT(l.owns_lock());
 
-            requests[target].push_back(req);
-        }
+    try {
+        refcnt_requests_type requests;
+        (*refcnt_requests_)[destination].swap(requests);
+        refcnt_requests_count_ -= requests.size();
 
-        // send requests to all locality
-        requests_type::const_iterator end = requests.end();
-        for (requests_type::const_iterator it = requests.begin(); it != end; ++it)
-        {
-            stubs::primary_namespace::bulk_service_non_blocking(
-                (*it).first, (*it).second, action_priority_);
-        }
+        l.unlock();
+
+        LAGAS_(info) << (boost::format(
+            "addressing_service::send_refcnt_requests_non_blocking, "
+            "locality(%1%), requests(%2%)")
+            % destination % requests.size());
+
+        send_refcnt_requests_non_blocking(requests);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -3130,13 +3554,14 @@ addressing_service::send_refcnt_requests_async(
 {
     HPX_ASSERT(l.owns_lock());
 
-    if (refcnt_requests_->empty())
+    if (0 == refcnt_requests_count_)
     {
         l.unlock();
         return std::vector<hpx::future<std::vector<response> > >();
     }
 
-    boost::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
+    boost::shared_ptr<refcnt_destinations_type> p(
+        new refcnt_destinations_type);
 
     p.swap(refcnt_requests_);
     refcnt_requests_count_ = 0;
@@ -3145,7 +3570,7 @@ addressing_service::send_refcnt_requests_async(
 
     LAGAS_(info) << (boost::format(
         "addressing_service::send_refcnt_requests_async, "
-        "requests(%1%)")
+        "destinations(%1%)")
         % p->size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
@@ -3154,32 +3579,34 @@ addressing_service::send_refcnt_requests_async(
             "addressing_service::send_refcnt_requests_sync");
 #endif
 
-    // collect all requests for each locality
-    typedef std::map<naming::id_type, std::vector<request> > requests_type;
-    requests_type requests;
-
+    // send requests to all localities
     std::vector<hpx::future<std::vector<response> > > lazy_results;
-    for (refcnt_requests_type::const_reference e : *p)
+    for (refcnt_destinations_type::const_reference d : *p)
     {
-        HPX_ASSERT(e.second < 0);
-
-        naming::gid_type raw(e.first);
-        request const req(primary_ns_decrement_credit, raw, raw, e.second);
+        if (d.second.empty())
+            continue;
 
         naming::id_type target(
-            stubs::primary_namespace::get_service_instance(raw)
+            stubs::primary_namespace::get_service_instance(
+                d.second.begin()->first)
           , naming::id_type::unmanaged);
 
-        requests[target].push_back(req);
-    }
+        std::vector<request> reqs;
+        reqs.reserve(d.second.size());
 
-    // send requests to all locality
-    requests_type::const_iterator end = requests.end();
-    for (requests_type::const_iterator it = requests.begin(); it != end; ++it)
-    {
+        for (refcnt_requests_type::const_reference e : d.second)
+        {
+            HPX_ASSERT(e.second < 0);
+
+            naming::gid_type raw(e.first);
+            reqs.push_back(
+                request(primary_ns_decrement_credit, raw, raw, e.second));
+        }
+
+        ++refcnt_messages_sent_;
         lazy_results.push_back(
             stubs::primary_namespace::bulk_service_async(
-                (*it).first, (*it).second, action_priority_));
+                target, reqs, action_priority_));
     }
 
     return lazy_results;
@@ -3238,10 +3665,15 @@ addressing_service::begin_migration_async(
 
     // insert the object's new locality into the map of migrated objects
     {
-        boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
+        boost::lock_guard<cache_mutex_type> lock(migrated_objects_mtx_);
         migrated_objects_table_.insert(gid);
+        num_migrated_objects_.store(migrated_objects_table_.size(),
+            boost::memory_order_relaxed);
     }
 
+    // the object is from now on resolved through the primary namespace only
+    local_address_table_.erase(gid);
+
     agas::request req(agas::primary_ns_begin_migration, gid);
     naming::id_type service_target(
         agas::stubs::primary_namespace::get_service_instance(gid)
@@ -3273,6 +3705,165 @@ hpx::future<bool> addressing_service::end_migration_async(
         service_target, req);
 }
 
+namespace detail
+{
+    typedef std::map<naming::gid_type, std::vector<std::size_t> >
+        primary_namespace_groups_type;
+
+    // group the given ids by the primary namespace instance managing them
+    primary_namespace_groups_type group_by_primary_namespace(
+        std::vector<naming::id_type> const& ids)
+    {
+        primary_namespace_groups_type groups;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            groups[stubs::primary_namespace::get_service_instance(
+                ids[i].get_gid())].push_back(i);
+        }
+        return groups;
+    }
+
+    typedef std::vector<lcos::future<std::vector<response> > >
+        bulk_responses_type;
+
+    lcos::future<bulk_responses_type> bulk_service_migration(
+        std::vector<naming::id_type> const& ids
+      , namespace_action_code code
+      , primary_namespace_groups_type const& groups
+        )
+    {
+        bulk_responses_type futures;
+        futures.reserve(groups.size());
+
+        for (primary_namespace_groups_type::value_type const& g : groups)
+        {
+            std::vector<request> reqs;
+            reqs.reserve(g.second.size());
+
+            for (std::size_t i : g.second)
+                reqs.push_back(request(code, ids[i].get_gid()));
+
+            futures.push_back(stubs::primary_namespace::bulk_service_async(
+                naming::id_type(g.first, naming::id_type::unmanaged), reqs));
+        }
+
+        return lcos::when_all(futures);
+    }
+
+    std::vector<std::pair<naming::id_type, naming::address> >
+    begin_migration_postproc(
+        lcos::future<bulk_responses_type> f
+      , primary_namespace_groups_type const& groups
+      , std::size_t count
+        )
+    {
+        typedef std::pair<naming::id_type, naming::address> result_type;
+        std::vector<result_type> result(count);
+
+        bulk_responses_type futures = f.get();
+
+        std::size_t k = 0;
+        for (primary_namespace_groups_type::value_type const& g : groups)
+        {
+            // rethrow errors
+            std::vector<response> reps = futures[k++].get();
+            HPX_ASSERT(reps.size() == g.second.size());
+
+            for (std::size_t j = 0; j != reps.size(); ++j)
+            {
+                result[g.second[j]] =
+                    traits::get_remote_result<result_type, response>::call(
+                        reps[j]);
+            }
+        }
+        return result;
+    }
+
+    bool end_migration_postproc(lcos::future<bulk_responses_type> f)
+    {
+        bool result = true;
+        for (lcos::future<std::vector<response> >& rf : f.get())
+        {
+            // rethrow errors
+            for (response const& rep : rf.get())
+            {
+                if (!traits::get_remote_result<bool, response>::call(rep))
+                    result = false;
+            }
+        }
+        return result;
+    }
+}
+
+hpx::future<std::vector<std::pair<naming::id_type, naming::address> > >
+addressing_service::begin_migration_async(
+    std::vector<naming::id_type> const& ids
+  , naming::id_type const& target_locality
+    )
+{
+    typedef std::vector<std::pair<naming::id_type, naming::address> >
+        result_type;
+
+    for (naming::id_type const& id : ids)
+    {
+        if (!id)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::begin_migration_async",
+                "invalid reference id");
+            return make_ready_future(result_type());
+        }
+    }
+
+    // insert the objects into the map of migrated objects
+    {
+        boost::lock_guard<cache_mutex_type> lock(migrated_objects_mtx_);
+        for (naming::id_type const& id : ids)
+            migrated_objects_table_.insert(id.get_gid());
+        num_migrated_objects_.store(migrated_objects_table_.size(),
+            boost::memory_order_relaxed);
+    }
+
+    // the objects are from now on resolved through the primary namespace only
+    for (naming::id_type const& id : ids)
+        local_address_table_.erase(id.get_gid());
+
+    // one request is sent to each of the involved primary namespace instances
+    detail::primary_namespace_groups_type groups =
+        detail::group_by_primary_namespace(ids);
+
+    lcos::future<detail::bulk_responses_type> f =
+        detail::bulk_service_migration(ids, primary_ns_begin_migration, groups);
+
+    using util::placeholders::_1;
+    return f.then(util::bind(
+            util::one_shot(&detail::begin_migration_postproc),
+            _1, std::move(groups), ids.size()
+        ));
+}
+
+hpx::future<bool> addressing_service::end_migration_async(
+    std::vector<naming::id_type> const& ids
+    )
+{
+    for (naming::id_type const& id : ids)
+    {
+        if (!id)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::end_migration_async",
+                "invalid reference id");
+            return make_ready_future(false);
+        }
+    }
+
+    lcos::future<detail::bulk_responses_type> f =
+        detail::bulk_service_migration(ids, primary_ns_end_migration,
+            detail::group_by_primary_namespace(ids));
+
+    return f.then(&detail::end_migration_postproc);
+}
+
 bool addressing_service::was_object_migrated_locked(
     naming::gid_type const& id
     )
@@ -3289,7 +3880,10 @@ bool addressing_service::was_object_migrated(
 #if !defined(HPX_SUPPORT_MULTIPLE_PARCEL_DESTINATIONS)
     HPX_ASSERT(1 == size);
 
-    boost::lock_guard<cache_mutex_type> lock(gva_cache_mtx_);
+    if (num_migrated_objects_.load(boost::memory_order_relaxed) == 0)
+        return false;
+
+    boost::lock_guard<cache_mutex_type> lock(migrated_objects_mtx_);
     return was_object_migrated_locked(ids[0].get_gid());
 #else
     // #FIXME: it's not really clear how to handle this situation
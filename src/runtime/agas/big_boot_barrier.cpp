@@ -268,6 +268,7 @@ struct notification_header
     boost::uint32_t used_cores;
     parcelset::endpoints_type agas_endpoints;
     detail::assigned_id_sequence ids;
+    parcelset::locality dest;       // locality this notification is sent to
 
 #if defined(HPX_HAVE_SECURITY)
     components::security::signed_certificate root_certificate;
@@ -286,6 +287,7 @@ struct notification_header
         ar & used_cores;
         ar & agas_endpoints;
         ar & ids;
+        ar & dest;
 #if defined(HPX_HAVE_SECURITY)
         ar & root_certificate;
 #endif
@@ -294,7 +296,8 @@ struct notification_header
 
 // {{{ early action forwards
 void register_worker(registration_header const& header);
-void notify_worker(notification_header const& header);
+void notify_worker(notification_header const& header,
+    std::vector<notification_header> const& subtree);
 // }}}
 
 // {{{ early action types
@@ -304,7 +307,8 @@ typedef actions::action<
 > register_worker_action;
 
 typedef actions::action<
-    void (*)(notification_header const&)
+    void (*)(notification_header const&,
+        std::vector<notification_header> const&)
   , notify_worker
 > notify_worker_action;
 // }}}
@@ -412,13 +416,46 @@ HPX_REGISTER_ACTION_ID(notify_worker_security_action,
 namespace hpx { namespace agas
 {
 
+// Send the given notifications along a tree: the notifications are split
+// into (at most) 'fanout' consecutive chunks, the first locality of each chunk
+// is responsible for forwarding the remaining notifications of its chunk.
+void send_notifications(
+    big_boot_barrier& bbb
+  , boost::uint32_t source_locality_id
+  , std::vector<notification_header>::const_iterator first
+  , std::vector<notification_header>::const_iterator last
+    )
+{
+    std::size_t const count = static_cast<std::size_t>(last - first);
+    if (count == 0)
+        return;
+
+    std::size_t const fanout = bbb.get_fanout();
+    std::size_t const chunks =
+        (fanout == 0 || fanout > count) ? count : fanout;
+    std::size_t const chunk_size = count / chunks;
+    std::size_t const remainder = count % chunks;
+
+    for (std::size_t i = 0; i != chunks; ++i)
+    {
+        std::vector<notification_header>::const_iterator end =
+            first + (chunk_size + (i < remainder ? 1 : 0));
+
+        bbb.apply(
+            source_locality_id
+          , naming::get_locality_id_from_gid(first->prefix)
+          , first->dest
+          , notify_worker_action()
+          , *first
+          , std::vector<notification_header>(first + 1, end));
+
+        first = end;
+    }
+}
+
 // remote call to AGAS
 void register_worker(registration_header const& header)
 {
-    // This lock acquires the bbb mutex on creation. When it goes out of scope,
-    // its dtor calls big_boot_barrier::notify().
-    big_boot_barrier::scoped_lock lock(get_big_boot_barrier());
-
     runtime& rt = get_runtime();
     naming::resolver_client& agas_client = rt.get_agas_client();
 
@@ -493,6 +530,11 @@ void register_worker(registration_header const& header)
 
     big_boot_barrier & bbb = get_big_boot_barrier();
 
+    // Registrations of different localities are handled concurrently up to
+    // this point. This lock acquires the bbb mutex on creation. When it goes
+    // out of scope, its dtor calls big_boot_barrier::notify().
+    big_boot_barrier::scoped_lock lock(bbb);
+
     // register all ids
     detail::assigned_id_sequence assigned_ids(header.typenames);
 
@@ -525,13 +567,12 @@ void register_worker(registration_header const& header)
     }
 #endif
 
-    parcelset::locality dest;
     parcelset::locality here = bbb.here();
     for (parcelset::endpoints_type::value_type const & loc : header.endpoints)
     {
         if(loc.second.type() == here.type())
         {
-            dest = loc.second;
+            hdr.dest = loc.second;
             break;
         }
     }
@@ -542,12 +583,14 @@ void register_worker(registration_header const& header)
     {
         // We can just send the parcel now, the connecting locality isn't a part
         // of startup synchronization.
-        get_big_boot_barrier().apply_late(
+        parcelset::locality dest = hdr.dest;
+        bbb.apply_late(
             0
           , naming::get_locality_id_from_gid(prefix)
           , dest
           , notify_worker_action()
-          , std::move(hdr));
+          , std::move(hdr)
+          , std::vector<notification_header>());
     }
 
     else
@@ -556,38 +599,24 @@ void register_worker(registration_header const& header)
         // synchronization.
 #if defined(HPX_HAVE_SECURITY)
         // send response directly to initiate second round trip
-        get_big_boot_barrier().apply(
+        parcelset::locality dest = hdr.dest;
+        bbb.apply(
             0
           , naming::get_locality_id_from_gid(prefix)
           , dest
           , notify_worker_action()
-          , std::move(hdr));
+          , std::move(hdr)
+          , std::vector<notification_header>());
 #else
         // delay the final response until the runtime system is up and running
-        void (big_boot_barrier::*f)(
-            boost::uint32_t,
-            boost::uint32_t,
-            parcelset::locality const&,
-            notify_worker_action,
-            notification_header&&)
-            = &big_boot_barrier::apply<notify_worker_action, notification_header&&>;
-        util::unique_function_nonser<void()>* thunk
-            = new util::unique_function_nonser<void()>(
-            util::bind(
-                util::one_shot(f)
-              , boost::ref(get_big_boot_barrier())
-              , 0
-              , naming::get_locality_id_from_gid(prefix)
-              , dest
-              , notify_worker_action()
-              , std::move(hdr)));
-        get_big_boot_barrier().add_thunk(thunk);
+        bbb.add_notification(std::move(hdr));
 #endif
     }
 }
 
 // AGAS callback to client (first round trip response)
-void notify_worker(notification_header const& header)
+void notify_worker(notification_header const& header,
+    std::vector<notification_header> const& subtree)
 {
     // This lock acquires the bbb mutex on creation. When it goes out of scope,
     // it's dtor calls big_boot_barrier::notify().
@@ -675,6 +704,11 @@ void notify_worker(notification_header const& header)
     cfg.set_first_used_core(header.used_cores);
     rt.assign_cores();
 
+    // forward the notifications of the localities in our subtree
+    send_notifications(get_big_boot_barrier()
+      , naming::get_locality_id_from_gid(header.prefix)
+      , subtree.begin(), subtree.end());
+
 #if defined(HPX_HAVE_SECURITY)
     // initialize certificate store
     rt.store_root_certificate(header.root_certificate);
@@ -836,18 +870,32 @@ big_boot_barrier::big_boot_barrier(
   , mtx()
   , connected(get_number_of_bootstrap_connections(ini_))
   , thunks(32)
+  , notifications(new std::vector<notification_header>)
+  , fanout(ini_.get_agas_bootstrap_fanout())
 {
     // register all not registered typenames
     if (service_type == service_mode_bootstrap)
         detail::register_unassigned_typenames();
 }
 
+big_boot_barrier::~big_boot_barrier()
+{
+    util::unique_function_nonser<void()>* f;
+    while (thunks.pop(f))
+        delete f;
+}
+
 void big_boot_barrier::wait_bootstrap()
 { // {{{
     HPX_ASSERT(service_mode_bootstrap == service_type);
 
+    boost::uint64_t start = util::high_resolution_clock::now();
+
     // the root just waits until all localities have connected
     spin();
+
+    get_runtime().set_startup_time(runtime::startup_phase_bootstrap,
+        util::high_resolution_clock::now() - start);
 } // }}}
 
 namespace detail
@@ -912,7 +960,9 @@ void big_boot_barrier::wait_hosted(
         , unassigned
         , suggested_prefix);
 
-    std::srand(static_cast<unsigned>(util::high_resolution_clock::now()));
+    boost::uint64_t start = util::high_resolution_clock::now();
+
+    std::srand(static_cast<unsigned>(start));
     apply(
           static_cast<boost::uint32_t>(std::rand()) // random first parcel id
         , 0
@@ -922,8 +972,17 @@ void big_boot_barrier::wait_hosted(
 
     // wait for registration to be complete
     spin();
+
+    rt.set_startup_time(runtime::startup_phase_bootstrap,
+        util::high_resolution_clock::now() - start);
 } // }}}
 
+void big_boot_barrier::add_notification(notification_header && hdr)
+{
+    // the bbb mutex is held by the caller (see big_boot_barrier::scoped_lock)
+    notifications->push_back(std::move(hdr));
+}
+
 void big_boot_barrier::notify()
 {
     boost::lock_guard<boost::mutex> lk(mtx, boost::adopt_lock);
@@ -938,6 +997,15 @@ void big_boot_barrier::trigger()
 {
     if (service_mode_bootstrap == service_type)
     {
+        std::vector<notification_header> headers;
+        {
+            boost::lock_guard<boost::mutex> l(mtx);
+            std::swap(headers, *notifications);
+        }
+
+        // notify the localities along a tree rooted at this locality
+        send_notifications(*this, 0, headers.begin(), headers.end());
+
         util::unique_function_nonser<void()>* p;
 
         while (thunks.pop(p))
@@ -0,0 +1,703 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/thread/locks.hpp>
+
+#include <algorithm>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Updates the call count and the time spent in an API function on exit.
+    class gva_cache::update_on_exit
+    {
+    public:
+        update_on_exit(shard& sh, statistics_type count, statistics_type time,
+                boost::int64_t num_calls = 1)
+          : sh_(sh), count_(count), time_(time), num_calls_(num_calls),
+            started_at_(util::high_resolution_clock::now())
+        {}
+
+        ~update_on_exit()
+        {
+            sh_.statistics_[time_].fetch_add(boost::int64_t(
+                util::high_resolution_clock::now() - started_at_),
+                boost::memory_order_relaxed);
+            sh_.statistics_[count_].fetch_add(num_calls_,
+                boost::memory_order_relaxed);
+        }
+
+    private:
+        shard& sh_;
+        statistics_type count_;
+        statistics_type time_;
+        boost::int64_t num_calls_;
+        boost::uint64_t started_at_;
+    };
+
+    // Marks a set as being modified for the lifetime of the object, the
+    // shard the set belongs to has to be locked.
+    class gva_cache::set_write_lock
+    {
+    public:
+        explicit set_write_lock(set& s)
+          : s_(s)
+        {
+            boost::uint64_t sequence =
+                s_.sequence_.load(boost::memory_order_relaxed);
+            HPX_ASSERT((sequence & 1) == 0);
+            s_.sequence_.store(sequence + 1, boost::memory_order_relaxed);
+
+            // the modifications must not become visible before the sequence
+            boost::atomic_thread_fence(boost::memory_order_release);
+        }
+
+        ~set_write_lock()
+        {
+            s_.sequence_.fetch_add(1, boost::memory_order_release);
+        }
+
+    private:
+        set& s_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        // Fibonacci hashing, consecutive ids end up in different sets
+        inline boost::uint64_t hash(boost::uint64_t msb, boost::uint64_t lsb)
+        {
+            return ((msb * 0xC2B2AE3D27D4EB4Full) ^ lsb) *
+                0x9E3779B97F4A7C15ull;
+        }
+
+        // the sets selected by the buckets of a range should not coincide
+        // with the ones selected by the ids of single objects
+        const boost::uint64_t bucket_seed = 0x5851F42D4C957F2Dull;
+
+        inline boost::uint64_t get_range_count(gva const& g)
+        {
+            // The entry in AGAS for a locality's RTS component has a count of
+            // 0, it is cached as a range of a single id.
+            return g.count ? g.count : 1;
+        }
+    }
+
+    gva_cache::table::table(std::size_t num_sets)
+      : num_sets_(num_sets), shift_(64), sets_(new set[num_sets]),
+        num_range_slots_(0)
+    {
+        HPX_ASSERT(num_sets >= num_shards);
+        HPX_ASSERT((num_sets & (num_sets - 1)) == 0);
+
+        for (std::size_t n = num_sets; n > 1; n >>= 1)
+            --shift_;
+    }
+
+    std::size_t gva_cache::table::get_set(naming::gid_type const& id) const
+    {
+        return static_cast<std::size_t>(
+            hash(id.get_msb(), id.get_lsb()) >> shift_);
+    }
+
+    std::size_t gva_cache::table::get_bucket_set(boost::uint64_t msb,
+        boost::uint64_t bucket) const
+    {
+        return static_cast<std::size_t>(
+            hash(msb ^ bucket_seed, bucket) >> shift_);
+    }
+
+    gva_cache::shard::shard()
+    {
+        for (std::size_t i = 0; i != num_statistics; ++i)
+            statistics_[i].store(0, boost::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache()
+      : table_(0), overflow_capacity_(16),
+        overflow_size_(0)
+    {}
+
+    void gva_cache::reserve(std::size_t capacity)
+    {
+        if (capacity > max_capacity)
+            capacity = max_capacity;
+
+        std::size_t num_sets = num_shards;
+        while (num_sets * num_ways < capacity)
+            num_sets <<= 1;
+
+        {
+            boost::lock_guard<mutex_type> l(tables_mtx_);
+
+            table* t = table_.load(boost::memory_order_relaxed);
+            if (t != 0 && t->num_sets_ >= num_sets)
+                return;
+
+            // The entries of the old table are not carried over. The number
+            // of range slots is kept per table, as concurrent operations may
+            // still evict entries from the old one.
+            tables_.push_back(std::unique_ptr<table>(new table(num_sets)));
+            table_.store(tables_.back().get(), boost::memory_order_release);
+        }
+
+        boost::lock_guard<mutex_type> l(overflow_mtx_);
+        overflow_capacity_ = (std::max)(std::size_t(16), capacity / 16);
+    }
+
+    std::size_t gva_cache::capacity() const
+    {
+        table* t = table_.load(boost::memory_order_acquire);
+        return t != 0 ? t->num_sets_ * num_ways : 0;
+    }
+
+    boost::uint64_t gva_cache::get_num_buckets(naming::gid_type const& id,
+        boost::uint64_t count)
+    {
+        boost::uint64_t first = id.get_lsb() >> bucket_shift;
+        boost::uint64_t last = (id.get_lsb() + (count - 1)) >> bucket_shift;
+
+        // the range wraps around
+        if (last < first)
+            return ~boost::uint64_t(0);
+
+        return last - first + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::get_entry(naming::gid_type const& id,
+        naming::gid_type& base, gva& g)
+    {
+        naming::gid_type const key = naming::detail::get_stripped_gid(id);
+
+        table* t = table_.load(boost::memory_order_acquire);
+        shard& sh = shards_[t != 0 ? get_shard(t->get_set(key)) : 0];
+
+        update_on_exit update(sh, get_entry_count, get_entry_time);
+
+        if (t != 0 && find(*t, key, base, g))
+        {
+            sh.statistics_[num_hits].fetch_add(1, boost::memory_order_relaxed);
+            return true;
+        }
+
+        sh.statistics_[num_misses].fetch_add(1, boost::memory_order_relaxed);
+        return false;
+    }
+
+    bool gva_cache::find(table& t, naming::gid_type const& id,
+        naming::gid_type& base, gva& g)
+    {
+        // single objects
+        if (find(t.sets_[t.get_set(id)], id, base, g))
+            return true;
+
+        // ranges
+        if (t.num_range_slots_.load(boost::memory_order_relaxed) != 0)
+        {
+            std::size_t set = t.get_bucket_set(id.get_msb(),
+                id.get_lsb() >> bucket_shift);
+            if (find(t.sets_[set], id, base, g))
+                return true;
+        }
+
+        return find_overflow(id, base, g);
+    }
+
+    bool gva_cache::find(set& s, naming::gid_type const& id,
+        naming::gid_type& base, gva& g)
+    {
+        boost::uint64_t const msb = id.get_msb();
+        boost::uint64_t const lsb = id.get_lsb();
+
+        for (std::size_t k = 0; /**/; ++k)
+        {
+            boost::uint64_t sequence =
+                s.sequence_.load(boost::memory_order_acquire);
+            if (sequence & 1)
+            {
+                // the set is being modified
+                mutex_type::yield(k);
+                continue;
+            }
+
+            slot* found = 0;
+            boost::uint64_t count = 0, base_lsb = 0;
+            for (slot& sl : s.slots_)
+            {
+                count = sl.count_.load(boost::memory_order_relaxed);
+                if (count == 0 ||
+                    sl.base_msb_.load(boost::memory_order_relaxed) != msb)
+                {
+                    continue;
+                }
+
+                base_lsb = sl.base_lsb_.load(boost::memory_order_relaxed);
+                if (lsb >= base_lsb && lsb - base_lsb < count)
+                {
+                    found = &sl;
+                    break;
+                }
+            }
+
+            gva result;
+            if (found != 0)
+            {
+                result.prefix = naming::gid_type(
+                    found->prefix_msb_.load(boost::memory_order_relaxed),
+                    found->prefix_lsb_.load(boost::memory_order_relaxed));
+                result.type = found->type_.load(boost::memory_order_relaxed);
+                result.count = count;
+                result.lva(found->lva_.load(boost::memory_order_relaxed));
+                result.offset =
+                    found->offset_.load(boost::memory_order_relaxed);
+            }
+
+            // retry if the set was modified while it was read
+            boost::atomic_thread_fence(boost::memory_order_acquire);
+            if (s.sequence_.load(boost::memory_order_relaxed) != sequence)
+                continue;
+
+            if (found == 0)
+                return false;
+
+            if (!found->referenced_.load(boost::memory_order_relaxed))
+                found->referenced_.store(true, boost::memory_order_relaxed);
+
+            base = naming::gid_type(msb, base_lsb);
+            g = result;
+            return true;
+        }
+    }
+
+    bool gva_cache::find_overflow(naming::gid_type const& id,
+        naming::gid_type& base, gva& g)
+    {
+        if (overflow_size_.load(boost::memory_order_relaxed) == 0)
+            return false;
+
+        boost::lock_guard<mutex_type> l(overflow_mtx_);
+
+        overflow_type::iterator it = overflow_.upper_bound(id);
+        if (it == overflow_.begin())
+            return false;
+
+        --it;
+        if (it->first.get_msb() != id.get_msb() ||
+            id.get_lsb() - it->first.get_lsb() >= it->second.gva_.count)
+        {
+            return false;
+        }
+
+        it->second.referenced_ = true;
+        base = it->first;
+        g = it->second.gva_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::insert(naming::gid_type const& id, gva const& g)
+    {
+        naming::gid_type const key = naming::detail::get_stripped_gid(id);
+
+        table* t = table_.load(boost::memory_order_acquire);
+        if (t == 0)
+            return false;
+
+        shard& sh = shards_[get_shard(t->get_set(key))];
+        update_on_exit update(sh, insert_entry_count, insert_entry_time);
+
+        naming::gid_type base;
+        gva existing;
+        if (find(*t, key, base, existing))
+            return false;
+
+        if (store_entry(*t, key, g))
+        {
+            sh.statistics_[num_insertions].fetch_add(1,
+                boost::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    void gva_cache::update(naming::gid_type const& id, gva const& g)
+    {
+        naming::gid_type const key = naming::detail::get_stripped_gid(id);
+
+        table* t = table_.load(boost::memory_order_acquire);
+        if (t == 0)
+            return;
+
+        shard& sh = shards_[get_shard(t->get_set(key))];
+        update_on_exit update(sh, update_entry_count, update_entry_time);
+
+        if (store_entry(*t, key, g))
+        {
+            sh.statistics_[num_insertions].fetch_add(1,
+                boost::memory_order_relaxed);
+        }
+    }
+
+    void gva_cache::update(std::vector<entry_type> const& entries)
+    {
+        table* t = table_.load(boost::memory_order_acquire);
+        if (t == 0 || entries.empty())
+            return;
+
+        shard& sh = shards_[0];
+        update_on_exit update(sh, update_entry_count, update_entry_time,
+            boost::int64_t(entries.size()));
+
+        // determine the sets all entries have to be stored in
+        std::vector<naming::gid_type> keys;
+        keys.reserve(entries.size());
+
+        std::vector<std::pair<std::size_t, std::size_t> > placements;
+        placements.reserve(entries.size());
+
+        boost::int64_t inserted = 0;
+        for (std::size_t i = 0; i != entries.size(); ++i)
+        {
+            keys.push_back(
+                naming::detail::get_stripped_gid(entries[i].first));
+
+            naming::gid_type const& key = keys.back();
+            boost::uint64_t count = get_range_count(entries[i].second);
+            if (count == 1)
+            {
+                placements.push_back(std::make_pair(t->get_set(key), i));
+                continue;
+            }
+
+            boost::uint64_t num_buckets = get_num_buckets(key, count);
+            if (num_buckets > max_range_buckets)
+            {
+                if (store_overflow(key, entries[i].second))
+                    ++inserted;
+                continue;
+            }
+
+            boost::uint64_t first = key.get_lsb() >> bucket_shift;
+            for (boost::uint64_t b = 0; b != num_buckets; ++b)
+            {
+                placements.push_back(std::make_pair(
+                    t->get_bucket_set(key.get_msb(), first + b), i));
+            }
+        }
+
+        // group the sets by shard to acquire each lock only once
+        std::sort(placements.begin(), placements.end(),
+            [](std::pair<std::size_t, std::size_t> const& lhs,
+               std::pair<std::size_t, std::size_t> const& rhs)
+            {
+                std::size_t lhs_shard = get_shard(lhs.first);
+                std::size_t rhs_shard = get_shard(rhs.first);
+                return lhs_shard < rhs_shard ||
+                    (lhs_shard == rhs_shard && lhs < rhs);
+            });
+
+        std::size_t current = std::size_t(-1);
+        boost::unique_lock<mutex_type> l;
+        for (std::pair<std::size_t, std::size_t> const& p : placements)
+        {
+            std::size_t shard_index = get_shard(p.first);
+            if (shard_index != current)
+            {
+                if (l.owns_lock())
+                    l.unlock();
+
+                l = boost::unique_lock<mutex_type>(
+                    shards_[shard_index].mtx_);
+                current = shard_index;
+            }
+
+            gva const& g = entries[p.second].second;
+            if (store(*t, t->sets_[p.first], shards_[shard_index],
+                    keys[p.second], get_range_count(g), g))
+            {
+                ++inserted;
+            }
+        }
+
+        sh.statistics_[num_insertions].fetch_add(inserted,
+            boost::memory_order_relaxed);
+    }
+
+    bool gva_cache::store_entry(table& t, naming::gid_type const& id,
+        gva const& g)
+    {
+        boost::uint64_t count = get_range_count(g);
+        if (count == 1)
+        {
+            std::size_t set = t.get_set(id);
+            shard& sh = shards_[get_shard(set)];
+
+            boost::lock_guard<mutex_type> l(sh.mtx_);
+            return store(t, t.sets_[set], sh, id, count, g);
+        }
+
+        boost::uint64_t num_buckets = get_num_buckets(id, count);
+        if (num_buckets > max_range_buckets)
+            return store_overflow(id, g);
+
+        // store the range in the sets of all buckets it covers
+        bool inserted = false;
+        boost::uint64_t first = id.get_lsb() >> bucket_shift;
+        for (boost::uint64_t b = 0; b != num_buckets; ++b)
+        {
+            std::size_t set = t.get_bucket_set(id.get_msb(), first + b);
+            shard& sh = shards_[get_shard(set)];
+
+            boost::lock_guard<mutex_type> l(sh.mtx_);
+            if (store(t, t.sets_[set], sh, id, count, g))
+                inserted = true;
+        }
+        return inserted;
+    }
+
+    bool gva_cache::store(table& t, set& s, shard& sh,
+        naming::gid_type const& id, boost::uint64_t count, gva const& g)
+    {
+        set_write_lock l(s);
+
+        // replace the entry for the same range, if any
+        slot* target = 0;
+        for (slot& sl : s.slots_)
+        {
+            if (sl.count_.load(boost::memory_order_relaxed) == count &&
+                sl.base_msb_.load(boost::memory_order_relaxed) ==
+                    id.get_msb() &&
+                sl.base_lsb_.load(boost::memory_order_relaxed) ==
+                    id.get_lsb())
+            {
+                target = &sl;
+                break;
+            }
+        }
+
+        bool const inserted = (target == 0);
+        if (inserted)
+        {
+            for (slot& sl : s.slots_)
+            {
+                if (sl.count_.load(boost::memory_order_relaxed) == 0)
+                {
+                    target = &sl;
+                    break;
+                }
+            }
+        }
+
+        if (target == 0)
+        {
+            // CLOCK: evict the first entry which was not referenced since
+            // the hand passed it the last time
+            for (;;)
+            {
+                slot& sl = s.slots_[s.hand_];
+                s.hand_ = (s.hand_ + 1) % num_ways;
+                if (!sl.referenced_.exchange(false,
+                        boost::memory_order_relaxed))
+                {
+                    target = &sl;
+                    break;
+                }
+            }
+
+            clear_slot(t, *target);
+            sh.statistics_[num_evictions].fetch_add(1,
+                boost::memory_order_relaxed);
+        }
+
+        if (inserted)
+        {
+            if (count > 1)
+                ++t.num_range_slots_;
+
+            // new entries have to be referenced before the hand passes them
+            // to survive, which evicts entries used only once first
+            target->referenced_.store(false, boost::memory_order_relaxed);
+        }
+
+        target->base_msb_.store(id.get_msb(), boost::memory_order_relaxed);
+        target->base_lsb_.store(id.get_lsb(), boost::memory_order_relaxed);
+        target->prefix_msb_.store(g.prefix.get_msb(),
+            boost::memory_order_relaxed);
+        target->prefix_lsb_.store(g.prefix.get_lsb(),
+            boost::memory_order_relaxed);
+        target->type_.store(g.type, boost::memory_order_relaxed);
+        target->lva_.store(g.lva(), boost::memory_order_relaxed);
+        target->offset_.store(g.offset, boost::memory_order_relaxed);
+        target->count_.store(count, boost::memory_order_relaxed);
+
+        return inserted;
+    }
+
+    bool gva_cache::store_overflow(naming::gid_type const& id, gva const& g)
+    {
+        boost::lock_guard<mutex_type> l(overflow_mtx_);
+
+        overflow_type::iterator it = overflow_.find(id);
+        if (it != overflow_.end())
+        {
+            it->second.gva_ = g;
+            return false;
+        }
+
+        if (overflow_.size() >= overflow_capacity_ && !overflow_.empty())
+        {
+            // CLOCK, using the id of the next entry to look at as the hand
+            it = overflow_.lower_bound(overflow_hand_);
+            for (;;)
+            {
+                if (it == overflow_.end())
+                    it = overflow_.begin();
+
+                if (!it->second.referenced_)
+                    break;
+
+                it->second.referenced_ = false;
+                ++it;
+            }
+
+            overflow_type::iterator next = it;
+            ++next;
+            overflow_hand_ = (next != overflow_.end()) ?
+                next->first : naming::gid_type();
+            overflow_.erase(it);
+
+            shards_[0].statistics_[num_evictions].fetch_add(1,
+                boost::memory_order_relaxed);
+        }
+
+        overflow_entry e = { g, false };
+        overflow_.insert(overflow_type::value_type(id, e));
+        overflow_size_.store(overflow_.size(), boost::memory_order_relaxed);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void gva_cache::erase(naming::gid_type const& id)
+    {
+        naming::gid_type const key = naming::detail::get_stripped_gid(id);
+
+        table* t = table_.load(boost::memory_order_acquire);
+        if (t == 0)
+            return;
+
+        std::size_t set = t->get_set(key);
+        update_on_exit update(shards_[get_shard(set)], erase_entry_count,
+            erase_entry_time);
+
+        {
+            shard& sh = shards_[get_shard(set)];
+            boost::lock_guard<mutex_type> l(sh.mtx_);
+            erase(*t, t->sets_[set], key);
+        }
+
+        // ranges starting at the given id are stored in the sets of the
+        // buckets following it
+        if (t->num_range_slots_.load(boost::memory_order_relaxed) != 0)
+        {
+            boost::uint64_t first = key.get_lsb() >> bucket_shift;
+            for (std::size_t b = 0; b != max_range_buckets; ++b)
+            {
+                set = t->get_bucket_set(key.get_msb(), first + b);
+
+                shard& sh = shards_[get_shard(set)];
+                boost::lock_guard<mutex_type> l(sh.mtx_);
+                erase(*t, t->sets_[set], key);
+            }
+        }
+
+        if (overflow_size_.load(boost::memory_order_relaxed) != 0)
+        {
+            boost::lock_guard<mutex_type> l(overflow_mtx_);
+            overflow_.erase(key);
+            overflow_size_.store(overflow_.size(),
+                boost::memory_order_relaxed);
+        }
+    }
+
+    void gva_cache::erase(table& t, set& s, naming::gid_type const& id)
+    {
+        set_write_lock l(s);
+        for (slot& sl : s.slots_)
+        {
+            if (sl.count_.load(boost::memory_order_relaxed) != 0 &&
+                sl.base_msb_.load(boost::memory_order_relaxed) ==
+                    id.get_msb() &&
+                sl.base_lsb_.load(boost::memory_order_relaxed) ==
+                    id.get_lsb())
+            {
+                clear_slot(t, sl);
+            }
+        }
+    }
+
+    void gva_cache::clear_slot(table& t, slot& sl)
+    {
+        if (sl.count_.load(boost::memory_order_relaxed) > 1)
+            --t.num_range_slots_;
+
+        sl.count_.store(0, boost::memory_order_relaxed);
+        sl.referenced_.store(false, boost::memory_order_relaxed);
+    }
+
+    void gva_cache::clear()
+    {
+        table* t = table_.load(boost::memory_order_acquire);
+        if (t != 0)
+        {
+            for (std::size_t i = 0; i != t->num_sets_; ++i)
+            {
+                shard& sh = shards_[get_shard(i)];
+
+                boost::lock_guard<mutex_type> l(sh.mtx_);
+                set_write_lock sl(t->sets_[i]);
+                for (slot& s : t->sets_[i].slots_)
+                {
+                    if (s.count_.load(boost::memory_order_relaxed) != 0)
+                        clear_slot(*t, s);
+                }
+            }
+        }
+
+        boost::lock_guard<mutex_type> l(overflow_mtx_);
+        overflow_.clear();
+        overflow_size_.store(0, boost::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    boost::int64_t gva_cache::get_statistics(statistics_type which,
+        bool reset)
+    {
+        HPX_ASSERT(which < num_statistics);
+
+        boost::int64_t result = 0;
+        for (shard& sh : shards_)
+        {
+            if (reset)
+            {
+                result += sh.statistics_[which].exchange(0,
+                    boost::memory_order_relaxed);
+            }
+            else
+            {
+                result += sh.statistics_[which].load(
+                    boost::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+}}}
@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/agas/detail/gva_table.hpp>
+
+#include <boost/static_assert.hpp>
+#include <boost/thread/locks.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    BOOST_STATIC_ASSERT(gva_table::num_shards == 64);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Locks all shards a range is stored in, always in the same order.
+    class gva_table::shards_lock
+    {
+    public:
+        shards_lock(shard* shards, boost::uint64_t mask)
+          : shards_(shards), mask_(mask)
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (mask_ & (boost::uint64_t(1) << i))
+                    shards_[i].mtx_.lock();
+            }
+        }
+
+        ~shards_lock()
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (mask_ & (boost::uint64_t(1) << i))
+                    shards_[i].mtx_.unlock();
+            }
+        }
+
+    private:
+        shard* shards_;
+        boost::uint64_t mask_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        inline std::size_t get_bucket_shard(boost::uint64_t msb,
+            boost::uint64_t bucket)
+        {
+            // Fibonacci hashing, consecutive buckets end up in different
+            // shards
+            boost::uint64_t h = (msb * 0xC2B2AE3D27D4EB4Full) ^ bucket;
+            return static_cast<std::size_t>(
+                (h * 0x9E3779B97F4A7C15ull) >> (64 - 6));
+        }
+    }
+
+    std::size_t gva_table::get_shard(naming::gid_type const& id)
+    {
+        return get_bucket_shard(id.get_msb(), id.get_lsb() >> bucket_shift);
+    }
+
+    bool gva_table::is_spanning(naming::gid_type const& id,
+        boost::uint64_t count)
+    {
+        boost::uint64_t first = id.get_lsb() >> bucket_shift;
+        boost::uint64_t last =
+            (id.get_lsb() + (count != 0 ? count - 1 : 0)) >> bucket_shift;
+
+        // the range wraps around or covers at least as many buckets as there
+        // are shards
+        return last < first || last - first >= num_shards;
+    }
+
+    boost::uint64_t gva_table::get_shards(naming::gid_type const& id,
+        boost::uint64_t count)
+    {
+        HPX_ASSERT(!is_spanning(id, count));
+
+        boost::uint64_t first = id.get_lsb() >> bucket_shift;
+        boost::uint64_t last =
+            (id.get_lsb() + (count != 0 ? count - 1 : 0)) >> bucket_shift;
+
+        boost::uint64_t mask = 0;
+        for (boost::uint64_t bucket = first; bucket <= last; ++bucket)
+        {
+            mask |= boost::uint64_t(1) <<
+                get_bucket_shard(id.get_msb(), bucket);
+        }
+        return mask;
+    }
+
+    // Find the last range starting at or before the given id and check
+    // whether it contains the id.
+    bool gva_table::find_range(map_type const& entries,
+        naming::gid_type const& id, naming::gid_type& base, data_type& data)
+    {
+        map_type::const_iterator it = entries.upper_bound(id);
+        if (it == entries.begin())
+            return false;
+        --it;
+
+        if (it->first != id && !((it->first + it->second.first.count) > id))
+            return false;
+
+        base = it->first;
+        data = it->second;
+        return true;
+    }
+
+    // Check whether a range of the given size may be bound to the given id,
+    // returns bind_inserted if no range in the given map conflicts with it
+    // and bind_updated if a matching range starting at the id exists.
+    gva_table::bind_result gva_table::check_bind(map_type const& entries,
+        naming::gid_type const& id, boost::uint64_t count, bool allow_update)
+    {
+        map_type::const_iterator it = entries.upper_bound(id);
+        if (it == entries.begin())
+            return bind_inserted;
+        --it;
+
+        // If we got an exact match, this is a request to update an existing
+        // binding (e.g. move semantics).
+        if (it->first == id)
+        {
+            // we can't change block sizes of existing bindings
+            if (it->second.first.count != count)
+                return bind_count_mismatch;
+
+            if (!allow_update)
+                return bind_update_rejected;
+
+            return bind_updated;
+        }
+
+        // Check that a previous range doesn't cover the new id.
+        if ((it->first + it->second.first.count) > id)
+            return bind_contained;
+
+        return bind_inserted;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_table::resolve(naming::gid_type const& id, naming::gid_type& base,
+        data_type& data) const
+    {
+        {
+            shard const& s = shards_[get_shard(id)];
+
+            boost::lock_guard<mutex_type> l(s.mtx_);
+            if (find_range(s.entries_, id, base, data))
+                return true;
+        }
+
+        if (num_spanning_.load(boost::memory_order_relaxed) == 0)
+            return false;
+
+        boost::lock_guard<mutex_type> l(spanning_.mtx_);
+        return find_range(spanning_.entries_, id, base, data);
+    }
+
+    gva_table::bind_result gva_table::bind(naming::gid_type const& id,
+        data_type const& data, bool allow_update)
+    {
+        boost::uint64_t count = data.first.count;
+        shard& primary = shards_[get_shard(id)];
+
+        // The shards are always locked before the shard holding the spanning
+        // ranges.
+        if (is_spanning(id, count))
+        {
+            boost::lock_guard<mutex_type> l(primary.mtx_);
+            boost::lock_guard<mutex_type> ls(spanning_.mtx_);
+
+            bind_result r = check_bind(primary.entries_, id, count,
+                allow_update);
+            if (r == bind_inserted)
+            {
+                r = check_bind(spanning_.entries_, id, count, allow_update);
+            }
+
+            if (r == bind_updated)
+            {
+                spanning_.entries_[id] = data;
+            }
+            else if (r == bind_inserted)
+            {
+                spanning_.entries_.insert(map_type::value_type(id, data));
+                ++num_spanning_;
+                ++size_;
+            }
+            return r;
+        }
+
+        boost::uint64_t mask = get_shards(id, count);
+        HPX_ASSERT(mask & (boost::uint64_t(1) << get_shard(id)));
+
+        shards_lock l(shards_, mask);
+
+        bind_result r = check_bind(primary.entries_, id, count, allow_update);
+        if (r == bind_inserted &&
+            num_spanning_.load(boost::memory_order_relaxed) != 0)
+        {
+            boost::lock_guard<mutex_type> ls(spanning_.mtx_);
+            r = check_bind(spanning_.entries_, id, count, allow_update);
+            HPX_ASSERT(r != bind_updated);
+        }
+
+        if (r == bind_updated)
+        {
+            // update all copies of this range
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (mask & (boost::uint64_t(1) << i))
+                    shards_[i].entries_[id] = data;
+            }
+        }
+        else if (r == bind_inserted)
+        {
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (mask & (boost::uint64_t(1) << i))
+                    shards_[i].entries_.insert(map_type::value_type(id, data));
+            }
+            ++size_;
+        }
+        return r;
+    }
+
+    gva_table::unbind_result gva_table::unbind(naming::gid_type const& id,
+        boost::uint64_t count, data_type& data)
+    {
+        shard& primary = shards_[get_shard(id)];
+
+        if (is_spanning(id, count))
+        {
+            boost::lock_guard<mutex_type> l(primary.mtx_);
+            boost::lock_guard<mutex_type> ls(spanning_.mtx_);
+
+            map_type::iterator it = spanning_.entries_.find(id);
+            if (it == spanning_.entries_.end())
+            {
+                // a smaller range may be bound to this id
+                return primary.entries_.find(id) == primary.entries_.end() ?
+                    unbind_not_found : unbind_count_mismatch;
+            }
+
+            if (it->second.first.count != count)
+                return unbind_count_mismatch;
+
+            data = it->second;
+            spanning_.entries_.erase(it);
+
+            --num_spanning_;
+            --size_;
+            return unbind_removed;
+        }
+
+        boost::uint64_t mask = get_shards(id, count);
+        HPX_ASSERT(mask & (boost::uint64_t(1) << get_shard(id)));
+
+        shards_lock l(shards_, mask);
+
+        map_type::iterator it = primary.entries_.find(id);
+        if (it == primary.entries_.end())
+        {
+            // a spanning range may be bound to this id
+            if (num_spanning_.load(boost::memory_order_relaxed) != 0)
+            {
+                boost::lock_guard<mutex_type> ls(spanning_.mtx_);
+                if (spanning_.entries_.find(id) != spanning_.entries_.end())
+                    return unbind_count_mismatch;
+            }
+            return unbind_not_found;
+        }
+
+        if (it->second.first.count != count)
+            return unbind_count_mismatch;
+
+        data = it->second;
+
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (mask & (boost::uint64_t(1) << i))
+                shards_[i].entries_.erase(id);
+        }
+
+        --size_;
+        return unbind_removed;
+    }
+}}}
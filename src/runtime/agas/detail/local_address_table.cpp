@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/agas/detail/local_address_table.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/thread/locks.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    // Marks a slot as being modified for the lifetime of the object, the
+    // writers lock has to be held.
+    class local_address_table::slot_write_lock
+    {
+    public:
+        explicit slot_write_lock(slot& s)
+          : s_(s)
+        {
+            boost::uint64_t sequence =
+                s_.sequence_.load(boost::memory_order_relaxed);
+            HPX_ASSERT((sequence & 1) == 0);
+            s_.sequence_.store(sequence + 1, boost::memory_order_relaxed);
+
+            // the modifications must not become visible before the sequence
+            boost::atomic_thread_fence(boost::memory_order_release);
+        }
+
+        ~slot_write_lock()
+        {
+            s_.sequence_.fetch_add(1, boost::memory_order_release);
+        }
+
+    private:
+        slot& s_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    local_address_table::local_address_table()
+      : mask_(0), generation_(0)
+    {}
+
+    void local_address_table::reserve(std::size_t size)
+    {
+        HPX_ASSERT(!slots_);
+
+        if (size == 0)
+            return;
+
+        std::size_t num_slots = 1;
+        while (num_slots < size)
+            num_slots <<= 1;
+
+        slots_.reset(new slot[num_slots]);
+        mask_ = num_slots - 1;
+    }
+
+    bool local_address_table::get_entry(naming::gid_type const& id,
+        boost::int32_t& type, boost::uint64_t& lva) const
+    {
+        if (!slots_)
+            return false;
+
+        boost::uint64_t const msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        boost::uint64_t const lsb = id.get_lsb();
+
+        slot& s = get_slot(lsb);
+        for (;;)
+        {
+            boost::uint64_t sequence =
+                s.sequence_.load(boost::memory_order_acquire);
+            if (sequence & 1)
+                continue;       // the slot is being modified
+
+            bool found =
+                s.lsb_.load(boost::memory_order_relaxed) == lsb &&
+                s.msb_.load(boost::memory_order_relaxed) == msb;
+            if (found)
+            {
+                type = s.type_.load(boost::memory_order_relaxed);
+                lva = s.lva_.load(boost::memory_order_relaxed);
+            }
+
+            // the loads above must not be moved past the check below
+            boost::atomic_thread_fence(boost::memory_order_acquire);
+            if (s.sequence_.load(boost::memory_order_relaxed) == sequence)
+                return found && lva != 0;
+        }
+    }
+
+    void local_address_table::store(slot& s, boost::uint64_t msb,
+        boost::uint64_t lsb, boost::int32_t type, boost::uint64_t lva)
+    {
+        slot_write_lock l(s);
+        s.msb_.store(msb, boost::memory_order_relaxed);
+        s.lsb_.store(lsb, boost::memory_order_relaxed);
+        s.type_.store(type, boost::memory_order_relaxed);
+        s.lva_.store(lva, boost::memory_order_relaxed);
+    }
+
+    bool local_address_table::insert(naming::gid_type const& id,
+        boost::int32_t type, boost::uint64_t lva, boost::uint64_t generation)
+    {
+        if (!slots_ || lva == 0)
+            return false;
+
+        boost::uint64_t const msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        boost::uint64_t const lsb = id.get_lsb();
+
+        boost::lock_guard<mutex_type> l(mtx_);
+
+        // an entry was removed while the address was being resolved, the
+        // given address might be outdated
+        if (generation_.load(boost::memory_order_relaxed) != generation)
+            return false;
+
+        // replace whatever is stored in the slot
+        store(get_slot(lsb), msb, lsb, type, lva);
+        return true;
+    }
+
+    void local_address_table::erase(naming::gid_type const& id,
+        boost::uint64_t count)
+    {
+        if (!slots_)
+            return;
+
+        if (count > mask_)
+        {
+            clear();
+            return;
+        }
+
+        boost::uint64_t const msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        boost::uint64_t const lsb = id.get_lsb();
+
+        boost::lock_guard<mutex_type> l(mtx_);
+        generation_.fetch_add(1, boost::memory_order_release);
+
+        for (boost::uint64_t i = 0; i != count; ++i)
+        {
+            // ranges do not cross the boundaries of the LSB
+            slot& s = get_slot(lsb + i);
+            if (s.lsb_.load(boost::memory_order_relaxed) == lsb + i &&
+                s.msb_.load(boost::memory_order_relaxed) == msb)
+            {
+                store(s, 0, 0, 0, 0);
+            }
+        }
+    }
+
+    void local_address_table::clear()
+    {
+        if (!slots_)
+            return;
+
+        boost::lock_guard<mutex_type> l(mtx_);
+        generation_.fetch_add(1, boost::memory_order_release);
+
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            slot& s = slots_[i];
+            if (s.lsb_.load(boost::memory_order_relaxed) != 0 ||
+                s.msb_.load(boost::memory_order_relaxed) != 0)
+            {
+                store(s, 0, 0, 0, 0);
+            }
+        }
+    }
+}}}
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/agas/detail/primary_namespace_partitions.hpp>
+
+#include <boost/atomic.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    namespace
+    {
+        boost::atomic<boost::uint32_t> num_partitions(0);
+
+        // 64 bit finalizer of MurmurHash3
+        inline boost::uint64_t mix(boost::uint64_t k)
+        {
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdULL;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ULL;
+            k ^= k >> 33;
+            return k;
+        }
+    }
+
+    void set_primary_namespace_partitions(boost::uint32_t partitions)
+    {
+        num_partitions.store(partitions, boost::memory_order_release);
+    }
+
+    boost::uint32_t get_primary_namespace_partitions()
+    {
+        return num_partitions.load(boost::memory_order_acquire);
+    }
+
+    bool is_dynamically_allocated(naming::gid_type const& id)
+    {
+        boost::uint64_t const vmsb =
+            id.get_msb() & naming::gid_type::virtual_memory_mask;
+
+        // ids referring to virtual memory (localities, LVA encoded ids) and
+        // the ids of the AGAS services are never allocated
+        if (vmsb == 0)
+            return false;
+        return vmsb != HPX_AGAS_NS_MSB ||
+            id.get_lsb() >= primary_namespace_first_lsb;
+    }
+
+    boost::uint32_t get_primary_namespace_locality_id(
+        naming::gid_type const& id)
+    {
+        boost::uint32_t const partitions =
+            num_partitions.load(boost::memory_order_relaxed);
+
+        if (partitions == 0 || !is_dynamically_allocated(id))
+            return naming::get_locality_id_from_gid(id);
+
+        boost::uint64_t const msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        boost::uint64_t const block =
+            id.get_lsb() >> primary_namespace_partition_shift;
+
+        return boost::uint32_t(
+            mix(mix(msb) ^ block) % partitions);
+    }
+}}}
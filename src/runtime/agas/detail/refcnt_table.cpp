@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/runtime/agas/detail/refcnt_table.hpp>
+
+#include <boost/static_assert.hpp>
+#include <boost/thread/locks.hpp>
+
+namespace hpx { namespace agas { namespace detail
+{
+    BOOST_STATIC_ASSERT(refcnt_table::num_shards == 64);
+
+    std::size_t refcnt_table::get_shard(naming::gid_type const& id)
+    {
+        boost::uint64_t h = (id.get_msb() * 0xC2B2AE3D27D4EB4Full) ^
+            id.get_lsb();
+        return static_cast<std::size_t>(
+            (h * 0x9E3779B97F4A7C15ull) >> (64 - 6));
+    }
+
+    bool refcnt_table::change(naming::gid_type const& lower,
+        naming::gid_type const& upper, boost::int64_t credits,
+        std::list<naming::gid_type>& freed,
+        naming::gid_type& invalid_id, boost::int64_t& invalid_count)
+    {
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        {
+            shard& s = shards_[get_shard(raw)];
+
+            boost::lock_guard<mutex_type> l(s.mtx_);
+
+            map_type::iterator it = s.entries_.find(raw);
+            if (it == s.entries_.end())
+            {
+                it = s.entries_.insert(map_type::value_type(raw,
+                    boost::int64_t(HPX_GLOBALCREDIT_INITIAL))).first;
+            }
+
+            it->second += credits;
+
+            // Sanity check.
+            if (it->second < 0)
+            {
+                invalid_id = raw;
+                invalid_count = it->second;
+                return false;
+            }
+
+            // this object needs to be deleted
+            if (it->second == 0)
+                freed.push_back(raw);
+        }
+        return true;
+    }
+
+    void refcnt_table::erase(std::list<naming::gid_type> const& freed)
+    {
+        for (naming::gid_type const& id : freed)
+        {
+            shard& s = shards_[get_shard(id)];
+
+            boost::lock_guard<mutex_type> l(s.mtx_);
+
+            map_type::iterator it = s.entries_.find(id);
+            if (it != s.entries_.end() && it->second == 0)
+                s.entries_.erase(it);
+        }
+    }
+
+    bool refcnt_table::get(naming::gid_type const& id,
+        boost::int64_t& count) const
+    {
+        shard const& s = shards_[get_shard(id)];
+
+        boost::lock_guard<mutex_type> l(s.mtx_);
+
+        map_type::const_iterator it = s.entries_.find(id);
+        if (it == s.entries_.end())
+            return false;
+
+        count = it->second;
+        return true;
+    }
+}}}
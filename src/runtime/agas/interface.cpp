@@ -142,6 +142,43 @@ naming::id_type resolve_name_sync(
     return agas_.resolve_name(name, ec);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::vector<bool> register_names_sync(
+    std::vector<std::pair<std::string, naming::id_type> > const& names
+  , error_code& ec
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.register_names(names, ec);
+}
+
+std::vector<naming::id_type> resolve_names_sync(
+    std::vector<std::string> const& names
+  , error_code& ec
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.resolve_names(names, ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+lcos::future<std::map<std::string, naming::id_type> > find_symbols(
+    std::string const& prefix
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.find_symbols_async(prefix);
+}
+
+std::map<std::string, naming::id_type> find_symbols_sync(
+    std::string const& prefix
+  , error_code& ec
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.find_symbols(prefix, ec);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // lcos::future<std::vector<naming::id_type> > get_localities(
 //     components::component_type type
@@ -506,5 +543,19 @@ hpx::future<bool> end_migration(naming::id_type const& id)
     return resolver.end_migration_async(id);
 }
 
+hpx::future<std::vector<std::pair<naming::id_type, naming::address> > >
+    begin_migration(std::vector<naming::id_type> const& ids,
+        naming::id_type const& target_locality)
+{
+    naming::resolver_client& resolver = naming::get_agas_client();
+    return resolver.begin_migration_async(ids, target_locality);
+}
+
+hpx::future<bool> end_migration(std::vector<naming::id_type> const& ids)
+{
+    naming::resolver_client& resolver = naming::get_agas_client();
+    return resolver.end_migration_async(ids);
+}
+
 }}
 
@@ -141,6 +141,7 @@ namespace hpx { namespace agas
             // component_ns_unbind_name
             // symbol_ns_resolve
             // symbol_ns_unbind
+            // symbol_ns_find_prefix
             // component_ns_statistics
             // primary_ns_statistics
             // symbol_ns_statistics
@@ -17,14 +17,16 @@
 #include <hpx/runtime/components/component_factory.hpp>
 #include <hpx/runtime/components/base_lco_factory.hpp>
 #include <hpx/runtime/components/component_type.hpp>
+#include <hpx/runtime/serialization/map.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
 #include <hpx/util/tuple.hpp>
 
 #include <boost/fusion/include/at_c.hpp>
 #include <boost/fusion/include/value_at.hpp>
 
 // The number of types that response's variant can represent.
-#define HPX_AGAS_RESPONSE_SUBTYPES 12
+#define HPX_AGAS_RESPONSE_SUBTYPES 13
 
 namespace hpx { namespace agas
 {
@@ -67,6 +69,7 @@ namespace hpx { namespace agas
           , subtype_resolved_localities = 0x9
           , subtype_added_credits       = 0xa
           , subtype_endpoints           = 0xb
+          , subtype_names               = 0xc
           // update HPX_AGAS_RESPONSE_SUBTYPES is you add more subtypes
         };
 
@@ -151,6 +154,11 @@ namespace hpx { namespace agas
           , util::tuple<
                 parcelset::endpoints_type  // associated endpoints
             >
+            // 0xc
+            // symbol_ns_find_prefix
+          , util::tuple<
+                std::map<std::string, naming::gid_type>  // names and gids
+            >
         > data_type;
 
         // {{{ variant helper TODO: consolidate with helpers in request
@@ -366,6 +374,18 @@ namespace hpx { namespace agas
         // TODO: verification of namespace_action_code
     }
 
+    response::response(
+        namespace_action_code type_
+      , std::map<std::string, naming::gid_type> const& names_
+      , error status_
+        )
+      : mc(type_)
+      , status(status_)
+      , data(new response_data(util::make_tuple(names_)))
+    {
+        HPX_ASSERT(type_ == symbol_ns_find_prefix);
+    }
+
     response::~response()
     {}
 
@@ -571,6 +591,13 @@ namespace hpx { namespace agas
         return data->get_data<response_data::subtype_statistics_counter, 0>(ec);
     }
 
+    std::map<std::string, naming::gid_type> response::get_names(
+        error_code& ec
+        ) const
+    {
+        return data->get_data<response_data::subtype_names, 0>(ec);
+    }
+
     struct save_visitor : boost::static_visitor<void>
     {
       private:
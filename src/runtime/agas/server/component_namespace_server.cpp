@@ -137,6 +137,7 @@ response component_namespace::service(
         case symbol_ns_unbind:
         case symbol_ns_iterate_names:
         case symbol_ns_on_event:
+        case symbol_ns_find_prefix:
         {
             LAGAS_(warning) <<
                 "component_namespace::service, redirecting request to "
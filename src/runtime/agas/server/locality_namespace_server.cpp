@@ -141,6 +141,7 @@ response locality_namespace::service(
         case symbol_ns_unbind:
         case symbol_ns_iterate_names:
         case symbol_ns_on_event:
+        case symbol_ns_find_prefix:
         {
             LAGAS_(warning) <<
                 "locality_namespace::service, redirecting request to "
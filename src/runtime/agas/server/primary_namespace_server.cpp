@@ -9,6 +9,7 @@
 #include <hpx/hpx_fwd.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/agas/interface.hpp>
+#include <hpx/runtime/agas/detail/primary_namespace_partitions.hpp>
 #include <hpx/runtime/agas/server/primary_namespace.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/applier/apply.hpp>
@@ -160,6 +161,7 @@ response primary_namespace::service(
         case symbol_ns_unbind:
         case symbol_ns_iterate_names:
         case symbol_ns_on_event:
+        case symbol_ns_find_prefix:
         {
             LAGAS_(warning) <<
                 "primary_namespace::service, redirecting request to "
@@ -371,7 +373,7 @@ response primary_namespace::begin_migration(
 
     boost::unique_lock<mutex_type> l(mutex_);
 
-    resolved_type r = resolve_gid_locked(l, id, ec);
+    resolved_type r = resolve_gid_impl(id, ec);
     if (at_c<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -400,8 +402,9 @@ response primary_namespace::begin_migration(
         std::forward_as_tuple(id), std::forward_as_tuple());
 #else
     migrating_objects_.insert(migration_table_type::value_type(
-        id, boost::make_shared<lcos::local::condition_variable>()));
+        id, boost::make_shared<migration_data>()));
 #endif
+    ++num_migrating_objects_;
 
     return response(primary_ns_begin_migration, at_c<0>(r), at_c<1>(r), at_c<2>(r));
 }
@@ -413,19 +416,44 @@ response primary_namespace::end_migration(
 {
     naming::gid_type id = req.get_gid();
 
-    boost::lock_guard<mutex_type> l(mutex_);
+    std::vector<parcelset::parcel> parcels;
+    {
+        boost::lock_guard<mutex_type> l(mutex_);
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
-        return response(primary_ns_end_migration, no_success);
+        migration_table_type::iterator it = migrating_objects_.find(id);
+        if (it == migrating_objects_.end())
+            return response(primary_ns_end_migration, no_success);
 
 #if !defined(HPX_GCC_VERSION) || HPX_GCC_VERSION >= 408000
-    it->second.notify_all(ec);
+        migration_data& data = it->second;
 #else
-    it->second->notify_all(ec);
+        migration_data& data = *it->second;
 #endif
+        data.cond_.notify_all(ec);
+        std::swap(parcels, data.parcels_);
 
-    migrating_objects_.erase(it);
+        ++counter_data_.migrated_objects_;
+        counter_data_.migration_time_ +=
+            util::high_resolution_clock::now() - data.started_at_;
+
+        migrating_objects_.erase(it);
+        --num_migrating_objects_;
+    }
+
+    // route the parcels which were held back to the new location of the
+    // object, a parcel which can't be routed must not affect the others
+    for (parcelset::parcel& p : parcels)
+    {
+        try {
+            route(std::move(p));
+        }
+        catch (std::exception const& e) {
+            LAGAS_(error) << (boost::format(
+                "primary_namespace::end_migration, failed to route parcel "
+                "held back during migration, gid(%1%): %2%")
+                % id % e.what());
+        }
+    }
 
     return response(primary_ns_end_migration, success);
 }
@@ -442,13 +470,58 @@ void primary_namespace::wait_for_migration_locked(
     if (it != migrating_objects_.end())
     {
 #if !defined(HPX_GCC_VERSION) || HPX_GCC_VERSION >= 408000
-        it->second.wait(l, ec);
+        it->second.cond_.wait(l, ec);
 #else
-        it->second->wait(l, ec);
+        it->second->cond_.wait(l, ec);
 #endif
     }
 }
 
+// hold back the parcel if its destination is currently being migrated
+bool primary_namespace::hold_back_parcel_if_migrating(
+    parcelset::parcel& p)
+{
+    if (num_migrating_objects_.load(boost::memory_order_acquire) == 0)
+        return false;
+
+    // parcels with more than one destination wait for the migration instead
+    if (p.size() != 1)
+        return false;
+
+    naming::gid_type const id = p.destinations()[0].get_gid();
+
+    boost::lock_guard<mutex_type> l(mutex_);
+
+    migration_table_type::iterator it = migrating_objects_.find(id);
+    if (it == migrating_objects_.end())
+        return false;
+
+#if !defined(HPX_GCC_VERSION) || HPX_GCC_VERSION >= 408000
+    it->second.parcels_.push_back(std::move(p));
+#else
+    it->second->parcels_.push_back(std::move(p));
+#endif
+    ++counter_data_.stalled_parcels_;
+    return true;
+}
+
+primary_namespace::resolved_type primary_namespace::wait_and_resolve_gid(
+    naming::gid_type const& id
+  , error_code& ec)
+{
+    // the migration table has to be consulted only while objects are being
+    // migrated, resolving an id does not acquire any global lock otherwise
+    if (num_migrating_objects_.load(boost::memory_order_acquire) != 0)
+    {
+        boost::unique_lock<mutex_type> l(mutex_);
+        wait_for_migration_locked(l, id, ec);
+        if (ec) return resolved_type(naming::invalid_gid, gva(),
+            naming::invalid_gid);
+    }
+
+    return resolve_gid_impl(id, ec);
+}
+
 response primary_namespace::bind_gid(
     request const& req
   , error_code& ec
@@ -463,123 +536,10 @@ response primary_namespace::bind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    boost::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
-
-    if (it != end)
-    {
-        // If we got an exact match, this is a request to update an existing
-        // binding (e.g. move semantics).
-        if (it->first == id)
-        {
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
-
-            // Check for count mismatch (we can't change block sizes of
-            // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "cannot change block size of existing binding");
-                return response();
-            }
-
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , boost::str(boost::format(
-                        "attempt to update a GVA with an invalid type, "
-                        "gid(%1%), gva(%2%), locality(%3%)")
-                        % id % g % locality));
-                return response();
-            }
-
-            if (HPX_UNLIKELY(!locality))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , boost::str(boost::format(
-                        "attempt to update a GVA with an invalid locality id, "
-                        "gid(%1%), gva(%2%), locality(%3%)")
-                        % id % g % locality));
-                return response();
-            }
-
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
-
-            l.unlock();
-
-            LAGAS_(info) << (boost::format(
-                "primary_namespace::bind_gid, gid(%1%), gva(%2%), "
-                "locality(%3%), response(repeated_request)")
-                % id % g % locality);
-
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            return response(primary_ns_bind_gid, repeated_request);
-        }
-
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
-        {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROWS_IF(ec, bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "the new GID is contained in an existing range");
-                return response();
-            }
-        }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
-        {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
-
-            HPX_THROWS_IF(ec, bad_parameter
-              , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
-            return response();
-        }
-    }
-
     naming::gid_type upper_bound(id + (g.count - 1));
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
-
         HPX_THROWS_IF(ec, internal_server_error
           , "primary_namespace::bind_gid"
           , "MSBs of lower and upper range bound do not match");
@@ -588,33 +548,60 @@ response primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
-
         HPX_THROWS_IF(ec, bad_parameter
           , "primary_namespace::bind_gid"
           , boost::str(boost::format(
-                "attempt to insert a GVA with an invalid type, "
+                "attempt to bind a GVA with an invalid type, "
                 "gid(%1%), gva(%2%), locality(%3%)")
                 % id % g % locality));
         return response();
     }
 
-    // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    // Existing bindings are updated (e.g. move semantics) only if the new
+    // locality is valid.
+    switch (gvas_.bind(id, gva_table_data_type(g, locality), bool(locality)))
     {
-        l.unlock();
+    case gva_table_type::bind_inserted:
+        break;
+
+    case gva_table_type::bind_updated:
+        LAGAS_(info) << (boost::format(
+            "primary_namespace::bind_gid, gid(%1%), gva(%2%), "
+            "locality(%3%), response(repeated_request)")
+            % id % g % locality);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return response(primary_ns_bind_gid, repeated_request);
+
+    case gva_table_type::bind_count_mismatch:
+        // REVIEW: Is this the right error code to use?
+        HPX_THROWS_IF(ec, bad_parameter
+          , "primary_namespace::bind_gid"
+          , "cannot change block size of existing binding");
+        return response();
 
-        HPX_THROWS_IF(ec, lock_error
+    case gva_table_type::bind_update_rejected:
+        HPX_THROWS_IF(ec, bad_parameter
           , "primary_namespace::bind_gid"
           , boost::str(boost::format(
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid(%1%), gva(%2%)")
+                "attempt to update a GVA with an invalid locality id, "
+                "gid(%1%), gva(%2%), locality(%3%)")
                 % id % g % locality));
         return response();
-    }
 
-    l.unlock();
+    case gva_table_type::bind_contained:
+        // REVIEW: Is this the right error code to use?
+        HPX_THROWS_IF(ec, bad_parameter
+          , "primary_namespace::bind_gid"
+          , "the new GID is contained in an existing range");
+        return response();
+
+    default:
+        HPX_ASSERT(false);
+        break;
+    }
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::bind_gid, gid(%1%), gva(%2%), locality(%3%)")
@@ -636,17 +623,8 @@ response primary_namespace::resolve_gid(
     // parameters
     naming::gid_type id = req.get_gid();
 
-    resolved_type r;
-
-    {
-        boost::unique_lock<mutex_type> l(mutex_);
-
-        // wait for any migration to be completed
-        wait_for_migration_locked(l, id, ec);
-
-        // now, resolve the id
-        r = resolve_gid_locked(l, id, ec);
-    }
+    // wait for any migration to be completed, then resolve the id
+    resolved_type r = wait_and_resolve_gid(id, ec);
 
     if (at_c<0>(r) == naming::invalid_gid)
     {
@@ -679,29 +657,10 @@ response primary_namespace::unbind_gid(
     naming::gid_type id = req.get_gid();
     naming::detail::strip_internal_bits_from_gid(id);
 
-    boost::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
-
-    if (it != end)
+    gva_table_data_type data;
+    switch (gvas_.unbind(id, count, data))
     {
-        if (HPX_UNLIKELY(it->second.first.count != count))
-        {
-            l.unlock();
-
-            HPX_THROWS_IF(ec, bad_parameter
-              , "primary_namespace::unbind_gid"
-              , "block sizes must match");
-            return response();
-        }
-
-        gva_table_data_type& data = it->second;
-        response r(primary_ns_unbind_gid, data.first, data.second);
-
-        gvas_.erase(it);
-
-        l.unlock();
+    case gva_table_type::unbind_removed:
         LAGAS_(info) << (boost::format(
             "primary_namespace::unbind_gid, gid(%1%), count(%2%), gva(%3%), "
             "locality_id(%4%)")
@@ -710,10 +669,17 @@ response primary_namespace::unbind_gid(
         if (&ec != &throws)
             ec = make_success_code();
 
-        return r;
-    }
+        return response(primary_ns_unbind_gid, data.first, data.second);
 
-    l.unlock();
+    case gva_table_type::unbind_count_mismatch:
+        HPX_THROWS_IF(ec, bad_parameter
+          , "primary_namespace::unbind_gid"
+          , "block sizes must match");
+        return response();
+
+    default:
+        break;
+    }
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::unbind_gid, gid(%1%), count(%2%), "
@@ -825,6 +791,34 @@ response primary_namespace::allocate(
     naming::gid_type lower(next_id_ + 1);
     naming::gid_type upper(lower + real_count);
 
+    // If the primary namespace is partitioned, all ids of an allocation have
+    // to be managed by the same partition, i.e. they can't cross the
+    // boundary of a block of ids.
+    if (agas::detail::get_primary_namespace_partitions() != 0)
+    {
+        boost::uint64_t const block_size =
+            agas::detail::primary_namespace_partition_size;
+
+        if (HPX_UNLIKELY(count > block_size))
+        {
+            HPX_THROWS_IF(ec, bad_parameter
+              , "primary_namespace::allocate"
+              , boost::str(boost::format(
+                    "can't allocate more than %1% ids at once if the primary "
+                    "namespace is partitioned, requested: %2%")
+                    % block_size % count));
+            return response();
+        }
+
+        if (upper.get_msb() == lower.get_msb() &&
+            (lower.get_lsb() / block_size) != (upper.get_lsb() / block_size))
+        {
+            lower = naming::gid_type(lower.get_msb(),
+                (upper.get_lsb() / block_size) * block_size);
+            upper = lower + real_count;
+        }
+    }
+
     // Check for overflow.
     if (upper.get_msb() != lower.get_msb())
     {
@@ -864,34 +858,29 @@ response primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , boost::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         ss << (boost::format(
               "%1%, dumping server-side refcnt table matches, lower(%2%), "
               "upper(%3%):")
               % func_name % lower % upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
+            boost::int64_t count = 0;
+            if (!refcnts_.get(raw, count))
+                continue;
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
             ss << (boost::format(
                    "\n  [server] lower(%1%), credits(%2%)")
-                   % lower_it->first
-                   % lower_it->second);
+                   % raw
+                   % count);
         }
 
         LAGAS_(debug) << ss.str();
@@ -906,28 +895,10 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    boost::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
+        dump_refcnt_matches(lower, upper, "primary_namespace::increment");
     }
 #endif
 
@@ -936,43 +907,28 @@ void primary_namespace::increment(
     // reference count is 2^64 - 2. The maximum number of credits a single GID
     // can hold, however, is limited to 2^32 - 1.
 
-    // The third parameter we pass here is the default data to use in case the
-    // key is not mapped. We don't insert GIDs into the refcnt table when we
-    // allocate/bind them, so if a GID is not in the refcnt table, we know that
-    // it's global reference count is the initial global reference count.
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count.
 
-    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    std::list<naming::gid_type> free_list;
+    naming::gid_type raw;
+    boost::int64_t count = 0;
+    if (!refcnts_.change(lower, upper, credits, free_list, raw, count))
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
-        {
-            boost::int64_t count = boost::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::decrement_sweep"
-                    , boost::str(boost::format(
-                        "couldn't create entry in reference count table, "
-                        "raw(%1%), ref-count(%3%)")
-                        % raw % count));
-                return;
-            }
-
-            it = p.first;
-        }
-        else
-        {
-            it->second += credits;
-        }
-
-        LAGAS_(info) << (boost::format(
-            "primary_namespace::increment, raw(%1%), refcnt(%2%)")
-            % lower % it->second);
+        HPX_THROWS_IF(ec, invalid_data
+          , "primary_namespace::increment"
+          , boost::str(boost::format(
+                "negative entry in reference count table, raw(%1%), "
+                "refcount(%2%)")
+                % raw % count));
+        return;
     }
+    HPX_ASSERT(free_list.empty());
+
+    LAGAS_(info) << (boost::format(
+        "primary_namespace::increment, lower(%1%), upper(%2%), credits(%3%)")
+        % lower % upper % credits);
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -980,39 +936,24 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    boost::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+    std::list<naming::gid_type> const& free_list
   , std::list<free_entry>& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , error_code& ec
     )
 {
-    HPX_ASSERT_OWNS_LOCK(l);
-
     using boost::fusion::at_c;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
-
-        // The mapping's key space.
-        key_type gid = it->first;
-
-        // wait for any migration to be completed
-        wait_for_migration_locked(l, gid, ec);
-
-        // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+        // wait for any migration to be completed, then resolve the query GID
+        resolved_type r = wait_and_resolve_gid(gid, ec);
         if (ec) return;
 
         naming::gid_type& raw = at_c<0>(r);
         if (raw == naming::invalid_gid)
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1028,8 +969,6 @@ void primary_namespace::resolve_free_list(
         // REVIEW: Should we do more to make sure the GVA is valid?
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1040,8 +979,6 @@ void primary_namespace::resolve_free_list(
         }
         else if (HPX_UNLIKELY(0 == g.count))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1062,9 +999,6 @@ void primary_namespace::resolve_free_list(
         // Add the information needed to destroy these components to the
         // free list.
         free_entry_list.push_back(free_entry(resolved, gid, at_c<2>(r)));
-
-        // remove this entry from the refcnt table
-        refcnts_.erase(it);
     }
 }
 
@@ -1084,94 +1018,40 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        boost::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+    if (LAGAS_ENABLED(debug))
+    {
+        dump_refcnt_matches(lower, upper, "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
-
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
-        {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                boost::int64_t count = boost::int64_t(HPX_GLOBALCREDIT_INITIAL)
-                    - credits;
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "couldn't create entry in reference count table, "
-                            "raw(%1%), ref-count(%3%)")
-                            % raw % count));
-                    return;
-                }
-
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
-            }
-
-            // Sanity check.
-            if (it->second < 0)
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, invalid_data
-                  , "primary_namespace::decrement_sweep"
-                  , boost::str(boost::format(
-                        "negative entry in reference count table, raw(%1%), "
-                        "refcount(%2%)")
-                        % raw % it->second));
-                return;
-            }
-
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
-        }
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count. The objects
+    // whose reference count drops to zero are removed from the table once
+    // they were successfully resolved.
+    std::list<naming::gid_type> free_list;
+    naming::gid_type raw;
+    boost::int64_t count = 0;
+    if (!refcnts_.change(lower, upper, -credits, free_list, raw, count))
+    {
+        HPX_THROWS_IF(ec, invalid_data
+          , "primary_namespace::decrement_sweep"
+          , boost::str(boost::format(
+                "negative entry in reference count table, raw(%1%), "
+                "refcount(%2%)")
+                % raw % count));
+        return;
+    }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+    if (ec) return;
 
-    } // Unlock the mutex.
+    refcnts_.erase(free_list);
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1238,87 +1118,32 @@ void primary_namespace::free_components_sync(
         ec = make_success_code();
 } // }}}
 
-primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-    boost::unique_lock<mutex_type>& l
-  , naming::gid_type const& gid
+primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+    naming::gid_type const& gid
   , error_code& ec
     )
 { // {{{ resolve_gid implementation
-    HPX_ASSERT_OWNS_LOCK(l);
-
     // parameters
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
-
-    if (it != end)
+    naming::gid_type base;
+    gva_table_data_type data;
+    if (gvas_.resolve(id, base, data))
     {
-        // Check for exact match
-        if (it->first == id)
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
-        }
-
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
+        if (HPX_UNLIKELY(id.get_msb() != base.get_msb()))
         {
-            --it;
-
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, internal_server_error
-                      , "primary_namespace::resolve_gid_locked"
-                      , "MSBs of lower and upper range bound do not match");
-                    return resolved_type(naming::invalid_gid, gva(),
-                        naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
+            HPX_THROWS_IF(ec, internal_server_error
+              , "primary_namespace::resolve_gid_impl"
+              , "MSBs of lower and upper range bound do not match");
+            return resolved_type(naming::invalid_gid, gva(),
+                naming::invalid_gid);
         }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
-            }
 
-            if (&ec != &throws)
-                ec = make_success_code();
+        if (&ec != &throws)
+            ec = make_success_code();
 
-            return resolved_type(it->first, data.first, data.second);
-        }
+        return resolved_type(base, data.first, data.second);
     }
 
     if (&ec != &throws)
@@ -1485,6 +1310,23 @@ response primary_namespace::statistics_counter(
 }
 
 // access current counter values
+boost::int64_t primary_namespace::counter_data::get_migrated_objects_count(
+    bool reset)
+{
+    return util::get_and_reset_value(migrated_objects_, reset);
+}
+
+boost::int64_t primary_namespace::counter_data::get_migration_time(bool reset)
+{
+    return util::get_and_reset_value(migration_time_, reset);
+}
+
+boost::int64_t primary_namespace::counter_data::get_stalled_parcels_count(
+    bool reset)
+{
+    return util::get_and_reset_value(stalled_parcels_, reset);
+}
+
 boost::int64_t primary_namespace::counter_data::get_route_count(bool reset)
 {
     return util::get_and_reset_value(route_.count_, reset);
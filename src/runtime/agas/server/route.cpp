@@ -25,6 +25,11 @@ namespace hpx { namespace agas { namespace server
         );
         counter_data_.increment_route_count();
 
+        // parcels sent to an object which is being migrated are routed once
+        // the migration is complete
+        if (hold_back_parcel_if_migrating(p))
+            return response(primary_ns_route, success);
+
         error_code ec = throws;
 
         std::size_t size = p.size();
@@ -37,23 +42,18 @@ namespace hpx { namespace agas { namespace server
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            boost::unique_lock<mutex_type> l(mutex_);
-
             cache_addresses.reserve(size);
             for (std::size_t i = 0; i != size; ++i)
             {
                 naming::gid_type gid(ids[i].get_gid());
 
                 // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-
-                cache_addresses.push_back(resolve_gid_locked(l, gid, ec));
+                cache_addresses.push_back(wait_and_resolve_gid(gid, ec));
                 resolved_type const& r = cache_addresses.back();
 
                 if (ec || boost::fusion::at_c<0>(r) == naming::invalid_gid)
                 {
                     id_type const id = ids[i];
-                    l.unlock();
 
                     HPX_THROWS_IF(ec, no_success,
                         "primary_namespace::route",
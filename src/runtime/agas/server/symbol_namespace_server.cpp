@@ -18,6 +18,11 @@
 #include <boost/make_shared.hpp>
 #include <boost/thread/locks.hpp>
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace hpx { namespace agas
 {
 
@@ -84,6 +89,14 @@ response symbol_namespace::service(
                 counter_data_.increment_on_event_count();
                 return on_event(req, ec);
             }
+        case symbol_ns_find_prefix:
+            {
+                update_time_on_exit update(
+                    counter_data_.find_prefix_.time_
+                );
+                counter_data_.increment_find_prefix_count();
+                return find_prefix(req, ec);
+            }
         case symbol_ns_statistics_counter:
             return statistics_counter(req, ec);
 
@@ -470,7 +483,7 @@ response symbol_namespace::unbind(
     // parameters
     std::string key = req.get_name();
 
-    boost::lock_guard<mutex_type> l(mutex_);
+    boost::unique_lock<mutex_type> l(mutex_);
 
     gid_table_type::iterator it = gids_.find(key);
     gid_table_type::iterator end = gids_.end();
@@ -491,6 +504,28 @@ response symbol_namespace::unbind(
 
     gids_.erase(it);
 
+    // handle registered events
+    typedef on_event_data_map_type::iterator iterator;
+    std::pair<std::string, namespace_action_code> evtkey(key, symbol_ns_unbind);
+    std::pair<iterator, iterator> p = on_event_data_.equal_range(evtkey);
+
+    std::vector<hpx::id_type> lcos;
+    for (iterator evt_it = p.first; evt_it != p.second; ++evt_it)
+        lcos.push_back((*evt_it).second);
+    on_event_data_.erase(p.first, p.second);
+
+    l.unlock();
+
+    // notify all LCOs which were registered with this name, the (uncounted)
+    // id allows for invalidating any locally cached resolution of the name
+    if (!lcos.empty())
+    {
+        naming::gid_type const stripped_gid =
+            naming::detail::get_stripped_gid(gid);
+        for (hpx::id_type const& id : lcos)
+            set_lco_value(id, stripped_gid);
+    }
+
     LAGAS_(info) << (boost::format(
         "symbol_namespace::unbind, key(%1%), gid(%2%)")
         % key % gid);
@@ -543,7 +578,7 @@ response symbol_namespace::on_event(
     bool call_for_past_events = req.get_on_event_call_for_past_event();
     hpx::id_type lco = req.get_on_event_result_lco();
 
-    if (evt != symbol_ns_bind)
+    if (evt != symbol_ns_bind && evt != symbol_ns_unbind)
     {
         HPX_THROWS_IF(ec, bad_parameter,
             "addressing_service::on_symbol_namespace_event",
@@ -554,7 +589,18 @@ response symbol_namespace::on_event(
     boost::unique_lock<mutex_type> l(mutex_);
 
     bool handled = false;
-    if (call_for_past_events)
+    if (call_for_past_events && evt == symbol_ns_unbind)
+    {
+        // the name is not bound (anymore), trigger the LCO right away
+        if (gids_.find(name) == gids_.end())
+        {
+            util::unlock_guard<boost::unique_lock<mutex_type> > ul(l);
+
+            handled = true;
+            set_lco_value(lco, naming::invalid_gid);
+        }
+    }
+    else if (call_for_past_events)
     {
         gid_table_type::iterator it = gids_.find(name);
         if (it != gids_.end())
@@ -611,6 +657,52 @@ response symbol_namespace::on_event(
     return response(symbol_ns_on_event);
 } // }}}
 
+response symbol_namespace::find_prefix(
+    request const& req
+  , error_code& ec
+    )
+{ // {{{ find_prefix implementation
+    // parameters
+    std::string prefix = req.get_name();
+
+    // The names are kept in sorted order, all names starting with the given
+    // prefix form a contiguous range of the table.
+    typedef std::pair<std::string, boost::shared_ptr<naming::gid_type> >
+        entry_type;
+    std::vector<entry_type> entries;
+
+    {
+        boost::lock_guard<mutex_type> l(mutex_);
+
+        gid_table_type::iterator end = gids_.end();
+        for (gid_table_type::iterator it = gids_.lower_bound(prefix);
+             it != end && it->first.compare(0, prefix.size(), prefix) == 0;
+             ++it)
+        {
+            // hold on to the gids while the map is unlocked
+            entries.push_back(entry_type(it->first, it->second));
+        }
+    }
+
+    // split the credits as the receiving end will expect to keep the objects
+    // alive
+    std::map<std::string, naming::gid_type> names;
+    for (entry_type const& e : entries)
+    {
+        names.insert(names.end(), std::make_pair(e.first,
+            naming::detail::split_gid_if_needed(*e.second).get()));
+    }
+
+    LAGAS_(info) << (boost::format(
+        "symbol_namespace::find_prefix, prefix(%1%), found(%2%)")
+        % prefix % names.size());
+
+    if (&ec != &throws)
+        ec = make_success_code();
+
+    return response(symbol_ns_find_prefix, names);
+} // }}}
+
 response symbol_namespace::statistics_counter(
     request const& req
   , error_code& ec
@@ -676,6 +768,10 @@ response symbol_namespace::statistics_counter(
         case symbol_ns_on_event:
             get_data_func = boost::bind(&cd::get_on_event_count, &counter_data_, ::_1);
             break;
+        case symbol_ns_find_prefix:
+            get_data_func = boost::bind(&cd::get_find_prefix_count,
+                &counter_data_, ::_1);
+            break;
         case symbol_ns_statistics_counter:
             get_data_func = boost::bind(&cd::get_overall_count, &counter_data_, ::_1);
             break;
@@ -705,6 +801,10 @@ response symbol_namespace::statistics_counter(
         case symbol_ns_on_event:
             get_data_func = boost::bind(&cd::get_on_event_time, &counter_data_, ::_1);
             break;
+        case symbol_ns_find_prefix:
+            get_data_func = boost::bind(&cd::get_find_prefix_time,
+                &counter_data_, ::_1);
+            break;
         case symbol_ns_statistics_counter:
             get_data_func = boost::bind(&cd::get_overall_time, &counter_data_, ::_1);
             break;
@@ -759,13 +859,19 @@ boost::int64_t symbol_namespace::counter_data::get_on_event_count(bool reset)
     return util::get_and_reset_value(on_event_.count_, reset);
 }
 
+boost::int64_t symbol_namespace::counter_data::get_find_prefix_count(bool reset)
+{
+    return util::get_and_reset_value(find_prefix_.count_, reset);
+}
+
 boost::int64_t symbol_namespace::counter_data::get_overall_count(bool reset)
 {
     return util::get_and_reset_value(bind_.count_, reset) +
         util::get_and_reset_value(resolve_.count_, reset) +
         util::get_and_reset_value(unbind_.count_, reset) +
         util::get_and_reset_value(iterate_names_.count_, reset) +
-        util::get_and_reset_value(on_event_.count_, reset);
+        util::get_and_reset_value(on_event_.count_, reset) +
+        util::get_and_reset_value(find_prefix_.count_, reset);
 }
 
 // access execution time counters
@@ -794,13 +900,19 @@ boost::int64_t symbol_namespace::counter_data::get_on_event_time(bool reset)
     return util::get_and_reset_value(on_event_.time_, reset);
 }
 
+boost::int64_t symbol_namespace::counter_data::get_find_prefix_time(bool reset)
+{
+    return util::get_and_reset_value(find_prefix_.time_, reset);
+}
+
 boost::int64_t symbol_namespace::counter_data::get_overall_time(bool reset)
 {
     return util::get_and_reset_value(bind_.time_, reset) +
         util::get_and_reset_value(resolve_.time_, reset) +
         util::get_and_reset_value(unbind_.time_, reset) +
         util::get_and_reset_value(iterate_names_.time_, reset) +
-        util::get_and_reset_value(on_event_.time_, reset);
+        util::get_and_reset_value(on_event_.time_, reset) +
+        util::get_and_reset_value(find_prefix_.time_, reset);
 }
 
 // increment counter values
@@ -829,5 +941,10 @@ void symbol_namespace::counter_data::increment_on_event_count()
     ++on_event_.count_;
 }
 
+void symbol_namespace::counter_data::increment_find_prefix_count()
+{
+    ++find_prefix_.count_;
+}
+
 }}}
 
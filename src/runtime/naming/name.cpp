@@ -480,12 +480,38 @@ namespace hpx { namespace naming
     }   // detail
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // If integer compression is enabled, the locality prefix of a gid is
+        // encoded relative to the destination locality of the archive. Gids
+        // referring to the destination locality (which is the common case)
+        // then have a zero locality prefix which makes the variable-length
+        // encoding of the msb significantly shorter. The transformation is
+        // its own inverse.
+        inline boost::uint64_t compact_locality_prefix(boost::uint64_t msb,
+            boost::uint32_t dest_locality_id)
+        {
+            if (dest_locality_id == naming::invalid_locality_id)
+                return msb;
+            return msb ^ get_gid_from_locality_id(dest_locality_id).get_msb();
+        }
+    }
+
     template <typename T>
     void gid_type::save(
         T& ar
       , const unsigned int version) const
     {
-        ar << id_msb_ << id_lsb_;
+        if (ar.enable_integer_compression())
+        {
+            ar << detail::compact_locality_prefix(
+                    id_msb_, ar.get_dest_locality_id())
+               << id_lsb_;
+        }
+        else
+        {
+            ar << id_msb_ << id_lsb_;
+        }
     }
 
     template <typename T>
@@ -495,6 +521,12 @@ namespace hpx { namespace naming
     {
         ar >> id_msb_ >> id_lsb_;
 
+        if (ar.enable_integer_compression())
+        {
+            id_msb_ = detail::compact_locality_prefix(
+                id_msb_, ar.get_dest_locality_id());
+        }
+
         id_msb_ &= ~is_locked_mask;     // strip lock-bit upon receive
     }
 
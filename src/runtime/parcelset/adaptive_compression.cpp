@@ -0,0 +1,421 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/locks.hpp>
+
+#include <cstring>
+#include <iterator>
+
+namespace hpx { namespace parcelset
+{
+    ///////////////////////////////////////////////////////////////////////////
+    struct adaptive_compression::impl
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        // weight of a new sample in the running estimates (1/8)
+        static const int estimate_weight_shift = 3;
+
+        // compress every n-th message even if it does not seem to pay off
+        static const std::size_t sample_interval = 32;
+
+        impl()
+          : threshold_(0),
+            adaptive_(true),
+            ratio_(1.0),
+            compress_ns_per_byte_(0.0),
+            decompress_ns_per_byte_(0.0),
+            link_ns_per_byte_(0.0),
+            configured_link_ns_per_byte_(0.0),
+            have_compression_samples_(false),
+            skipped_since_sample_(0),
+            num_compressed_(0),
+            num_skipped_(0),
+            bytes_uncompressed_(0),
+            bytes_compressed_(0),
+            compression_time_(0),
+            decompression_time_(0)
+        {}
+
+        static void update_estimate(double& estimate, double sample,
+            bool first_sample)
+        {
+            if (first_sample)
+                estimate = sample;
+            else
+                estimate += (sample - estimate) / (1 << estimate_weight_shift);
+        }
+
+        // Compressing pays off if the time saved on the wire exceeds the
+        // time needed for compressing and decompressing the data. This has
+        // to be called while holding the lock.
+        bool pays_off() const
+        {
+            double link_ns_per_byte = configured_link_ns_per_byte_ != 0.0 ?
+                configured_link_ns_per_byte_ : link_ns_per_byte_;
+
+            // compress until there is enough data to decide
+            if (!have_compression_samples_ || link_ns_per_byte == 0.0)
+                return true;
+
+            double saved = (1.0 - ratio_) * link_ns_per_byte;
+            double cost = compress_ns_per_byte_ + decompress_ns_per_byte_;
+
+            return saved > cost;
+        }
+
+        serialization::binary_filter* create_filter(std::size_t size)
+        {
+            std::string codec;
+            {
+                boost::lock_guard<mutex_type> l(mtx_);
+
+                if (codec_.empty() || size < threshold_)
+                    return 0;
+
+                if (adaptive_ && !pays_off())
+                {
+                    if (++skipped_since_sample_ < sample_interval)
+                    {
+                        ++num_skipped_;
+                        return 0;
+                    }
+                    skipped_since_sample_ = 0;
+                }
+
+                codec = codec_;
+            }
+
+            return new adaptive_serialization_filter(codec);
+        }
+
+        void add_compression(std::size_t size, std::size_t compressed_size,
+            boost::int64_t time)
+        {
+            ++num_compressed_;
+            bytes_uncompressed_ += size;
+            bytes_compressed_ += compressed_size;
+            compression_time_ += time;
+
+            if (size == 0)
+                return;
+
+            boost::lock_guard<mutex_type> l(mtx_);
+            update_estimate(ratio_, double(compressed_size) / size,
+                !have_compression_samples_);
+            update_estimate(compress_ns_per_byte_, double(time) / size,
+                !have_compression_samples_);
+            have_compression_samples_ = true;
+        }
+
+        void add_decompression(std::size_t size, boost::int64_t time)
+        {
+            decompression_time_ += time;
+
+            if (size == 0)
+                return;
+
+            boost::lock_guard<mutex_type> l(mtx_);
+            update_estimate(decompress_ns_per_byte_, double(time) / size,
+                decompress_ns_per_byte_ == 0.0);
+        }
+
+        void add_transmission(std::size_t size, boost::int64_t time)
+        {
+            if (size == 0 || time <= 0)
+                return;
+
+            boost::lock_guard<mutex_type> l(mtx_);
+
+            // the transmission time of small messages is dominated by the
+            // latency, those would spoil the bandwidth estimate
+            if (codec_.empty() || size < threshold_)
+                return;
+
+            update_estimate(link_ns_per_byte_, double(time) / size,
+                link_ns_per_byte_ == 0.0);
+        }
+
+        boost::int64_t get_compression_ratio(bool reset)
+        {
+            boost::int64_t compressed =
+                util::get_and_reset_value(bytes_compressed_, reset);
+            boost::int64_t uncompressed =
+                util::get_and_reset_value(bytes_uncompressed_, reset);
+
+            if (uncompressed == 0)
+                return 0;
+            return (compressed * 100) / uncompressed;
+        }
+
+        mutex_type mtx_;
+
+        // configuration
+        std::string codec_;
+        std::size_t threshold_;
+        bool adaptive_;
+
+        // running estimates
+        double ratio_;
+        double compress_ns_per_byte_;
+        double decompress_ns_per_byte_;
+        double link_ns_per_byte_;
+        double configured_link_ns_per_byte_;
+        bool have_compression_samples_;
+        std::size_t skipped_since_sample_;
+
+        // statistics
+        boost::atomic<boost::int64_t> num_compressed_;
+        boost::atomic<boost::int64_t> num_skipped_;
+        boost::atomic<boost::int64_t> bytes_uncompressed_;
+        boost::atomic<boost::int64_t> bytes_compressed_;
+        boost::atomic<boost::int64_t> compression_time_;
+        boost::atomic<boost::int64_t> decompression_time_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_compression::adaptive_compression()
+      : impl_(new impl)
+    {}
+
+    adaptive_compression& adaptive_compression::instance()
+    {
+        // The instance is intentionally never destroyed as filters may be
+        // used during static destruction.
+        static adaptive_compression* compression = new adaptive_compression;
+        return *compression;
+    }
+
+    void adaptive_compression::configure(std::string const& codec,
+        std::size_t threshold, bool adaptive, boost::uint64_t bandwidth)
+    {
+        boost::lock_guard<impl::mutex_type> l(impl_->mtx_);
+
+        impl_->codec_ = codec;
+        impl_->threshold_ = threshold;
+        impl_->adaptive_ = adaptive;
+        impl_->configured_link_ns_per_byte_ =
+            bandwidth != 0 ? 1e9 / double(bandwidth) : 0.0;
+    }
+
+    serialization::binary_filter*
+    adaptive_compression::create_filter(std::size_t size)
+    {
+        return impl_->create_filter(size);
+    }
+
+    void adaptive_compression::add_compression(std::size_t size,
+        std::size_t compressed_size, boost::int64_t time)
+    {
+        impl_->add_compression(size, compressed_size, time);
+    }
+
+    void adaptive_compression::add_decompression(std::size_t size,
+        boost::int64_t time)
+    {
+        impl_->add_decompression(size, time);
+    }
+
+    void adaptive_compression::add_transmission(std::size_t size,
+        boost::int64_t time)
+    {
+        impl_->add_transmission(size, time);
+    }
+
+    boost::int64_t adaptive_compression::get_statistics(statistics_type type,
+        bool reset)
+    {
+        switch (type)
+        {
+        case num_compressed:
+            return util::get_and_reset_value(impl_->num_compressed_, reset);
+
+        case num_skipped:
+            return util::get_and_reset_value(impl_->num_skipped_, reset);
+
+        case compression_ratio:
+            return impl_->get_compression_ratio(reset);
+
+        case compression_time:
+            return util::get_and_reset_value(impl_->compression_time_, reset);
+
+        case decompression_time:
+            return util::get_and_reset_value(impl_->decompression_time_, reset);
+
+        default:
+            break;
+        }
+        return 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the first byte of the filtered data
+        enum adaptive_filter_data
+        {
+            data_uncompressed = 0,
+            data_compressed = 1
+        };
+    }
+
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    void adaptive_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    // The archive calls flush() repeatedly with a growing buffer until all
+    // data fits, the data is filtered only once.
+    bool adaptive_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        if (!flushed_)
+        {
+            compress();
+            flushed_ = true;
+        }
+
+        if (dst_count < filtered_.size())
+        {
+            written = 0;
+            return false;
+        }
+
+        std::memcpy(dst, filtered_.data(), filtered_.size());
+        written = filtered_.size();
+        return true;
+    }
+
+    void adaptive_serialization_filter::compress()
+    {
+        filtered_.clear();
+
+        if (!buffer_.empty())
+        {
+            util::high_resolution_timer timer;
+
+            // fall back to sending the data uncompressed if the codec is
+            // not available on this locality
+            error_code ec(lightweight);
+            std::unique_ptr<serialization::binary_filter> filter(
+                hpx::create_binary_filter(codec_.c_str(), true, 0, ec));
+
+            if (!ec && filter)
+            {
+                filter->set_max_length(buffer_.size());
+                filter->save(buffer_.data(), buffer_.size());
+
+                std::size_t current = 1;
+                filtered_.resize(buffer_.size() + buffer_.size() / 16 + 64);
+
+                do {
+                    std::size_t written = 0;
+                    bool flushed = filter->flush(&filtered_[current],
+                        filtered_.size() - current, written);
+
+                    current += written;
+                    if (flushed)
+                        break;
+
+                    filtered_.resize(filtered_.size() * 2);
+
+                } while (true);
+
+                adaptive_compression::instance().add_compression(
+                    buffer_.size(), current - 1, timer.elapsed_nanoseconds());
+
+                if (current - 1 < buffer_.size())
+                {
+                    filtered_[0] = detail::data_compressed;
+                    filtered_.resize(current);
+                    return;
+                }
+            }
+        }
+
+        // compressing did not reduce the size of the data
+        filtered_.resize(1);
+        filtered_[0] = detail::data_uncompressed;
+        filtered_.insert(filtered_.end(), buffer_.begin(), buffer_.end());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t adaptive_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        current_ = 0;
+        if (buffer[0] == detail::data_uncompressed)
+        {
+            codec_filter_.reset();
+            buffer_.assign(buffer + 1, buffer + size);
+            return buffer_.size();
+        }
+
+        util::high_resolution_timer timer;
+
+        codec_filter_.reset(hpx::create_binary_filter(codec_.c_str(), false));
+        std::size_t decompressed =
+            codec_filter_->init_data(buffer + 1, size - 1, buffer_size);
+
+        adaptive_compression::instance().add_decompression(
+            decompressed, timer.elapsed_nanoseconds());
+
+        return decompressed;
+    }
+
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (codec_filter_)
+        {
+            codec_filter_->load(dst, dst_count);
+            return;
+        }
+
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_serialization_filter::reset()
+    {
+        codec_filter_.reset();
+        buffer_.clear();
+        filtered_.clear();
+        current_ = 0;
+        flushed_ = false;
+        return true;
+    }
+}}
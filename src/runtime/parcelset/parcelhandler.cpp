@@ -13,8 +13,10 @@
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/size_class_pool.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/static_parcelports.hpp>
 #include <hpx/runtime/threads/threadmanager.hpp>
@@ -92,6 +94,27 @@ namespace hpx { namespace parcelset
         count_routed_(0),
         write_handler_(&default_write_handler)
     {
+        // configure the pool the parcelports draw their buffers from
+        util::size_class_pool::instance().configure(
+            util::get_entry_as<std::size_t>(cfg,
+                "hpx.parcel.buffer_pool.max_cached_bytes",
+                BOOST_PP_STRINGIZE(HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES)),
+            util::get_entry_as<int>(cfg,
+                "hpx.parcel.buffer_pool.huge_pages", "0") != 0);
+
+        // configure the compression of parcels not using an action specific
+        // binary filter
+        adaptive_compression::instance().configure(
+            util::get_entry_as<std::string>(cfg,
+                "hpx.parcel.compression.filter", ""),
+            util::get_entry_as<std::size_t>(cfg,
+                "hpx.parcel.compression.threshold",
+                BOOST_PP_STRINGIZE(HPX_PARCEL_COMPRESSION_THRESHOLD)),
+            util::get_entry_as<int>(cfg,
+                "hpx.parcel.compression.adaptive", "1") != 0,
+            util::get_entry_as<boost::uint64_t>(cfg,
+                "hpx.parcel.compression.bandwidth", "0"));
+
         for (plugins::parcelport_factory_base* factory : get_parcelport_factories())
         {
             boost::shared_ptr<parcelport> pp;
@@ -776,6 +799,36 @@ namespace hpx { namespace parcelset
         util::function_nonser<boost::int64_t(bool)> outgoing_routed_count(
             util::bind(&parcelhandler::get_parcel_routed_count, this, _1));
 
+        // register counters for the parcel buffer pool
+        util::size_class_pool& pool = util::size_class_pool::instance();
+        util::function_nonser<boost::int64_t(bool)> buffer_pool_allocations(
+            util::bind(&util::size_class_pool::get_statistics, &pool,
+                util::size_class_pool::num_allocations, _1));
+        util::function_nonser<boost::int64_t(bool)> buffer_pool_allocations_avoided(
+            util::bind(&util::size_class_pool::get_statistics, &pool,
+                util::size_class_pool::num_allocations_avoided, _1));
+        util::function_nonser<boost::int64_t(bool)> buffer_pool_bytes_resident(
+            util::bind(&util::size_class_pool::get_statistics, &pool,
+                util::size_class_pool::num_bytes_resident, _1));
+
+        // register counters for the globally enabled compression
+        adaptive_compression& compression = adaptive_compression::instance();
+        util::function_nonser<boost::int64_t(bool)> compression_compressed(
+            util::bind(&adaptive_compression::get_statistics, &compression,
+                adaptive_compression::num_compressed, _1));
+        util::function_nonser<boost::int64_t(bool)> compression_skipped(
+            util::bind(&adaptive_compression::get_statistics, &compression,
+                adaptive_compression::num_skipped, _1));
+        util::function_nonser<boost::int64_t(bool)> compression_ratio(
+            util::bind(&adaptive_compression::get_statistics, &compression,
+                adaptive_compression::compression_ratio, _1));
+        util::function_nonser<boost::int64_t(bool)> compression_time(
+            util::bind(&adaptive_compression::get_statistics, &compression,
+                adaptive_compression::compression_time, _1));
+        util::function_nonser<boost::int64_t(bool)> decompression_time(
+            util::bind(&adaptive_compression::get_statistics, &compression,
+                adaptive_compression::decompression_time, _1));
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { "/parcelqueue/length/receive",
@@ -805,6 +858,86 @@ namespace hpx { namespace parcelset
                   _1, outgoing_routed_count, _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { "/parcels/count/buffer-pool/allocations",
+              performance_counters::counter_raw,
+              "returns the number of parcel buffers allocated by all "
+                  "parcelports using the buffer pool",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_allocations, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/buffer-pool/allocations-avoided",
+              performance_counters::counter_raw,
+              "returns the number of parcel buffer allocations which were "
+                  "served from the buffer pool without calling the system "
+                  "allocator",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_allocations_avoided, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/buffer-pool/bytes-resident",
+              performance_counters::counter_raw,
+              "returns the number of bytes currently allocated from the system "
+                  "by the parcel buffer pool",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_bytes_resident, _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { "/parcels/count/compression/compressed",
+              performance_counters::counter_raw,
+              "returns the number of messages which were compressed as "
+                  "compression was enabled globally",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, compression_compressed, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/compression/skipped",
+              performance_counters::counter_raw,
+              "returns the number of messages larger than the compression "
+                  "threshold which were sent uncompressed as compressing "
+                  "them was not expected to pay off",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, compression_skipped, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/compression/ratio",
+              performance_counters::counter_raw,
+              "returns the size of the compressed messages relative to their "
+                  "uncompressed size (in percent)",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, compression_ratio, _2),
+              &performance_counters::locality_counter_discoverer,
+              "%"
+            },
+            { "/parcels/compression/time/compress",
+              performance_counters::counter_raw,
+              "returns the overall time spent compressing messages",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, compression_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { "/parcels/compression/time/decompress",
+              performance_counters::counter_raw,
+              "returns the overall time spent decompressing messages",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, decompression_time, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
             }
         };
         performance_counters::install_counter_types(
@@ -1181,6 +1314,7 @@ namespace hpx { namespace parcelset
                 BOOST_PP_STRINGIZE(HPX_PARCEL_MAX_CONNECTIONS) "}",
             "max_connections_per_locality = ${HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY:"
                 BOOST_PP_STRINGIZE(HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY) "}",
+            "priority_connections = ${HPX_PARCEL_PRIORITY_CONNECTIONS:0}",
             "max_message_size = ${HPX_PARCEL_MAX_MESSAGE_SIZE:"
                 BOOST_PP_STRINGIZE(HPX_PARCEL_MAX_MESSAGE_SIZE) "}",
             "max_outbound_message_size = ${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:"
@@ -1193,9 +1327,22 @@ namespace hpx { namespace parcelset
             "array_optimization = ${HPX_PARCEL_ARRAY_OPTIMIZATION:1}",
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.array_optimization]}",
+            "integer_compression = ${HPX_PARCEL_INTEGER_COMPRESSION:0}",
             "enable_security = ${HPX_PARCEL_ENABLE_SECURITY:0}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
-            "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:0}"
+            "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:0}",
+
+            "[hpx.parcel.buffer_pool]",
+            "max_cached_bytes = ${HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES:"
+                BOOST_PP_STRINGIZE(HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES) "}",
+            "huge_pages = ${HPX_PARCEL_BUFFER_POOL_HUGE_PAGES:0}",
+
+            "[hpx.parcel.compression]",
+            "filter = ${HPX_PARCEL_COMPRESSION_FILTER:}",
+            "threshold = ${HPX_PARCEL_COMPRESSION_THRESHOLD:"
+                BOOST_PP_STRINGIZE(HPX_PARCEL_COMPRESSION_THRESHOLD) "}",
+            "adaptive = ${HPX_PARCEL_COMPRESSION_ADAPTIVE:1}",
+            "bandwidth = ${HPX_PARCEL_COMPRESSION_BANDWIDTH:0}"
             ;
 
         for (plugins::parcelport_factory_base* factory : get_parcelport_factories())
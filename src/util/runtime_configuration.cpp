@@ -218,6 +218,8 @@ namespace hpx { namespace util
                 "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:"
                 BOOST_PP_STRINGIZE(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
                 "}",
+            "refcnt_flush_interval = ${HPX_AGAS_REFCNT_FLUSH_INTERVAL:"
+                BOOST_PP_STRINGIZE(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL) "}",
             "service_mode = hosted",
             "dedicated_server = 0",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:"
@@ -226,6 +228,12 @@ namespace hpx { namespace util
                 BOOST_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
+            "hashed_primary_namespace = ${HPX_AGAS_HASHED_PRIMARY_NAMESPACE:0}",
+            "local_address_table_size = ${HPX_AGAS_LOCAL_ADDRESS_TABLE_SIZE:"
+                BOOST_PP_STRINGIZE(HPX_INITIAL_AGAS_LOCAL_ADDRESS_TABLE_SIZE)
+                "}",
+            "bootstrap_fanout = ${HPX_AGAS_BOOTSTRAP_FANOUT:"
+                BOOST_PP_STRINGIZE(HPX_INITIAL_AGAS_BOOTSTRAP_FANOUT) "}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
@@ -653,6 +661,18 @@ namespace hpx { namespace util
         return false;
     }
 
+    bool runtime_configuration::get_agas_hashed_primary_namespace_mode() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (NULL != sec) {
+                return hpx::util::get_entry_as<int>(
+                    *sec, "hashed_primary_namespace", "0") != 0;
+            }
+        }
+        return false;
+    }
+
     std::size_t
     runtime_configuration::get_agas_max_pending_refcnt_requests() const
     {
@@ -667,6 +687,45 @@ namespace hpx { namespace util
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    boost::int64_t runtime_configuration::get_agas_refcnt_flush_interval() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (NULL != sec) {
+                return hpx::util::get_entry_as<boost::int64_t>(
+                    *sec, "refcnt_flush_interval",
+                    HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL);
+            }
+        }
+        return HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL;
+    }
+
+    std::size_t runtime_configuration::get_agas_local_address_table_size() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (NULL != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_address_table_size",
+                    HPX_INITIAL_AGAS_LOCAL_ADDRESS_TABLE_SIZE);
+            }
+        }
+        return HPX_INITIAL_AGAS_LOCAL_ADDRESS_TABLE_SIZE;
+    }
+
+    std::size_t runtime_configuration::get_agas_bootstrap_fanout() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (NULL != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "bootstrap_fanout",
+                    HPX_INITIAL_AGAS_BOOTSTRAP_FANOUT);
+            }
+        }
+        return HPX_INITIAL_AGAS_BOOTSTRAP_FANOUT;
+    }
+
     // Get whether the AGAS server is running as a dedicated runtime.
     // This decides whether the AGAS actions are executed with normal
     // priority (if dedicated) or with high priority (non-dedicated)
@@ -0,0 +1,349 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/size_class_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    struct size_class_pool::impl
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        // 64 bytes up to 64 MBytes
+        static const std::size_t min_class_shift = 6;
+        static const std::size_t max_class_shift = 26;
+        static const std::size_t num_size_classes =
+            max_class_shift - min_class_shift + 1;
+
+        // limits of the thread local caches (per size class)
+        static const std::size_t max_thread_cached_blocks = 64;
+        static const std::size_t max_thread_cached_bytes = 4 * 1024 * 1024;
+
+        // blocks of at least this size are allocated directly from the OS
+        static const std::size_t huge_page_size = 2 * 1024 * 1024;
+
+        struct thread_cache
+        {
+            std::vector<void*> blocks_[num_size_classes];
+        };
+
+        // The thread local caches are handed back to the shared free lists
+        // whenever an OS-thread exits. Blocks may be returned to the pool
+        // before the thread_specific_ptr was constructed or after it was
+        // destroyed (static initialization/destruction), in which case the
+        // thread local caches are bypassed.
+        struct thread_cache_holder
+        {
+            thread_cache_holder()
+              : ptr_(&impl::release_thread_cache)
+            {
+                alive_ = true;
+            }
+
+            ~thread_cache_holder()
+            {
+                alive_ = false;
+            }
+
+            boost::thread_specific_ptr<thread_cache> ptr_;
+            static bool alive_;
+        };
+        static thread_cache_holder thread_cache_;
+
+        struct free_list
+        {
+            mutex_type mtx_;
+            std::vector<void*> blocks_;
+        };
+
+        impl()
+          : cached_bytes_(0),
+            max_cached_bytes_(HPX_PARCEL_BUFFER_POOL_MAX_CACHED_BYTES),
+            use_huge_pages_(false),
+            allocations_(0),
+            allocations_avoided_(0),
+            bytes_resident_(0)
+        {}
+
+        static std::size_t get_size_class(std::size_t size)
+        {
+            std::size_t size_class = 0;
+            std::size_t block_size = std::size_t(1) << min_class_shift;
+            while (block_size < size)
+            {
+                block_size <<= 1;
+                ++size_class;
+            }
+            return size_class;
+        }
+
+        static std::size_t get_block_size(std::size_t size_class)
+        {
+            return std::size_t(1) << (size_class + min_class_shift);
+        }
+
+        static std::size_t get_thread_cache_capacity(std::size_t size_class)
+        {
+            std::size_t capacity =
+                max_thread_cached_bytes / get_block_size(size_class);
+            return capacity < max_thread_cached_blocks ?
+                capacity : max_thread_cached_blocks;
+        }
+
+        static thread_cache* get_thread_cache()
+        {
+            if (!thread_cache_holder::alive_)
+                return 0;
+
+            thread_cache* cache = thread_cache_.ptr_.get();
+            if (0 == cache)
+            {
+                cache = new thread_cache;
+                thread_cache_.ptr_.reset(cache);
+            }
+            return cache;
+        }
+
+        // invoked on thread exit
+        static void release_thread_cache(thread_cache* cache)
+        {
+            size_class_pool::instance().impl_->flush_thread_cache(*cache);
+            delete cache;
+        }
+
+        void flush_thread_cache(thread_cache& cache)
+        {
+            for (std::size_t i = 0; i != num_size_classes; ++i)
+            {
+                std::vector<void*>& blocks = cache.blocks_[i];
+                std::size_t block_size = get_block_size(i);
+
+                // the blocks are already accounted for in cached_bytes_,
+                // release them only if the limit was lowered in the meantime
+                while (!blocks.empty() && cached_bytes_ > max_cached_bytes_)
+                {
+                    cached_bytes_ -= block_size;
+                    deallocate_system(blocks.back(), block_size);
+                    blocks.pop_back();
+                }
+
+                if (!blocks.empty())
+                {
+                    free_list& fl = free_lists_[i];
+                    boost::lock_guard<mutex_type> l(fl.mtx_);
+                    fl.blocks_.insert(fl.blocks_.end(),
+                        blocks.begin(), blocks.end());
+                }
+                blocks.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void* allocate_system(std::size_t size)
+        {
+            void* p = 0;
+#if defined(__linux__)
+            if (size >= huge_page_size)
+            {
+                p = mmap(0, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED)
+                    throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+                if (use_huge_pages_)
+                    madvise(p, size, MADV_HUGEPAGE);
+#endif
+            }
+            else
+#endif
+            {
+                p = std::malloc(size);
+                if (0 == p)
+                    throw std::bad_alloc();
+            }
+
+            bytes_resident_ += size;
+            return p;
+        }
+
+        void deallocate_system(void* p, std::size_t size)
+        {
+            bytes_resident_ -= size;
+#if defined(__linux__)
+            if (size >= huge_page_size)
+            {
+                munmap(p, size);
+                return;
+            }
+#endif
+            std::free(p);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void* allocate(std::size_t size)
+        {
+            ++allocations_;
+
+            if (size > get_block_size(num_size_classes - 1))
+                return allocate_system(size);
+
+            std::size_t size_class = get_size_class(size);
+            std::size_t block_size = get_block_size(size_class);
+
+            // try the thread local cache first
+            if (thread_cache* tc = get_thread_cache())
+            {
+                std::vector<void*>& cache = tc->blocks_[size_class];
+                if (!cache.empty())
+                {
+                    void* p = cache.back();
+                    cache.pop_back();
+                    cached_bytes_ -= block_size;
+                    ++allocations_avoided_;
+                    return p;
+                }
+            }
+
+            // now try the shared free list
+            {
+                free_list& fl = free_lists_[size_class];
+                boost::lock_guard<mutex_type> l(fl.mtx_);
+                if (!fl.blocks_.empty())
+                {
+                    void* p = fl.blocks_.back();
+                    fl.blocks_.pop_back();
+                    cached_bytes_ -= block_size;
+                    ++allocations_avoided_;
+                    return p;
+                }
+            }
+
+            return allocate_system(block_size);
+        }
+
+        void deallocate(void* p, std::size_t size)
+        {
+            if (0 == p)
+                return;
+
+            if (size > get_block_size(num_size_classes - 1))
+            {
+                deallocate_system(p, size);
+                return;
+            }
+
+            std::size_t size_class = get_size_class(size);
+            std::size_t block_size = get_block_size(size_class);
+
+            // the thread local caches and the shared free lists together
+            // may not hold more than the configured amount of memory
+            if (cached_bytes_ + block_size > max_cached_bytes_)
+            {
+                deallocate_system(p, block_size);
+                return;
+            }
+
+            // keep the block in the thread local cache, if possible
+            if (thread_cache* tc = get_thread_cache())
+            {
+                std::vector<void*>& cache = tc->blocks_[size_class];
+                if (cache.size() < get_thread_cache_capacity(size_class))
+                {
+                    cache.push_back(p);
+                    cached_bytes_ += block_size;
+                    return;
+                }
+            }
+
+            // otherwise hand it to the shared free list
+            {
+                free_list& fl = free_lists_[size_class];
+                boost::lock_guard<mutex_type> l(fl.mtx_);
+                fl.blocks_.push_back(p);
+                cached_bytes_ += block_size;
+            }
+        }
+
+        free_list free_lists_[num_size_classes];
+        boost::atomic<std::size_t> cached_bytes_;
+
+        boost::atomic<std::size_t> max_cached_bytes_;
+        boost::atomic<bool> use_huge_pages_;
+
+        boost::atomic<boost::int64_t> allocations_;
+        boost::atomic<boost::int64_t> allocations_avoided_;
+        boost::atomic<boost::int64_t> bytes_resident_;
+    };
+
+    bool size_class_pool::impl::thread_cache_holder::alive_ = false;
+    size_class_pool::impl::thread_cache_holder
+        size_class_pool::impl::thread_cache_;
+
+    ///////////////////////////////////////////////////////////////////////////
+    size_class_pool::size_class_pool()
+      : impl_(new impl)
+    {}
+
+    size_class_pool& size_class_pool::instance()
+    {
+        // The pool is intentionally never destroyed as memory blocks may be
+        // returned during static destruction.
+        static size_class_pool* pool = new size_class_pool;
+        return *pool;
+    }
+
+    void* size_class_pool::allocate(std::size_t size)
+    {
+        return impl_->allocate(size);
+    }
+
+    void size_class_pool::deallocate(void* p, std::size_t size)
+    {
+        impl_->deallocate(p, size);
+    }
+
+    void size_class_pool::configure(std::size_t max_cached_bytes,
+        bool use_huge_pages)
+    {
+        impl_->max_cached_bytes_.store(max_cached_bytes);
+        impl_->use_huge_pages_.store(use_huge_pages);
+    }
+
+    boost::int64_t size_class_pool::get_statistics(statistics_type type,
+        bool reset)
+    {
+        switch (type)
+        {
+        case num_allocations:
+            return util::get_and_reset_value(impl_->allocations_, reset);
+
+        case num_allocations_avoided:
+            return util::get_and_reset_value(impl_->allocations_avoided_, reset);
+
+        case num_bytes_resident:
+            return impl_->bytes_resident_;
+
+        default:
+            break;
+        }
+        return 0;
+    }
+}}
@@ -159,6 +159,11 @@ namespace hpx
 #else
         strm << "  HPX_HAVE_COMPRESSION_BZIP2=OFF\n";
 #endif
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+        strm << "  HPX_HAVE_COMPRESSION_LZ4=ON\n";
+#else
+        strm << "  HPX_HAVE_COMPRESSION_LZ4=OFF\n";
+#endif
 #if defined(HPX_HAVE_COMPRESSION_SNAPPY)
         strm << "  HPX_HAVE_COMPRESSION_SNAPPY=ON\n";
 #else
@@ -169,6 +174,11 @@ namespace hpx
 #else
         strm << "  HPX_HAVE_COMPRESSION_ZLIB=OFF\n";
 #endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+        strm << "  HPX_HAVE_COMPRESSION_ZSTD=ON\n";
+#else
+        strm << "  HPX_HAVE_COMPRESSION_ZSTD=OFF\n";
+#endif
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         strm << "  HPX_HAVE_PARCEL_COALESCING=ON\n";
 #else
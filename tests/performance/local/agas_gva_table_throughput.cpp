@@ -0,0 +1,201 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the tables used by the AGAS
+// primary namespace (binding, resolving, and unbinding ids and changing their
+// reference counts) while being accessed by many threads concurrently.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/detail/gva_table.hpp>
+#include <hpx/runtime/agas/detail/refcnt_table.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <boost/format.hpp>
+#include <boost/cstdint.hpp>
+
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::naming::gid_type;
+using hpx::agas::gva;
+using hpx::agas::detail::gva_table;
+using hpx::agas::detail::refcnt_table;
+
+///////////////////////////////////////////////////////////////////////////////
+gva_table table;
+refcnt_table refcnts;
+
+boost::uint64_t num_objects = 0;
+boost::uint64_t num_resolves = 0;
+
+// each task works on its own set of ids, the ids of all tasks are interleaved
+inline gid_type get_gid(boost::uint64_t task, boost::uint64_t num_tasks,
+    boost::uint64_t i)
+{
+    return gid_type(0x100000001ULL, 0x1000 + i * num_tasks + task);
+}
+
+void bind_objects(boost::uint64_t task, boost::uint64_t num_tasks)
+{
+    gid_type locality(0x100000001ULL, 0);
+    for (boost::uint64_t i = 0; i != num_objects; ++i)
+    {
+        gva g(locality, 1, 1, i, 0);
+        if (table.bind(get_gid(task, num_tasks, i),
+                gva_table::data_type(g, locality), true) !=
+            gva_table::bind_inserted)
+        {
+            throw std::logic_error("error: binding an object failed");
+        }
+    }
+}
+
+void resolve_objects(boost::uint64_t task, boost::uint64_t num_tasks)
+{
+    gid_type base;
+    gva_table::data_type data;
+
+    boost::uint64_t total = num_objects * num_tasks;
+    boost::uint64_t id = task;
+    for (boost::uint64_t i = 0; i != num_resolves; ++i)
+    {
+        // resolve the ids of all tasks
+        id = (id + 0x9E3779B97F4A7C15ULL) % total;
+        if (!table.resolve(gid_type(0x100000001ULL, 0x1000 + id), base, data))
+            throw std::logic_error("error: resolving an object failed");
+    }
+}
+
+void change_credits(boost::uint64_t task, boost::uint64_t num_tasks)
+{
+    std::list<gid_type> freed;
+    gid_type invalid_id;
+    boost::int64_t invalid_count = 0;
+
+    for (boost::uint64_t i = 0; i != num_objects; ++i)
+    {
+        gid_type lower = get_gid(task, num_tasks, i);
+        gid_type upper = lower + 1;
+        if (!refcnts.change(lower, upper, 16, freed, invalid_id,
+                invalid_count) ||
+            !refcnts.change(lower, upper, -16, freed, invalid_id,
+                invalid_count))
+        {
+            throw std::logic_error("error: changing credits failed");
+        }
+    }
+}
+
+void unbind_objects(boost::uint64_t task, boost::uint64_t num_tasks)
+{
+    gva_table::data_type data;
+    for (boost::uint64_t i = 0; i != num_objects; ++i)
+    {
+        if (table.unbind(get_gid(task, num_tasks, i), 1, data) !=
+            gva_table::unbind_removed)
+        {
+            throw std::logic_error("error: unbinding an object failed");
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_tasks(F f, boost::uint64_t num_tasks)
+{
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::util::high_resolution_timer t;
+    for (boost::uint64_t task = 0; task != num_tasks; ++task)
+        tasks.push_back(hpx::async(f, task, num_tasks));
+
+    hpx::wait_all(tasks);
+    for (hpx::future<void>& task : tasks)
+        task.get();
+
+    return t.elapsed();
+}
+
+void print_result(char const* name, boost::uint64_t ops, double elapsed,
+    bool csv)
+{
+    if (csv)
+    {
+        hpx::cout << (boost::format("%1%,%2%,%3%\n")
+            % name % ops % elapsed) << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << (boost::format("%1%: %2% operations in %3% [s], "
+            "%4% [ops/s]\n") % name % ops % elapsed % (ops / elapsed))
+            << hpx::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        num_objects = vm["objects"].as<boost::uint64_t>();
+        num_resolves = vm["resolves"].as<boost::uint64_t>();
+        boost::uint64_t num_tasks = vm["tasks"].as<boost::uint64_t>();
+        bool csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == num_tasks))
+            num_tasks = hpx::get_os_thread_count();
+
+        if (HPX_UNLIKELY(0 == num_objects))
+            throw std::logic_error("error: count of 0 objects specified\n");
+
+        boost::uint64_t total = num_objects * num_tasks;
+
+        print_result("bind", total,
+            run_tasks(&bind_objects, num_tasks), csv);
+        print_result("resolve", num_resolves * num_tasks,
+            run_tasks(&resolve_objects, num_tasks), csv);
+        print_result("credit", 2 * total,
+            run_tasks(&change_credits, num_tasks), csv);
+        print_result("unbind", total,
+            run_tasks(&unbind_objects, num_tasks), csv);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "objects"
+        , value<boost::uint64_t>()->default_value(100000)
+        , "number of objects bound by each task")
+
+        ( "resolves"
+        , value<boost::uint64_t>()->default_value(1000000)
+        , "number of ids resolved by each task")
+
+        ( "tasks"
+        , value<boost::uint64_t>()->default_value(0)
+        , "number of concurrent tasks (default: number of OS threads)")
+
+        ( "csv"
+        , "output results as csv (format: operation,count,duration)")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
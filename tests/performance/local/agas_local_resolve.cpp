@@ -0,0 +1,157 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of resolving the ids of components
+// which were created on the calling locality: invoking an action on such a
+// component, retrieving a pointer to it, and resolving its id.
+//
+// The results are to be compared to a run with the local address table
+// disabled:
+//
+//      agas_local_resolve --hpx:ini=hpx.agas.local_address_table_size=0
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/interface.hpp>
+#include <hpx/runtime/get_ptr.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <boost/format.hpp>
+#include <boost/cstdint.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+    void call() {}
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::id_type> objects;
+
+void invoke_actions(boost::uint64_t num_calls)
+{
+    call_action act;
+    for (boost::uint64_t i = 0; i != num_calls; ++i)
+        hpx::async(act, objects[i % objects.size()]).get();
+}
+
+void get_pointers(boost::uint64_t num_calls)
+{
+    for (boost::uint64_t i = 0; i != num_calls; ++i)
+    {
+        if (!hpx::get_ptr<test_server>(objects[i % objects.size()]).get())
+            throw std::logic_error("error: retrieving a pointer failed");
+    }
+}
+
+void resolve_ids(boost::uint64_t num_calls)
+{
+    for (boost::uint64_t i = 0; i != num_calls; ++i)
+    {
+        if (!hpx::agas::resolve_sync(objects[i % objects.size()]))
+            throw std::logic_error("error: resolving an object failed");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run(F f, boost::uint64_t num_calls)
+{
+    hpx::util::high_resolution_timer t;
+    f(num_calls);
+    return t.elapsed();
+}
+
+void print_result(char const* name, boost::uint64_t ops, double elapsed,
+    bool csv)
+{
+    if (csv)
+    {
+        hpx::cout << (boost::format("%1%,%2%,%3%\n")
+            % name % ops % elapsed) << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << (boost::format("%1%: %2% operations in %3% [s], "
+            "%4% [us/op]\n") % name % ops % elapsed % (1e6 * elapsed / ops))
+            << hpx::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        boost::uint64_t num_objects = vm["objects"].as<boost::uint64_t>();
+        boost::uint64_t num_calls = vm["calls"].as<boost::uint64_t>();
+        bool csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == num_objects))
+            throw std::logic_error("error: count of 0 objects specified\n");
+
+        objects = hpx::new_<test_server[]>(hpx::find_here(), num_objects).get();
+
+        if (!csv)
+        {
+            hpx::cout << "local address table size: "
+                      << hpx::get_config_entry(
+                            "hpx.agas.local_address_table_size", "0")
+                      << "\n" << hpx::flush;
+        }
+
+        // warm up the caches
+        run(&resolve_ids, num_objects);
+
+        print_result("async", num_calls, run(&invoke_actions, num_calls), csv);
+        print_result("get_ptr", num_calls, run(&get_pointers, num_calls), csv);
+        print_result("resolve", num_calls, run(&resolve_ids, num_calls), csv);
+
+        objects.clear();
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "objects"
+        , value<boost::uint64_t>()->default_value(1000)
+        , "number of local components")
+
+        ( "calls"
+        , value<boost::uint64_t>()->default_value(1000000)
+        , "number of calls of each kind")
+
+        ( "csv"
+        , "output results as csv (format: operation,count,duration)")
+        ;
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
@@ -8,12 +8,17 @@
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/runtime/serialization/shared_ptr.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
 
 #include <algorithm>
 #include <iterator>
 #include <fstream>
+#include <vector>
 
 #include <boost/format.hpp>
+#include <boost/ref.hpp>
+#include <boost/shared_ptr.hpp>
 
 // This function will never be called
 int test_function(hpx::serialization::serialize_buffer<double> const& b)
@@ -22,6 +27,49 @@ int test_function(hpx::serialization::serialize_buffer<double> const& b)
 }
 HPX_PLAIN_ACTION(test_function, test_action)
 
+///////////////////////////////////////////////////////////////////////////////
+// A pointer-heavy payload: each node of the mesh refers to some of the nodes
+// created before it.
+struct mesh_node
+{
+    double value_;
+    std::vector<boost::shared_ptr<mesh_node> > neighbors_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & value_ & neighbors_;
+    }
+};
+
+typedef std::vector<boost::shared_ptr<mesh_node> > mesh_type;
+
+mesh_type create_mesh(std::size_t num_nodes)
+{
+    mesh_type mesh;
+    mesh.reserve(num_nodes);
+    for (std::size_t i = 0; i != num_nodes; ++i)
+    {
+        boost::shared_ptr<mesh_node> node(new mesh_node);
+        node->value_ = double(i);
+        if (i != 0)
+            node->neighbors_.push_back(mesh[i - 1]);
+        if (i > 1)
+            node->neighbors_.push_back(mesh[i - 2]);
+        if (i > 2)
+            node->neighbors_.push_back(mesh[i / 2]);
+        mesh.push_back(node);
+    }
+    return mesh;
+}
+
+// This function will never be called
+int test_mesh_function(mesh_type const& mesh)
+{
+    return 42;
+}
+HPX_PLAIN_ACTION(test_mesh_function, test_mesh_action)
+
 std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     boost::uint32_t flags,
     std::vector<hpx::serialization::serialization_chunk>* chunks)
@@ -35,10 +83,35 @@ std::size_t get_archive_size(hpx::parcelset::parcel const& p,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-double benchmark_serialization(std::size_t data_size, std::size_t iterations,
-    bool continuation, bool zerocopy)
+template <typename Action, typename Arg>
+hpx::parcelset::parcel create_parcel(hpx::naming::address const& addr,
+    bool continuation, Arg const& arg)
 {
     hpx::naming::id_type const here = hpx::find_here();
+
+    // create a parcel with/without continuation
+    hpx::parcelset::parcel p;
+    if (continuation) {
+        p = hpx::parcelset::parcel(here, addr,
+            hpx::actions::typed_continuation<int>(here),
+            Action(), hpx::threads::thread_priority_normal, arg
+            );
+    }
+    else {
+        p = hpx::parcelset::parcel(here, addr,
+            Action(), hpx::threads::thread_priority_normal, arg);
+    }
+
+    p.parcel_id() = hpx::parcelset::parcel::generate_unique_id();
+    p.set_source_id(here);
+
+    return p;
+}
+
+double benchmark_serialization(std::size_t data_size, std::size_t mesh_size,
+    std::size_t iterations, bool continuation, bool zerocopy,
+    bool compress_integers, std::size_t& archive_size)
+{
     hpx::naming::address addr(hpx::get_locality(),
         hpx::components::component_invalid,
         reinterpret_cast<boost::uint64_t>(&test_function));
@@ -79,6 +152,9 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
         }
     }
 
+    if (compress_integers)
+        out_archive_flags |= hpx::serialization::enable_integer_compression;
+
     // create argument for action
     std::vector<double> data;
     data.resize(data_size);
@@ -86,22 +162,17 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
     hpx::serialization::serialize_buffer<double> buffer(data.data(), data.size(),
         hpx::serialization::serialize_buffer<double>::reference);
 
-    // create a parcel with/without continuation
     hpx::parcelset::parcel outp;
-    if (continuation) {
-        outp = hpx::parcelset::parcel(here, addr,
-            hpx::actions::typed_continuation<int>(here),
-            test_action(), hpx::threads::thread_priority_normal, buffer
-            );
+    if (mesh_size != 0)
+    {
+        outp = create_parcel<test_mesh_action>(addr, continuation,
+            create_mesh(mesh_size));
     }
-    else {
-        outp = hpx::parcelset::parcel(here, addr,
-            test_action(), hpx::threads::thread_priority_normal, buffer);
+    else
+    {
+        outp = create_parcel<test_action>(addr, continuation, buffer);
     }
 
-    outp.parcel_id() = hpx::parcelset::parcel::generate_unique_id();
-    outp.set_source_id(here);
-
     std::vector<hpx::serialization::serialization_chunk>* chunks = 0;
     if (zerocopy)
         chunks = new std::vector<hpx::serialization::serialization_chunk>();
@@ -124,6 +195,8 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
             arg_size = archive.bytes_written();
         }
 
+        archive_size = arg_size;
+
         hpx::parcelset::parcel inp;
 
         {
@@ -143,6 +216,7 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
 
 ///////////////////////////////////////////////////////////////////////////////
 std::size_t data_size = 1;
+std::size_t mesh_size = 0;
 std::size_t iterations = 1000;
 std::size_t concurrency = 1;
 
@@ -151,13 +225,16 @@ int hpx_main(boost::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool continuation = vm.count("continuation") != 0;
     bool zerocopy = vm.count("zerocopy") != 0;
+    bool compress_integers = vm.count("integer-compression") != 0;
 
+    std::vector<std::size_t> archive_sizes(concurrency, 0);
     std::vector<hpx::future<double> > timings;
     for (std::size_t i = 0; i != concurrency; ++i)
     {
         timings.push_back(hpx::async(
-            &benchmark_serialization, data_size, iterations,
-            continuation, zerocopy));
+            &benchmark_serialization, data_size, mesh_size, iterations,
+            continuation, zerocopy, compress_integers,
+            boost::ref(archive_sizes[i])));
     }
 
     double overall_time = 0;
@@ -165,10 +242,13 @@ int hpx_main(boost::program_options::variables_map& vm)
         overall_time += timings[i].get();
 
     if (print_header)
-        hpx::cout << "datasize,testcount,average_time[s]\n" << hpx::flush;
+        hpx::cout << "datasize,meshsize,testcount,average_time[s],"
+                     "archive_size[bytes]\n"
+                  << hpx::flush;
 
-    hpx::cout << (boost::format("%d,%d,%f\n") %
-        data_size % iterations % (overall_time / concurrency)) << hpx::flush;
+    hpx::cout << (boost::format("%d,%d,%d,%f,%d\n") %
+        data_size % mesh_size % iterations % (overall_time / concurrency) %
+        archive_sizes[0]) << hpx::flush;
 
     return hpx::finalize();
 }
@@ -188,6 +268,11 @@ int main(int argc, char* argv[])
         , boost::program_options::value<std::size_t>(&data_size)->default_value(1)
         , "size of data buffer to serialize in bytes (default: 1)")
 
+        ( "mesh_size"
+        , boost::program_options::value<std::size_t>(&mesh_size)->default_value(0)
+        , "number of nodes of a mesh of shared pointers to serialize instead "
+          "of the data buffer (default: 0)")
+
         ( "iterations"
         , boost::program_options::value<std::size_t>(&iterations)->default_value(1000)
         , "number of iterations while measuring serialization overhead (default: 1000)")
@@ -198,6 +283,9 @@ int main(int argc, char* argv[])
         ( "zerocopy"
         , "use zero copy serialization of bitwise copyable arguments")
 
+        ( "integer-compression"
+        , "use variable-length encoding for integers and global ids")
+
         ( "no-header"
         , "do not print out the csv header row")
         ;
@@ -0,0 +1,169 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the parallel sorting algorithms against their
+// sequential counterparts from the standard library. All timings are given in
+// seconds and are averaged over test_count runs on the same input data.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/iostreams.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+
+std::vector<boost::uint64_t> make_data(std::size_t size)
+{
+    std::vector<boost::uint64_t> data(size);
+    std::generate(boost::begin(data), boost::end(data),
+        []() { return boost::uint64_t(std::rand()); });
+    return data;
+}
+
+// Invoke f on a fresh copy of the input data test_count times and return the
+// average execution time in nanoseconds.
+template <typename F>
+boost::uint64_t average_out(std::vector<boost::uint64_t> const& input, F && f)
+{
+    boost::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<boost::uint64_t> data(input);
+
+        boost::uint64_t start = hpx::util::high_resolution_clock::now();
+        f(data);
+        time += hpx::util::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+typedef std::vector<boost::uint64_t>::iterator iterator;
+
+void print_result(bool csvoutput, char const* name, boost::uint64_t time)
+{
+    if (csvoutput)
+    {
+        hpx::cout << "," << time/1e9 << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << name << ": " << std::right
+            << std::setw(30) << time/1e9 << "\n" << hpx::flush;
+    }
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be less than zero...\n" << hpx::flush;
+        return hpx::finalize();
+    }
+
+    using hpx::parallel::par;
+    std::vector<boost::uint64_t> input = make_data(vector_size);
+    std::size_t middle = vector_size / 10;
+
+    print_result(csvoutput, "std::sort",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            std::sort(boost::begin(d), boost::end(d));
+        }));
+    print_result(csvoutput, "sort(par)",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            hpx::parallel::sort(par, boost::begin(d), boost::end(d));
+        }));
+
+    // a user supplied comparison operator disables the radix sort
+    print_result(csvoutput, "sort(par, comp)",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            hpx::parallel::sort(par, boost::begin(d), boost::end(d),
+                [](boost::uint64_t lhs, boost::uint64_t rhs) {
+                    return lhs < rhs;
+                });
+        }));
+    print_result(csvoutput, "sort_by_key(par)",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            std::vector<boost::uint64_t> values(d.size());
+            hpx::parallel::sort_by_key(par, boost::begin(d), boost::end(d),
+                boost::begin(values));
+        }));
+
+    print_result(csvoutput, "std::stable_sort",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            std::stable_sort(boost::begin(d), boost::end(d));
+        }));
+    print_result(csvoutput, "stable_sort(par)",
+        average_out(input, [](std::vector<boost::uint64_t>& d) {
+            hpx::parallel::stable_sort(par, boost::begin(d), boost::end(d));
+        }));
+
+    print_result(csvoutput, "std::partial_sort",
+        average_out(input, [middle](std::vector<boost::uint64_t>& d) {
+            std::partial_sort(boost::begin(d), boost::begin(d) + middle,
+                boost::end(d));
+        }));
+    print_result(csvoutput, "partial_sort(par)",
+        average_out(input, [middle](std::vector<boost::uint64_t>& d) {
+            hpx::parallel::partial_sort(par, boost::begin(d),
+                boost::begin(d) + middle, boost::end(d));
+        }));
+
+    print_result(csvoutput, "std::nth_element",
+        average_out(input, [middle](std::vector<boost::uint64_t>& d) {
+            std::nth_element(boost::begin(d), boost::begin(d) + middle,
+                boost::end(d));
+        }));
+    print_result(csvoutput, "nth_element(par)",
+        average_out(input, [middle](std::vector<boost::uint64_t>& d) {
+            hpx::parallel::nth_element(par, boost::begin(d),
+                boost::begin(d) + middle, boost::end(d));
+        }));
+
+    if (csvoutput)
+        hpx::cout << "\n" << hpx::flush;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("vector_size"
+        , boost::program_options::value<std::size_t>()->default_value(10000000)
+        , "number of elements to sort")
+
+        ("csv_output"
+        , boost::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , boost::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
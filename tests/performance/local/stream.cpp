@@ -392,6 +392,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::string num_numa_domains_str = vm["stream-numa-domains"].as<std::string>();
 
     std::string chunker = vm["chunker"].as<std::string>();
+    bool vectorize = vm.count("vector") != 0;
 
     std::cout
         << "-------------------------------------------------------------\n"
@@ -415,6 +416,7 @@ int hpx_main(boost::program_options::variables_map& vm)
         << "Number of Threads requested = "
             << numa_nodes * pus.second << "\n"
         << "Chunking policy requested: " << chunker << "\n"
+        << "Vectorization requested: " << (vectorize ? "yes" : "no") << "\n"
         << "-------------------------------------------------------------\n"
         ;
 
@@ -456,7 +458,18 @@ int hpx_main(boost::program_options::variables_map& vm)
 
     for (std::size_t i = 0; i != numa_nodes; ++i)
     {
-        if(chunker == "dynamic")
+        if(vectorize)
+        {
+            workers.push_back(
+                hpx::async(execs[i], &numa_domain_worker<
+                        vector_type, parallel_vector_execution_policy
+                    >,
+                    i, par_vec, boost::ref(l),
+                    part_size, part_size*i, iterations,
+                    boost::ref(a), boost::ref(b), boost::ref(c))
+            );
+        }
+        else if(chunker == "dynamic")
         {
             auto policy = par.on(execs[i]).with(dynamic_chunk_size());
             workers.push_back(
@@ -486,6 +499,16 @@ int hpx_main(boost::program_options::variables_map& vm)
                     boost::ref(a), boost::ref(b), boost::ref(c))
             );
         }
+        else if(chunker == "pinned")
+        {
+            auto policy = par.on(execs[i]).with(pinned_chunk_size());
+            workers.push_back(
+                hpx::async(execs[i], &numa_domain_worker<vector_type, decltype(policy)>,
+                    i, policy, boost::ref(l),
+                    part_size, part_size*i, iterations,
+                    boost::ref(a), boost::ref(b), boost::ref(c))
+            );
+        }
         else
         {
             // default
@@ -561,6 +584,36 @@ int hpx_main(boost::program_options::variables_map& vm)
            maxtime[j]);
     }
 
+    // report the bandwidth achieved by each of the NUMA domains separately
+    if (numa_nodes > 1)
+    {
+        printf("\nPer NUMA domain (%zu elements each):\n", part_size);
+        printf("Domain  Function    Best Rate MB/s  Avg time     Min time     Max time\n");
+        for (std::size_t d = 0; d != numa_nodes; ++d)
+        {
+            std::vector<std::vector<double> > const& times = timings_all[d];
+            for (std::size_t j = 0; j != 4; ++j)
+            {
+                // Note: skip first iteration
+                double avg = 0.0;
+                double min = (std::numeric_limits<double>::max)();
+                double max = 0.0;
+                for (std::size_t iteration = 1; iteration != iterations;
+                     ++iteration)
+                {
+                    avg += times[j][iteration];
+                    min = (std::min)(min, times[j][iteration]);
+                    max = (std::max)(max, times[j][iteration]);
+                }
+                avg = avg / (double)(iterations - 1);
+
+                double domain_bytes = bytes[j] * part_size / vector_size;
+                printf("%6zu  %s%12.1f  %11.6f  %11.6f  %11.6f\n", d,
+                    label[j], 1.0E-06 * domain_bytes / min, avg, min, max);
+            }
+        }
+    }
+
     std::cout
         << "\nTotal time: " << time_total
         << " (per iteration: " << time_total/iterations << ")\n";
@@ -611,7 +664,10 @@ int main(int argc, char* argv[])
         (   "chunker",
             boost::program_options::value<std::string>()->default_value("default"),
             "Which chunker to use for the parallel algorithms. "
-            "possible values: dynamic, auto, guided. (default: default)")
+            "possible values: dynamic, auto, guided, pinned. (default: default)")
+        (   "vector",
+            "use the vectorizing execution policy (par_vec) for the kernels, "
+            "this runs the algorithms on the default executor")
         ;
 
     // parse command line here to extract the necessary settings for HPX
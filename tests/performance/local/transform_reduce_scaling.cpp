@@ -63,12 +63,44 @@ void measure_transform_reduce_old(std::size_t size)
     );
 }
 
+template <typename ExPolicy>
+double measure_transform_reduce_values(ExPolicy policy,
+    std::vector<double> const& data)
+{
+    return hpx::parallel::transform_reduce(policy,
+        boost::begin(data), boost::end(data),
+        [](double v)
+        {
+            return v * v;
+        },
+        0.0,
+        std::plus<double>()
+    );
+}
+
 boost::uint64_t average_out_transform_reduce(std::size_t vector_size)
 {
     measure_transform_reduce(vector_size);
     return boost::uint64_t(1);
 }
 
+template <typename ExPolicy>
+boost::uint64_t average_out_transform_reduce_values(ExPolicy policy,
+    std::size_t vector_size)
+{
+    std::vector<double> data(vector_size);
+    for (std::size_t i = 0; i != vector_size; ++i)
+        data[i] = double(std::rand()) / RAND_MAX;
+
+    // warm up
+    measure_transform_reduce_values(policy, data);
+
+    boost::uint64_t start = hpx::util::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+        measure_transform_reduce_values(policy, data);
+    return (hpx::util::high_resolution_clock::now() - start) / test_count;
+}
+
 boost::uint64_t average_out_transform_reduce_old(std::size_t vector_size)
 {
     measure_transform_reduce_old(vector_size);
@@ -86,15 +118,25 @@ int hpx_main(boost::program_options::variables_map& vm)
         boost::uint64_t tr_time = average_out_transform_reduce(vector_size);
         boost::uint64_t tr_old_time = average_out_transform_reduce_old(
             vector_size);
+        boost::uint64_t tr_par_time = average_out_transform_reduce_values(
+            hpx::parallel::par, vector_size);
+        boost::uint64_t tr_par_vec_time = average_out_transform_reduce_values(
+            hpx::parallel::par_vec, vector_size);
 
         if(csvoutput) {
             hpx::cout << "," << tr_time/1e9
-                      << "," << tr_old_time/1e9 << "\n" << hpx::flush;
+                      << "," << tr_old_time/1e9
+                      << "," << tr_par_time/1e9
+                      << "," << tr_par_vec_time/1e9 << "\n" << hpx::flush;
         } else {
             hpx::cout << "transform_reduce: " << std::right
                 << std::setw(30) << tr_time/1e9 << "\n" << hpx::flush;
             hpx::cout << "old_transform_reduce" << std::right
                 << std::setw(30) << tr_old_time/1e9 << "\n" << hpx::flush;
+            hpx::cout << "transform_reduce(par, double)" << std::right
+                << std::setw(30) << tr_par_time/1e9 << "\n" << hpx::flush;
+            hpx::cout << "transform_reduce(par_vec, double)" << std::right
+                << std::setw(30) << tr_par_vec_time/1e9 << "\n" << hpx::flush;
         }
     }
     return hpx::finalize();
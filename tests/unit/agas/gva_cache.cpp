@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/runtime/agas/detail/gva_cache.hpp>
+
+#include <vector>
+
+using hpx::naming::gid_type;
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+
+gva make_gva(boost::uint64_t count, boost::uint64_t lva)
+{
+    return gva(gid_type(0x100000002ULL, 0), 1, count, lva, 8);
+}
+
+void test_single_objects()
+{
+    gva_cache cache;
+
+    // nothing is cached before the capacity is set
+    HPX_TEST(!cache.insert(gid_type(1, 0x1000), make_gva(1, 0)));
+
+    cache.reserve(256);
+    HPX_TEST(cache.capacity() >= std::size_t(256));
+
+    for (boost::uint64_t i = 0; i != 100; ++i)
+        HPX_TEST(cache.insert(gid_type(1, 0x1000 + i), make_gva(1, i)));
+
+    // inserting an id which is already cached fails
+    HPX_TEST(!cache.insert(gid_type(1, 0x1000), make_gva(1, 0)));
+
+    gid_type base;
+    gva g;
+    for (boost::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(cache.get_entry(gid_type(1, 0x1000 + i), base, g));
+        HPX_TEST_EQ(base, gid_type(1, 0x1000 + i));
+        HPX_TEST_EQ(g.lva(), i);
+        HPX_TEST_EQ(g.prefix, gid_type(0x100000002ULL, 0));
+    }
+    HPX_TEST(!cache.get_entry(gid_type(1, 0x1000 + 100), base, g));
+
+    // updating replaces the cached data
+    cache.update(gid_type(1, 0x1000), make_gva(1, 42));
+    HPX_TEST(cache.get_entry(gid_type(1, 0x1000), base, g));
+    HPX_TEST_EQ(g.lva(), boost::uint64_t(42));
+
+    cache.erase(gid_type(1, 0x1000));
+    HPX_TEST(!cache.get_entry(gid_type(1, 0x1000), base, g));
+
+    cache.clear();
+    HPX_TEST(!cache.get_entry(gid_type(1, 0x1001), base, g));
+}
+
+void test_ranges()
+{
+    gva_cache cache;
+    cache.reserve(256);
+
+    // a range stored in the sets and a range stored in the overflow map
+    boost::uint64_t const small = 500;
+    boost::uint64_t const large = 1 << 20;
+    cache.update(gid_type(1, 0x1000), make_gva(small, 0x10000));
+    cache.update(gid_type(2, 0x1000), make_gva(large, 0x10000));
+
+    gid_type base;
+    gva g;
+    for (boost::uint64_t i = 0; i < small; i += 7)
+    {
+        HPX_TEST(cache.get_entry(gid_type(1, 0x1000 + i), base, g));
+        HPX_TEST_EQ(base, gid_type(1, 0x1000));
+        HPX_TEST_EQ(g.lva(gid_type(1, 0x1000 + i), base),
+            boost::uint64_t(0x10000 + 8 * i));
+    }
+    for (boost::uint64_t i = 0; i < large; i += 4099)
+    {
+        HPX_TEST(cache.get_entry(gid_type(2, 0x1000 + i), base, g));
+        HPX_TEST_EQ(base, gid_type(2, 0x1000));
+    }
+
+    HPX_TEST(!cache.get_entry(gid_type(1, 0x1000 + small), base, g));
+    HPX_TEST(!cache.get_entry(gid_type(2, 0x1000 + large), base, g));
+
+    // no copies of the ranges are left behind
+    cache.erase(gid_type(1, 0x1000));
+    cache.erase(gid_type(2, 0x1000));
+    for (boost::uint64_t i = 0; i < small; ++i)
+        HPX_TEST(!cache.get_entry(gid_type(1, 0x1000 + i), base, g));
+    HPX_TEST(!cache.get_entry(gid_type(2, 0x1000), base, g));
+}
+
+void test_eviction()
+{
+    gva_cache cache;
+    cache.reserve(256);
+
+    std::size_t const capacity = cache.capacity();
+
+    // batch insertion of more entries than the cache can hold
+    std::vector<gva_cache::entry_type> entries;
+    for (boost::uint64_t i = 0; i != 4 * capacity; ++i)
+    {
+        entries.push_back(
+            gva_cache::entry_type(gid_type(1, 0x1000 + i), make_gva(1, i)));
+    }
+    cache.update(entries);
+
+    HPX_TEST_EQ(cache.get_statistics(gva_cache::num_insertions, true),
+        boost::int64_t(4 * capacity));
+    HPX_TEST(cache.get_statistics(gva_cache::num_evictions, true) >=
+        boost::int64_t(3 * capacity));
+
+    // all cached entries are valid
+    gid_type base;
+    gva g;
+    std::size_t hits = 0;
+    for (boost::uint64_t i = 0; i != 4 * capacity; ++i)
+    {
+        if (cache.get_entry(gid_type(1, 0x1000 + i), base, g))
+        {
+            HPX_TEST_EQ(g.lva(), i);
+            ++hits;
+        }
+    }
+    HPX_TEST(hits != 0 && hits <= capacity);
+
+    HPX_TEST_EQ(cache.get_statistics(gva_cache::num_hits, false),
+        boost::int64_t(hits));
+    HPX_TEST_EQ(cache.get_statistics(gva_cache::get_entry_count, false),
+        boost::int64_t(4 * capacity));
+}
+
+int main()
+{
+    test_single_objects();
+    test_ranges();
+    test_eviction();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/runtime/agas/detail/gva_table.hpp>
+#include <hpx/runtime/agas/detail/refcnt_table.hpp>
+
+#include <list>
+
+using hpx::naming::gid_type;
+using hpx::agas::gva;
+using hpx::agas::detail::gva_table;
+using hpx::agas::detail::refcnt_table;
+
+gva_table::data_type make_data(boost::uint64_t count, boost::uint64_t lva)
+{
+    gid_type locality(0x100000001ULL, 0);
+    return gva_table::data_type(gva(locality, 1, count, lva, 8), locality);
+}
+
+void test_bind_resolve()
+{
+    gva_table table;
+
+    // single objects and a block spanning many buckets and all shards
+    for (boost::uint64_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(table.bind(gid_type(1, 0x1000 + i), make_data(1, i), true),
+            gva_table::bind_inserted);
+    }
+
+    boost::uint64_t const block_size = gva_table::num_shards << 10;
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x100000), make_data(block_size, 0),
+        true), gva_table::bind_inserted);
+    HPX_TEST_EQ(table.size(), std::size_t(1001));
+
+    gid_type base;
+    gva_table::data_type data;
+    for (boost::uint64_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(table.resolve(gid_type(1, 0x1000 + i), base, data));
+        HPX_TEST_EQ(base, gid_type(1, 0x1000 + i));
+        HPX_TEST_EQ(data.first.lva(), i);
+    }
+
+    // all ids of the block resolve to its base
+    for (boost::uint64_t i = 0; i < block_size; i += 97)
+    {
+        HPX_TEST(table.resolve(gid_type(1, 0x100000 + i), base, data));
+        HPX_TEST_EQ(base, gid_type(1, 0x100000));
+        HPX_TEST_EQ(data.first.count, block_size);
+    }
+
+    HPX_TEST(!table.resolve(gid_type(1, 0x1000 + 1000), base, data));
+    HPX_TEST(!table.resolve(gid_type(1, 0x100000 + block_size), base, data));
+    HPX_TEST(!table.resolve(gid_type(2, 0x1000), base, data));
+}
+
+void test_bind_errors()
+{
+    gva_table table;
+
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1000), make_data(16, 0), true),
+        gva_table::bind_inserted);
+
+    // update of an existing binding
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1000), make_data(16, 42), true),
+        gva_table::bind_updated);
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1000), make_data(16, 43), false),
+        gva_table::bind_update_rejected);
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1000), make_data(8, 0), true),
+        gva_table::bind_count_mismatch);
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1008), make_data(1, 0), true),
+        gva_table::bind_contained);
+
+    gid_type base;
+    gva_table::data_type data;
+    HPX_TEST(table.resolve(gid_type(1, 0x100f), base, data));
+    HPX_TEST_EQ(data.first.lva(), boost::uint64_t(42));
+    HPX_TEST_EQ(table.size(), std::size_t(1));
+}
+
+void test_unbind()
+{
+    gva_table table;
+
+    boost::uint64_t const block_size = 1000;
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x1000), make_data(block_size, 0),
+        true), gva_table::bind_inserted);
+
+    gva_table::data_type data;
+    HPX_TEST_EQ(table.unbind(gid_type(1, 0x1001), block_size, data),
+        gva_table::unbind_not_found);
+    HPX_TEST_EQ(table.unbind(gid_type(1, 0x1000), 1, data),
+        gva_table::unbind_count_mismatch);
+    HPX_TEST_EQ(table.unbind(gid_type(1, 0x1000), block_size, data),
+        gva_table::unbind_removed);
+    HPX_TEST_EQ(data.first.count, block_size);
+    HPX_TEST(table.empty());
+
+    // no copies of the range are left behind
+    gid_type base;
+    for (boost::uint64_t i = 0; i < block_size; ++i)
+        HPX_TEST(!table.resolve(gid_type(1, 0x1000 + i), base, data));
+}
+
+void test_spanning()
+{
+    gva_table table;
+
+    // a block covering more buckets than there are shards
+    boost::uint64_t const block_size = (gva_table::num_shards + 1) << 8;
+    gid_type const block(1, 0x100000);
+    HPX_TEST_EQ(table.bind(block, make_data(block_size, 0), true),
+        gva_table::bind_inserted);
+    HPX_TEST_EQ(table.bind(block, make_data(block_size, 1), true),
+        gva_table::bind_updated);
+    HPX_TEST_EQ(table.bind(block, make_data(1, 0), true),
+        gva_table::bind_count_mismatch);
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x100000 + block_size - 1),
+        make_data(1, 0), true), gva_table::bind_contained);
+
+    // a small range right behind the block
+    HPX_TEST_EQ(table.bind(gid_type(1, 0x100000 + block_size),
+        make_data(1, 0), true), gva_table::bind_inserted);
+    HPX_TEST_EQ(table.size(), std::size_t(2));
+
+    gid_type base;
+    gva_table::data_type data;
+    HPX_TEST(table.resolve(gid_type(1, 0x100000 + block_size - 1), base,
+        data));
+    HPX_TEST_EQ(base, block);
+    HPX_TEST_EQ(data.first.lva(), boost::uint64_t(1));
+
+    HPX_TEST_EQ(table.unbind(block, 1, data),
+        gva_table::unbind_count_mismatch);
+    HPX_TEST_EQ(table.unbind(block, block_size, data),
+        gva_table::unbind_removed);
+    HPX_TEST(!table.resolve(block, base, data));
+    HPX_TEST_EQ(table.size(), std::size_t(1));
+}
+
+void test_refcnt()
+{
+    refcnt_table table;
+
+    gid_type const lower(1, 0x1000);
+    gid_type const upper(1, 0x1010);
+
+    std::list<gid_type> freed;
+    gid_type invalid_id;
+    boost::int64_t invalid_count = 0;
+
+    // ids not in the table have the initial reference count
+    HPX_TEST(table.change(lower, upper, 10, freed, invalid_id, invalid_count));
+    HPX_TEST(freed.empty());
+
+    boost::int64_t count = 0;
+    HPX_TEST(table.get(lower, count));
+    HPX_TEST_EQ(count, HPX_GLOBALCREDIT_INITIAL + 10);
+
+    HPX_TEST(table.change(lower, upper, -(HPX_GLOBALCREDIT_INITIAL + 10),
+        freed, invalid_id, invalid_count));
+    HPX_TEST_EQ(freed.size(), std::size_t(16));
+
+    // the freed ids are kept until they are erased
+    HPX_TEST(table.get(lower, count));
+    HPX_TEST_EQ(count, boost::int64_t(0));
+    table.erase(freed);
+    HPX_TEST(!table.get(lower, count));
+
+    freed.clear();
+    HPX_TEST(!table.change(lower, upper, -(HPX_GLOBALCREDIT_INITIAL + 1),
+        freed, invalid_id, invalid_count));
+    HPX_TEST_EQ(invalid_id, lower);
+    HPX_TEST_EQ(invalid_count, boost::int64_t(-1));
+}
+
+int main()
+{
+    test_bind_resolve();
+    test_bind_errors();
+    test_unbind();
+    test_spanning();
+    test_refcnt();
+
+    return hpx::util::report_errors();
+}
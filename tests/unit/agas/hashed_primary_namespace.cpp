@@ -0,0 +1,127 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that ids are bound, resolved, and routed correctly if the
+// primary namespace is distributed over all localities.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/runtime/agas/detail/primary_namespace_partitions.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using hpx::agas::detail::get_primary_namespace_partitions;
+using hpx::agas::detail::get_primary_namespace_locality_id;
+using hpx::agas::detail::primary_namespace_partition_size;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_blocks = 16;
+
+// Bind new ids from different blocks to the given local object.
+std::vector<hpx::id_type> bind_ids(hpx::id_type const& object)
+{
+    HPX_TEST_EQ(get_primary_namespace_partitions(),
+        hpx::get_initial_num_localities());
+
+    hpx::naming::address addr = hpx::agas::resolve_sync(object);
+    HPX_TEST(addr);
+
+    hpx::naming::resolver_client& agas_client = hpx::naming::get_agas_client();
+
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        // every allocation of a full block starts a new block
+        hpx::naming::gid_type id =
+            hpx::agas::get_next_id(primary_namespace_partition_size);
+        HPX_TEST(agas_client.bind_range_local(id, 1, addr, 0));
+        ids.push_back(hpx::id_type(id, hpx::id_type::unmanaged));
+    }
+    return ids;
+}
+HPX_PLAIN_ACTION(bind_ids);
+
+void unbind_ids(std::vector<hpx::id_type> const& ids)
+{
+    hpx::naming::resolver_client& agas_client = hpx::naming::get_agas_client();
+    for (hpx::id_type const& id : ids)
+        HPX_TEST(agas_client.unbind_range_local(id.get_gid(), 1));
+}
+HPX_PLAIN_ACTION(unbind_ids);
+
+///////////////////////////////////////////////////////////////////////////////
+void test(hpx::id_type const& there, std::set<boost::uint32_t>& owners)
+{
+    hpx::id_type object = hpx::new_<test_server>(there).get();
+
+    std::vector<hpx::id_type> ids =
+        hpx::async<bind_ids_action>(there, object).get();
+    HPX_TEST_EQ(ids.size(), num_blocks);
+
+    for (hpx::id_type const& id : ids)
+    {
+        boost::uint32_t owner = get_primary_namespace_locality_id(id.get_gid());
+        HPX_TEST(owner < hpx::get_initial_num_localities());
+        owners.insert(owner);
+
+        // the parcels are routed through the locality managing the id
+        HPX_TEST_EQ(call_action()(id), there);
+
+        hpx::naming::address addr = hpx::agas::resolve_sync(id);
+        HPX_TEST_EQ(addr.locality_, hpx::naming::get_gid_from_locality_id(
+            hpx::naming::get_locality_id_from_id(there)));
+    }
+
+    hpx::async<unbind_ids_action>(there, ids).get();
+}
+
+int hpx_main()
+{
+    std::set<boost::uint32_t> owners;
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        test(id, owners);
+    }
+
+    // the ids are managed by more than one locality
+    if (hpx::get_initial_num_localities() > 1)
+        HPX_TEST(owners.size() > 1);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.agas.hashed_primary_namespace=1");
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
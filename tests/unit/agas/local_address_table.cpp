@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/runtime/agas/detail/local_address_table.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <vector>
+
+using hpx::naming::gid_type;
+using hpx::agas::detail::local_address_table;
+
+void test_insert_resolve()
+{
+    local_address_table table;
+
+    boost::int32_t type = 0;
+    boost::uint64_t lva = 0;
+
+    // nothing is stored before the size is set
+    HPX_TEST(!table.insert(gid_type(1, 0x1000), 1, 0x42,
+        table.get_generation()));
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000), type, lva));
+
+    table.reserve(1000);
+    HPX_TEST_EQ(table.size(), std::size_t(1024));
+
+    for (boost::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(table.insert(gid_type(1, 0x1000 + i), 7, 0x10000 + i,
+            table.get_generation()));
+    }
+
+    for (boost::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(table.get_entry(gid_type(1, 0x1000 + i), type, lva));
+        HPX_TEST_EQ(type, 7);
+        HPX_TEST_EQ(lva, 0x10000 + i);
+    }
+
+    // ids mapping to the same slot but differing in any bit are not found
+    HPX_TEST(!table.get_entry(gid_type(2, 0x1000), type, lva));
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000 + 1024), type, lva));
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000 + 100), type, lva));
+
+    // a colliding id replaces the existing entry
+    HPX_TEST(table.insert(gid_type(1, 0x1000 + 1024), 8, 0x20000,
+        table.get_generation()));
+    HPX_TEST(table.get_entry(gid_type(1, 0x1000 + 1024), type, lva));
+    HPX_TEST_EQ(type, 8);
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000), type, lva));
+
+    // addresses of zero are never stored
+    HPX_TEST(!table.insert(gid_type(1, 0x2000), 7, 0,
+        table.get_generation()));
+}
+
+void test_unbind()
+{
+    local_address_table table;
+    table.reserve(256);
+
+    boost::int32_t type = 0;
+    boost::uint64_t lva = 0;
+
+    HPX_TEST(table.insert(gid_type(1, 0x1000), 7, 0x42,
+        table.get_generation()));
+
+    // an entry removed while resolving the address of another object
+    // prevents inserting the (possibly outdated) result
+    boost::uint64_t generation = table.get_generation();
+    table.erase(gid_type(1, 0x1000));
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000), type, lva));
+    HPX_TEST(!table.insert(gid_type(1, 0x1001), 7, 0x43, generation));
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1001), type, lva));
+
+    // erasing an id which is not stored leaves the colliding entry alone
+    HPX_TEST(table.insert(gid_type(1, 0x1001), 7, 0x43,
+        table.get_generation()));
+    table.erase(gid_type(1, 0x1001 + 256));
+    HPX_TEST(table.get_entry(gid_type(1, 0x1001), type, lva));
+    HPX_TEST_EQ(lva, boost::uint64_t(0x43));
+
+    table.clear();
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1001), type, lva));
+}
+
+void test_ranges()
+{
+    local_address_table table;
+    table.reserve(256);
+
+    boost::int32_t type = 0;
+    boost::uint64_t lva = 0;
+
+    // the ids of a range are stored one by one
+    for (boost::uint64_t i = 0; i != 64; ++i)
+    {
+        HPX_TEST(table.insert(gid_type(1, 0x1000 + i), 7, 0x10000 + 8 * i,
+            table.get_generation()));
+    }
+    HPX_TEST(table.insert(gid_type(1, 0x1000 + 64), 7, 0x42,
+        table.get_generation()));
+
+    // erasing the range removes all of its ids only
+    table.erase(gid_type(1, 0x1000), 64);
+    for (boost::uint64_t i = 0; i != 64; ++i)
+        HPX_TEST(!table.get_entry(gid_type(1, 0x1000 + i), type, lva));
+    HPX_TEST(table.get_entry(gid_type(1, 0x1000 + 64), type, lva));
+
+    // ranges larger than the table clear it
+    table.erase(gid_type(1, 0x8000), 1024);
+    HPX_TEST(!table.get_entry(gid_type(1, 0x1000 + 64), type, lva));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Readers never see an address which does not belong to the id they look up,
+// while a writer keeps replacing and removing the entries.
+boost::uint64_t const num_ids = 512;
+
+boost::uint64_t expected_lva(boost::uint64_t lsb)
+{
+    return (lsb << 4) | 1;
+}
+
+void writer(local_address_table& table, boost::atomic<bool>& done)
+{
+    for (int round = 0; round != 200; ++round)
+    {
+        for (boost::uint64_t i = 0; i != num_ids; ++i)
+        {
+            // ids which collide in the table
+            boost::uint64_t lsb = 0x1000 + i + (round % 2) * 256;
+            table.insert(gid_type(1, lsb), boost::int32_t(lsb & 0xff),
+                expected_lva(lsb), table.get_generation());
+        }
+        table.erase(gid_type(1, 0x1000 + round % 64), 16);
+    }
+    done = true;
+}
+
+void reader(local_address_table& table, boost::atomic<bool>& done,
+    boost::atomic<std::size_t>& errors)
+{
+    while (!done)
+    {
+        for (boost::uint64_t i = 0; i != num_ids + 256; ++i)
+        {
+            boost::uint64_t lsb = 0x1000 + i;
+            boost::int32_t type = 0;
+            boost::uint64_t lva = 0;
+            if (table.get_entry(gid_type(1, lsb), type, lva) &&
+                (lva != expected_lva(lsb) ||
+                    type != boost::int32_t(lsb & 0xff)))
+            {
+                ++errors;
+            }
+        }
+    }
+}
+
+void test_concurrent_lookup()
+{
+    local_address_table table;
+    table.reserve(256);
+
+    boost::atomic<bool> done(false);
+    boost::atomic<std::size_t> errors(0);
+
+    std::vector<boost::thread> readers;
+    for (int i = 0; i != 4; ++i)
+    {
+        readers.push_back(boost::thread(&reader, boost::ref(table),
+            boost::ref(done), boost::ref(errors)));
+    }
+
+    writer(table, done);
+    for (boost::thread& t : readers)
+        t.join();
+
+    HPX_TEST_EQ(errors.load(), std::size_t(0));
+}
+
+int main()
+{
+    test_insert_resolve();
+    test_unbind();
+    test_ranges();
+    test_concurrent_lookup();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,67 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that requests for incrementing and decrementing global
+// reference counts are combined before being sent to AGAS.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/agas/interface.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t get_counter(char const* name)
+{
+    std::string counter_name("/agas{locality#0/total}/count/refcnt/");
+    counter_name += name;
+
+    hpx::performance_counters::performance_counter counter(counter_name);
+    return counter.get_value_sync<boost::int64_t>();
+}
+
+int hpx_main()
+{
+    // the id does not refer to any object, the credits are never exhausted
+    hpx::naming::gid_type id = hpx::agas::get_next_id(1);
+
+    boost::int64_t requests = get_counter("requests");
+    boost::int64_t saved = get_counter("saved");
+
+    // the second decref is combined with the first one, the incref fully
+    // compensates both of them
+    hpx::agas::decref(id, 1);
+    hpx::agas::decref(id, 1);
+    HPX_TEST_EQ(hpx::agas::incref_async(id, 2, hpx::find_here()).get(),
+        boost::int64_t(-2));
+
+    HPX_TEST(get_counter("requests") - requests >= 3);
+    HPX_TEST(get_counter("saved") - saved >= 3);
+
+    // a pending decref is sent to AGAS on garbage collection
+    boost::int64_t messages = get_counter("messages");
+
+    hpx::agas::decref(id, 1);
+    hpx::agas::garbage_collect();
+
+    HPX_TEST(get_counter("messages") - messages >= 1);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // disable timed flushing of pending requests
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.agas.refcnt_flush_interval=0");
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
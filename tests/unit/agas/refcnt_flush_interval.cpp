@@ -0,0 +1,74 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that pending requests for decrementing global reference
+// counts are sent to AGAS once the flush interval has expired, even if their
+// number stays below the configured threshold.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/agas/interface.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/chrono/chrono.hpp>
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t get_counter(char const* name)
+{
+    std::string counter_name("/agas{locality#0/total}/count/refcnt/");
+    counter_name += name;
+
+    hpx::performance_counters::performance_counter counter(counter_name);
+    return counter.get_value_sync<boost::int64_t>();
+}
+
+// wait for (at most) the given number of flush intervals until at least one
+// message was sent to AGAS
+bool wait_for_flush(boost::int64_t messages, int intervals)
+{
+    for (int i = 0; i != intervals; ++i)
+    {
+        hpx::this_thread::sleep_for(boost::chrono::milliseconds(10));
+        if (get_counter("messages") > messages)
+            return true;
+    }
+    return false;
+}
+
+int hpx_main()
+{
+    // the id does not refer to any object, the credits are never exhausted
+    hpx::naming::gid_type id = hpx::agas::get_next_id(1);
+
+    // a single decref stays below the threshold, it is sent by the timer
+    // only, this has to work for consecutive flushes as well
+    for (int i = 0; i != 2; ++i)
+    {
+        boost::int64_t messages = get_counter("messages");
+
+        hpx::agas::decref(id, 1);
+        HPX_TEST(wait_for_flush(messages, 100));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // flush pending requests every 10ms
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.agas.refcnt_flush_interval=10000");
+    cfg.push_back("hpx.agas.max_pending_refcnt_requests=4096");
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,60 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that all localities are started if the AGAS startup
+// notifications are forwarded along a chain of localities, and that the
+// time spent in each startup phase is recorded.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/format.hpp>
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t get_startup_time(boost::uint32_t locality_id, char const* phase)
+{
+    std::string counter_name = boost::str(
+        boost::format("/runtime{locality#%1%/total}/startup/time/%2%") %
+            locality_id % phase);
+
+    hpx::performance_counters::performance_counter counter(counter_name);
+    return counter.get_value_sync<boost::int64_t>();
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    HPX_TEST_EQ(localities.size(), std::size_t(hpx::get_initial_num_localities()));
+
+    for (hpx::id_type const& id : localities)
+    {
+        boost::uint32_t locality_id = hpx::naming::get_locality_id_from_id(id);
+
+        HPX_TEST(get_startup_time(locality_id, "bootstrap") >= 0);
+        HPX_TEST(get_startup_time(locality_id, "components") > 0);
+        HPX_TEST(get_startup_time(locality_id, "counters") > 0);
+        HPX_TEST(get_startup_time(locality_id, "barrier") >= 0);
+        HPX_TEST(get_startup_time(locality_id, "startup_functions") > 0);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // every locality forwards the notifications to at most one other locality
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.agas.bootstrap_fanout=1");
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
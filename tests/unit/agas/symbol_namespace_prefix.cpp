@@ -0,0 +1,139 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies prefix queries, batched registration and resolution of
+// global names, and notifications about unregistered names.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/interface.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_names = 100;
+
+std::string make_name(char const* category, std::size_t i)
+{
+    std::string name("/symbol_namespace_prefix_test/");
+    name += category;
+    name += "/";
+    name += boost::lexical_cast<std::string>(i);
+    return name;
+}
+
+void test_register_and_find(hpx::id_type const& here)
+{
+    std::vector<std::pair<std::string, hpx::id_type> > names;
+    for (std::size_t i = 0; i != num_names; ++i)
+        names.push_back(std::make_pair(make_name("a", i), here));
+    for (std::size_t i = 0; i != num_names / 10; ++i)
+        names.push_back(std::make_pair(make_name("b", i), here));
+
+    std::vector<bool> registered = hpx::agas::register_names_sync(names);
+    HPX_TEST_EQ(registered.size(), names.size());
+    for (std::size_t i = 0; i != registered.size(); ++i)
+        HPX_TEST(registered[i]);
+
+    // registering the same names again fails
+    registered = hpx::agas::register_names_sync(names);
+    for (std::size_t i = 0; i != registered.size(); ++i)
+        HPX_TEST(!registered[i]);
+
+    // the names are spread over all symbol namespace instances
+    std::map<std::string, hpx::id_type> found =
+        hpx::agas::find_symbols_sync("/symbol_namespace_prefix_test/a/");
+    HPX_TEST_EQ(found.size(), num_names);
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        std::map<std::string, hpx::id_type>::iterator it =
+            found.find(make_name("a", i));
+        HPX_TEST(it != found.end());
+        if (it != found.end())
+            HPX_TEST_EQ(it->second, here);
+    }
+
+    found = hpx::agas::find_symbols("/symbol_namespace_prefix_test/").get();
+    HPX_TEST_EQ(found.size(), num_names + num_names / 10);
+
+    found = hpx::agas::find_symbols_sync("/symbol_namespace_prefix_test/c");
+    HPX_TEST(found.empty());
+}
+
+void test_resolve(hpx::id_type const& here)
+{
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i != num_names; ++i)
+        names.push_back(make_name("a", i));
+    names.push_back(make_name("c", 0));
+
+    std::vector<hpx::id_type> ids = hpx::agas::resolve_names_sync(names);
+    HPX_TEST_EQ(ids.size(), names.size());
+    for (std::size_t i = 0; i != num_names; ++i)
+        HPX_TEST_EQ(ids[i], here);
+
+    // names which are not registered resolve to an invalid id
+    HPX_TEST_EQ(ids.back(), hpx::invalid_id);
+}
+
+void test_unbind_event(hpx::id_type const& here)
+{
+    std::string name = make_name("a", 0);
+
+    hpx::future<hpx::id_type> f = hpx::agas::on_symbol_namespace_event(
+        name, hpx::agas::symbol_ns_unbind, false);
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(hpx::agas::unregister_name_sync(name), here);
+
+    // the listener is triggered by unregistering the name
+    HPX_TEST_EQ(f.get(), here);
+
+    // the listener is triggered right away if the name is not registered
+    f = hpx::agas::on_symbol_namespace_event(
+        name, hpx::agas::symbol_ns_unbind, true);
+    HPX_TEST_EQ(f.get(), hpx::invalid_id);
+}
+
+void test_unregister()
+{
+    std::map<std::string, hpx::id_type> found =
+        hpx::agas::find_symbols_sync("/symbol_namespace_prefix_test/");
+    HPX_TEST_EQ(found.size(), num_names + num_names / 10 - 1);
+
+    typedef std::map<std::string, hpx::id_type>::value_type value_type;
+    for (value_type const& v : found)
+        HPX_TEST_EQ(hpx::agas::unregister_name_sync(v.first), v.second);
+
+    found = hpx::agas::find_symbols_sync("/symbol_namespace_prefix_test/");
+    HPX_TEST(found.empty());
+}
+
+int hpx_main()
+{
+    hpx::id_type here = hpx::find_here();
+
+    test_register_and_find(here);
+    test_resolve(here);
+    test_unbind_event(here);
+    test_unregister();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
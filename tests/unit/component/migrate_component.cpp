@@ -6,9 +6,15 @@
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/components.hpp>
 #include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/agas/interface.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <string>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 struct test_server
   : hpx::components::migration_support<
@@ -90,6 +96,101 @@ bool test_migrate_component(hpx::id_type source, hpx::id_type target)
     }
 }
 
+bool test_bulk_migrate_component(hpx::id_type source, hpx::id_type target)
+{
+    // create components on given locality
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(source, 10).get();
+
+    for (hpx::id_type const& id : ids)
+        HPX_TEST_EQ(call_action()(id), source);
+
+    try {
+        // migrate all components to the target at once
+        std::vector<hpx::id_type> migrated =
+            hpx::components::migrate<test_server>(ids, target).get();
+        HPX_TEST_EQ(migrated.size(), ids.size());
+
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            // the migrated objects should have the same ids as before
+            HPX_TEST_EQ(ids[i], migrated[i]);
+
+            // the migrated objects should life on the target now
+            HPX_TEST_EQ(call_action()(migrated[i]), target);
+        }
+
+        return true;
+    }
+    catch (hpx::exception const&) {
+        return false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// invoke the given object a couple of times, executed on a remote locality
+std::size_t send_calls(hpx::id_type const& id, std::size_t count)
+{
+    std::vector<hpx::future<hpx::id_type> > calls;
+    calls.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        calls.push_back(hpx::async<call_action>(id));
+
+    hpx::wait_all(calls);
+    return calls.size();
+}
+HPX_PLAIN_ACTION(send_calls, send_calls_action);
+
+boost::int64_t get_stalled_parcels_count()
+{
+    std::string counter_name("/agas{locality#");
+    counter_name += std::to_string(hpx::get_locality_id());
+    counter_name += "/total}/count/migration/stalled_parcels";
+
+    hpx::performance_counters::performance_counter counter(counter_name);
+    return counter.get_value_sync<boost::int64_t>();
+}
+
+// parcels sent to an object while it is being migrated are held back by AGAS
+// and are delivered once the migration has ended
+void test_hold_back_parcels(hpx::id_type remote)
+{
+    std::size_t const count = 10;
+
+    // the object lives on (and is managed by) this locality, the remote
+    // locality has never resolved its address
+    test_client t1 = test_client::create(hpx::find_here());
+    hpx::id_type id = t1.get_id();
+
+    boost::int64_t stalled = get_stalled_parcels_count();
+
+    hpx::agas::begin_migration(id, remote).get();
+
+    // the remote locality has to route the parcels through AGAS
+    hpx::future<std::size_t> f =
+        hpx::async<send_calls_action>(remote, id, count);
+
+    // wait for (at most) one second until all parcels were held back
+    for (int i = 0; i != 100; ++i)
+    {
+        if (get_stalled_parcels_count() - stalled >=
+                static_cast<boost::int64_t>(count))
+        {
+            break;
+        }
+        hpx::this_thread::sleep_for(boost::chrono::milliseconds(10));
+    }
+
+    HPX_TEST_EQ(get_stalled_parcels_count() - stalled,
+        static_cast<boost::int64_t>(count));
+    HPX_TEST(!f.is_ready());
+
+    // the object was not moved, the parcels are delivered to it as before
+    HPX_TEST(hpx::agas::end_migration(id).get());
+    HPX_TEST_EQ(f.get(), count);
+    HPX_TEST_EQ(t1.call(), hpx::find_here());
+}
+
 int main()
 {
     std::vector<hpx::id_type> localities = hpx::find_remote_localities();
@@ -97,6 +198,11 @@ int main()
     {
         HPX_TEST(test_migrate_component(hpx::find_here(), id));
         HPX_TEST(test_migrate_component(id, hpx::find_here()));
+
+        HPX_TEST(test_bulk_migrate_component(hpx::find_here(), id));
+        HPX_TEST(test_bulk_migrate_component(id, hpx::find_here()));
+
+        test_hold_back_parcels(id);
     }
 
     return hpx::util::report_errors();
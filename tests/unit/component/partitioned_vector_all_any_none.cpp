@@ -0,0 +1,120 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_all_any_none_of.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct is_equal
+{
+    is_equal(T val = T())
+      : val_(val)
+    {}
+
+    bool operator()(T v) const
+    {
+        return v == val_;
+    }
+
+    T val_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & val_;
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_all_any_none(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v)
+{
+    using hpx::parallel::all_of;
+    using hpx::parallel::any_of;
+    using hpx::parallel::none_of;
+
+    HPX_TEST(!all_of(policy, boost::begin(v), boost::end(v),
+        is_equal<T>(T(1))));
+    HPX_TEST(all_of(policy, boost::begin(v) + 1, boost::end(v) - 1,
+        is_equal<T>(T(1))));
+
+    HPX_TEST(any_of(policy, boost::begin(v), boost::end(v),
+        is_equal<T>(T(2))));
+    HPX_TEST(!any_of(policy, boost::begin(v), boost::end(v),
+        is_equal<T>(T(3))));
+
+    HPX_TEST(none_of(policy, boost::begin(v), boost::end(v),
+        is_equal<T>(T(3))));
+    HPX_TEST(!none_of(policy, boost::begin(v), boost::end(v),
+        is_equal<T>(T(2))));
+}
+
+template <typename ExPolicy, typename T>
+void test_all_any_none_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v)
+{
+    hpx::future<bool> f = hpx::parallel::all_of(policy,
+        boost::begin(v), boost::end(v), is_equal<T>(T(1)));
+    HPX_TEST(!f.get());
+
+    f = hpx::parallel::any_of(policy,
+        boost::begin(v), boost::end(v), is_equal<T>(T(2)));
+    HPX_TEST(f.get());
+
+    f = hpx::parallel::none_of(policy,
+        boost::begin(v), boost::end(v), is_equal<T>(T(3)));
+    HPX_TEST(f.get());
+}
+
+template <typename T>
+void all_any_none_tests(hpx::partitioned_vector<T>& v)
+{
+    // the only values different from all others are placed into the first
+    // and last partitions
+    v.set_value_sync(0, T(2));
+    v.set_value_sync(v.size() - 1, T(2));
+
+    test_all_any_none(hpx::parallel::seq, v);
+    test_all_any_none(hpx::parallel::par, v);
+
+    test_all_any_none_async(hpx::parallel::seq(hpx::parallel::task), v);
+    test_all_any_none_async(hpx::parallel::par(hpx::parallel::task), v);
+}
+
+template <typename T>
+void all_any_none_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1));
+        all_any_none_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1), hpx::container_layout(2));
+        all_any_none_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    all_any_none_tests<int>();
+    all_any_none_tests<double>();
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_equal.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <functional>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_equal(ExPolicy && policy, hpx::partitioned_vector<T> const& v1,
+    hpx::partitioned_vector<T> const& v2, bool expected)
+{
+    bool r = hpx::parallel::equal(policy,
+        boost::begin(v1), boost::end(v1), boost::begin(v2));
+    HPX_TEST_EQ(r, expected);
+
+    r = hpx::parallel::equal(policy,
+        boost::begin(v1), boost::end(v1), boost::begin(v2),
+        std::equal_to<T>());
+    HPX_TEST_EQ(r, expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_equal_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v1,
+    hpx::partitioned_vector<T> const& v2, bool expected)
+{
+    hpx::future<bool> f = hpx::parallel::equal(policy,
+        boost::begin(v1), boost::end(v1), boost::begin(v2));
+    HPX_TEST_EQ(f.get(), expected);
+}
+
+template <typename T>
+void equal_tests(hpx::partitioned_vector<T> const& v1,
+    hpx::partitioned_vector<T> const& v2, bool expected)
+{
+    test_equal(hpx::parallel::seq, v1, v2, expected);
+    test_equal(hpx::parallel::par, v1, v2, expected);
+
+    test_equal_async(hpx::parallel::seq(hpx::parallel::task),
+        v1, v2, expected);
+    test_equal_async(hpx::parallel::par(hpx::parallel::task),
+        v1, v2, expected);
+}
+
+template <typename T>
+void equal_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v1(num, T(1));
+        hpx::partitioned_vector<T> v2(num, T(1));
+
+        equal_tests(v1, v2, true);
+
+        v2.set_value_sync(num - 1, T(2));
+        equal_tests(v1, v2, false);
+    }
+
+    {
+        hpx::partitioned_vector<T> v1(num, T(1), hpx::container_layout(2));
+        hpx::partitioned_vector<T> v2(num, T(1), hpx::container_layout(2));
+
+        equal_tests(v1, v2, true);
+
+        // the difference is located in the last partition only
+        v2.set_value_sync(num - 1, T(2));
+        equal_tests(v1, v2, false);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    equal_tests<int>();
+    equal_tests<double>();
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_scan.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <functional>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_exclusive_scan(hpx::partitioned_vector<T> const& dest)
+{
+    for (std::size_t i = 0; i != dest.size(); ++i)
+        HPX_TEST_EQ(dest.get_value_sync(i), T(i + 42));
+}
+
+template <typename ExPolicy, typename T>
+void test_exclusive_scan(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    iterator r = hpx::parallel::exclusive_scan(policy,
+        boost::begin(xvalues), boost::end(xvalues), boost::begin(dest),
+        T(42), std::plus<T>());
+    HPX_TEST(r == boost::end(dest));
+
+    verify_exclusive_scan(dest);
+}
+
+template <typename ExPolicy, typename T>
+void test_exclusive_scan_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::future<iterator> f = hpx::parallel::exclusive_scan(policy,
+        boost::begin(xvalues), boost::end(xvalues), boost::begin(dest),
+        T(42), std::plus<T>());
+    HPX_TEST(f.get() == boost::end(dest));
+
+    verify_exclusive_scan(dest);
+}
+
+template <typename T>
+void exclusive_scan_tests(hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    test_exclusive_scan(hpx::parallel::seq, xvalues, dest);
+    test_exclusive_scan(hpx::parallel::par, xvalues, dest);
+
+    test_exclusive_scan_async(hpx::parallel::seq(hpx::parallel::task),
+        xvalues, dest);
+    test_exclusive_scan_async(hpx::parallel::par(hpx::parallel::task),
+        xvalues, dest);
+}
+
+template <typename T>
+void exclusive_scan_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> xvalues(num, T(1));
+        hpx::partitioned_vector<T> dest(num);
+
+        exclusive_scan_tests(xvalues, dest);
+    }
+
+    {
+        hpx::partitioned_vector<T> xvalues(num, T(1), hpx::container_layout(2));
+        hpx::partitioned_vector<T> dest(num, hpx::container_layout(2));
+
+        exclusive_scan_tests(xvalues, dest);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    exclusive_scan_tests<int>();
+    exclusive_scan_tests<double>();
+
+    return 0;
+}
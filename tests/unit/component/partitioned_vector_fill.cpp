@@ -0,0 +1,78 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_fill.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_fill(hpx::partitioned_vector<T> const& v, T val)
+{
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(v.get_value_sync(i), val);
+}
+
+template <typename ExPolicy, typename T>
+void test_fill(ExPolicy && policy, hpx::partitioned_vector<T>& v, T val)
+{
+    hpx::parallel::fill(policy, boost::begin(v), boost::end(v), val);
+    verify_fill(v, val);
+}
+
+template <typename ExPolicy, typename T>
+void test_fill_async(ExPolicy && policy, hpx::partitioned_vector<T>& v,
+    T val)
+{
+    hpx::future<void> f =
+        hpx::parallel::fill(policy, boost::begin(v), boost::end(v), val);
+    f.get();
+
+    verify_fill(v, val);
+}
+
+template <typename T>
+void fill_tests(hpx::partitioned_vector<T>& v)
+{
+    test_fill(hpx::parallel::seq, v, T(1));
+    test_fill(hpx::parallel::par, v, T(2));
+
+    test_fill_async(hpx::parallel::seq(hpx::parallel::task), v, T(3));
+    test_fill_async(hpx::parallel::par(hpx::parallel::task), v, T(4));
+}
+
+template <typename T>
+void fill_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num);
+        fill_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(2));
+        fill_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    fill_tests<int>();
+    fill_tests<double>();
+
+    return 0;
+}
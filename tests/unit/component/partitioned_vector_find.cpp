@@ -0,0 +1,140 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_find.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <iterator>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct greater_than
+{
+    greater_than(T val = T())
+      : val_(val)
+    {}
+
+    bool operator()(T v) const
+    {
+        return v > val_;
+    }
+
+    T val_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & val_;
+    }
+};
+
+template <typename T>
+struct less_than
+{
+    less_than(T val = T())
+      : val_(val)
+    {}
+
+    bool operator()(T v) const
+    {
+        return v < val_;
+    }
+
+    T val_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & val_;
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_find(ExPolicy && policy, hpx::partitioned_vector<T> const& v,
+    std::size_t pos)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+
+    iterator r = hpx::parallel::find(policy,
+        boost::begin(v), boost::end(v), T(2));
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(v), r)), pos);
+
+    r = hpx::parallel::find(policy, boost::begin(v), boost::end(v), T(3));
+    HPX_TEST(r == boost::end(v));
+
+    r = hpx::parallel::find_if(policy, boost::begin(v), boost::end(v),
+        greater_than<T>(T(1)));
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(v), r)), pos);
+
+    r = hpx::parallel::find_if_not(policy, boost::begin(v), boost::end(v),
+        less_than<T>(T(2)));
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(v), r)), pos);
+}
+
+template <typename ExPolicy, typename T>
+void test_find_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v, std::size_t pos)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+
+    hpx::future<iterator> f = hpx::parallel::find(policy,
+        boost::begin(v), boost::end(v), T(2));
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(v), f.get())), pos);
+
+    f = hpx::parallel::find_if(policy, boost::begin(v), boost::end(v),
+        greater_than<T>(T(2)));
+    HPX_TEST(f.get() == boost::end(v));
+}
+
+template <typename T>
+void find_tests(hpx::partitioned_vector<T>& v)
+{
+    // place the values to find into different partitions, only the first
+    // one is expected to be found
+    std::size_t const pos = v.size() / 2 + 3;
+    v.set_value_sync(pos, T(2));
+    v.set_value_sync(v.size() - 1, T(2));
+
+    test_find(hpx::parallel::seq, v, pos);
+    test_find(hpx::parallel::par, v, pos);
+
+    test_find_async(hpx::parallel::seq(hpx::parallel::task), v, pos);
+    test_find_async(hpx::parallel::par(hpx::parallel::task), v, pos);
+}
+
+template <typename T>
+void find_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1));
+        find_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1), hpx::container_layout(2));
+        find_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    find_tests<int>();
+    find_tests<double>();
+
+    return 0;
+}
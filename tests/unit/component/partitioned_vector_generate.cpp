@@ -0,0 +1,102 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_generate.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// the generator is sent to the localities the segments live on, it has to be
+// serializable
+template <typename T>
+struct generator
+{
+    generator(T val = T())
+      : val_(val)
+    {}
+
+    T operator()() const
+    {
+        return val_;
+    }
+
+    T val_;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & val_;
+    }
+};
+
+template <typename T>
+void verify_generate(hpx::partitioned_vector<T> const& v, T val)
+{
+    for (std::size_t i = 0; i != v.size(); ++i)
+        HPX_TEST_EQ(v.get_value_sync(i), val);
+}
+
+template <typename ExPolicy, typename T>
+void test_generate(ExPolicy && policy, hpx::partitioned_vector<T>& v, T val)
+{
+    hpx::parallel::generate(policy, boost::begin(v), boost::end(v),
+        generator<T>(val));
+    verify_generate(v, val);
+}
+
+template <typename ExPolicy, typename T>
+void test_generate_async(ExPolicy && policy, hpx::partitioned_vector<T>& v,
+    T val)
+{
+    hpx::future<void> f = hpx::parallel::generate(policy,
+        boost::begin(v), boost::end(v), generator<T>(val));
+    f.get();
+
+    verify_generate(v, val);
+}
+
+template <typename T>
+void generate_tests(hpx::partitioned_vector<T>& v)
+{
+    test_generate(hpx::parallel::seq, v, T(1));
+    test_generate(hpx::parallel::par, v, T(2));
+
+    test_generate_async(hpx::parallel::seq(hpx::parallel::task), v, T(3));
+    test_generate_async(hpx::parallel::par(hpx::parallel::task), v, T(4));
+}
+
+template <typename T>
+void generate_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num);
+        generate_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(2));
+        generate_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    generate_tests<int>();
+    generate_tests<double>();
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <functional>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_min_max_element(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+
+    iterator r = hpx::parallel::min_element(policy,
+        boost::begin(v), boost::end(v));
+    HPX_TEST(r != boost::end(v));
+    HPX_TEST_EQ(*r, T(-1));
+
+    r = hpx::parallel::max_element(policy,
+        boost::begin(v), boost::end(v), std::less<T>());
+    HPX_TEST(r != boost::end(v));
+    HPX_TEST_EQ(*r, T(100));
+
+    std::pair<iterator, iterator> p = hpx::parallel::minmax_element(policy,
+        boost::begin(v), boost::end(v));
+    HPX_TEST_EQ(*p.first, T(-1));
+    HPX_TEST_EQ(*p.second, T(100));
+}
+
+template <typename ExPolicy, typename T>
+void test_min_max_element_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+
+    hpx::future<iterator> f = hpx::parallel::min_element(policy,
+        boost::begin(v), boost::end(v));
+    HPX_TEST_EQ(*f.get(), T(-1));
+
+    f = hpx::parallel::max_element(policy,
+        boost::begin(v), boost::end(v), std::less<T>());
+    HPX_TEST_EQ(*f.get(), T(100));
+
+    hpx::future<std::pair<iterator, iterator> > p =
+        hpx::parallel::minmax_element(policy,
+            boost::begin(v), boost::end(v), std::less<T>());
+    std::pair<iterator, iterator> result = p.get();
+    HPX_TEST_EQ(*result.first, T(-1));
+    HPX_TEST_EQ(*result.second, T(100));
+}
+
+template <typename T>
+void min_max_element_tests(hpx::partitioned_vector<T>& v)
+{
+    // place the extreme values into different partitions
+    v.set_value_sync(v.size() - 3, T(-1));
+    v.set_value_sync(7, T(100));
+
+    test_min_max_element(hpx::parallel::seq, v);
+    test_min_max_element(hpx::parallel::par, v);
+
+    test_min_max_element_async(hpx::parallel::seq(hpx::parallel::task), v);
+    test_min_max_element_async(hpx::parallel::par(hpx::parallel::task), v);
+}
+
+template <typename T>
+void min_max_element_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1));
+        min_max_element_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1), hpx::container_layout(2));
+        min_max_element_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    min_max_element_tests<int>();
+    min_max_element_tests<double>();
+
+    return 0;
+}
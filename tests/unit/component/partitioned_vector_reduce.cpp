@@ -0,0 +1,78 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <functional>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_reduce(ExPolicy && policy, hpx::partitioned_vector<T> const& v,
+    T expected)
+{
+    T r = hpx::parallel::reduce(policy, boost::begin(v), boost::end(v),
+        T(42), std::plus<T>());
+    HPX_TEST_EQ(r, expected + T(42));
+
+    r = hpx::parallel::reduce(policy, boost::begin(v), boost::end(v));
+    HPX_TEST_EQ(r, expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_reduce_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& v, T expected)
+{
+    hpx::future<T> f = hpx::parallel::reduce(policy,
+        boost::begin(v), boost::end(v), T(42), std::plus<T>());
+    HPX_TEST_EQ(f.get(), expected + T(42));
+}
+
+template <typename T>
+void reduce_tests(hpx::partitioned_vector<T> const& v)
+{
+    T const expected = T(v.size());
+
+    test_reduce(hpx::parallel::seq, v, expected);
+    test_reduce(hpx::parallel::par, v, expected);
+
+    test_reduce_async(hpx::parallel::seq(hpx::parallel::task), v, expected);
+    test_reduce_async(hpx::parallel::par(hpx::parallel::task), v, expected);
+}
+
+template <typename T>
+void reduce_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1));
+        reduce_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, T(1), hpx::container_layout(2));
+        reduce_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    reduce_tests<int>();
+    reduce_tests<double>();
+
+    return 0;
+}
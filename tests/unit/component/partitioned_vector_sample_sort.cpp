@@ -0,0 +1,146 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_sample_sort.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// Fill the vector and return a copy of the values stored in it
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    // descending values move most of the elements to another partition, add
+    // some noise to create duplicates
+    std::vector<T> values(v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        values[i] = T(v.size() - i + std::rand() % 17);
+        v.set_value_sync(i, values[i]);
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<std::size_t> partition_sizes(hpx::partitioned_vector<T> const& v)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+    typedef hpx::traits::segmented_iterator_traits<iterator> traits;
+    typedef typename traits::segment_iterator segment_iterator;
+
+    std::vector<std::size_t> sizes;
+    for (segment_iterator it = v.segment_cbegin(); it != v.segment_cend();
+        ++it)
+    {
+        sizes.push_back(std::distance(traits::begin(it), traits::end(it)));
+    }
+    return sizes;
+}
+
+// The vector has to hold exactly the original values in sorted order
+template <typename T, typename Compare>
+void verify_sort(hpx::partitioned_vector<T> const& v,
+    std::vector<T> expected, std::vector<std::size_t> const& sizes,
+    Compare comp)
+{
+    std::sort(expected.begin(), expected.end(), comp);
+
+    HPX_TEST_EQ(v.size(), expected.size());
+    for (std::size_t i = 0; i != expected.size(); ++i)
+        HPX_TEST_EQ(v.get_value_sync(i), expected[i]);
+
+    // the partitions have to keep their sizes
+    HPX_TEST(partition_sizes(v) == sizes);
+}
+
+template <typename ExPolicy, typename T>
+void test_sample_sort(ExPolicy && policy, hpx::partitioned_vector<T>& v)
+{
+    std::vector<std::size_t> sizes = partition_sizes(v);
+
+    std::vector<T> values = fill_vector(v);
+    hpx::parallel::sample_sort_timings t =
+        hpx::parallel::sample_sort(policy, boost::begin(v), boost::end(v));
+    verify_sort(v, values, sizes, std::less<T>());
+
+    HPX_TEST(t.local_sort != 0);
+
+    values = fill_vector(v);
+    hpx::parallel::sample_sort(policy, boost::begin(v), boost::end(v),
+        std::greater<T>());
+    verify_sort(v, values, sizes, std::greater<T>());
+}
+
+template <typename ExPolicy, typename T>
+void test_sample_sort_async(ExPolicy && policy, hpx::partitioned_vector<T>& v)
+{
+    std::vector<std::size_t> sizes = partition_sizes(v);
+
+    std::vector<T> values = fill_vector(v);
+    hpx::future<hpx::parallel::sample_sort_timings> f =
+        hpx::parallel::sample_sort(policy, boost::begin(v), boost::end(v));
+    hpx::parallel::sample_sort_timings t = f.get();
+
+    verify_sort(v, values, sizes, std::less<T>());
+    HPX_TEST(t.local_sort != 0);
+}
+
+template <typename T>
+void sample_sort_tests(hpx::partitioned_vector<T>& v)
+{
+    test_sample_sort(hpx::parallel::seq, v);
+    test_sample_sort(hpx::parallel::par, v);
+
+    test_sample_sort_async(hpx::parallel::seq(hpx::parallel::task), v);
+    test_sample_sort_async(hpx::parallel::par(hpx::parallel::task), v);
+}
+
+template <typename T>
+void sample_sort_tests(std::vector<hpx::id_type> const& localities)
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num);
+        sample_sort_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(localities));
+        sample_sort_tests(v);
+    }
+
+    {
+        // partitions of different sizes spread over all localities
+        hpx::partitioned_vector<T> v(num,
+            hpx::container_layout(7, localities));
+        sample_sort_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sample_sort_tests<int>(localities);
+    sample_sort_tests<double>(localities);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_sort.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// Fill the vector and return a copy of the values stored in it
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    // descending values force the largest possible number of exchanges
+    // between the partitions, add some noise to create duplicates
+    std::vector<T> values(v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        values[i] = T(v.size() - i + std::rand() % 17);
+        v.set_value_sync(i, values[i]);
+    }
+    return values;
+}
+
+// The vector has to hold exactly the original values in sorted order
+template <typename T, typename Compare>
+void verify_sort(hpx::partitioned_vector<T> const& v,
+    std::vector<T> expected, Compare comp)
+{
+    std::sort(expected.begin(), expected.end(), comp);
+
+    HPX_TEST_EQ(v.size(), expected.size());
+    for (std::size_t i = 0; i != expected.size(); ++i)
+        HPX_TEST_EQ(v.get_value_sync(i), expected[i]);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort(ExPolicy && policy, hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values = fill_vector(v);
+    hpx::parallel::sort(policy, boost::begin(v), boost::end(v));
+    verify_sort(v, values, std::less<T>());
+
+    values = fill_vector(v);
+    hpx::parallel::sort(policy, boost::begin(v), boost::end(v),
+        std::greater<T>());
+    verify_sort(v, values, std::greater<T>());
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_async(ExPolicy && policy, hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values = fill_vector(v);
+    hpx::future<void> f =
+        hpx::parallel::sort(policy, boost::begin(v), boost::end(v));
+    f.get();
+
+    verify_sort(v, values, std::less<T>());
+}
+
+template <typename T>
+void sort_tests(hpx::partitioned_vector<T>& v)
+{
+    test_sort(hpx::parallel::seq, v);
+    test_sort(hpx::parallel::par, v);
+
+    test_sort_async(hpx::parallel::seq(hpx::parallel::task), v);
+    test_sort_async(hpx::parallel::par(hpx::parallel::task), v);
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> v(num);
+        sort_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(2));
+        sort_tests(v);
+    }
+
+    {
+        // partitions of different sizes
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(7));
+        sort_tests(v);
+    }
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    {
+        hpx::partitioned_vector<T> v(num, hpx::container_layout(localities));
+        sort_tests(v);
+    }
+
+    {
+        // partitions of different sizes spread over all localities
+        hpx::partitioned_vector<T> v(num,
+            hpx::container_layout(7, localities));
+        sort_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<int>();
+    sort_tests<double>();
+
+    return 0;
+}
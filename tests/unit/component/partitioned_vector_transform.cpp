@@ -0,0 +1,115 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/parallel_transform.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(double);
+HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+struct multiply
+{
+    template <typename T>
+    T operator()(T val) const
+    {
+        return 2 * val;
+    }
+};
+
+template <typename T>
+void verify_transform(hpx::partitioned_vector<T> const& dest)
+{
+    for (std::size_t i = 0; i != dest.size(); ++i)
+        HPX_TEST_EQ(dest.get_value_sync(i), T(2 * i));
+}
+
+template <typename ExPolicy, typename T>
+void test_transform(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+    typedef typename hpx::partitioned_vector<T>::iterator output_iterator;
+
+    hpx::util::tuple<iterator, output_iterator> r =
+        hpx::parallel::transform(policy,
+            boost::begin(xvalues), boost::end(xvalues), boost::begin(dest),
+            multiply());
+    HPX_TEST(hpx::util::get<0>(r) == boost::end(xvalues));
+    HPX_TEST(hpx::util::get<1>(r) == boost::end(dest));
+
+    verify_transform(dest);
+}
+
+template <typename ExPolicy, typename T>
+void test_transform_async(ExPolicy && policy,
+    hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator iterator;
+    typedef typename hpx::partitioned_vector<T>::iterator output_iterator;
+
+    hpx::future<hpx::util::tuple<iterator, output_iterator> > f =
+        hpx::parallel::transform(policy,
+            boost::begin(xvalues), boost::end(xvalues), boost::begin(dest),
+            multiply());
+    HPX_TEST(hpx::util::get<1>(f.get()) == boost::end(dest));
+
+    verify_transform(dest);
+}
+
+template <typename T>
+void transform_tests(hpx::partitioned_vector<T> const& xvalues,
+    hpx::partitioned_vector<T>& dest)
+{
+    test_transform(hpx::parallel::seq, xvalues, dest);
+    test_transform(hpx::parallel::par, xvalues, dest);
+
+    test_transform_async(hpx::parallel::seq(hpx::parallel::task),
+        xvalues, dest);
+    test_transform_async(hpx::parallel::par(hpx::parallel::task),
+        xvalues, dest);
+}
+
+template <typename T>
+void transform_tests()
+{
+    std::size_t const num = 10007;
+
+    {
+        hpx::partitioned_vector<T> xvalues(num);
+        hpx::partitioned_vector<T> dest(num);
+        for (std::size_t i = 0; i != num; ++i)
+            xvalues.set_value_sync(i, T(i));
+
+        transform_tests(xvalues, dest);
+    }
+
+    {
+        hpx::partitioned_vector<T> xvalues(num, hpx::container_layout(2));
+        hpx::partitioned_vector<T> dest(num, hpx::container_layout(2));
+        for (std::size_t i = 0; i != num; ++i)
+            xvalues.set_value_sync(i, T(i));
+
+        transform_tests(xvalues, dest);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    transform_tests<int>();
+    transform_tests<double>();
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::size_t> make_sorted_data(std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 10000;
+    std::sort(boost::begin(c), boost::end(c));
+    return c;
+}
+
+void verify_merge(std::vector<std::size_t> const& c,
+    std::vector<std::size_t> const& d)
+{
+    std::size_t count = 0;
+    HPX_TEST(std::equal(boost::begin(c), boost::end(c), boost::begin(d),
+        [&count](std::size_t v1, std::size_t v2) -> bool {
+            HPX_TEST_EQ(v1, v2);
+            ++count;
+            return v1 == v2;
+        }));
+    HPX_TEST_EQ(count, d.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge(ExPolicy policy, std::size_t size1, std::size_t size2)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c1 = make_sorted_data(size1);
+    std::vector<std::size_t> c2 = make_sorted_data(size2);
+    std::vector<std::size_t> dest(size1 + size2);
+    std::vector<std::size_t> d(size1 + size2);
+
+    std::vector<std::size_t>::iterator result = hpx::parallel::merge(policy,
+        boost::begin(c1), boost::end(c1), boost::begin(c2), boost::end(c2),
+        boost::begin(dest));
+    std::merge(boost::begin(c1), boost::end(c1),
+        boost::begin(c2), boost::end(c2), boost::begin(d));
+
+    HPX_TEST(result == boost::end(dest));
+    verify_merge(dest, d);
+}
+
+template <typename ExPolicy>
+void test_merge_async(ExPolicy p, std::size_t size1, std::size_t size2)
+{
+    std::vector<std::size_t> c1 = make_sorted_data(size1);
+    std::vector<std::size_t> c2 = make_sorted_data(size2);
+    std::vector<std::size_t> dest(size1 + size2);
+    std::vector<std::size_t> d(size1 + size2);
+
+    hpx::future<std::vector<std::size_t>::iterator> f =
+        hpx::parallel::merge(p,
+            boost::begin(c1), boost::end(c1), boost::begin(c2), boost::end(c2),
+            boost::begin(dest));
+    std::merge(boost::begin(c1), boost::end(c1),
+        boost::begin(c2), boost::end(c2), boost::begin(d));
+
+    HPX_TEST(f.get() == boost::end(dest));
+    verify_merge(dest, d);
+}
+
+template <typename ExPolicy>
+void test_inplace_merge(ExPolicy policy, std::size_t size1, std::size_t size2)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = make_sorted_data(size1);
+    std::vector<std::size_t> c2 = make_sorted_data(size2);
+    c.insert(boost::end(c), boost::begin(c2), boost::end(c2));
+    std::vector<std::size_t> d = c;
+
+    hpx::parallel::inplace_merge(policy,
+        boost::begin(c), boost::begin(c) + size1, boost::end(c));
+    std::inplace_merge(boost::begin(d), boost::begin(d) + size1, boost::end(d));
+
+    verify_merge(c, d);
+}
+
+template <typename ExPolicy>
+void test_inplace_merge_async(ExPolicy p, std::size_t size1,
+    std::size_t size2)
+{
+    std::vector<std::size_t> c = make_sorted_data(size1);
+    std::vector<std::size_t> c2 = make_sorted_data(size2);
+    c.insert(boost::end(c), boost::begin(c2), boost::end(c2));
+    std::vector<std::size_t> d = c;
+
+    hpx::future<void> f = hpx::parallel::inplace_merge(p,
+        boost::begin(c), boost::begin(c) + size1, boost::end(c));
+    f.wait();
+
+    std::inplace_merge(boost::begin(d), boost::begin(d) + size1, boost::end(d));
+
+    verify_merge(c, d);
+}
+
+void merge_test()
+{
+    using namespace hpx::parallel;
+
+    // the larger sizes exercise the parallel merge steps
+    std::size_t sizes[][2] = {
+        { 10007, 5003 }, { 1000007, 300007 }, { 17, 700007 }
+    };
+    for (std::size_t* s : sizes)
+    {
+        test_merge(seq, s[0], s[1]);
+        test_merge(par, s[0], s[1]);
+        test_merge(par_vec, s[0], s[1]);
+
+        test_merge_async(seq(task), s[0], s[1]);
+        test_merge_async(par(task), s[0], s[1]);
+
+        test_merge(execution_policy(seq), s[0], s[1]);
+        test_merge(execution_policy(par), s[0], s[1]);
+        test_merge(execution_policy(par_vec), s[0], s[1]);
+        test_merge(execution_policy(seq(task)), s[0], s[1]);
+        test_merge(execution_policy(par(task)), s[0], s[1]);
+
+        test_inplace_merge(seq, s[0], s[1]);
+        test_inplace_merge(par, s[0], s[1]);
+        test_inplace_merge(par_vec, s[0], s[1]);
+
+        test_inplace_merge_async(seq(task), s[0], s[1]);
+        test_inplace_merge_async(par(task), s[0], s[1]);
+
+        test_inplace_merge(execution_policy(seq), s[0], s[1]);
+        test_inplace_merge(execution_policy(par), s[0], s[1]);
+        test_inplace_merge(execution_policy(par_vec), s[0], s[1]);
+        test_inplace_merge(execution_policy(seq(task)), s[0], s[1]);
+        test_inplace_merge(execution_policy(par(task)), s[0], s[1]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    merge_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
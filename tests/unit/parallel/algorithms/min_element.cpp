@@ -48,6 +48,17 @@ void test_min_element(ExPolicy policy, IteratorTag)
     ref = std::min_element(boost::begin(c), boost::end(c));
     HPX_TEST(ref != ref_end);
     HPX_TEST_EQ(*ref, *r);
+
+    // negating the projected values reverses the order of the elements
+    r = hpx::parallel::min_element(policy,
+        iterator(boost::begin(c)), iterator(boost::end(c)),
+        std::less<std::ptrdiff_t>(),
+        [](std::size_t v) { return -std::ptrdiff_t(v); });
+    HPX_TEST(r != end);
+
+    ref = std::max_element(boost::begin(c), boost::end(c));
+    HPX_TEST(ref != ref_end);
+    HPX_TEST_EQ(*ref, *r);
 }
 
 template <typename ExPolicy, typename IteratorTag>
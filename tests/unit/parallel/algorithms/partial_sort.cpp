@@ -0,0 +1,134 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::size_t> make_data(std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 100000;
+    return c;
+}
+
+void verify_partial_sort(std::vector<std::size_t> const& c, std::size_t n,
+    std::vector<std::size_t> d)
+{
+    std::sort(boost::begin(d), boost::end(d));
+
+    std::size_t count = 0;
+    HPX_TEST(std::equal(boost::begin(c), boost::begin(c) + n, boost::begin(d),
+        [&count](std::size_t v1, std::size_t v2) -> bool {
+            HPX_TEST_EQ(v1, v2);
+            ++count;
+            return v1 == v2;
+        }));
+    HPX_TEST_EQ(count, n);
+}
+
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy policy, std::size_t size, std::size_t n)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c = make_data(size);
+    std::vector<std::size_t> d = c;
+
+    hpx::parallel::partial_sort(policy,
+        boost::begin(c), boost::begin(c) + n, boost::end(c));
+
+    verify_partial_sort(c, n, d);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy p, std::size_t size, std::size_t n)
+{
+    std::vector<std::size_t> c = make_data(size);
+    std::vector<std::size_t> d = c;
+
+    hpx::future<void> f = hpx::parallel::partial_sort(p,
+        boost::begin(c), boost::begin(c) + n, boost::end(c));
+    f.wait();
+
+    verify_partial_sort(c, n, d);
+}
+
+void partial_sort_test()
+{
+    using namespace hpx::parallel;
+
+    // the larger size exercises the parallel partitioning steps
+    std::size_t sizes[] = { 10007, 1000007 };
+    for (std::size_t size : sizes)
+    {
+        std::size_t counts[] = { 0, size / 3, size };
+        for (std::size_t n : counts)
+        {
+            test_partial_sort(seq, size, n);
+            test_partial_sort(par, size, n);
+            test_partial_sort(par_vec, size, n);
+
+            test_partial_sort_async(seq(task), size, n);
+            test_partial_sort_async(par(task), size, n);
+
+            test_partial_sort(execution_policy(seq), size, n);
+            test_partial_sort(execution_policy(par), size, n);
+            test_partial_sort(execution_policy(par_vec), size, n);
+            test_partial_sort(execution_policy(seq(task)), size, n);
+            test_partial_sort(execution_policy(par(task)), size, n);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partial_sort_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,262 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_data(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 1000;
+    return c;
+}
+
+struct is_small
+{
+    bool operator()(int v) const
+    {
+        return v < 300;
+    }
+};
+
+void verify_partition(std::vector<int> c, std::vector<int> d,
+    std::size_t count)
+{
+    std::vector<int>::iterator middle = boost::begin(d);
+    std::advance(middle, count);
+
+    HPX_TEST(std::is_partitioned(boost::begin(d), boost::end(d), is_small()));
+    HPX_TEST(std::partition_point(boost::begin(d), boost::end(d),
+        is_small()) == middle);
+
+    std::sort(boost::begin(c), boost::end(c));
+    std::sort(boost::begin(d), boost::end(d));
+    HPX_TEST(c == d);
+}
+
+void verify_stable_partition(std::vector<int> c, std::vector<int> const& d,
+    std::size_t count)
+{
+    std::vector<int>::iterator expected =
+        std::stable_partition(boost::begin(c), boost::end(c), is_small());
+
+    HPX_TEST_EQ(count,
+        std::size_t(std::distance(boost::begin(c), expected)));
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    iterator result = hpx::parallel::partition(policy,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    verify_partition(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    hpx::future<iterator> f = hpx::parallel::partition(p,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    iterator result = f.get();
+    verify_partition(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_stable_partition(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    iterator result = hpx::parallel::stable_partition(policy,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    verify_stable_partition(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_stable_partition_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    hpx::future<iterator> f = hpx::parallel::stable_partition(p,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    iterator result = f.get();
+    verify_stable_partition(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename IteratorTag>
+void test_partition(IteratorTag tag, std::size_t size)
+{
+    using namespace hpx::parallel;
+
+    test_partition(seq, tag, size);
+    test_partition(par, tag, size);
+    test_partition(par_vec, tag, size);
+
+    test_partition_async(seq(task), tag, size);
+    test_partition_async(par(task), tag, size);
+
+    test_partition(execution_policy(seq), tag, size);
+    test_partition(execution_policy(par), tag, size);
+    test_partition(execution_policy(par(task)), tag, size);
+}
+
+template <typename IteratorTag>
+void test_stable_partition(IteratorTag tag, std::size_t size)
+{
+    using namespace hpx::parallel;
+
+    test_stable_partition(seq, tag, size);
+    test_stable_partition(par, tag, size);
+    test_stable_partition(par_vec, tag, size);
+
+    test_stable_partition_async(seq(task), tag, size);
+    test_stable_partition_async(par(task), tag, size);
+
+    test_stable_partition(execution_policy(seq), tag, size);
+    test_stable_partition(execution_policy(par), tag, size);
+    test_stable_partition(execution_policy(par(task)), tag, size);
+
+    // small chunks force most of the chunks to look back
+    static_chunk_size scs(64);
+    test_stable_partition(par.with(scs), tag, size);
+    test_stable_partition_async(par(task).with(scs), tag, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(100007);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::partition(policy,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            [](int) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_partition_exception(IteratorTag tag)
+{
+    using namespace hpx::parallel;
+
+    test_partition_exception(seq, tag);
+    test_partition_exception(par, tag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void partition_test()
+{
+    std::size_t const sizes[] = { 0, 1, 7, 1023, 16384, 100003 };
+    for (std::size_t size : sizes)
+    {
+        test_partition(std::random_access_iterator_tag(), size);
+        test_partition(std::forward_iterator_tag(), size);
+
+        test_stable_partition(std::random_access_iterator_tag(), size);
+        test_stable_partition(std::bidirectional_iterator_tag(), size);
+    }
+
+    test_partition_exception(std::random_access_iterator_tag());
+    test_partition_exception(std::forward_iterator_tag());
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partition_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
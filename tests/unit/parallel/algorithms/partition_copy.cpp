@@ -0,0 +1,221 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_data(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 1000;
+    return c;
+}
+
+struct is_small
+{
+    bool operator()(int v) const
+    {
+        return v < 300;
+    }
+};
+
+void verify_partition_copy(std::vector<int> const& c,
+    std::vector<int> const& d_true, std::vector<int> const& d_false,
+    std::pair<std::size_t, std::size_t> counts)
+{
+    std::vector<int> e_true(c.size());
+    std::vector<int> e_false(c.size());
+
+    std::pair<
+            std::vector<int>::iterator, std::vector<int>::iterator
+        > expected = std::partition_copy(boost::begin(c), boost::end(c),
+            boost::begin(e_true), boost::begin(e_false), is_small());
+
+    HPX_TEST_EQ(counts.first,
+        std::size_t(std::distance(boost::begin(e_true), expected.first)));
+    HPX_TEST_EQ(counts.second,
+        std::size_t(std::distance(boost::begin(e_false), expected.second)));
+
+    HPX_TEST(std::equal(boost::begin(e_true), expected.first,
+        boost::begin(d_true)));
+    HPX_TEST(std::equal(boost::begin(e_false), expected.second,
+        boost::begin(d_false)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_copy(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d_true(size);
+    std::vector<int> d_false(size);
+
+    std::pair<base_iterator, base_iterator> result =
+        hpx::parallel::partition_copy(policy,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            boost::begin(d_true), boost::begin(d_false), is_small());
+
+    verify_partition_copy(c, d_true, d_false, std::make_pair(
+        std::size_t(std::distance(boost::begin(d_true), result.first)),
+        std::size_t(std::distance(boost::begin(d_false), result.second))));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_copy_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d_true(size);
+    std::vector<int> d_false(size);
+
+    hpx::future<std::pair<base_iterator, base_iterator> > f =
+        hpx::parallel::partition_copy(p,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            boost::begin(d_true), boost::begin(d_false), is_small());
+
+    std::pair<base_iterator, base_iterator> result = f.get();
+    verify_partition_copy(c, d_true, d_false, std::make_pair(
+        std::size_t(std::distance(boost::begin(d_true), result.first)),
+        std::size_t(std::distance(boost::begin(d_false), result.second))));
+}
+
+template <typename IteratorTag>
+void test_partition_copy(IteratorTag tag, std::size_t size)
+{
+    using namespace hpx::parallel;
+
+    test_partition_copy(seq, tag, size);
+    test_partition_copy(par, tag, size);
+    test_partition_copy(par_vec, tag, size);
+
+    test_partition_copy_async(seq(task), tag, size);
+    test_partition_copy_async(par(task), tag, size);
+
+    test_partition_copy(execution_policy(seq), tag, size);
+    test_partition_copy(execution_policy(par), tag, size);
+    test_partition_copy(execution_policy(par(task)), tag, size);
+
+    // small chunks force most of the chunks to look back
+    static_chunk_size scs(64);
+    test_partition_copy(par.with(scs), tag, size);
+    test_partition_copy_async(par(task).with(scs), tag, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_copy_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(100007);
+    std::vector<int> d_true(c.size());
+    std::vector<int> d_false(c.size());
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::partition_copy(policy,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            boost::begin(d_true), boost::begin(d_false),
+            [](int v) -> bool
+            {
+                if (v == 42)
+                    throw std::runtime_error("test");
+                return v < 300;
+            });
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    // the data contains the value 42 with a high probability only
+    if (std::find(boost::begin(c), boost::end(c), 42) != boost::end(c))
+        HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_partition_copy_exception(IteratorTag tag)
+{
+    using namespace hpx::parallel;
+
+    test_partition_copy_exception(seq, tag);
+    test_partition_copy_exception(par, tag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void partition_copy_test()
+{
+    std::size_t const sizes[] = { 1, 7, 1023, 16384, 100003 };
+    for (std::size_t size : sizes)
+    {
+        test_partition_copy(std::random_access_iterator_tag(), size);
+        test_partition_copy(std::forward_iterator_tag(), size);
+    }
+
+    test_partition_copy_exception(std::random_access_iterator_tag());
+    test_partition_copy_exception(std::forward_iterator_tag());
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    partition_copy_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,272 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_pipeline.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+struct square
+{
+    int operator()(int i) const
+    {
+        return i * i;
+    }
+};
+
+struct is_even
+{
+    bool operator()(int i) const
+    {
+        return i % 2 == 0;
+    }
+};
+
+struct plus_one
+{
+    long operator()(int i) const
+    {
+        return i + 1;
+    }
+};
+
+// computes the expected results of the tested pipeline sequentially
+std::vector<long> expected_elements(std::vector<int> const& c)
+{
+    std::vector<long> result;
+    for (int i : c)
+    {
+        int sq = square()(i);
+        if (is_even()(sq))
+            result.push_back(plus_one()(sq));
+    }
+    return result;
+}
+
+template <typename Iter>
+auto make_test_pipeline(Iter first, Iter last)
+->  decltype(hpx::parallel::make_pipeline(first, last)
+        | hpx::parallel::transformed(square())
+        | hpx::parallel::filtered(is_even())
+        | hpx::parallel::transformed(plus_one()))
+{
+    using namespace hpx::parallel;
+    return make_pipeline(first, last)
+        | transformed(square())
+        | filtered(is_even())
+        | transformed(plus_one());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_pipeline(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(size);
+    std::iota(boost::begin(c), boost::end(c), std::rand() % 1000);
+
+    std::vector<long> expected = expected_elements(c);
+
+    auto view = make_test_pipeline(
+        iterator(boost::begin(c)), iterator(boost::end(c)));
+
+    // count
+    HPX_TEST_EQ(std::size_t(hpx::parallel::count(policy, view)),
+        expected.size());
+
+    // reduce
+    HPX_TEST_EQ(hpx::parallel::reduce(policy, view, 42L),
+        std::accumulate(boost::begin(expected), boost::end(expected), 42L));
+    HPX_TEST_EQ(hpx::parallel::reduce(policy, view, 0L, std::plus<long>()),
+        std::accumulate(boost::begin(expected), boost::end(expected), 0L));
+
+    // copy, preserves the order of the elements
+    std::vector<long> d(size);
+    std::vector<long>::iterator end =
+        hpx::parallel::copy(policy, view, boost::begin(d));
+
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(d), end)),
+        expected.size());
+    HPX_TEST(std::equal(boost::begin(expected), boost::end(expected),
+        boost::begin(d)));
+
+    // for_each
+    boost::atomic<long> sum(0);
+    iterator result = hpx::parallel::for_each(policy, view,
+        [&sum](long v)
+        {
+            sum += v;
+        });
+
+    HPX_TEST(result == iterator(boost::end(c)));
+    HPX_TEST_EQ(sum.load(),
+        std::accumulate(boost::begin(expected), boost::end(expected), 0L));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_pipeline_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(size);
+    std::iota(boost::begin(c), boost::end(c), std::rand() % 1000);
+
+    std::vector<long> expected = expected_elements(c);
+
+    auto view = make_test_pipeline(
+        iterator(boost::begin(c)), iterator(boost::end(c)));
+
+    hpx::future<std::ptrdiff_t> f1 = hpx::parallel::count(p, view);
+    HPX_TEST_EQ(std::size_t(f1.get()), expected.size());
+
+    hpx::future<long> f2 = hpx::parallel::reduce(p, view, 42L);
+    HPX_TEST_EQ(f2.get(),
+        std::accumulate(boost::begin(expected), boost::end(expected), 42L));
+
+    std::vector<long> d(size);
+    hpx::future<std::vector<long>::iterator> f3 =
+        hpx::parallel::copy(p, view, boost::begin(d));
+
+    std::vector<long>::iterator end = f3.get();
+    HPX_TEST_EQ(std::size_t(std::distance(boost::begin(d), end)),
+        expected.size());
+    HPX_TEST(std::equal(boost::begin(expected), boost::end(expected),
+        boost::begin(d)));
+}
+
+template <typename IteratorTag>
+void test_pipeline(IteratorTag tag, std::size_t size)
+{
+    using namespace hpx::parallel;
+
+    test_pipeline(seq, tag, size);
+    test_pipeline(par, tag, size);
+    test_pipeline(par_vec, tag, size);
+
+    test_pipeline_async(seq(task), tag, size);
+    test_pipeline_async(par(task), tag, size);
+
+    test_pipeline(execution_policy(seq), tag, size);
+    test_pipeline(execution_policy(par), tag, size);
+
+    // small chunks create many chunks without any remaining elements
+    static_chunk_size scs(4);
+    test_pipeline(par.with(scs), tag, size);
+    test_pipeline_async(par(task).with(scs), tag, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_pipeline_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+
+    auto view = hpx::parallel::make_pipeline(
+            iterator(boost::begin(c)), iterator(boost::end(c)))
+        | hpx::parallel::filtered(
+            [](int) -> bool
+            {
+                throw std::runtime_error("test");
+                return true;
+            });
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::reduce(policy, view, 0);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_pipeline_exception(IteratorTag tag)
+{
+    using namespace hpx::parallel;
+
+    test_pipeline_exception(seq, tag);
+    test_pipeline_exception(par, tag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void pipeline_test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 7, 1023, 100003 };
+    for (std::size_t size : sizes)
+    {
+        test_pipeline(std::random_access_iterator_tag(), size);
+        test_pipeline(std::forward_iterator_tag(), size);
+    }
+
+    test_pipeline_exception(std::random_access_iterator_tag());
+    test_pipeline_exception(std::forward_iterator_tag());
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    pipeline_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,223 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_data(std::size_t size)
+{
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 1000;
+    return c;
+}
+
+struct is_small
+{
+    bool operator()(int v) const
+    {
+        return v < 300;
+    }
+};
+
+void verify_remove_if(std::vector<int> c, std::vector<int> const& d,
+    std::size_t count)
+{
+    std::vector<int>::iterator expected =
+        std::remove_if(boost::begin(c), boost::end(c), is_small());
+
+    HPX_TEST_EQ(count,
+        std::size_t(std::distance(boost::begin(c), expected)));
+    HPX_TEST(std::equal(boost::begin(c), expected, boost::begin(d)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_if(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    iterator result = hpx::parallel::remove_if(policy,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    verify_remove_if(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_if_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(size);
+    std::vector<int> d = c;
+
+    hpx::future<iterator> f = hpx::parallel::remove_if(p,
+        iterator(boost::begin(d)), iterator(boost::end(d)), is_small());
+
+    iterator result = f.get();
+    verify_remove_if(c, d, std::size_t(
+        std::distance(boost::begin(d), result.base())));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_remove(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::rand() % 4;
+    std::vector<int> d = c;
+
+    iterator result = hpx::parallel::remove(policy,
+        iterator(boost::begin(d)), iterator(boost::end(d)), 0);
+
+    base_iterator expected = std::remove(boost::begin(c), boost::end(c), 0);
+
+    HPX_TEST_EQ(std::distance(boost::begin(c), expected),
+        std::distance(boost::begin(d), result.base()));
+    HPX_TEST(std::equal(boost::begin(c), expected, boost::begin(d)));
+}
+
+template <typename IteratorTag>
+void test_remove(IteratorTag tag, std::size_t size)
+{
+    using namespace hpx::parallel;
+
+    test_remove_if(seq, tag, size);
+    test_remove_if(par, tag, size);
+    test_remove_if(par_vec, tag, size);
+
+    test_remove_if_async(seq(task), tag, size);
+    test_remove_if_async(par(task), tag, size);
+
+    test_remove_if(execution_policy(seq), tag, size);
+    test_remove_if(execution_policy(par), tag, size);
+    test_remove_if(execution_policy(par(task)), tag, size);
+
+    // small chunks force most of the chunks to look back
+    static_chunk_size scs(64);
+    test_remove_if(par.with(scs), tag, size);
+    test_remove_if_async(par(task).with(scs), tag, size);
+
+    test_remove(seq, tag, size);
+    test_remove(par, tag, size);
+    test_remove(par.with(scs), tag, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_remove_if_exception(ExPolicy policy, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = make_data(100007);
+
+    bool caught_exception = false;
+    bool found = std::find(boost::begin(c), boost::end(c), 42) != boost::end(c);
+    try {
+        hpx::parallel::remove_if(policy,
+            iterator(boost::begin(c)), iterator(boost::end(c)),
+            [](int v) -> bool
+            {
+                if (v == 42)
+                    throw std::runtime_error("test");
+                return v < 300;
+            });
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    // the data contains the value 42 with a high probability only
+    if (found)
+        HPX_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_remove_if_exception(IteratorTag tag)
+{
+    using namespace hpx::parallel;
+
+    test_remove_if_exception(seq, tag);
+    test_remove_if_exception(par, tag);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void remove_test()
+{
+    std::size_t const sizes[] = { 0, 1, 7, 1023, 16384, 100003 };
+    for (std::size_t size : sizes)
+    {
+        test_remove(std::random_access_iterator_tag(), size);
+        test_remove(std::forward_iterator_tag(), size);
+    }
+
+    test_remove_if_exception(std::random_access_iterator_tag());
+    test_remove_if_exception(std::forward_iterator_tag());
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    remove_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
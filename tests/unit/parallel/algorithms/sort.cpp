@@ -113,6 +113,28 @@ void test_sort2()
     test_sort2(execution_policy(par(task)), int());
 }
 
+void test_sort3()
+{
+    using namespace hpx::parallel;
+
+    test_sort3(seq,     int());
+    test_sort3(par,     int());
+    test_sort3(par_vec, int());
+
+    test_sort3(par,     short());
+    test_sort3(par,     boost::int64_t());
+    test_sort3(par,     boost::uint32_t());
+    test_sort3(par,     float());
+    test_sort3(par,     double());
+
+    test_sort3_async(seq(task), int());
+    test_sort3_async(par(task), int());
+    test_sort3_async(par(task), double());
+
+    test_sort3(execution_policy(par),       boost::int64_t());
+    test_sort3(execution_policy(par(task)), float());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -125,6 +147,7 @@ int hpx_main(boost::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
     return hpx::finalize();
 }
 
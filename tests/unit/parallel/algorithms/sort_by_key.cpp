@@ -0,0 +1,174 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are derived from the keys, which allows to verify that they
+// were reordered along with the keys.
+template <typename Key>
+std::size_t make_value(Key key)
+{
+    return std::size_t(key) * 7 + 3;
+}
+
+template <typename Key>
+void make_data(std::size_t size, std::vector<Key>& keys,
+    std::vector<std::size_t>& values)
+{
+    keys.resize(size);
+    values.resize(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = Key(std::rand() % 100000) - Key(std::rand() % 100000);
+        values[i] = make_value(keys[i]);
+    }
+}
+
+template <typename Key, typename Compare>
+void verify_sort_by_key(std::vector<Key> const& keys,
+    std::vector<std::size_t> const& values, std::vector<Key> d,
+    Compare comp)
+{
+    std::sort(boost::begin(d), boost::end(d), comp);
+    HPX_TEST(keys == d);
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+        HPX_TEST_EQ(values[i], make_value(keys[i]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Key,
+    typename Compare = std::less<Key> >
+void test_sort_by_key(ExPolicy policy, Key, std::size_t size,
+    Compare comp = Compare())
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    std::vector<Key> keys;
+    std::vector<std::size_t> values;
+    make_data(size, keys, values);
+    std::vector<Key> d = keys;
+
+    typedef typename std::vector<Key>::iterator key_iterator;
+    typedef std::vector<std::size_t>::iterator value_iterator;
+
+    std::pair<key_iterator, value_iterator> result =
+        hpx::parallel::sort_by_key(policy,
+            boost::begin(keys), boost::end(keys), boost::begin(values), comp);
+
+    HPX_TEST(result.first == boost::end(keys));
+    HPX_TEST(result.second == boost::end(values));
+    verify_sort_by_key(keys, values, d, comp);
+}
+
+template <typename ExPolicy, typename Key,
+    typename Compare = std::less<Key> >
+void test_sort_by_key_async(ExPolicy p, Key, std::size_t size,
+    Compare comp = Compare())
+{
+    std::vector<Key> keys;
+    std::vector<std::size_t> values;
+    make_data(size, keys, values);
+    std::vector<Key> d = keys;
+
+    typedef typename std::vector<Key>::iterator key_iterator;
+    typedef std::vector<std::size_t>::iterator value_iterator;
+
+    hpx::future<std::pair<key_iterator, value_iterator> > f =
+        hpx::parallel::sort_by_key(p,
+            boost::begin(keys), boost::end(keys), boost::begin(values), comp);
+
+    std::pair<key_iterator, value_iterator> result = f.get();
+
+    HPX_TEST(result.first == boost::end(keys));
+    HPX_TEST(result.second == boost::end(values));
+    verify_sort_by_key(keys, values, d, comp);
+}
+
+void sort_by_key_test()
+{
+    using namespace hpx::parallel;
+
+    // the larger size exercises the radix sort for arithmetic keys
+    std::size_t sizes[] = { 10007, 1000007 };
+    for (std::size_t size : sizes)
+    {
+        test_sort_by_key(seq, int(), size);
+        test_sort_by_key(par, int(), size);
+        test_sort_by_key(par_vec, int(), size);
+        test_sort_by_key(par, double(), size);
+        test_sort_by_key(par, boost::int64_t(), size);
+
+        // user supplied comparison operator, sorted as pairs
+        test_sort_by_key(seq, int(), size, std::greater<int>());
+        test_sort_by_key(par, int(), size, std::greater<int>());
+        test_sort_by_key(par_vec, int(), size, std::greater<int>());
+
+        test_sort_by_key_async(seq(task), int(), size);
+        test_sort_by_key_async(par(task), int(), size);
+        test_sort_by_key_async(par(task), float(), size);
+        test_sort_by_key_async(par(task), int(), size, std::greater<int>());
+
+        test_sort_by_key(execution_policy(seq), int(), size);
+        test_sort_by_key(execution_policy(par), int(), size);
+        test_sort_by_key(execution_policy(par_vec), int(), size);
+        test_sort_by_key(execution_policy(seq(task)), int(), size);
+        test_sort_by_key(execution_policy(par(task)), int(), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    sort_by_key_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
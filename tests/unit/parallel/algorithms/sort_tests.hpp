@@ -585,6 +585,74 @@ void test_sort2_async(ExPolicy && policy, T, Compare comp = Compare())
     HPX_TEST(is_sorted);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Fill a vector with random values of both signs (if supported by T)
+template <typename T>
+void rnd_fill_signed(std::vector<T> &V)
+{
+    T lower = std::numeric_limits<T>::is_integer ?
+        T((std::numeric_limits<T>::min)() / 2) : T(-1.0e9);
+    T upper = std::numeric_limits<T>::is_integer ?
+        T((std::numeric_limits<T>::max)() / 2) : T(1.0e9);
+    rnd_fill<T>(V, lower, upper, T(std::rand()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// negative and positive values, compared against std::sort as arithmetic
+// values are sorted using a radix sort
+template <typename ExPolicy, typename T>
+void test_sort3(ExPolicy && policy, T)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "default", sync, signed);
+
+    // Fill vector with random values of both signs
+    std::vector<T> c(5000000);
+    rnd_fill_signed(c);
+    std::vector<T> d = c;
+
+    boost::uint64_t t = hpx::util::high_resolution_clock::now();
+    // sort, blocking when seq, par, par_vec
+    hpx::parallel::sort(std::forward<ExPolicy>(policy),
+            c.begin(), c.end());
+    boost::uint64_t elapsed = hpx::util::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+
+    std::sort(d.begin(), d.end());
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort3_async(ExPolicy && policy, T)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "default", async, signed);
+
+    // Fill vector with random values of both signs
+    std::vector<T> c(5000000);
+    rnd_fill_signed(c);
+    std::vector<T> d = c;
+
+    boost::uint64_t t = hpx::util::high_resolution_clock::now();
+    // sort, non blocking
+    hpx::future<void> f = hpx::parallel::sort(std::forward<ExPolicy>(policy),
+            c.begin(), c.end());
+    f.get();
+    boost::uint64_t elapsed = hpx::util::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+
+    std::sort(d.begin(), d.end());
+    HPX_TEST(c == d);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // overload of test routine 1 for strings
 // call sort on a string array with no comparison operator
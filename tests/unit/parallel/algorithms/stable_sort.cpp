@@ -0,0 +1,211 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// the second member records the original position of each element, the
+// elements are compared using the first member only
+typedef std::pair<std::size_t, std::size_t> element_type;
+
+struct compare_first
+{
+    bool operator()(element_type const& lhs, element_type const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+std::vector<element_type> make_data(std::size_t size)
+{
+    std::vector<element_type> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = element_type(std::rand() % 1000, i);
+    return c;
+}
+
+void verify_stable_sort(std::vector<element_type> const& c,
+    std::vector<element_type> const& d)
+{
+    // the result has to be identical to the one of std::stable_sort
+    std::size_t count = 0;
+    HPX_TEST(std::equal(boost::begin(c), boost::end(c), boost::begin(d),
+        [&count](element_type const& v1, element_type const& v2) -> bool {
+            HPX_TEST(v1 == v2);
+            ++count;
+            return v1 == v2;
+        }));
+    HPX_TEST_EQ(count, d.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    hpx::parallel::stable_sort(policy, boost::begin(c), boost::end(c),
+        compare_first());
+    std::stable_sort(boost::begin(d), boost::end(d), compare_first());
+
+    verify_stable_sort(c, d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy p, std::size_t size)
+{
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    hpx::future<void> f = hpx::parallel::stable_sort(p,
+        boost::begin(c), boost::end(c), compare_first());
+    f.wait();
+
+    std::stable_sort(boost::begin(d), boost::end(d), compare_first());
+
+    verify_stable_sort(c, d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_projection(ExPolicy policy, std::size_t size)
+{
+    std::vector<element_type> c = make_data(size);
+    std::vector<element_type> d = c;
+
+    hpx::parallel::stable_sort(policy, boost::begin(c), boost::end(c),
+        std::less<std::size_t>(),
+        [](element_type const& e) { return e.first; });
+    std::stable_sort(boost::begin(d), boost::end(d), compare_first());
+
+    verify_stable_sort(c, d);
+}
+
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    // the larger size exercises the parallel merge steps
+    std::size_t sizes[] = { 10007, 1000007 };
+    for (std::size_t size : sizes)
+    {
+        test_stable_sort(seq, size);
+        test_stable_sort(par, size);
+        test_stable_sort(par_vec, size);
+
+        test_stable_sort_async(seq(task), size);
+        test_stable_sort_async(par(task), size);
+
+        test_stable_sort(execution_policy(seq), size);
+        test_stable_sort(execution_policy(par), size);
+        test_stable_sort(execution_policy(par_vec), size);
+        test_stable_sort(execution_policy(seq(task)), size);
+        test_stable_sort(execution_policy(par(task)), size);
+
+        test_stable_sort_projection(seq, size);
+        test_stable_sort_projection(par, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy policy, std::size_t size)
+{
+    static_assert(
+        hpx::parallel::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::decorated_iterator<
+            base_iterator, std::random_access_iterator_tag
+        > decorated_iterator;
+
+    std::vector<std::size_t> c(size);
+    std::iota(boost::begin(c), boost::end(c), std::rand());
+    std::reverse(boost::begin(c), boost::end(c));
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::stable_sort(policy,
+            decorated_iterator(
+                boost::begin(c), [](){ throw std::runtime_error("test"); }),
+            decorated_iterator(boost::end(c)));
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&) {
+        caught_exception = true;
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+void stable_sort_exception_test()
+{
+    using namespace hpx::parallel;
+
+    std::size_t sizes[] = { 10007, 1000007 };
+    for (std::size_t size : sizes)
+    {
+        test_stable_sort_exception(seq, size);
+        test_stable_sort_exception(par, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stable_sort_test();
+    stable_sort_exception_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
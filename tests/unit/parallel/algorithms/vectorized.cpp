@@ -0,0 +1,225 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test exercises the explicitly vectorized code paths used by some of
+// the algorithms when invoked with par_vec on contiguous sequences of
+// arithmetic values.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_algorithm.hpp>
+#include <hpx/include/parallel_numeric.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/parallel/util/detail/simd_dispatch.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/range/functions.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = T(std::rand() % 100);
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_for_each(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> d = c;
+
+    typename std::vector<T>::iterator result = hpx::parallel::for_each(
+        policy, boost::begin(c), boost::end(c), [](T& v) { v = v * 2 + 1; });
+    HPX_TEST(result == boost::end(c));
+
+    std::for_each(boost::begin(d), boost::end(d), [](T& v) { v = v * 2 + 1; });
+    HPX_TEST(c == d);
+
+    // raw pointers are handled as well
+    if (size != 0)
+    {
+        hpx::parallel::for_each(policy, c.data(), c.data() + size,
+            [](T& v) { v = v - 1; });
+        std::for_each(boost::begin(d), boost::end(d), [](T& v) { v = v - 1; });
+        HPX_TEST(c == d);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_transform(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> c2 = make_data<T>(size);
+    std::vector<T> dest(size);
+    std::vector<T> d(size);
+
+    hpx::parallel::transform(policy, boost::begin(c), boost::end(c),
+        boost::begin(dest), [](T v) { return v * 3; });
+    std::transform(boost::begin(c), boost::end(c), boost::begin(d),
+        [](T v) { return v * 3; });
+    HPX_TEST(dest == d);
+
+    hpx::parallel::transform(policy, boost::begin(c), boost::end(c),
+        boost::begin(c2), boost::begin(dest),
+        [](T v1, T v2) { return v1 + v2; });
+    std::transform(boost::begin(c), boost::end(c), boost::begin(c2),
+        boost::begin(d), [](T v1, T v2) { return v1 + v2; });
+    HPX_TEST(dest == d);
+}
+
+template <typename ExPolicy, typename T>
+void test_fill_copy(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c(size);
+    hpx::parallel::fill(policy, boost::begin(c), boost::end(c), T(42));
+    HPX_TEST_EQ(std::size_t(std::count(boost::begin(c), boost::end(c), T(42))),
+        size);
+
+    std::vector<T> src = make_data<T>(size);
+    hpx::parallel::copy(policy, boost::begin(src), boost::end(src),
+        boost::begin(c));
+    HPX_TEST(c == src);
+}
+
+template <typename ExPolicy, typename T>
+void test_reduce(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+
+    // all values are small integers, so the result is exact even if the
+    // elements are summed up in a different order
+    T sum = hpx::parallel::reduce(policy, boost::begin(c), boost::end(c),
+        T(1));
+    HPX_TEST_EQ(sum, std::accumulate(boost::begin(c), boost::end(c), T(1)));
+
+    double tr = hpx::parallel::transform_reduce(policy,
+        boost::begin(c), boost::end(c), [](T v) { return double(v) * 2; },
+        0.0, std::plus<double>());
+    HPX_TEST_EQ(tr, 2.0 * std::accumulate(boost::begin(c), boost::end(c), 0.0));
+
+    T max_value = hpx::parallel::reduce(policy, boost::begin(c),
+        boost::end(c), T(0), [](T v1, T v2) { return (std::max)(v1, v2); });
+    HPX_TEST_EQ(max_value, size != 0 ?
+        *std::max_element(boost::begin(c), boost::end(c)) : T(0));
+}
+
+template <typename ExPolicy, typename T>
+void test_count(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+
+    HPX_TEST_EQ(
+        hpx::parallel::count(policy, boost::begin(c), boost::end(c), T(42)),
+        std::count(boost::begin(c), boost::end(c), T(42)));
+
+    HPX_TEST_EQ(
+        hpx::parallel::count_if(policy, boost::begin(c), boost::end(c),
+            [](T v) { return v > T(50); }),
+        std::count_if(boost::begin(c), boost::end(c),
+            [](T v) { return v > T(50); }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_vectorized(ExPolicy policy)
+{
+    // use sizes which are not multiples of the pack sizes
+    std::size_t const sizes[] = { 0, 1, 7, 31, 33, 1023, 10007, 100003 };
+    for (std::size_t size : sizes)
+    {
+        test_for_each<ExPolicy, T>(policy, size);
+        test_transform<ExPolicy, T>(policy, size);
+        test_fill_copy<ExPolicy, T>(policy, size);
+        test_reduce<ExPolicy, T>(policy, size);
+        test_count<ExPolicy, T>(policy, size);
+    }
+}
+
+void vectorized_test()
+{
+    using namespace hpx::parallel;
+
+    test_vectorized<parallel_vector_execution_policy, int>(par_vec);
+    test_vectorized<parallel_vector_execution_policy, float>(par_vec);
+    test_vectorized<parallel_vector_execution_policy, double>(par_vec);
+    test_vectorized<parallel_vector_execution_policy, boost::uint64_t>(par_vec);
+
+    // the same code paths for non-vectorizing policies
+    test_vectorized<parallel_execution_policy, int>(par);
+    test_vectorized<parallel_execution_policy, double>(par);
+}
+
+// run the tests for each of the code variants supported by this CPU, this
+// makes sure that all of them are compiled and executed
+void vectorized_isa_test()
+{
+    using namespace hpx::parallel::util::detail;
+
+    simd_isa const isas[] =
+    {
+        simd_isa_generic, simd_isa_avx2, simd_isa_avx512
+    };
+    simd_isa const supported = detect_simd_isa();
+
+    for (simd_isa isa : isas)
+    {
+        if (isa > supported)
+            continue;
+
+        simd_isa const old_isa = set_simd_isa(isa);
+        HPX_TEST_EQ(get_simd_isa(), isa);
+
+        vectorized_test();
+
+        set_simd_isa(old_isa);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(0);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    vectorized_isa_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.os_threads=" +
+        boost::lexical_cast<std::string>(hpx::threads::hardware_concurrency()));
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <vector>
 
 #include <boost/range/iterator_range.hpp>
 #include <boost/range/functions.hpp>
@@ -93,6 +94,82 @@ void test_auto_chunk_size()
     }
 }
 
+void test_pinned_chunk_size()
+{
+    {
+        hpx::parallel::pinned_chunk_size pcs;
+        chunk_size_test(pcs);
+    }
+
+    {
+        hpx::parallel::pinned_chunk_size pcs(100);
+        chunk_size_test(pcs);
+    }
+
+    // the chunks are placed deterministically by executors attached to a
+    // fixed set of cores only
+    {
+        using namespace hpx::parallel;
+
+        typedef std::random_access_iterator_tag iterator_tag;
+        local_priority_queue_attached_executor exec(0,
+            hpx::get_os_thread_count());
+
+        pinned_chunk_size pcs;
+        test_for_each(par.on(exec).with(pcs), iterator_tag());
+        test_for_each_async(par(task).on(exec).with(pcs), iterator_tag());
+    }
+
+    // each piece runs on the same worker thread for repeated invocations
+    {
+        using namespace hpx::parallel;
+
+        local_priority_queue_attached_executor exec(0,
+            hpx::get_os_thread_count());
+
+        std::vector<std::size_t> first(10007);
+        std::vector<std::size_t> second(first.size());
+
+        pinned_chunk_size pcs(100);
+        hpx::parallel::for_each(par.on(exec).with(pcs), boost::begin(first),
+            boost::end(first),
+            [](std::size_t& v) { v = hpx::get_worker_thread_num(); });
+        hpx::parallel::for_each(par.on(exec).with(pcs), boost::begin(second),
+            boost::end(second),
+            [](std::size_t& v) { v = hpx::get_worker_thread_num(); });
+
+        HPX_TEST(first == second);
+    }
+}
+
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::parallel::adaptive_chunk_size acs;
+        chunk_size_test(acs);
+    }
+
+    {
+        hpx::parallel::adaptive_chunk_size acs(boost::chrono::milliseconds(1));
+        chunk_size_test(acs);
+    }
+
+    // all copies share the cost estimate, the measurements of previous
+    // invocations must not affect the results of later ones
+    {
+        using namespace hpx::parallel;
+
+        typedef std::random_access_iterator_tag iterator_tag;
+
+        adaptive_chunk_size acs;
+        for (int i = 0; i != 10; ++i)
+        {
+            test_for_each(par.with(acs), iterator_tag());
+            test_for_each_async(par(task).with(acs), iterator_tag());
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -107,6 +184,8 @@ int hpx_main(boost::program_options::variables_map& vm)
     test_static_chunk_size();
     test_guided_chunk_size();
     test_auto_chunk_size();
+    test_pinned_chunk_size();
+    test_adaptive_chunk_size();
 
     return hpx::finalize();
 }
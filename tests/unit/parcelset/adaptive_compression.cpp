@@ -0,0 +1,120 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/runtime/parcelset/adaptive_compression.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::adaptive_compression;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_threshold()
+{
+    adaptive_compression& compression = adaptive_compression::instance();
+
+    // compression is disabled by default
+    compression.configure("", 64, false, 0);
+    HPX_TEST(0 == compression.create_filter(1024 * 1024));
+
+    compression.configure("unknown_serialization_filter", 64, false, 0);
+    HPX_TEST(0 == compression.create_filter(63));
+
+    std::unique_ptr<hpx::serialization::binary_filter> filter(
+        compression.create_filter(64));
+    HPX_TEST(0 != filter.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Data is sent uncompressed if the codec is not available
+void test_fallback()
+{
+    adaptive_compression& compression = adaptive_compression::instance();
+    compression.configure("unknown_serialization_filter", 64, false, 0);
+
+    std::vector<double> values(1000);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = double(i);
+
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            compression.create_filter(8 * values.size()));
+        HPX_TEST(0 != filter.get());
+
+        hpx::serialization::output_archive oarchive(buffer,
+            hpx::serialization::enable_compression, ~0U, 0, filter.get());
+        oarchive << values;
+        size = oarchive.bytes_written();
+    }
+
+    std::vector<double> values_in;
+    {
+        hpx::serialization::input_archive iarchive(buffer, size);
+        iarchive >> values_in;
+    }
+    HPX_TEST(values == values_in);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_adaptive()
+{
+    adaptive_compression& compression = adaptive_compression::instance();
+
+    // a very fast link: compressing does not pay off
+    compression.configure("unknown_serialization_filter", 64, true,
+        1000000000000ull);
+    compression.add_compression(1000, 900, 100000);
+
+    compression.get_statistics(adaptive_compression::num_skipped, true);
+
+    // every so often a message is compressed anyways
+    std::size_t created = 0;
+    for (std::size_t i = 0; i != 64; ++i)
+    {
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            compression.create_filter(1024));
+        if (filter.get() != 0)
+            ++created;
+    }
+    HPX_TEST_EQ(created, std::size_t(2));
+    HPX_TEST_EQ(compression.get_statistics(
+        adaptive_compression::num_skipped, true), 62);
+
+    // a very slow link: compressing pays off
+    compression.configure("unknown_serialization_filter", 64, true, 1);
+    for (std::size_t i = 0; i != 64; ++i)
+    {
+        std::unique_ptr<hpx::serialization::binary_filter> filter(
+            compression.create_filter(1024));
+        HPX_TEST(0 != filter.get());
+    }
+    HPX_TEST_EQ(compression.get_statistics(
+        adaptive_compression::num_skipped, true), 0);
+
+    // the compression ratio is reported in percent
+    compression.get_statistics(adaptive_compression::compression_ratio, true);
+    compression.add_compression(1000, 250, 1000);
+    HPX_TEST_EQ(compression.get_statistics(
+        adaptive_compression::compression_ratio, true), 25);
+}
+
+int main()
+{
+    test_threshold();
+    test_fallback();
+    test_adaptive();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,150 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// number of bulk parcels received by this locality
+boost::atomic<std::size_t> bulk_received(0);
+
+std::size_t bulk(std::vector<char> const& data)
+{
+    ++bulk_received;
+    return data.size();
+}
+HPX_PLAIN_ACTION(bulk);     // defines bulk_action
+
+std::size_t get_bulk_received()
+{
+    return bulk_received.load();
+}
+HPX_PLAIN_ACTION(get_bulk_received);
+HPX_ACTION_HAS_CRITICAL_PRIORITY(get_bulk_received_action);
+
+int control(int i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(control);  // defines control_action
+HPX_ACTION_HAS_CRITICAL_PRIORITY(control_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_parcel_priority()
+{
+    hpx::naming::address addr;
+
+    hpx::parcelset::parcel p1(hpx::find_here(), addr, bulk_action(),
+        std::vector<char>());
+    HPX_TEST(!p1.is_high_priority());
+
+    // parcels can be explicitly marked as high priority
+    p1.set_high_priority();
+    HPX_TEST(p1.is_high_priority());
+
+    hpx::parcelset::parcel p2(std::move(p1));
+    HPX_TEST(p2.is_high_priority());
+
+    p2.set_high_priority(false);
+    HPX_TEST(!p2.is_high_priority());
+
+    // parcels for critical actions are high priority
+    hpx::parcelset::parcel p3(hpx::find_here(), addr, control_action(), 0);
+    HPX_TEST(p3.is_high_priority());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Small high priority parcels are sent while large transfers to the same
+// locality are pending.
+void test_mixed_traffic()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::vector<hpx::future<std::size_t> > bulk_results;
+    std::vector<hpx::future<int> > control_results;
+    for (hpx::id_type const& id : localities)
+    {
+        for (int i = 0; i != 4; ++i)
+        {
+            bulk_results.push_back(hpx::async<bulk_action>(
+                id, std::vector<char>(4 * 1024 * 1024)));
+        }
+        for (int i = 0; i != 16; ++i)
+        {
+            control_results.push_back(hpx::async<control_action>(id, i));
+        }
+    }
+
+    for (std::size_t i = 0; i != control_results.size(); ++i)
+    {
+        HPX_TEST_EQ(control_results[i].get(), int(i % 16) + 1);
+    }
+    for (hpx::future<std::size_t>& f : bulk_results)
+    {
+        HPX_TEST_EQ(f.get(), std::size_t(4 * 1024 * 1024));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A high priority parcel overtakes the normal priority parcels which were
+// queued for the same locality before it.
+void test_overtaking()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+        return;
+
+    hpx::id_type const& id = localities[0];
+    std::size_t const num_bulk = 64;
+
+    std::size_t received_before =
+        hpx::async<get_bulk_received_action>(id).get();
+
+    // fill the normal priority lane first
+    std::vector<hpx::future<std::size_t> > bulk_results;
+    bulk_results.reserve(num_bulk);
+    for (std::size_t i = 0; i != num_bulk; ++i)
+    {
+        bulk_results.push_back(hpx::async<bulk_action>(
+            id, std::vector<char>(1024 * 1024)));
+    }
+
+    // the answer has to arrive before all of the bulk parcels were received
+    std::size_t received =
+        hpx::async<get_bulk_received_action>(id).get() - received_before;
+    HPX_TEST_LT(received, num_bulk);
+
+    hpx::wait_all(bulk_results);
+    HPX_TEST_EQ(hpx::async<get_bulk_received_action>(id).get() -
+        received_before, num_bulk);
+}
+
+int hpx_main()
+{
+    test_parcel_priority();
+    test_mixed_traffic();
+    test_overtaking();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // give the high priority lane its own connections
+    std::vector<std::string> cfg;
+    cfg.push_back("hpx.parcel.priority_connections=1");
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
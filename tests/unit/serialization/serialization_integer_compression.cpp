@@ -0,0 +1,160 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <limits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t test_roundtrip(std::vector<T> const& values, boost::uint32_t flags)
+{
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        for (T const& t : values)
+            oarchive << t;
+        size = oarchive.bytes_written();
+    }
+
+    hpx::serialization::input_archive iarchive(buffer, size);
+    for (T const& t : values)
+    {
+        T tt;
+        iarchive >> tt;
+        HPX_TEST(t == tt);
+    }
+    HPX_TEST_EQ(iarchive.bytes_read(), size);
+
+    return size;
+}
+
+template <typename T>
+void test_integral()
+{
+    std::vector<T> values;
+    values.push_back(T(0));
+    values.push_back(T(1));
+    values.push_back(T(127));
+    values.push_back((std::numeric_limits<T>::max)());
+    values.push_back((std::numeric_limits<T>::min)());
+    if (std::numeric_limits<T>::is_signed)
+    {
+        values.push_back(T(-1));
+        values.push_back(T(-64));
+        values.push_back(T(-65));
+    }
+
+    std::size_t raw = test_roundtrip(values, 0U);
+    std::size_t compressed = test_roundtrip(values,
+        hpx::serialization::enable_integer_compression);
+
+    HPX_TEST_LT(compressed, raw);
+}
+
+void test_small_integers()
+{
+    // small integers need a single byte each
+    std::vector<boost::int64_t> small;
+    for (boost::int64_t i = -64; i != 64; ++i)
+        small.push_back(i);
+
+    std::size_t empty = test_roundtrip(std::vector<boost::int64_t>(),
+        hpx::serialization::enable_integer_compression);
+    std::size_t size = test_roundtrip(small,
+        hpx::serialization::enable_integer_compression);
+
+    HPX_TEST_EQ(size - empty, small.size());
+}
+
+void test_container_size()
+{
+    std::vector<std::vector<int> > values;
+    values.push_back(std::vector<int>());
+    values.push_back(std::vector<int>(10, 42));
+    values.push_back(std::vector<int>(1000, -42));
+
+    std::size_t raw = test_roundtrip(values, 0U);
+    std::size_t compressed = test_roundtrip(values,
+        hpx::serialization::enable_integer_compression);
+
+    HPX_TEST_LT(compressed, raw);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_gid(hpx::naming::gid_type const& gid,
+    boost::uint32_t dest_locality_id, boost::uint32_t flags)
+{
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, flags, dest_locality_id);
+        oarchive << gid;
+        size = oarchive.bytes_written();
+    }
+
+    hpx::serialization::input_archive iarchive(buffer, size);
+
+    hpx::naming::gid_type gid_in;
+    iarchive >> gid_in;
+    HPX_TEST_EQ(gid, gid_in);
+
+    return size;
+}
+
+void test_gids()
+{
+    boost::uint32_t const flags =
+        hpx::serialization::enable_integer_compression;
+
+    hpx::naming::gid_type local(
+        hpx::naming::get_gid_from_locality_id(3).get_msb() | 0x1, 42);
+    hpx::naming::gid_type remote(
+        hpx::naming::get_gid_from_locality_id(4).get_msb() | 0x1, 42);
+    hpx::naming::gid_type agas_ns(HPX_AGAS_NS_MSB, 0);
+
+    // gids referring to the destination locality have the shortest encoding
+    std::size_t local_size = test_gid(local, 3, flags);
+    std::size_t remote_size = test_gid(remote, 3, flags);
+    HPX_TEST_LT(local_size, remote_size);
+    HPX_TEST_LT(local_size, test_gid(local, 3, 0U));
+
+    // special gids without a locality prefix have to survive the round trip
+    test_gid(agas_ns, 3, flags);
+    test_gid(hpx::naming::invalid_gid, 3, flags);
+    test_gid(local, hpx::naming::invalid_locality_id, flags);
+}
+
+int main()
+{
+    test_integral<signed char>();
+    test_integral<unsigned char>();
+    test_integral<short>();
+    test_integral<unsigned short>();
+    test_integral<int>();
+    test_integral<unsigned int>();
+    test_integral<long>();
+    test_integral<unsigned long>();
+    test_integral<boost::int64_t>();
+    test_integral<boost::uint64_t>();
+
+    test_small_integers();
+    test_container_size();
+    test_gids();
+
+    return hpx::util::report_errors();
+}
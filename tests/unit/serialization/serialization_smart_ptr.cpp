@@ -7,6 +7,7 @@
 #include <hpx/runtime/serialization/shared_ptr.hpp>
 #include <hpx/runtime/serialization/unique_ptr.hpp>
 #include <hpx/runtime/serialization/intrusive_ptr.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
 
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
@@ -35,6 +36,32 @@ void test_shared()
     HPX_TEST_EQ(*op2, *ip);
 }
 
+void test_shared_many()
+{
+    // enough pointers to make the pointer tracking tables grow a few times
+    std::vector<boost::shared_ptr<int> > ip;
+    for (int i = 0; i != 1000; ++i)
+        ip.push_back(boost::shared_ptr<int>(new int(i)));
+
+    std::vector<boost::shared_ptr<int> > op(2 * ip.size());
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive oarchive(buffer);
+        for (std::size_t i = 0; i != ip.size(); ++i)
+            oarchive << ip[i] << ip[ip.size() - i - 1];
+
+        hpx::serialization::input_archive iarchive(buffer);
+        for (std::size_t i = 0; i != op.size(); ++i)
+            iarchive >> op[i];
+    }
+
+    for (std::size_t i = 0; i != ip.size(); ++i)
+    {
+        HPX_TEST_EQ(*op[2 * i], *ip[i]);
+        HPX_TEST_EQ(op[2 * i].get(), op[2 * (ip.size() - i - 1) + 1].get());
+    }
+}
+
 void test_unique()
 {
     std::unique_ptr<int> ip(new int(7));
@@ -112,6 +139,7 @@ void test_intrusive()
 int main()
 {
     test_shared();
+    test_shared_many();
     test_unique();
     test_intrusive();
 
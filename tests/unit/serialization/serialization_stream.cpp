@@ -0,0 +1,205 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/runtime/serialization/segmented_stream.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// keeps the segments in memory
+struct segment_queue
+  : hpx::serialization::segment_sink, hpx::serialization::segment_source
+{
+    segment_queue() : max_segment_size_(0) {}
+
+    void write_segment(std::vector<char>& segment)
+    {
+        if (segment.size() > max_segment_size_)
+            max_segment_size_ = segment.size();
+
+        segments_.push_back(std::vector<char>());
+        segments_.back().swap(segment);
+    }
+
+    bool read_segment(std::vector<char>& segment)
+    {
+        if (segments_.empty())
+            return false;
+
+        segment.swap(segments_.front());
+        segments_.pop_front();
+        return true;
+    }
+
+    std::deque<std::vector<char> > segments_;
+    std::size_t max_segment_size_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// stores the data uncompressed but inverts all bits, each segment is
+// filtered separately
+struct inverting_filter : hpx::serialization::binary_filter
+{
+    inverting_filter() : current_(0) {}
+
+    void set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    void save(void const* src, std::size_t src_count)
+    {
+        char const* begin = static_cast<char const*>(src);
+        for (std::size_t i = 0; i != src_count; ++i)
+            buffer_.push_back(static_cast<char>(~begin[i]));
+    }
+
+    bool flush(void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (dst_count < buffer_.size())
+        {
+            written = 0;
+            return false;
+        }
+
+        std::memcpy(dst, buffer_.data(), buffer_.size());
+        written = buffer_.size();
+        return true;
+    }
+
+    std::size_t init_data(char const* buffer, std::size_t size,
+        std::size_t buffer_size)
+    {
+        buffer_.clear();
+        for (std::size_t i = 0; i != size; ++i)
+            buffer_.push_back(static_cast<char>(~buffer[i]));
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    void load(void* dst, std::size_t dst_count)
+    {
+        HPX_TEST(current_ + dst_count <= buffer_.size());
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    bool reset()
+    {
+        buffer_.clear();
+        current_ = 0;
+        return true;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {}
+
+    HPX_SERIALIZATION_POLYMORPHIC(inverting_filter);
+
+    std::vector<char> buffer_;
+    std::size_t current_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stream(std::size_t segment_size, bool use_filter)
+{
+    std::vector<double> doubles(10000);
+    for (std::size_t i = 0; i != doubles.size(); ++i)
+        doubles[i] = double(i) / 3.;
+
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i != 1000; ++i)
+        strings.push_back(std::string(i % 100, char('a' + i % 26)));
+
+    int const marker = 42;
+
+    segment_queue queue;
+    inverting_filter filter;
+    {
+        hpx::serialization::output_stream stream(queue, segment_size);
+        hpx::serialization::output_archive oarchive(stream,
+            use_filter ? hpx::serialization::enable_compression : 0U,
+            ~0U, 0, use_filter ? &filter : 0);
+
+        oarchive << doubles << strings << marker;
+        oarchive.flush();
+    }
+
+    // no segment holds more than the requested amount of data
+    HPX_TEST(queue.segments_.size() > 1);
+    HPX_TEST(queue.max_segment_size_ <=
+        segment_size + hpx::serialization::segment_header_size);
+
+    std::vector<double> doubles_in;
+    std::vector<std::string> strings_in;
+    int marker_in = 0;
+    {
+        hpx::serialization::input_stream stream(queue);
+        hpx::serialization::input_archive iarchive(stream);
+
+        iarchive >> doubles_in >> strings_in >> marker_in;
+    }
+
+    HPX_TEST(doubles == doubles_in);
+    HPX_TEST(strings == strings_in);
+    HPX_TEST_EQ(marker, marker_in);
+
+    // all segments were consumed
+    HPX_TEST(queue.segments_.empty());
+}
+
+void test_truncated_stream()
+{
+    segment_queue queue;
+    {
+        hpx::serialization::output_stream stream(queue, 256);
+        hpx::serialization::output_archive oarchive(stream);
+
+        oarchive << std::vector<double>(1000, 1.0);
+        oarchive.flush();
+    }
+
+    // drop the last segment
+    queue.segments_.pop_back();
+
+    bool caught_exception = false;
+    try {
+        hpx::serialization::input_stream stream(queue);
+        hpx::serialization::input_archive iarchive(stream);
+
+        std::vector<double> v;
+        iarchive >> v;
+    }
+    catch (hpx::exception const& e) {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    std::size_t const segment_sizes[] = { 1, 100, 4096 };
+    for (std::size_t segment_size : segment_sizes)
+    {
+        test_stream(segment_size, false);
+        test_stream(segment_size, true);
+    }
+
+    test_truncated_stream();
+
+    return hpx::util::report_errors();
+}
@@ -15,6 +15,12 @@
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <algorithm>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 struct data_buffer
@@ -323,6 +329,218 @@ void test_zero_copy_serialization(double d, T1& arg1, std::string const& s,
     test_parcel_serialization(std::move(outp), out_archive_flags, true);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Serialize the given buffer and de-serialize it into inb as if the zero-copy
+// chunks had been received into a separate buffer.
+template <typename Buffer>
+void receive_chunks(Buffer const& outb, Buffer& inb)
+{
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::vector<char> out_buffer;
+    {
+        hpx::serialization::output_archive archive(out_buffer, 0U, ~0U, &chunks);
+        archive << outb;
+    }
+
+    // simulate received zero-copy chunks owned by the parcel buffer
+    boost::shared_ptr<std::vector<double> > received =
+        boost::make_shared<std::vector<double> >(
+            outb.data(), outb.data() + outb.size());
+    for (hpx::serialization::serialization_chunk& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer)
+            c.data_.pos_ = received->data();
+    }
+
+    hpx::serialization::input_archive archive(
+        out_buffer, out_buffer.size(), &chunks, received);
+    archive >> inb;
+}
+
+void test_chunk_adoption(std::size_t size)
+{
+    typedef hpx::serialization::serialize_buffer<double> buffer_type;
+
+    std::vector<double> data(size, 42.0);
+    buffer_type outb(data.data(), data.size(), buffer_type::reference);
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::vector<char> out_buffer;
+    {
+        hpx::serialization::output_archive archive(out_buffer, 0U, ~0U, &chunks);
+        archive << outb;
+    }
+
+    // without an owner for the chunks the data is copied
+    {
+        hpx::serialization::input_archive archive(
+            out_buffer, out_buffer.size(), &chunks);
+
+        buffer_type inb;
+        archive >> inb;
+
+        HPX_TEST_EQ(inb.size(), data.size());
+        HPX_TEST(inb.data() != data.data());
+        HPX_TEST(std::equal(data.begin(), data.end(), inb.data()));
+    }
+
+    // simulate received zero-copy chunks owned by the parcel buffer
+    boost::shared_ptr<std::vector<double> > received =
+        boost::make_shared<std::vector<double> >(data);
+    for (hpx::serialization::serialization_chunk& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer)
+            c.data_.pos_ = received->data();
+    }
+
+    buffer_type inb;
+    {
+        hpx::serialization::input_archive archive(
+            out_buffer, out_buffer.size(), &chunks, received);
+        archive >> inb;
+    }
+
+    // only large chunks are taken over, small ones are copied
+    bool is_adopted =
+        size * sizeof(double) >= HPX_ZERO_COPY_ADOPTION_THRESHOLD;
+    HPX_TEST_EQ(inb.size(), data.size());
+    HPX_TEST_EQ(inb.data() == received->data(), is_adopted);
+
+    // the buffer keeps the received chunk alive
+    received.reset();
+    HPX_TEST(std::equal(data.begin(), data.end(), inb.data()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// An allocator handing out a pre-posted destination buffer, similar to the
+// one used by the network_storage benchmark.
+template <typename T>
+struct posted_allocator
+{
+    typedef T value_type;
+    typedef T* pointer;
+    typedef T const* const_pointer;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    posted_allocator() : pointer_(0), size_(0) {}
+    posted_allocator(T* p, std::size_t size) : pointer_(p), size_(size) {}
+
+    T* allocate(std::size_t n, void const* = 0)
+    {
+        HPX_TEST_EQ(n, size_);
+        return pointer_;
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        HPX_TEST(p == pointer_ && n == size_);
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        std::size_t address = reinterpret_cast<std::size_t>(pointer_);
+        ar & size_ & address;
+        pointer_ = reinterpret_cast<T*>(address);
+    }
+
+    T* pointer_;
+    std::size_t size_;
+};
+
+// An allocator which does not customize the placement of received chunks.
+template <typename T>
+struct counting_allocator : std::allocator<T>
+{
+    template <typename U>
+    struct rebind { typedef counting_allocator<U> other; };
+
+    T* allocate(std::size_t n, void const* = 0)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned) {}
+
+    static std::size_t allocations;
+};
+
+template <typename T>
+std::size_t counting_allocator<T>::allocations = 0;
+
+static std::size_t placed_chunks = 0;
+
+namespace hpx { namespace traits
+{
+    // place received chunks directly into the pre-posted destination
+    template <typename T>
+    struct adopt_received_chunk<posted_allocator<T> >
+    {
+        static boost::shared_array<T>
+        call(posted_allocator<T>& alloc, T* data, std::size_t size,
+            boost::shared_ptr<void> const&)
+        {
+            ++placed_chunks;
+            std::copy(data, data + size, alloc.pointer_);
+            return boost::shared_array<T>(alloc.pointer_, &no_deleter);
+        }
+
+        static void no_deleter(T*) {}
+    };
+}}
+
+void test_chunk_placement(std::size_t size)
+{
+    bool is_adopted =
+        size * sizeof(double) >= HPX_ZERO_COPY_ADOPTION_THRESHOLD;
+
+    std::vector<double> data(size, 42.0);
+
+    // the allocator places the data into the pre-posted destination
+    {
+        typedef posted_allocator<double> allocator_type;
+        typedef hpx::serialization::serialize_buffer<double, allocator_type>
+            buffer_type;
+
+        std::vector<double> posted(size, 0.0);
+        buffer_type outb(data.data(), data.size(), buffer_type::reference,
+            allocator_type(posted.data(), posted.size()));
+
+        std::size_t placed = placed_chunks;
+
+        buffer_type inb;
+        receive_chunks(outb, inb);
+
+        HPX_TEST_EQ(inb.size(), data.size());
+        HPX_TEST(inb.data() == posted.data());
+        HPX_TEST(std::equal(data.begin(), data.end(), posted.begin()));
+        HPX_TEST_EQ(placed_chunks - placed, std::size_t(is_adopted ? 1 : 0));
+    }
+
+    // without customization the data is copied into allocated memory
+    {
+        typedef counting_allocator<double> allocator_type;
+        typedef hpx::serialization::serialize_buffer<double, allocator_type>
+            buffer_type;
+
+        buffer_type outb(data.data(), data.size(), buffer_type::reference);
+
+        std::size_t allocations = allocator_type::allocations;
+
+        buffer_type inb;
+        receive_chunks(outb, inb);
+
+        HPX_TEST_EQ(inb.size(), data.size());
+        HPX_TEST(std::equal(data.begin(), data.end(), inb.data()));
+        HPX_TEST_EQ(allocator_type::allocations - allocations, std::size_t(1));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -352,6 +570,9 @@ int hpx_main(boost::program_options::variables_map& vm)
         data_buffer<double> buffer3(size << i);
         test_normal_serialization<test_action4>(buffer3);
         test_zero_copy_serialization<test_action4>(buffer3);
+
+        test_chunk_adoption(size << i);
+        test_chunk_placement(size << i);
     }
 
     return hpx::finalize();
@@ -0,0 +1,93 @@
+//  Copyright (c) 2015 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_fwd.hpp>
+#include <hpx/util/size_class_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstring>
+#include <vector>
+
+typedef std::vector<char, hpx::util::size_class_allocator<char> > buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse(std::size_t size)
+{
+    hpx::util::size_class_pool& pool = hpx::util::size_class_pool::instance();
+
+    // the first allocation might have to go to the system
+    void* p = pool.allocate(size);
+    HPX_TEST(p != 0);
+    std::memset(p, 0xff, size);
+    pool.deallocate(p, size);
+
+    // subsequent allocations of the same size class are served by the pool
+    pool.get_statistics(hpx::util::size_class_pool::num_allocations, true);
+    pool.get_statistics(hpx::util::size_class_pool::num_allocations_avoided, true);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        void* q = pool.allocate(size);
+        HPX_TEST_EQ(p, q);
+        pool.deallocate(q, size);
+    }
+
+    HPX_TEST_EQ(pool.get_statistics(
+        hpx::util::size_class_pool::num_allocations, true), 10);
+    HPX_TEST_EQ(pool.get_statistics(
+        hpx::util::size_class_pool::num_allocations_avoided, true), 10);
+}
+
+void test_allocator()
+{
+    hpx::util::size_class_pool& pool = hpx::util::size_class_pool::instance();
+
+    for (std::size_t size = 1; size <= 16 * 1024 * 1024; size *= 3)
+    {
+        buffer_type buffer(size, '\x42');
+        HPX_TEST_EQ(buffer.size(), size);
+        HPX_TEST_EQ(buffer[size - 1], '\x42');
+
+        buffer_type copy(buffer);
+        HPX_TEST(copy == buffer);
+    }
+
+    HPX_TEST(pool.get_statistics(
+        hpx::util::size_class_pool::num_bytes_resident, false) > 0);
+}
+
+void test_oversized()
+{
+    // blocks larger than the largest size class are not cached
+    hpx::util::size_class_pool& pool = hpx::util::size_class_pool::instance();
+
+    std::size_t size = 128 * 1024 * 1024;
+    boost::int64_t resident = pool.get_statistics(
+        hpx::util::size_class_pool::num_bytes_resident, false);
+
+    void* p = pool.allocate(size);
+    HPX_TEST_EQ(pool.get_statistics(
+        hpx::util::size_class_pool::num_bytes_resident, false),
+        resident + boost::int64_t(size));
+
+    pool.deallocate(p, size);
+    HPX_TEST_EQ(pool.get_statistics(
+        hpx::util::size_class_pool::num_bytes_resident, false), resident);
+}
+
+int main()
+{
+    test_reuse(1);
+    test_reuse(1000);
+    test_reuse(100000);
+    test_reuse(10000000);
+
+    test_allocator();
+    test_oversized();
+
+    return hpx::util::report_errors();
+}
@@ -15,7 +15,7 @@
 
 #include <hpx/util/hardware/cpuid.hpp>
 
-using hpx::util::hardware::cpuid;
+using hpx::util::hardware::cpuidex;
 using hpx::util::hardware::cpu_info;
 using hpx::util::hardware::cpuid_table;
 using hpx::util::hardware::cpuid_table_type;
@@ -115,7 +115,7 @@ int main(int argc, char* argv[])
         {
             if (features.count(cpuid_table[i].name))
             {
-                cpuid(registers, cpuid_table[i].function);
+                cpuidex(registers, cpuid_table[i].function, 0);
                 bool found =  has_bit_set(registers[cpuid_table[i].register_],
                                           cpuid_table[i].bit);
                 if (!vm.count("quiet"))